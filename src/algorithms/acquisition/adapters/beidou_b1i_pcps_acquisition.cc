@@ -48,7 +48,7 @@ BeidouB1iPcpsAcquisition::BeidouB1iPcpsAcquisition(
                                 out_streams_(out_streams)
 {
     acq_parameters_.ms_per_code = 1;
-    acq_parameters_.SetFromConfiguration(configuration, role, BEIDOU_B1I_CODE_RATE_CPS, 10e6);
+    acq_parameters_.SetFromConfiguration(configuration, role, BEIDOU_B1I_CODE_RATE_CPS, BEIDOU_B1I_OPT_ACQ_FS_SPS);
 
     LOG(INFO) << "role " << role;
 
@@ -46,7 +46,7 @@ BeidouB3iPcpsAcquisition::BeidouB3iPcpsAcquisition(
                                 out_streams_(out_streams)
 {
     acq_parameters_.ms_per_code = 1;
-    acq_parameters_.SetFromConfiguration(configuration, role, BEIDOU_B3I_CODE_RATE_CPS, 100e6);
+    acq_parameters_.SetFromConfiguration(configuration, role, BEIDOU_B3I_CODE_RATE_CPS, BEIDOU_B3I_OPT_ACQ_FS_SPS);
 
     LOG(INFO) << "role " << role;
 
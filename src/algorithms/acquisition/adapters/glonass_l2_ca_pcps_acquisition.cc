@@ -45,7 +45,7 @@ GlonassL2CaPcpsAcquisition::GlonassL2CaPcpsAcquisition(
                                 out_streams_(out_streams)
 {
     acq_parameters_.ms_per_code = 1;
-    acq_parameters_.SetFromConfiguration(configuration, role, GLONASS_L2_CA_CODE_RATE_CPS, 100e6);
+    acq_parameters_.SetFromConfiguration(configuration, role, GLONASS_L2_CA_CODE_RATE_CPS, GLONASS_L2_CA_OPT_ACQ_FS_SPS);
 
     DLOG(INFO) << "role " << role;
 
@@ -29,6 +29,7 @@
 #include "gnss_sdr_create_directory.h"
 #include "gnss_sdr_make_unique.h"
 #include "gnss_synchro.h"
+#include "replay_clock.h"
 #if HAS_STD_FILESYSTEM
 #if HAS_STD_FILESYSTEM_EXPERIMENTAL
 #include <experimental/filesystem>
@@ -186,6 +187,30 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_) : gr::block("pcps_acqu
                     d_dump = false;
                 }
         }
+
+    d_replay_clock_id = Replay_Clock::get().register_consumer(this, static_cast<double>(d_acq_parameters.resampled_fs));
+    if (d_replay_clock_id >= 0 and !d_acq_parameters.blocking)
+        {
+            // a background acquisition would deliver its result at an arbitrary sample
+            LOG(INFO) << "Deterministic replay: the acquisition is run in blocking mode";
+            d_acq_parameters.blocking = true;
+        }
+    if (d_replay_clock_id >= 0 and d_acq_parameters.blocking_on_standby)
+        {
+            // an idle acquisition that does not consume samples would never reach
+            // the end of the epoch, and the clock would wait for it forever
+            LOG(INFO) << "Deterministic replay: the acquisition consumes samples on standby";
+            d_acq_parameters.blocking_on_standby = false;
+        }
+}
+
+
+pcps_acquisition::~pcps_acquisition()
+{
+    if (d_replay_clock_id >= 0)
+        {
+            Replay_Clock::get().unregister_consumer(d_replay_clock_id);
+        }
 }
 
 
@@ -376,13 +401,15 @@ void pcps_acquisition::send_positive_acquisition()
                << ", Assist doppler_center " << d_doppler_center;
     d_positive_acq = 1;
 
-    if (!d_channel_fsm.expired())
+    if (!d_channel_fsm.expired() and d_replay_clock_id < 0)
         {
             // the channel FSM is set, so, notify it directly the positive acquisition to minimize delays
             d_channel_fsm.lock()->Event_valid_acquisition();
         }
     else
         {
+            // in deterministic replays, the channel defers it to the end of the epoch
+            Replay_Clock::get().event_posted();
             this->message_port_pub(pmt::mp("events"), pmt::from_long(1));
         }
 }
@@ -402,6 +429,7 @@ void pcps_acquisition::send_negative_acquisition()
                << ", magnitude " << d_mag
                << ", input signal power " << d_input_power;
     d_positive_acq = 0;
+    Replay_Clock::get().event_posted();
     this->message_port_pub(pmt::mp("events"), pmt::from_long(2));
 }
 
@@ -915,13 +943,20 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
      * 5. Compute the test statistics and compare to the threshold
      * 6. Declare positive or negative acquisition using a message port
      */
+    int ninput = ninput_items[0];
+    if (d_replay_clock_id >= 0)
+        {
+            // deterministic replay: do not go beyond the end of the current epoch
+            // (before locking, since the events are applied while waiting)
+            ninput = static_cast<int>(std::min(static_cast<uint64_t>(ninput), Replay_Clock::get().wait(d_replay_clock_id, d_sample_counter)));
+        }
     gr::thread::scoped_lock lk(d_setlock);
     if (!d_active or d_worker_active)
         {
             if (!d_acq_parameters.blocking_on_standby)
                 {
-                    d_sample_counter += static_cast<uint64_t>(ninput_items[0]);
-                    consume_each(ninput_items[0]);
+                    d_sample_counter += static_cast<uint64_t>(ninput);
+                    consume_each(ninput);
                 }
             if (d_step_two)
                 {
@@ -947,8 +982,8 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
                 d_buffer_count = 0U;
                 if (!d_acq_parameters.blocking_on_standby)
                     {
-                        d_sample_counter += static_cast<uint64_t>(ninput_items[0]);  // sample counter
-                        consume_each(ninput_items[0]);
+                        d_sample_counter += static_cast<uint64_t>(ninput);  // sample counter
+                        consume_each(ninput);
                     }
                 break;
             }
@@ -958,9 +993,9 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
                 if (d_cshort)
                     {
                         const auto* in = reinterpret_cast<const lv_16sc_t*>(input_items[0]);  // Get the input samples pointer
-                        if ((ninput_items[0] + d_buffer_count) <= d_consumed_samples)
+                        if ((ninput + d_buffer_count) <= d_consumed_samples)
                             {
-                                buff_increment = ninput_items[0];
+                                buff_increment = ninput;
                             }
                         else
                             {
@@ -971,9 +1006,9 @@ int pcps_acquisition::general_work(int noutput_items __attribute__((unused)),
                 else
                     {
                         const auto* in = reinterpret_cast<const gr_complex*>(input_items[0]);  // Get the input samples pointer
-                        if ((ninput_items[0] + d_buffer_count) <= d_consumed_samples)
+                        if ((ninput + d_buffer_count) <= d_consumed_samples)
                             {
-                                buff_increment = ninput_items[0];
+                                buff_increment = ninput;
                             }
                         else
                             {
@@ -95,7 +95,7 @@ pcps_acquisition_sptr pcps_make_acquisition(const Acq_Conf& conf_);
 class pcps_acquisition : public gr::block
 {
 public:
-    ~pcps_acquisition() = default;
+    ~pcps_acquisition();
 
     /*!
      * \brief Initializes acquisition algorithm and reserves memory.
@@ -136,6 +136,15 @@ public:
         return d_mag;
     }
 
+    /*!
+     * \brief Returns the sampling rate of the input samples, which is the
+     * rate after the acquisition resampler, if any.
+     */
+    inline int64_t resampled_fs() const
+    {
+        return d_acq_parameters.resampled_fs;
+    }
+
     /*!
      * \brief Starts acquisition algorithm, turning from standby mode to
      * active mode
@@ -257,6 +266,8 @@ private:
     int64_t d_dump_number;
     uint64_t d_sample_counter;
 
+    int d_replay_clock_id;  // -1 if the replay is not deterministic
+
     float d_threshold;
     float d_mag;
     float d_input_power;
@@ -24,6 +24,21 @@
 #include <gnuradio/gr_complex.h>
 #include <cmath>
 
+uint32_t acq_resampler_decimation(int64_t fs_in, double target_fs)
+{
+    if (fs_in <= 0 or target_fs <= 0.0 or static_cast<double>(fs_in) <= target_fs)
+        {
+            return 1U;
+        }
+    auto decimation = static_cast<uint32_t>(std::floor(static_cast<double>(fs_in) / target_fs));
+    while (fs_in % decimation > 0)
+        {
+            decimation--;
+        }
+    return decimation;
+}
+
+
 Acq_Conf::Acq_Conf()
 {
     /* PCPS acquisition configuration */
@@ -94,7 +109,8 @@ void Acq_Conf::SetFromConfiguration(const ConfigurationInterface *configuration,
 
     if (use_automatic_resampler)
         {
-            ConfigureAutomaticResampler(opt_freq);
+            // same target rate as the resampler shared by the channels of the band in the flowgraph
+            ConfigureAutomaticResampler(configuration->property(role + ".resampler_fs_sps", opt_freq));
         }
 
     it_size = item_type_size(item_type);
@@ -129,16 +145,11 @@ void Acq_Conf::ConfigureAutomaticResampler(double opt_freq)
 {
     if (use_automatic_resampler)
         {
-            if (fs_in > opt_freq)
+            const uint32_t decimation = acq_resampler_decimation(fs_in, opt_freq);
+            if (decimation > 1)
                 {
-                    resampler_ratio = floor(static_cast<float>(fs_in) / opt_freq);
-                    uint32_t decimation = fs_in / opt_freq;
-                    while (fs_in % decimation > 0)
-                        {
-                            decimation--;
-                        };
-                    resampler_ratio = decimation;
-                    resampled_fs = fs_in / static_cast<int>(resampler_ratio);
+                    resampler_ratio = static_cast<float>(decimation);
+                    resampled_fs = fs_in / static_cast<int64_t>(decimation);
                 }
             // --- Find number of samples per spreading code -------------------
             SetDerivedParams();
@@ -25,6 +25,15 @@
 #include <cstdint>
 #include <string>
 
+/*!
+ * \brief Decimation factor of the automatic acquisition resampler: the
+ * largest divisor of fs_in not above fs_in / target_fs, or 1 if fs_in is not
+ * above target_fs. The flowgraph builds its decimators with it, and the
+ * acquisition blocks derive their sampling rate from it.
+ */
+uint32_t acq_resampler_decimation(int64_t fs_in, double target_fs);
+
+
 class Acq_Conf
 {
 public:
@@ -21,6 +21,7 @@
 
 #include "channel_fsm.h"
 #include "channel_event.h"
+#include "replay_clock.h"
 #include <glog/logging.h>
 #include <utility>
 
@@ -184,6 +185,13 @@ void ChannelFsm::set_channel(uint32_t channel)
 }
 
 
+uint32_t ChannelFsm::get_channel()
+{
+    std::lock_guard<std::mutex> lk(mx_);
+    return channel_;
+}
+
+
 void ChannelFsm::stop_acquisition()
 {
     acq_->stop_acquisition();
@@ -206,17 +214,20 @@ void ChannelFsm::start_acquisition()
 void ChannelFsm::start_tracking()
 {
     trk_->start_tracking();
+    Replay_Clock::get().event_posted();  // handled by the control thread
     queue_->push(pmt::make_any(channel_event_make(channel_, 1)));
 }
 
 
 void ChannelFsm::request_satellite()
 {
+    Replay_Clock::get().event_posted();
     queue_->push(pmt::make_any(channel_event_make(channel_, 0)));
 }
 
 
 void ChannelFsm::notify_stop_tracking()
 {
+    Replay_Clock::get().event_posted();
     queue_->push(pmt::make_any(channel_event_make(channel_, 2)));
 }
@@ -47,6 +47,7 @@ public:
     void set_telemetry(std::shared_ptr<TelemetryDecoderInterface> telemetry);
     void set_queue(Concurrent_Queue<pmt::pmt_t>* queue);
     void set_channel(uint32_t channel);
+    uint32_t get_channel();
     void start_acquisition();
 
     // FSM EVENTS
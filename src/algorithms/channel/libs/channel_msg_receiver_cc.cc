@@ -20,6 +20,7 @@
 
 
 #include "channel_msg_receiver_cc.h"
+#include "replay_clock.h"
 #include <boost/any.hpp>
 #include <glog/logging.h>
 #include <gnuradio/gr_complex.h>
@@ -58,6 +59,18 @@ channel_msg_receiver_cc::channel_msg_receiver_cc(std::shared_ptr<ChannelFsm> cha
 
 
 void channel_msg_receiver_cc::msg_handler_events(pmt::pmt_t msg)
+{
+    if (Replay_Clock::get().enabled())
+        {
+            // deterministic replay: the event is applied at the end of the epoch
+            Replay_Clock::get().defer(d_channel_fsm->get_channel(), [this, msg] { process_event(msg); });
+            return;
+        }
+    process_event(std::move(msg));
+}
+
+
+void channel_msg_receiver_cc::process_event(pmt::pmt_t msg)
 {
     bool result = false;
     try
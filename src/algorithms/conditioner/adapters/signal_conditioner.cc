@@ -40,6 +40,14 @@ SignalConditioner::SignalConditioner(const ConfigurationInterface *configuration
     if (configuration)
         {
         };
+    // an input filter with several outputs (e.g., a channelizer) provides
+    // the outputs of the conditioner, which have to be at the internal rate
+    const gr::basic_block_sptr filter_block = in_filt_ ? in_filt_->get_right_block() : nullptr;
+    multiband_ = filter_block and filter_block->output_signature()->max_streams() > 1;
+    if (multiband_ and res_ and res_->implementation() != "Pass_Through")
+        {
+            LOG(WARNING) << "The " << res_->implementation() << " resampler of " << role_ << " is bypassed, since its input filter has several outputs";
+        }
 }
 
 
@@ -52,11 +60,16 @@ void SignalConditioner::connect(gr::top_block_sptr top_block)
         }
     data_type_adapt_->connect(top_block);
     in_filt_->connect(top_block);
-    res_->connect(top_block);
 
     top_block->connect(data_type_adapt_->get_right_block(), 0, in_filt_->get_left_block(), 0);
     DLOG(INFO) << "data_type_adapter -> input_filter";
 
+    if (multiband_)
+        {
+            connected_ = true;
+            return;
+        }
+    res_->connect(top_block);
     top_block->connect(in_filt_->get_right_block(), 0, res_->get_left_block(), 0);
     DLOG(INFO) << "input_filter -> resampler";
     connected_ = true;
@@ -73,12 +86,15 @@ void SignalConditioner::disconnect(gr::top_block_sptr top_block)
 
     top_block->disconnect(data_type_adapt_->get_right_block(), 0,
         in_filt_->get_left_block(), 0);
-    top_block->disconnect(in_filt_->get_right_block(), 0,
-        res_->get_left_block(), 0);
+    if (!multiband_)
+        {
+            top_block->disconnect(in_filt_->get_right_block(), 0,
+                res_->get_left_block(), 0);
+            res_->disconnect(top_block);
+        }
 
     data_type_adapt_->disconnect(top_block);
     in_filt_->disconnect(top_block);
-    res_->disconnect(top_block);
 
     connected_ = false;
 }
@@ -92,5 +108,9 @@ gr::basic_block_sptr SignalConditioner::get_left_block()
 
 gr::basic_block_sptr SignalConditioner::get_right_block()
 {
+    if (multiband_)
+        {
+            return in_filt_->get_right_block();
+        }
     return res_->get_right_block();
 }
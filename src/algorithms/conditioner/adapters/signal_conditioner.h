@@ -32,6 +32,10 @@ class ConfigurationInterface;
 /*!
  * \brief This class wraps blocks to change data_type_adapter, input_filter and resampler
  * to be applied to the input flow of sampled signal.
+ *
+ * If the input filter has several outputs, such as the sub-bands of a
+ * Channelizer_Filter, the resampler is bypassed and the outputs of the input
+ * filter are the outputs of the conditioner.
  */
 class SignalConditioner : public GNSSBlockInterface
 {
@@ -66,6 +70,7 @@ private:
     std::string role_;
     std::string implementation_;
     bool connected_;
+    bool multiband_;
 };
 
 #endif  // GNSS_SDR_SIGNAL_CONDITIONER_H
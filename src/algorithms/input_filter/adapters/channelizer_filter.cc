@@ -0,0 +1,130 @@
+/*!
+ * \file channelizer_filter.cc
+ * \brief Adapts the polyphase FFT channelizer, which extracts several
+ * sub-bands of a wideband input in a single pass
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "channelizer_filter.h"
+#include "configuration_interface.h"
+#include <glog/logging.h>
+#include <gnuradio/filter/firdes.h>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+
+ChannelizerFilter::ChannelizerFilter(const ConfigurationInterface* configuration, std::string role,
+    unsigned int in_streams, unsigned int out_streams) : role_(std::move(role)), in_streams_(in_streams), out_streams_(out_streams)
+{
+    const std::string default_item_type("gr_complex");
+    const double default_sampling_freq = 4000000.0;
+    const unsigned int default_decimation_factor = 1;
+    const unsigned int default_sub_bands = 1;
+
+    item_type_ = configuration->property(role_ + ".item_type", default_item_type);
+    sampling_freq_ = configuration->property(role_ + ".sampling_frequency", default_sampling_freq);
+    decimation_factor_ = std::max(configuration->property(role_ + ".decimation_factor", default_decimation_factor), 1U);
+    const unsigned int sub_bands = std::max(configuration->property(role_ + ".sub_bands", default_sub_bands), 1U);
+    const double output_freq = sampling_freq_ / static_cast<double>(decimation_factor_);
+    if (std::abs(configuration->property("GNSS-SDR.internal_fs_sps", output_freq) - output_freq) > 0.5)
+        {
+            LOG(WARNING) << "The output rate of " << role_ << " (" << output_freq << " sps) is not GNSS-SDR.internal_fs_sps";
+        }
+
+    // The residual offset between a sub-band and its FFT channel is at most
+    // half the channel spacing, and has to fit in the passband of the
+    // prototype filter: by default, channels four times narrower than the
+    // output rate
+    unsigned int default_fft_size = 1;
+    while (default_fft_size < 4 * decimation_factor_)
+        {
+            default_fft_size *= 2;
+        }
+    fft_size_ = std::max(configuration->property(role_ + ".fft_size", default_fft_size), 1U);
+
+    double passband = 0.0;
+    for (unsigned int i = 0; i < sub_bands; i++)
+        {
+            const double freq = configuration->property(role_ + ".IF" + std::to_string(i), 0.0);
+            const double bw = configuration->property(role_ + ".bw" + std::to_string(i), output_freq / 2.0);
+            const double spacing = sampling_freq_ / static_cast<double>(fft_size_);
+            const double residual = freq - std::round(freq / spacing) * spacing;
+            passband = std::max(passband, bw / 2.0 + std::abs(residual));
+            sub_band_freqs_.push_back(freq);
+            LOG(INFO) << "Channelizer sub-band " << i << " centered at " << freq << " Hz, with a bandwidth of " << bw << " Hz";
+        }
+
+    // All the sub-bands share the prototype filter, designed for the widest
+    // one: the transition band ends where its aliases would fold into the
+    // passband after decimation
+    const double default_tw = output_freq - 2.0 * passband;
+    double tw = configuration->property(role_ + ".tw", default_tw);
+    if (tw <= 0.0)
+        {
+            tw = output_freq / 10.0;
+            LOG(WARNING) << "The sub-bands of " << role_ << " do not fit in the output rate of " << output_freq << " sps, some aliasing will occur";
+        }
+    taps_ = gr::filter::firdes::low_pass(1.0, sampling_freq_, output_freq / 2.0, tw);
+
+    if (item_type_ == "gr_complex")
+        {
+            channelizer_ = make_polyphase_channelizer_cc(taps_, sub_band_freqs_, sampling_freq_, decimation_factor_, fft_size_);
+            LOG(INFO) << "Created polyphase channelizer with " << sub_bands << " sub-bands, " << fft_size_ << " channels and " << taps_.size() << " taps";
+            DLOG(INFO) << "input_filter(" << channelizer_->unique_id() << ")";
+        }
+    else
+        {
+            LOG(ERROR) << item_type_ << " unrecognized item type for the channelizer filter";
+        }
+    if (in_streams_ > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one input stream";
+        }
+    if (out_streams_ > 1)
+        {
+            LOG(ERROR) << "This implementation provides one output stream per sub-band";
+        }
+}
+
+
+void ChannelizerFilter::connect(gr::top_block_sptr top_block)
+{
+    if (top_block)
+        { /* top_block is not null */
+        };
+    DLOG(INFO) << "nothing to connect internally";
+}
+
+
+void ChannelizerFilter::disconnect(gr::top_block_sptr top_block)
+{
+    if (top_block)
+        { /* top_block is not null */
+        };
+    // Nothing to disconnect
+}
+
+
+gr::basic_block_sptr ChannelizerFilter::get_left_block()
+{
+    return channelizer_;
+}
+
+
+gr::basic_block_sptr ChannelizerFilter::get_right_block()
+{
+    return channelizer_;
+}
@@ -0,0 +1,82 @@
+/*!
+ * \file channelizer_filter.h
+ * \brief Adapts the polyphase FFT channelizer, which extracts several
+ * sub-bands of a wideband input in a single pass
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CHANNELIZER_FILTER_H
+#define GNSS_SDR_CHANNELIZER_FILTER_H
+
+#include "gnss_block_interface.h"
+#include "polyphase_channelizer_cc.h"
+#include <string>
+#include <vector>
+
+class ConfigurationInterface;
+
+/*!
+ * \brief This class adapts a polyphase FFT channelizer with one output per
+ * sub-band, replacing a Freq_Xlating_Fir_Filter for each of them.
+ *
+ * Each sub-band i is centered at role.IFi Hz from the center of the input band,
+ * with a bandwidth of role.bwi Hz, and all of them are decimated by
+ * role.decimation_factor. The outputs of the filter are the outputs of the
+ * signal conditioner, and channels select theirs with ChannelN.sub_band.
+ */
+class ChannelizerFilter : public GNSSBlockInterface
+{
+public:
+    ChannelizerFilter(const ConfigurationInterface* configuration,
+        std::string role, unsigned int in_streams,
+        unsigned int out_streams);
+
+    ~ChannelizerFilter() = default;
+
+    inline std::string role() override
+    {
+        return role_;
+    }
+
+    //! Returns "Channelizer_Filter"
+    inline std::string implementation() override
+    {
+        return "Channelizer_Filter";
+    }
+
+    inline size_t item_size() override
+    {
+        return sizeof(gr_complex);
+    }
+
+    void connect(gr::top_block_sptr top_block) override;
+    void disconnect(gr::top_block_sptr top_block) override;
+    gr::basic_block_sptr get_left_block() override;
+    gr::basic_block_sptr get_right_block() override;
+
+private:
+    polyphase_channelizer_cc_sptr channelizer_;
+    std::vector<float> taps_;
+    std::vector<double> sub_band_freqs_;
+    std::string item_type_;
+    std::string role_;
+    double sampling_freq_;
+    unsigned int decimation_factor_;
+    unsigned int fft_size_;
+    unsigned int in_streams_;
+    unsigned int out_streams_;
+};
+
+#endif  // GNSS_SDR_CHANNELIZER_FILTER_H
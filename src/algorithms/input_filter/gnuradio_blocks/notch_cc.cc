@@ -54,11 +54,12 @@ Notch::Notch(float pfa,
     n_segments = 0;
     this->n_segments_est = n_segments_est;      // Set the number of segments for noise power estimation
     this->n_segments_reset = n_segments_reset;  // Set the period (in segments) when the noise power is estimated
-    z_0 = gr_complex(0.0, 0.0);
     boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred);
     thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa));
     c_samples = volk_gnsssdr::vector<gr_complex>(length_);
-    angle_ = volk_gnsssdr::vector<float>(length_);
+    magnitude_ = volk_gnsssdr::vector<float>(length_);
+    z_ = volk_gnsssdr::vector<gr_complex>(length_);
+    w_ = volk_gnsssdr::vector<gr_complex>(length_);
     power_spect = volk_gnsssdr::vector<float>(length_);
     last_out = gr_complex(0.0, 0.0);
     d_fft = std::make_unique<gr::fft::fft_complex>(length_, true);
@@ -106,13 +107,26 @@ int Notch::general_work(int noutput_items, gr_vector_int &ninput_items __attribu
                                     filter_state_ = true;
                                     last_out = gr_complex(0.0, 0.0);
                                 }
+                            // the zero of the filter follows the phase increment of the
+                            // input, z_k = c_k / |c_k| with c_k = x_k * conj(x_{k-1}), which
+                            // avoids the evaluation of atan2 and exp for each sample
                             volk_32fc_x2_multiply_conjugate_32fc(c_samples.data(), in, (in - 1), length_);
-                            volk_32fc_s32f_atan2_32f(angle_.data(), c_samples.data(), static_cast<float>(1.0), length_);
+                            volk_32fc_magnitude_32f(magnitude_.data(), c_samples.data(), length_);
                             for (int32_t aux = 0; aux < length_; aux++)
                                 {
-                                    z_0 = std::exp(gr_complex(0.0, 1.0) * (*(angle_.data() + aux)));
-                                    *(out + aux) = *(in + aux) - z_0 * (*(in + aux - 1)) + p_c_factor * z_0 * last_out;
-                                    last_out = *(out + aux);
+                                    const float mag = magnitude_[aux];
+                                    z_[aux] = mag > 0.0F ? c_samples[aux] * (1.0F / mag) : gr_complex(1.0, 0.0);
+                                }
+                            // feedforward part, w_k = x_k - z_k * x_{k-1}
+                            volk_32fc_x2_multiply_32fc(w_.data(), z_.data(), (in - 1), length_);
+                            volk_32f_x2_subtract_32f(reinterpret_cast<float *>(w_.data()), reinterpret_cast<const float *>(in), reinterpret_cast<const float *>(w_.data()), 2 * length_);
+                            // pole of the filter, p_c_factor * z_k
+                            volk_32f_s32f_multiply_32f(reinterpret_cast<float *>(z_.data()), reinterpret_cast<const float *>(z_.data()), p_c_factor.real(), 2 * length_);
+                            // only the first-order recursion is left sample by sample
+                            for (int32_t aux = 0; aux < length_; aux++)
+                                {
+                                    last_out = w_[aux] + z_[aux] * last_out;
+                                    out[aux] = last_out;
                                 }
                         }
                     else
@@ -47,6 +47,13 @@ notch_sptr make_notch_filter(
 
 /*!
  * \brief This class implements a real-time software-defined multi state notch filter
+ *
+ * When an interference is detected, each segment is filtered with
+ * y_k = x_k - z_k * x_{k-1} + p_c_factor * z_k * y_{k-1}, where the zero z_k
+ * tracks the phase increment of the input. The phase increments, the
+ * feedforward term and the pole are computed with VOLK kernels on
+ * preallocated buffers. The normalization z_k = c_k / |c_k| and the
+ * first-order recursion are scalar loops.
  */
 class Notch : public gr::block
 {
@@ -64,10 +71,11 @@ private:
     Notch(float pfa, float p_c_factor, int32_t length_, int32_t n_segments_est, int32_t n_segments_reset);
     std::unique_ptr<gr::fft::fft_complex> d_fft;
     volk_gnsssdr::vector<gr_complex> c_samples;
-    volk_gnsssdr::vector<float> angle_;
+    volk_gnsssdr::vector<gr_complex> z_;
+    volk_gnsssdr::vector<gr_complex> w_;
+    volk_gnsssdr::vector<float> magnitude_;
     volk_gnsssdr::vector<float> power_spect;
     gr_complex last_out;
-    gr_complex z_0;
     gr_complex p_c_factor;
     float pfa;
     float noise_pow_est;
@@ -66,6 +66,7 @@ NotchLite::NotchLite(float p_c_factor,
     angle1 = 0.0;
     angle2 = 0.0;
     power_spect = volk_gnsssdr::vector<float>(length_);
+    w_ = volk_gnsssdr::vector<gr_complex>(length_);
     d_fft = std::make_unique<gr::fft::fft_complex>(length_, true);
 }
 
@@ -121,10 +122,15 @@ int NotchLite::general_work(int noutput_items, gr_vector_int &ninput_items __att
                                     float angle_ = (angle1 + angle2) / 2.0F;
                                     z_0 = std::exp(gr_complex(0, 1) * angle_);
                                 }
+                            // feedforward part with VOLK, w_k = x_k - z_0 * x_{k-1}, so that
+                            // only the first-order recursion is left sample by sample
+                            volk_32fc_s32fc_multiply_32fc(w_.data(), (in - 1), z_0, length_);
+                            volk_32f_x2_subtract_32f(reinterpret_cast<float *>(w_.data()), reinterpret_cast<const float *>(in), reinterpret_cast<const float *>(w_.data()), 2 * length_);
+                            const gr_complex pole = p_c_factor * z_0;
                             for (int32_t aux = 0; aux < length_; aux++)
                                 {
-                                    *(out + aux) = *(in + aux) - z_0 * (*(in + aux - 1)) + p_c_factor * z_0 * last_out;
-                                    last_out = *(out + aux);
+                                    last_out = w_[aux] + pole * last_out;
+                                    out[aux] = last_out;
                                 }
                             n_segments_coeff++;
                             n_segments_coeff = n_segments_coeff % n_segments_coeff_reset;
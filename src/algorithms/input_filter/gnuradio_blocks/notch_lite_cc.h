@@ -64,6 +64,7 @@ private:
     friend notch_lite_sptr make_notch_filter_lite(float p_c_factor, float pfa, int32_t length_, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff);
     NotchLite(float p_c_factor, float pfa, int32_t length_, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff);
     std::unique_ptr<gr::fft::fft_complex> d_fft;
+    volk_gnsssdr::vector<gr_complex> w_;
     volk_gnsssdr::vector<float> power_spect;
     gr_complex last_out;
     gr_complex z_0;
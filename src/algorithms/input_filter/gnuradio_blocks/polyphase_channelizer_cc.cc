@@ -0,0 +1,116 @@
+/*!
+ * \file polyphase_channelizer_cc.cc
+ * \brief Polyphase FFT channelizer that extracts several decimated sub-bands
+ * from a wideband input in a single pass
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "polyphase_channelizer_cc.h"
+#include "MATH_CONSTANTS.h"
+#include "gnss_sdr_make_unique.h"
+#include <gnuradio/io_signature.h>
+#include <cmath>
+
+
+polyphase_channelizer_cc_sptr make_polyphase_channelizer_cc(const std::vector<float> &taps,
+    const std::vector<double> &sub_band_freqs,
+    double sampling_freq,
+    uint32_t decimation,
+    uint32_t fft_size)
+{
+    return polyphase_channelizer_cc_sptr(new polyphase_channelizer_cc(taps, sub_band_freqs, sampling_freq, decimation, fft_size));
+}
+
+
+polyphase_channelizer_cc::polyphase_channelizer_cc(const std::vector<float> &taps,
+    const std::vector<double> &sub_band_freqs,
+    double sampling_freq,
+    uint32_t decimation,
+    uint32_t fft_size) : gr::sync_decimator("polyphase_channelizer_cc",
+                             gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                             gr::io_signature::make(sub_band_freqs.size(), sub_band_freqs.size(), sizeof(gr_complex)),
+                             decimation),
+                         d_fft_size(fft_size)
+{
+    // the taps are applied to the input window with the oldest sample first,
+    // so they are stored reversed, with the zero padding at the beginning
+    d_ntaps = ((static_cast<uint32_t>(taps.size()) + d_fft_size - 1) / d_fft_size) * d_fft_size;
+    d_taps = volk_gnsssdr::vector<float>(2 * d_ntaps, 0.0);
+    for (size_t l = 0; l < taps.size(); l++)
+        {
+            const size_t i = d_ntaps - 1 - l;
+            d_taps[2 * i] = taps[l];
+            d_taps[2 * i + 1] = taps[l];
+        }
+    set_history(d_ntaps);
+    d_fft = std::make_unique<gr::fft::fft_complex>(d_fft_size, true);
+
+    // Output n of channel k is exp(-j 2 pi k n decimation / fft_size) times
+    // the bin k of the FFT of the folded window. The rotator of each output
+    // includes that term and the residual frequency offset, so that it
+    // advances by the sub-band frequency at the output rate.
+    for (const double freq : sub_band_freqs)
+        {
+            const auto k = static_cast<int64_t>(std::round(freq / sampling_freq * static_cast<double>(d_fft_size)));
+            const int64_t m = static_cast<int64_t>(d_fft_size);
+            d_bins.push_back(static_cast<uint32_t>(((k % m) + m) % m));
+            const double phase_inc = -TWO_PI * freq * static_cast<double>(decimation) / sampling_freq;
+            d_phase.emplace_back(1.0, 0.0);
+            d_phase_inc.emplace_back(std::cos(phase_inc), std::sin(phase_inc));
+        }
+}
+
+
+int polyphase_channelizer_cc::work(int noutput_items,
+    gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items)
+{
+    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    const uint32_t decim = decimation();
+    const uint32_t width = 2 * d_fft_size;
+    const uint32_t length = 2 * d_ntaps;
+    const float *taps = d_taps.data();
+    auto *fold = reinterpret_cast<float *>(d_fft->get_inbuf());
+    for (int n = 0; n < noutput_items; n++)
+        {
+            // polyphase partition of the filter: the products of the taps
+            // and the input window are folded into fft_size bins
+            const auto *window = reinterpret_cast<const float *>(in + static_cast<size_t>(n) * decim);
+            for (uint32_t q = 0; q < width; q++)
+                {
+                    fold[q] = taps[q] * window[q];
+                }
+            for (uint32_t p = width; p < length; p += width)
+                {
+                    for (uint32_t q = 0; q < width; q++)
+                        {
+                            fold[q] += taps[p + q] * window[p + q];
+                        }
+                }
+            d_fft->execute();
+            const gr_complex *spectrum = d_fft->get_outbuf();
+            for (size_t s = 0; s < d_bins.size(); s++)
+                {
+                    reinterpret_cast<gr_complex *>(output_items[s])[n] = spectrum[d_bins[s]] * d_phase[s];
+                    d_phase[s] *= d_phase_inc[s];
+                }
+        }
+    // keep the rotators on the unit circle
+    for (auto &phase : d_phase)
+        {
+            phase /= std::abs(phase);
+        }
+    return noutput_items;
+}
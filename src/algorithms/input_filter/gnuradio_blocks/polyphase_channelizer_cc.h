@@ -0,0 +1,85 @@
+/*!
+ * \file polyphase_channelizer_cc.h
+ * \brief Polyphase FFT channelizer that extracts several decimated sub-bands
+ * from a wideband input in a single pass
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_POLYPHASE_CHANNELIZER_CC_H
+#define GNSS_SDR_POLYPHASE_CHANNELIZER_CC_H
+
+#if GNURADIO_USES_STD_POINTERS
+#else
+#include <boost/shared_ptr.hpp>
+#endif
+#include <gnuradio/fft/fft.h>
+#include <gnuradio/sync_decimator.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class polyphase_channelizer_cc;
+
+#if GNURADIO_USES_STD_POINTERS
+using polyphase_channelizer_cc_sptr = std::shared_ptr<polyphase_channelizer_cc>;
+#else
+using polyphase_channelizer_cc_sptr = boost::shared_ptr<polyphase_channelizer_cc>;
+#endif
+
+polyphase_channelizer_cc_sptr make_polyphase_channelizer_cc(
+    const std::vector<float> &taps,
+    const std::vector<double> &sub_band_freqs,
+    double sampling_freq,
+    uint32_t decimation,
+    uint32_t fft_size);
+
+/*!
+ * \brief This class implements a polyphase FFT channelizer with one output
+ * per sub-band.
+ *
+ * The input is split into fft_size channels centered at multiples of
+ * sampling_freq / fft_size, all of them filtered with the low-pass prototype
+ * filter taps and decimated by decimation, with a single pass of the
+ * polyphase filter and one FFT per output sample. Each output takes the
+ * channel closest to its sub-band frequency, and a rotator at the output rate
+ * removes the rest of the frequency offset, so every output is the signal of
+ * its sub-band shifted by -sub_band_freqs[i] to baseband. The passband of the
+ * prototype filter has to cover the bandwidth of the sub-bands plus that
+ * residual offset, which is at most half the channel spacing.
+ */
+class polyphase_channelizer_cc : public gr::sync_decimator
+{
+public:
+    ~polyphase_channelizer_cc() = default;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend polyphase_channelizer_cc_sptr make_polyphase_channelizer_cc(const std::vector<float> &taps, const std::vector<double> &sub_band_freqs, double sampling_freq, uint32_t decimation, uint32_t fft_size);
+    polyphase_channelizer_cc(const std::vector<float> &taps, const std::vector<double> &sub_band_freqs, double sampling_freq, uint32_t decimation, uint32_t fft_size);
+
+    std::unique_ptr<gr::fft::fft_complex> d_fft;
+    volk_gnsssdr::vector<float> d_taps;  // reversed, zero-padded to a multiple of fft_size, and repeated for the real and imaginary parts
+    std::vector<uint32_t> d_bins;
+    std::vector<gr_complex> d_phase;
+    std::vector<gr_complex> d_phase_inc;
+    uint32_t d_fft_size;
+    uint32_t d_ntaps;
+};
+
+#endif  // GNSS_SDR_POLYPHASE_CHANNELIZER_CC_H
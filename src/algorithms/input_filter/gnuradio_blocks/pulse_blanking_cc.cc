@@ -21,7 +21,8 @@
 #include <boost/math/distributions/chi_squared.hpp>
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
-#include <algorithm>
+#include <algorithm>  // for std::max, std::fill_n
+#include <cstring>    // for memcpy
 
 
 pulse_blanking_cc_sptr make_pulse_blanking_cc(float pfa, int32_t length_,
@@ -50,7 +51,6 @@ pulse_blanking_cc::pulse_blanking_cc(float pfa,
     n_deg_fred = 2 * length_;
     boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred);
     thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa));
-    zeros_ = volk_gnsssdr::vector<gr_complex>(length_);
 }
 
 
@@ -68,13 +68,14 @@ int pulse_blanking_cc::general_work(int noutput_items, gr_vector_int &ninput_ite
 {
     const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
     auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
-    auto magnitude = volk_gnsssdr::vector<float>(noutput_items);
-    volk_32fc_magnitude_squared_32f(magnitude.data(), in, noutput_items);
     int32_t sample_index = 0;
+    lv_32fc_t dot_prod_;
     float segment_energy;
     while ((sample_index + length_) < noutput_items)
         {
-            volk_32f_accumulator_s32f(&segment_energy, (magnitude.data() + sample_index), length_);
+            // energy of the segment in a single pass, without intermediate buffers
+            volk_32fc_x2_conjugate_dot_prod_32fc(&dot_prod_, in, in, length_);
+            segment_energy = lv_creal(dot_prod_);
             if ((n_segments < n_segments_est) && (last_filtered == false))
                 {
                     noise_power_estimation = (static_cast<float>(n_segments) * noise_power_estimation + segment_energy / static_cast<float>(n_deg_fred)) / static_cast<float>(n_segments + 1);
@@ -84,7 +85,7 @@ int pulse_blanking_cc::general_work(int noutput_items, gr_vector_int &ninput_ite
                 {
                     if ((segment_energy / noise_power_estimation) > thres_)
                         {
-                            memcpy(out, zeros_.data(), sizeof(gr_complex) * length_);
+                            std::fill_n(out, length_, gr_complex(0.0, 0.0));
                             last_filtered = true;
                         }
                     else
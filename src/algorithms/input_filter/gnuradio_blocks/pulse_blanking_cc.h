@@ -26,7 +26,6 @@
 #include <boost/shared_ptr.hpp>
 #endif
 #include <gnuradio/block.h>
-#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <cstdint>
 
 class pulse_blanking_cc;
@@ -43,6 +42,12 @@ pulse_blanking_cc_sptr make_pulse_blanking_cc(
     int32_t n_segments_est,
     int32_t n_segments_reset);
 
+/*!
+ * \brief Blanks the segments of length_ samples whose energy exceeds the
+ * noise floor by a threshold set by the probability of false alarm pfa. The
+ * energy is computed directly from the input samples, so the block does not
+ * allocate any memory while running.
+ */
 class pulse_blanking_cc : public gr::block
 {
 public:
@@ -56,7 +61,6 @@ public:
 private:
     friend pulse_blanking_cc_sptr make_pulse_blanking_cc(float pfa, int32_t length_, int32_t n_segments_est, int32_t n_segments_reset);
     pulse_blanking_cc(float pfa, int32_t length_, int32_t n_segments_est, int32_t n_segments_reset);
-    volk_gnsssdr::vector<gr_complex> zeros_;
     float noise_power_estimation;
     float thres_;
     float pfa;
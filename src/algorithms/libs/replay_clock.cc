@@ -0,0 +1,291 @@
+/*!
+ * \file replay_clock.cc
+ * \brief Sample-counter clock that makes the replay of files deterministic,
+ * by ordering the receiver events by sample counter instead of wall-clock time.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "replay_clock.h"
+#include <glog/logging.h>
+#include <gnuradio/block_detail.h>
+#include <gnuradio/buffer.h>
+#include <algorithm>  // for std::stable_sort, std::max
+#include <chrono>     // for std::chrono::milliseconds
+#include <cmath>      // for std::llround
+#include <limits>     // for std::numeric_limits
+#include <utility>    // for std::move
+
+
+Replay_Clock& Replay_Clock::get()
+{
+    static Replay_Clock clock;
+    return clock;
+}
+
+
+Replay_Clock::Replay_Clock() : d_epoch_s(0.0),
+                               d_epoch(1),
+                               d_tick_epochs(1),
+                               d_pending(0),
+                               d_next_id(0),
+                               d_stopped(false),
+                               d_enabled(false)
+{
+}
+
+
+Replay_Clock::~Replay_Clock()
+{
+    stop();
+}
+
+
+void Replay_Clock::enable(double epoch_s, double tick_s)
+{
+    stop();
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_epoch_s = epoch_s;
+    d_tick_epochs = std::max(static_cast<int64_t>(1), static_cast<int64_t>(std::llround(tick_s / epoch_s)));
+    d_epoch = 1;
+    d_pending = 0;
+    d_actions.clear();
+    d_stopped = false;
+    d_enabled = true;
+    LOG(INFO) << "Deterministic replay enabled, with epochs of " << epoch_s * 1e3 << " ms";
+}
+
+
+void Replay_Clock::start(std::function<void()> tick_handler)
+{
+    if (not d_enabled or d_thread.joinable())
+        {
+            return;
+        }
+    d_tick_handler = std::move(tick_handler);
+    d_thread = std::thread([this] { clock_thread(); });
+}
+
+
+void Replay_Clock::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stopped = true;
+        d_enabled = false;
+    }
+    d_clock_cond.notify_all();
+    d_consumer_cond.notify_all();
+    if (d_thread.joinable())
+        {
+            d_thread.join();
+            LOG(INFO) << "Deterministic replay finished after " << d_epoch - 1 << " epochs";
+        }
+}
+
+
+int Replay_Clock::register_consumer(gr::block* block, double sampling_frequency)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (not d_enabled)
+        {
+            return -1;
+        }
+    const int id = d_next_id++;
+    d_consumers[id] = Consumer{block, sampling_frequency, 0};
+    return id;
+}
+
+
+void Replay_Clock::unregister_consumer(int id)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_consumers.erase(id);
+    }
+    d_clock_cond.notify_all();
+}
+
+
+uint64_t Replay_Clock::horizon(const Consumer& consumer) const
+{
+    return static_cast<uint64_t>(std::llround(static_cast<double>(d_epoch) * d_epoch_s * consumer.fs));
+}
+
+
+uint64_t Replay_Clock::wait(int id, uint64_t sample_counter)
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    auto it = d_consumers.find(id);
+    if (it == d_consumers.end())
+        {
+            return std::numeric_limits<uint64_t>::max();
+        }
+    Consumer& consumer = it->second;
+    while (not d_stopped and sample_counter >= horizon(consumer))
+        {
+            consumer.parked_epoch = d_epoch;
+            d_clock_cond.notify_all();
+            d_consumer_cond.wait(lock);
+        }
+    if (d_stopped)
+        {
+            return std::numeric_limits<uint64_t>::max();
+        }
+    return horizon(consumer) - sample_counter;
+}
+
+
+void Replay_Clock::event_posted()
+{
+    if (not d_enabled)
+        {
+            return;
+        }
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_pending++;
+}
+
+
+void Replay_Clock::event_handled()
+{
+    if (not d_enabled)
+        {
+            return;
+        }
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        if (d_pending > 0)
+            {
+                d_pending--;
+            }
+    }
+    d_clock_cond.notify_all();
+}
+
+
+void Replay_Clock::defer(uint32_t channel, std::function<void()> action)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_actions.push_back(Action{channel, std::move(action)});
+        if (d_pending > 0)
+            {
+                d_pending--;
+            }
+    }
+    d_clock_cond.notify_all();
+}
+
+
+uint64_t Replay_Clock::epoch() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_epoch;
+}
+
+
+bool Replay_Clock::finished(const Consumer& consumer) const
+{
+    // Not in a running flowgraph, or at the end of the input stream without
+    // enough items to be called again
+    if (consumer.block == nullptr)
+        {
+            return false;
+        }
+    const gr::block_detail_sptr detail = consumer.block->detail();
+    if (detail == nullptr or detail->ninputs() == 0)
+        {
+            return true;
+        }
+    if (not detail->input(0)->done())
+        {
+            return false;
+        }
+    gr_vector_int required(1, 1);
+    consumer.block->forecast(1, required);
+    return detail->input(0)->items_available() < std::max(1, required[0]);
+}
+
+
+bool Replay_Clock::epoch_complete()
+{
+    if (d_pending > 0)
+        {
+            return false;
+        }
+    bool parked = false;
+    for (const auto& consumer : d_consumers)
+        {
+            if (consumer.second.parked_epoch == d_epoch)
+                {
+                    parked = true;
+                }
+            else if (not finished(consumer.second))
+                {
+                    return false;
+                }
+        }
+    return parked;
+}
+
+
+void Replay_Clock::wait_for_events(std::unique_lock<std::mutex>& lock)
+{
+    while (not d_stopped and d_pending > 0)
+        {
+            d_clock_cond.wait_for(lock, std::chrono::milliseconds(10));
+        }
+}
+
+
+void Replay_Clock::clock_thread()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (not d_stopped)
+        {
+            // The timeout only matters at the end of the input streams, where
+            // consumers finish without waiting
+            if (not epoch_complete())
+                {
+                    d_clock_cond.wait_for(lock, std::chrono::milliseconds(10));
+                    continue;
+                }
+
+            // All the consumers are at the end of the epoch: apply the
+            // deferred events, and let the control thread handle the
+            // channel events they generate
+            std::vector<Action> actions;
+            actions.swap(d_actions);
+            std::stable_sort(actions.begin(), actions.end(), [](const Action& a, const Action& b) { return a.channel < b.channel; });
+            lock.unlock();
+            for (auto& action : actions)
+                {
+                    action.run();
+                }
+            lock.lock();
+            wait_for_events(lock);
+
+            if (d_epoch % d_tick_epochs == 0 and d_tick_handler)
+                {
+                    lock.unlock();
+                    d_tick_handler();
+                    lock.lock();
+                    wait_for_events(lock);
+                }
+
+            d_epoch++;
+            d_consumer_cond.notify_all();
+        }
+}
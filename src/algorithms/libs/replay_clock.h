@@ -0,0 +1,162 @@
+/*!
+ * \file replay_clock.h
+ * \brief Sample-counter clock that makes the replay of files deterministic,
+ * by ordering the receiver events by sample counter instead of wall-clock time.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_REPLAY_CLOCK_H
+#define GNSS_SDR_REPLAY_CLOCK_H
+
+#include <gnuradio/block.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/*!
+ * \brief Process-wide clock for deterministic replays.
+ *
+ * When enabled, the signal is processed in epochs of a fixed duration. The
+ * acquisition and tracking blocks registered as consumers wait at the end of
+ * each epoch, and the events they generate (acquisition results, loss of lock)
+ * are not handled right away, but deferred to the end of the epoch, where they
+ * are applied in channel order while all the consumers wait. The consumers
+ * only proceed with the next epoch once the control thread has handled all the
+ * resulting channel events. Hence the sample at which each channel starts or
+ * stops acquiring or tracking a signal does not depend on thread scheduling,
+ * while the blocks still run as fast as they can within each epoch.
+ *
+ * A consumer whose upstream block has finished, and that does not have enough
+ * input items left to be called again, is not waited for.
+ */
+class Replay_Clock
+{
+public:
+    /*!
+     * \brief The clock shared by all the blocks of the receiver.
+     */
+    static Replay_Clock& get();
+
+    ~Replay_Clock();
+
+    /*!
+     * \brief Enables the clock, with epochs of epoch_s seconds. The tick handler
+     * set by start() is called every tick_s seconds of signal. Consumers have to
+     * be registered after this call.
+     */
+    void enable(double epoch_s, double tick_s);
+
+    inline bool enabled() const
+    {
+        return d_enabled.load();
+    }
+
+    /*!
+     * \brief Starts advancing the epochs, once the flowgraph is running.
+     * tick_handler is called at the end of the epochs where a tick is due,
+     * while all the consumers wait.
+     */
+    void start(std::function<void()> tick_handler);
+
+    /*!
+     * \brief Stops the clock and releases all the waiting consumers.
+     */
+    void stop();
+
+    /*!
+     * \brief Registers a block that consumes samples at sampling_frequency.
+     * Returns the consumer id to be passed to wait(), or -1 if the clock is
+     * not enabled. block can be nullptr if the consumer is not a block.
+     */
+    int register_consumer(gr::block* block, double sampling_frequency);
+
+    void unregister_consumer(int id);
+
+    /*!
+     * \brief Called by a consumer before processing the items starting at
+     * sample_counter. Waits until that sample is in the current epoch, and
+     * returns the number of items left until the end of the epoch. A consumer
+     * may process a chunk of items that crosses the end of the epoch.
+     */
+    uint64_t wait(int id, uint64_t sample_counter);
+
+    /*!
+     * \brief Announces an event that is going to be deferred, or pushed to the
+     * control queue. The clock does not advance until it is deferred or handled.
+     */
+    void event_posted();
+
+    /*!
+     * \brief Marks an event pushed to the control queue as handled.
+     */
+    void event_handled();
+
+    /*!
+     * \brief Defers action, generated by an event of channel, to the end of
+     * the current epoch. Actions run in channel order, and in order of
+     * arrival within a channel.
+     */
+    void defer(uint32_t channel, std::function<void()> action);
+
+    /*!
+     * \brief Number of the current epoch, starting at 1.
+     */
+    uint64_t epoch() const;
+
+private:
+    struct Consumer
+    {
+        gr::block* block;
+        double fs;
+        uint64_t parked_epoch;
+    };
+
+    struct Action
+    {
+        uint32_t channel;
+        std::function<void()> run;
+    };
+
+    Replay_Clock();
+
+    void clock_thread();
+    bool epoch_complete();
+    bool finished(const Consumer& consumer) const;
+    uint64_t horizon(const Consumer& consumer) const;
+    void wait_for_events(std::unique_lock<std::mutex>& lock);
+
+    std::map<int, Consumer> d_consumers;
+    std::vector<Action> d_actions;
+    std::function<void()> d_tick_handler;
+    std::thread d_thread;
+    mutable std::mutex d_mutex;
+    std::condition_variable d_clock_cond;
+    std::condition_variable d_consumer_cond;
+    double d_epoch_s;
+    uint64_t d_epoch;
+    uint64_t d_tick_epochs;
+    int64_t d_pending;
+    int d_next_id;
+    bool d_stopped;
+    std::atomic<bool> d_enabled;
+};
+
+#endif  // GNSS_SDR_REPLAY_CLOCK_H
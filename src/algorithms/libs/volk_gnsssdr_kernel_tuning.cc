@@ -0,0 +1,112 @@
+/*!
+ * \file volk_gnsssdr_kernel_tuning.cc
+ * \brief In-process calibration of VOLK_GNSSSDR kernels for the call shapes
+ * used by the receiver
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "volk_gnsssdr_kernel_tuning.h"
+#include "gnss_sdr_create_directory.h"
+#include <glog/logging.h>
+#include <volk_gnsssdr/volk_gnsssdr_prefs.h>
+#include <algorithm>  // for min
+#include <chrono>
+#include <cstdlib>  // for free
+#include <cstring>  // for strncmp
+#include <limits>
+#include <mutex>
+
+
+namespace
+{
+std::mutex tuning_mutex;
+constexpr int TUNING_REPETITIONS = 16;  // the fastest of these runs is kept for each implementation
+}  // namespace
+
+
+std::string volk_gnsssdr_tune_kernel(const std::string& kernel_name,
+    const volk_gnsssdr_func_desc_t& desc,
+    unsigned int num_points,
+    unsigned int num_vectors,
+    const std::function<void(const char*)>& run_impl)
+{
+    std::lock_guard<std::mutex> lock(tuning_mutex);
+    const unsigned int bucket = volk_gnsssdr_num_points_bucket(num_points);
+
+    volk_gnsssdr_shape_pref_t* prefs = nullptr;
+    const size_t n_prefs = volk_gnsssdr_load_shape_preferences(&prefs);
+    std::string cached_impl;
+    for (size_t i = 0; i < n_prefs; i++)
+        {
+            if (kernel_name == prefs[i].name and prefs[i].num_points_bucket == bucket and prefs[i].num_vectors == num_vectors)
+                {
+                    cached_impl = prefs[i].impl_u;
+                }
+        }
+    free(prefs);
+    if (!cached_impl.empty())
+        {
+            return cached_impl;
+        }
+
+    std::string best_impl;
+    double best_time = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < desc.n_impls; i++)
+        {
+            if (desc.impl_alignment[i])
+                {
+                    continue;
+                }
+            run_impl(desc.impl_names[i]);  // warm up caches
+            double impl_time = std::numeric_limits<double>::max();
+            for (int k = 0; k < TUNING_REPETITIONS; k++)
+                {
+                    const auto start = std::chrono::steady_clock::now();
+                    run_impl(desc.impl_names[i]);
+                    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+                    impl_time = std::min(impl_time, elapsed.count());
+                }
+            if (impl_time < best_time)
+                {
+                    best_time = impl_time;
+                    best_impl = desc.impl_names[i];
+                }
+        }
+    if (best_impl.empty())
+        {
+            return best_impl;
+        }
+
+    volk_gnsssdr_shape_pref_t pref{};
+    kernel_name.copy(pref.name, sizeof(pref.name) - 1);
+    best_impl.copy(pref.impl_u, sizeof(pref.impl_u) - 1);
+    pref.num_points_bucket = bucket;
+    pref.num_vectors = num_vectors;
+
+    char path[512];
+    volk_gnsssdr_get_shape_config_path(path, false);
+    const std::string config_path(path);
+    const std::string config_folder = config_path.substr(0, config_path.find_last_of('/'));
+    if (config_folder.empty() or !gnss_sdr_create_directory(config_folder) or !volk_gnsssdr_store_shape_preference(&pref))
+        {
+            LOG(WARNING) << "Could not store the calibration of " << kernel_name << " in " << config_path;
+        }
+    else
+        {
+            LOG(INFO) << "Calibrated " << kernel_name << " for " << num_points << " samples and " << num_vectors
+                      << " vectors: " << best_impl << " (" << best_time * 1e6 << " us per call)";
+        }
+    return best_impl;
+}
@@ -0,0 +1,50 @@
+/*!
+ * \file volk_gnsssdr_kernel_tuning.h
+ * \brief In-process calibration of VOLK_GNSSSDR kernels for the call shapes
+ * used by the receiver
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_VOLK_GNSSSDR_KERNEL_TUNING_H
+#define GNSS_SDR_VOLK_GNSSSDR_KERNEL_TUNING_H
+
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <functional>
+#include <string>
+
+/*!
+ * \brief Returns the preferred unaligned implementation of a VOLK_GNSSSDR
+ * kernel for calls of num_points samples over num_vectors vectors.
+ *
+ * If volk_gnsssdr_shape_config has no entry for that kernel, num_points
+ * bucket and number of vectors, each unaligned implementation is timed
+ * through run_impl and the fastest one is stored there. The kernel
+ * dispatcher reads that file the first time the kernel is called, so the
+ * calibration has to happen before, typically when the blocks are built.
+ * Calibrations are serialized across threads.
+ *
+ * \param kernel_name Name of the kernel, e.g. "volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn"
+ * \param desc Kernel description, as returned by <kernel_name>_get_func_desc()
+ * \param num_points Number of samples per call
+ * \param num_vectors Number of vectors per call
+ * \param run_impl Calls the kernel once with the given implementation name
+ */
+std::string volk_gnsssdr_tune_kernel(const std::string& kernel_name,
+    const volk_gnsssdr_func_desc_t& desc,
+    unsigned int num_points,
+    unsigned int num_vectors,
+    const std::function<void(const char*)>& run_impl);
+
+#endif  // GNSS_SDR_VOLK_GNSSSDR_KERNEL_TUNING_H
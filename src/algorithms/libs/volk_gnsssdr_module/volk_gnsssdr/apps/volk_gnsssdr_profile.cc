@@ -11,7 +11,7 @@
 #include "kernel_tests.h"                       // for init_test_list
 #include "qa_utils.h"                           // for volk_gnsssdr_test_results_t
 #include "volk_gnsssdr/volk_gnsssdr_complex.h"  // for lv_32fc_t
-#include "volk_gnsssdr/volk_gnsssdr_prefs.h"    // for volk_gnsssdr_get_config_path
+#include "volk_gnsssdr/volk_gnsssdr_prefs.h"    // for volk_gnsssdr_get_config_path, volk_gnsssdr_shape_pref_t
 #include "volk_gnsssdr_option_helpers.h"        // for option_list, option_t
 #if HAS_STD_FILESYSTEM
 #if HAS_STD_FILESYSTEM_EXPERIMENTAL
@@ -25,9 +25,11 @@
 #include <boost/filesystem/path_traits.hpp>  // for filesystem
 #endif
 #include <cstddef>     // for size_t
+#include <cstdlib>     // for atoi
 #include <fstream>     // IWYU pragma: keep
 #include <iostream>    // for operator<<, basic_ostream
 #include <map>         // for map, map<>::iterator
+#include <sstream>     // for stringstream
 #include <sys/stat.h>  // for stat
 #include <utility>     // for pair
 #include <vector>      // for vector, vector<>::const_..
@@ -57,6 +59,8 @@ std::string json_filename("");
 void set_json(std::string val) { json_filename = val; }
 std::string volk_config_path("");
 void set_volk_config(std::string val) { volk_config_path = val; }
+std::string shape_vlens("");
+void set_shape_vlens(std::string val) { shape_vlens = val; }
 
 int main(int argc, char *argv[])
 {
@@ -70,6 +74,7 @@ int main(int argc, char *argv[])
     profile_options.add((option_t("dry-run", "n", "Dry run. Respect other options, but don't write to file", set_dryrun)));
     profile_options.add((option_t("json", "j", "Write results to JSON file named as argument value", set_json)));
     profile_options.add((option_t("path", "p", "Specify the volk_config path", set_volk_config)));
+    profile_options.add((option_t("shape-vlens", "s", "Profile each comma-separated vector length and write volk_gnsssdr_shape_config", set_shape_vlens)));
 
     try
         {
@@ -88,6 +93,11 @@ int main(int argc, char *argv[])
                     return 0;
                 }
         }
+    if (shape_vlens != "")
+        {
+            return profile_shapes();
+        }
+
     // Adding program options
     std::ofstream json_file;
     std::string config_file;
@@ -183,6 +193,90 @@ int main(int argc, char *argv[])
 }
 
 
+int profile_shapes()
+{
+    // Each vector length is profiled on its own and stored as the preferred
+    // implementation for its num_points bucket. The puppets fix the number of
+    // vectors, so the entries apply to any number of vectors.
+    std::stringstream vlens(shape_vlens);
+    std::string vlen_str;
+    while (std::getline(vlens, vlen_str, ','))
+        {
+            const int vlen = std::atoi(vlen_str.c_str());
+            if (vlen <= 0)
+                {
+                    std::cerr << "Invalid vector length " << vlen_str << '\n';
+                    return 1;
+                }
+            test_params.set_vlen(static_cast<unsigned int>(vlen));
+            std::vector<volk_gnsssdr_test_case_t> test_cases = init_test_list(test_params);
+            std::vector<volk_gnsssdr_test_results_t> results;
+            for (auto &test_case : test_cases)
+                {
+                    if (test_case.name().find(test_params.kernel_regex()) == std::string::npos)
+                        {
+                            continue;
+                        }
+                    try
+                        {
+                            run_volk_gnsssdr_tests(test_case.desc(), test_case.kernel_ptr(), test_case.name(),
+                                test_case.test_parameters(), &results, test_case.puppet_master_name());
+                        }
+                    catch (std::string &error)
+                        {
+                            std::cerr << "Caught Exception in 'run_volk_gnsssdr_tests': " << error << '\n';
+                        }
+                }
+            if (!dry_run)
+                {
+                    write_shape_results(&results, static_cast<unsigned int>(vlen));
+                }
+        }
+
+    if (dry_run)
+        {
+            std::cout << "Warning: this was a dry-run. Shape config not generated\n";
+        }
+    return 0;
+}
+
+
+void write_shape_results(const std::vector<volk_gnsssdr_test_results_t> *results, unsigned int vlen)
+{
+    char path[1024];
+    volk_gnsssdr_get_shape_config_path(path, false);
+    const fs::path config_path(path);
+    if (!fs::exists(config_path.parent_path()))
+        {
+            try
+                {
+                    std::cout << "Creating " << config_path.parent_path() << " ...\n";
+                    fs::create_directories(config_path.parent_path());
+                }
+            catch (...)
+                {
+                    std::cerr << "ERROR: Could not create folder " << config_path.parent_path() << '\n';
+                    return;
+                }
+        }
+
+    std::cout << "Updating " << path << " for vector length " << vlen << " ...\n";
+    for (const auto &result : *results)
+        {
+            volk_gnsssdr_shape_pref_t pref{};
+            result.config_name.copy(pref.name, sizeof(pref.name) - 1);
+            result.best_arch_u.copy(pref.impl_u, sizeof(pref.impl_u) - 1);
+            pref.num_points_bucket = volk_gnsssdr_num_points_bucket(vlen);
+            pref.num_vectors = 0;
+            if (!volk_gnsssdr_store_shape_preference(&pref))
+                {
+                    std::cout << "Error writing file " << path << '\n';
+                    return;
+                }
+        }
+}
+
+
 void read_results(std::vector<volk_gnsssdr_test_results_t> *results)
 {
     char path[1024];
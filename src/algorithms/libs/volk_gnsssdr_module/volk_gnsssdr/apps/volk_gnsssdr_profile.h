@@ -27,3 +27,5 @@ void read_results(std::vector<volk_gnsssdr_test_results_t> *results, std::string
 void write_results(const std::vector<volk_gnsssdr_test_results_t> *results, bool update_result);
 void write_results(const std::vector<volk_gnsssdr_test_results_t> *results, bool update_result, const std::string path);
 void write_json(std::ofstream &json_file, std::vector<volk_gnsssdr_test_results_t> results);
+int profile_shapes();
+void write_shape_results(const std::vector<volk_gnsssdr_test_results_t> *results, unsigned int vlen);
@@ -1,7 +1,7 @@
 /*!
  * \file volk_gnsssdr_alloc.h
  * \author Carles Fernandez, 2019. cfernandez(at)cttc.es
- * \brief C++11 allocator using volk_gnsssdr_malloc and volk_gnsssdr_free.
+ * \brief C++11 allocator using volk_gnsssdr_malloc_sized and volk_gnsssdr_free_sized.
  * Based on https://github.com/gnuradio/volk/pull/284/ by @hcab14
  *
  * Copyright (C) 2010-2019 (see AUTHORS file for a list of contributors)
@@ -20,15 +20,18 @@
 #include <cstdlib>
 #include <limits>
 #include <new>
+#include <string>
 #include <vector>
 
 namespace volk_gnsssdr
 {
 /*!
- * \brief C++11 allocator using volk_gnsssdr_malloc and volk_gnsssdr_free
+ * \brief C++11 allocator using volk_gnsssdr_malloc_sized and volk_gnsssdr_free_sized
  *
  * \details
  *   adapted from https://en.cppreference.com/w/cpp/named_req/Alloc
+ *   Large allocations follow volk_gnsssdr_set_page_mode, and are accounted to
+ *   the subsystem set with volk_gnsssdr::alloc_subsystem_scope.
  */
 template <class T>
 struct alloc
@@ -44,13 +47,13 @@ struct alloc
     {
         if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) throw std::bad_alloc();
 
-        if (auto p = static_cast<T*>(volk_gnsssdr_malloc(n * sizeof(T), volk_gnsssdr_get_alignment())))
+        if (auto p = static_cast<T*>(volk_gnsssdr_malloc_sized(n * sizeof(T), volk_gnsssdr_get_alignment())))
             return p;
 
         throw std::bad_alloc();
     }
 
-    void deallocate(T* p, std::size_t) noexcept { volk_gnsssdr_free(p); }
+    void deallocate(T* p, std::size_t n) noexcept { volk_gnsssdr_free_sized(p, n * sizeof(T)); }
 };
 
 template <class T, class U>
@@ -70,6 +73,33 @@ bool operator!=(alloc<T> const&, alloc<U> const&) { return false; }
 template <class T>
 using vector = std::vector<T, alloc<T> >;
 
+
+/*!
+ * \brief Accounts the large allocations made by the calling thread to
+ * \p subsystem while in scope
+ *
+ * \details
+ * example code:
+ *   volk_gnsssdr::alloc_subsystem_scope scope("Tracking");
+ *   volk_gnsssdr::vector<float> v(100000); // accounted to "Tracking"
+ */
+class alloc_subsystem_scope
+{
+public:
+    explicit alloc_subsystem_scope(const std::string& subsystem) : d_previous(volk_gnsssdr_get_alloc_subsystem())
+    {
+        volk_gnsssdr_set_alloc_subsystem(subsystem.c_str());
+    }
+
+    ~alloc_subsystem_scope() { volk_gnsssdr_set_alloc_subsystem(d_previous.c_str()); }
+
+    alloc_subsystem_scope(const alloc_subsystem_scope&) = delete;
+    alloc_subsystem_scope& operator=(const alloc_subsystem_scope&) = delete;
+
+private:
+    std::string d_previous;
+};
+
 }  // namespace volk_gnsssdr
 
 #endif  // INCLUDED_VOLK_GNSSSDR_ALLOC_H
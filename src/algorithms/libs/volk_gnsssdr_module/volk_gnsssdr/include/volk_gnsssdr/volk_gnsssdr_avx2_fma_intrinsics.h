@@ -0,0 +1,85 @@
+/*!
+ * \file volk_gnsssdr_avx2_fma_intrinsics.h
+ * \brief Holds AVX2 and FMA intrinsics of intrinsics.
+ * They should be used in VOLK kernels to avoid copy-paste.
+ *
+ * Copyright (C) 2010-2020 (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software-defined Global Navigation Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#ifndef INCLUDED_VOLK_VOLK_AVX2_FMA_INTRINSICS_H
+#define INCLUDED_VOLK_VOLK_AVX2_FMA_INTRINSICS_H
+#include <immintrin.h>
+#include <volk_gnsssdr/volk_gnsssdr_nco.h>
+
+static inline __m256
+_mm256_complexmul_fma_ps(__m256 x, __m256 y)
+{
+    __m256 yl, yh, tmp2;
+    yl = _mm256_moveldup_ps(y);              // Load yl with cr,cr,dr,dr ...
+    yh = _mm256_movehdup_ps(y);              // Load yh with ci,ci,di,di ...
+    tmp2 = _mm256_shuffle_ps(x, x, 0xB1);    // Re-arrange x to be ai,ar,bi,br ...
+    tmp2 = _mm256_mul_ps(tmp2, yh);          // tmp2 = ai*ci,ar*ci,bi*di,br*di ...
+    return _mm256_fmaddsub_ps(x, yl, tmp2);  // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di
+}
+
+static inline __m256
+_mm256_complexnormalise_fma_ps(__m256 z)
+{
+    __m256 tmp1 = _mm256_mul_ps(z, z);                                // zr^2, zi^2 ...
+    tmp1 = _mm256_add_ps(tmp1, _mm256_shuffle_ps(tmp1, tmp1, 0xB1));  // |z|^2, |z|^2 ...
+    return _mm256_div_ps(z, _mm256_sqrt_ps(tmp1));
+}
+
+static inline __m256i
+_mm256_code_chip_index_fma_ps(__m256 code_phase, __m256 code_length, __m256 inv_code_length)
+{
+    // Inside [0, code_length) truncation is the floor and no wrap is needed,
+    // which is the case for almost every block of a one code period integration
+    const __m256 zeros = _mm256_setzero_ps();
+    if (_mm256_movemask_ps(_mm256_or_ps(_mm256_cmp_ps(code_phase, zeros, _CMP_LT_OS), _mm256_cmp_ps(code_phase, code_length, _CMP_GE_OS))) != 0)
+        {
+            __m256 cTrunc;
+            code_phase = _mm256_floor_ps(code_phase);
+            // fmod, with the remainder brought back into [0, code_length)
+            cTrunc = _mm256_round_ps(_mm256_mul_ps(code_phase, inv_code_length), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            code_phase = _mm256_fnmadd_ps(cTrunc, code_length, code_phase);
+            code_phase = _mm256_add_ps(code_phase, _mm256_and_ps(code_length, _mm256_cmp_ps(code_phase, zeros, _CMP_LT_OS)));
+            code_phase = _mm256_sub_ps(code_phase, _mm256_and_ps(code_length, _mm256_cmp_ps(code_phase, code_length, _CMP_GE_OS)));
+        }
+    return _mm256_cvttps_epi32(code_phase);
+}
+
+static inline void
+_mm256_nco_phasors_fma_ps(__m256i phase_hi, __m256* z0, __m256* z1)
+{
+    // Unit phasors of 8 NCO phases (upper 32 bits), see volk_gnsssdr_nco_phasor()
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i two = _mm256_set1_epi32(2);
+    const __m256i q = _mm256_srli_epi32(_mm256_add_epi32(phase_hi, _mm256_set1_epi32(0x20000000)), 30);
+    const __m256 x = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(phase_hi, _mm256_slli_epi32(q, 30))), _mm256_set1_ps(VOLK_GNSSSDR_NCO_RAD_PER_UNIT));
+    const __m256 z = _mm256_mul_ps(x, x);
+    __m256 s, c, cq, sq, lo, hi;
+    s = _mm256_fmadd_ps(z, _mm256_set1_ps(VOLK_GNSSSDR_NCO_SIN_C3), _mm256_set1_ps(VOLK_GNSSSDR_NCO_SIN_C2));
+    s = _mm256_fmadd_ps(z, s, _mm256_set1_ps(VOLK_GNSSSDR_NCO_SIN_C1));
+    s = _mm256_fmadd_ps(_mm256_mul_ps(x, z), s, x);
+    c = _mm256_fmadd_ps(z, _mm256_set1_ps(VOLK_GNSSSDR_NCO_COS_C3), _mm256_set1_ps(VOLK_GNSSSDR_NCO_COS_C2));
+    c = _mm256_fmadd_ps(z, c, _mm256_set1_ps(VOLK_GNSSSDR_NCO_COS_C1));
+    c = _mm256_fmadd_ps(_mm256_mul_ps(z, z), c, _mm256_fnmadd_ps(_mm256_set1_ps(0.5f), z, _mm256_set1_ps(1.0f)));
+    // Quadrants 1 and 3 swap sin and cos, then the signs follow the quadrant
+    const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, one), one));
+    cq = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, one), two), 30)));
+    sq = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, two), 30)));
+    lo = _mm256_unpacklo_ps(cq, sq);  // c0 s0 c1 s1 c4 s4 c5 s5
+    hi = _mm256_unpackhi_ps(cq, sq);  // c2 s2 c3 s3 c6 s6 c7 s7
+    *z0 = _mm256_permute2f128_ps(lo, hi, 0x20);
+    *z1 = _mm256_permute2f128_ps(lo, hi, 0x31);
+}
+
+#endif /* INCLUDED_VOLK_VOLK_AVX2_FMA_INTRINSICS_H */
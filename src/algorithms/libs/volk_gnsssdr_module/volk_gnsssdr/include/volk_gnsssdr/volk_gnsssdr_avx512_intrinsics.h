@@ -0,0 +1,95 @@
+/*!
+ * \file volk_gnsssdr_avx512_intrinsics.h
+ * \brief Holds AVX-512F intrinsics of intrinsics.
+ * They should be used in VOLK kernels to avoid copy-paste.
+ *
+ * Copyright (C) 2010-2020 (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software-defined Global Navigation Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#ifndef INCLUDED_VOLK_VOLK_AVX512_INTRINSICS_H
+#define INCLUDED_VOLK_VOLK_AVX512_INTRINSICS_H
+#include <immintrin.h>
+#include <volk_gnsssdr/volk_gnsssdr_nco.h>
+
+static inline __m512
+_mm512_complexmul_ps(__m512 x, __m512 y)
+{
+    __m512 yl, yh, tmp2;
+    yl = _mm512_moveldup_ps(y);              // Load yl with cr,cr,dr,dr ...
+    yh = _mm512_movehdup_ps(y);              // Load yh with ci,ci,di,di ...
+    tmp2 = _mm512_shuffle_ps(x, x, 0xB1);    // Re-arrange x to be ai,ar,bi,br ...
+    tmp2 = _mm512_mul_ps(tmp2, yh);          // tmp2 = ai*ci,ar*ci,bi*di,br*di ...
+    return _mm512_fmaddsub_ps(x, yl, tmp2);  // ar*cr-ai*ci, ai*cr+ar*ci, br*dr-bi*di, bi*dr+br*di
+}
+
+static inline __m512
+_mm512_complexnormalise_ps(__m512 z)
+{
+    __m512 tmp1 = _mm512_mul_ps(z, z);                                // zr^2, zi^2 ...
+    tmp1 = _mm512_add_ps(tmp1, _mm512_shuffle_ps(tmp1, tmp1, 0xB1));  // |z|^2, |z|^2 ...
+    return _mm512_div_ps(z, _mm512_sqrt_ps(tmp1));
+}
+
+static inline __m512
+_mm512_negate_real_ps(__m512 x)
+{
+    return _mm512_mask_sub_ps(x, 0x5555, _mm512_setzero_ps(), x);  // -xr, xi, -yr, yi ...
+}
+
+static inline __m512i
+_mm512_code_chip_index_ps(__m512 code_phase, __m512 code_length, __m512 inv_code_length)
+{
+    // Inside [0, code_length) truncation is the floor and no wrap is needed,
+    // which is the case for almost every block of a one code period integration
+    const __m512 zeros = _mm512_setzero_ps();
+    if ((_mm512_cmp_ps_mask(code_phase, zeros, _CMP_LT_OS) | _mm512_cmp_ps_mask(code_phase, code_length, _CMP_GE_OS)) != 0)
+        {
+            __m512 cTrunc;
+            code_phase = _mm512_roundscale_ps(code_phase, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+            // fmod, with the remainder brought back into [0, code_length)
+            cTrunc = _mm512_roundscale_ps(_mm512_mul_ps(code_phase, inv_code_length), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            code_phase = _mm512_fnmadd_ps(cTrunc, code_length, code_phase);
+            code_phase = _mm512_mask_add_ps(code_phase, _mm512_cmp_ps_mask(code_phase, zeros, _CMP_LT_OS), code_phase, code_length);
+            code_phase = _mm512_mask_sub_ps(code_phase, _mm512_cmp_ps_mask(code_phase, code_length, _CMP_GE_OS), code_phase, code_length);
+        }
+    return _mm512_cvttps_epi32(code_phase);
+}
+
+static inline void
+_mm512_nco_phasors_ps(__m512i phase_hi, __m512* z0, __m512* z1)
+{
+    // Unit phasors of 16 NCO phases (upper 32 bits), see volk_gnsssdr_nco_phasor()
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i two = _mm512_set1_epi32(2);
+    const __m512i q = _mm512_srli_epi32(_mm512_add_epi32(phase_hi, _mm512_set1_epi32(0x20000000)), 30);
+    const __m512 x = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_sub_epi32(phase_hi, _mm512_slli_epi32(q, 30))), _mm512_set1_ps(VOLK_GNSSSDR_NCO_RAD_PER_UNIT));
+    const __m512 z = _mm512_mul_ps(x, x);
+    // 128 bit blocks of the unpacked registers, in sample order
+    const __m512i lo_blocks = _mm512_setr_epi32(0, 1, 2, 3, 16, 17, 18, 19, 4, 5, 6, 7, 20, 21, 22, 23);
+    const __m512i hi_blocks = _mm512_setr_epi32(8, 9, 10, 11, 24, 25, 26, 27, 12, 13, 14, 15, 28, 29, 30, 31);
+    __m512 s, c, cq, sq, lo, hi;
+    __mmask16 swap;
+    s = _mm512_fmadd_ps(z, _mm512_set1_ps(VOLK_GNSSSDR_NCO_SIN_C3), _mm512_set1_ps(VOLK_GNSSSDR_NCO_SIN_C2));
+    s = _mm512_fmadd_ps(z, s, _mm512_set1_ps(VOLK_GNSSSDR_NCO_SIN_C1));
+    s = _mm512_fmadd_ps(_mm512_mul_ps(x, z), s, x);
+    c = _mm512_fmadd_ps(z, _mm512_set1_ps(VOLK_GNSSSDR_NCO_COS_C3), _mm512_set1_ps(VOLK_GNSSSDR_NCO_COS_C2));
+    c = _mm512_fmadd_ps(z, c, _mm512_set1_ps(VOLK_GNSSSDR_NCO_COS_C1));
+    c = _mm512_fmadd_ps(_mm512_mul_ps(z, z), c, _mm512_fnmadd_ps(_mm512_set1_ps(0.5f), z, _mm512_set1_ps(1.0f)));
+    // Quadrants 1 and 3 swap sin and cos, then the signs follow the quadrant
+    swap = _mm512_test_epi32_mask(q, one);
+    cq = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_mask_blend_ps(swap, c, s)), _mm512_slli_epi32(_mm512_and_si512(_mm512_add_epi32(q, one), two), 30)));
+    sq = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_mask_blend_ps(swap, s, c)), _mm512_slli_epi32(_mm512_and_si512(q, two), 30)));
+    lo = _mm512_unpacklo_ps(cq, sq);
+    hi = _mm512_unpackhi_ps(cq, sq);
+    *z0 = _mm512_permutex2var_ps(lo, lo_blocks, hi);
+    *z1 = _mm512_permutex2var_ps(lo, hi_blocks, hi);
+}
+
+#endif /* INCLUDED_VOLK_VOLK_AVX512_INTRINSICS_H */
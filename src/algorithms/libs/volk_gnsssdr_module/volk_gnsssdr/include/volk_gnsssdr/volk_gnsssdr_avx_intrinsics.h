@@ -17,6 +17,7 @@
 #ifndef INCLUDED_VOLK_VOLK_AVX_INTRINSICS_H
 #define INCLUDED_VOLK_VOLK_AVX_INTRINSICS_H
 #include <immintrin.h>
+#include <volk_gnsssdr/volk_gnsssdr_nco.h>
 
 static inline __m256
 _mm256_complexmul_ps(__m256 x, __m256 y)
@@ -70,4 +71,36 @@ _mm256_magnitude_ps(__m256 cplxValue1, __m256 cplxValue2)
     return _mm256_sqrt_ps(_mm256_magnitudesquared_ps(cplxValue1, cplxValue2));
 }
 
+static inline void
+_mm256_nco_phasors_ps(__m256i phase_hi, __m256* z0, __m256* z1)
+{
+    // Unit phasors of 8 NCO phases (upper 32 bits), see volk_gnsssdr_nco_phasor().
+    // AVX has no 256 bit integer arithmetic, so the quadrants are computed on each half.
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i two = _mm_set1_epi32(2);
+    const __m128i half_quadrant = _mm_set1_epi32(0x20000000);
+    const __m128i phase_lo4 = _mm256_castsi256_si128(phase_hi);
+    const __m128i phase_hi4 = _mm256_extractf128_si256(phase_hi, 1);
+    const __m128i q_lo4 = _mm_srli_epi32(_mm_add_epi32(phase_lo4, half_quadrant), 30);
+    const __m128i q_hi4 = _mm_srli_epi32(_mm_add_epi32(phase_hi4, half_quadrant), 30);
+    const __m256 x = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(_mm_sub_epi32(phase_lo4, _mm_slli_epi32(q_lo4, 30))), _mm_sub_epi32(phase_hi4, _mm_slli_epi32(q_hi4, 30)), 1)), _mm256_set1_ps(VOLK_GNSSSDR_NCO_RAD_PER_UNIT));
+    const __m256 swap = _mm256_castsi256_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(_mm_cmpeq_epi32(_mm_and_si128(q_lo4, one), one)), _mm_cmpeq_epi32(_mm_and_si128(q_hi4, one), one), 1));
+    const __m256 cos_sign = _mm256_castsi256_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q_lo4, one), two), 30)), _mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q_hi4, one), two), 30), 1));
+    const __m256 sin_sign = _mm256_castsi256_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(_mm_slli_epi32(_mm_and_si128(q_lo4, two), 30)), _mm_slli_epi32(_mm_and_si128(q_hi4, two), 30), 1));
+    const __m256 z = _mm256_mul_ps(x, x);
+    __m256 s, c, cq, sq, lo, hi;
+    s = _mm256_add_ps(_mm256_mul_ps(z, _mm256_set1_ps(VOLK_GNSSSDR_NCO_SIN_C3)), _mm256_set1_ps(VOLK_GNSSSDR_NCO_SIN_C2));
+    s = _mm256_add_ps(_mm256_mul_ps(z, s), _mm256_set1_ps(VOLK_GNSSSDR_NCO_SIN_C1));
+    s = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(x, z), s), x);
+    c = _mm256_add_ps(_mm256_mul_ps(z, _mm256_set1_ps(VOLK_GNSSSDR_NCO_COS_C3)), _mm256_set1_ps(VOLK_GNSSSDR_NCO_COS_C2));
+    c = _mm256_add_ps(_mm256_mul_ps(z, c), _mm256_set1_ps(VOLK_GNSSSDR_NCO_COS_C1));
+    c = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(z, z), c), _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_set1_ps(0.5f), z)));
+    cq = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), cos_sign);
+    sq = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), sin_sign);
+    lo = _mm256_unpacklo_ps(cq, sq);  // c0 s0 c1 s1 c4 s4 c5 s5
+    hi = _mm256_unpackhi_ps(cq, sq);  // c2 s2 c3 s3 c6 s6 c7 s7
+    *z0 = _mm256_permute2f128_ps(lo, hi, 0x20);
+    *z1 = _mm256_permute2f128_ps(lo, hi, 0x31);
+}
+
 #endif /* INCLUDE_VOLK_VOLK_AVX_INTRINSICS_H_ */
@@ -32,6 +32,53 @@
 #define __VOLK_GNSSSDR_PREFETCH_LOCALITY(addr, rw, locality)
 #endif
 
+//
+// Evaluates call, in which taps stands for num_a_vectors, with taps set to a
+// compile-time constant for the usual tap layouts: prompt (1), E/P/L (3),
+// E/P/L plus data prompt (4), VE/E/P/L/VL (5) and VE/E/P/L/VL plus data
+// prompt (6). Once the called implementation is inlined, its loops over taps
+// are unrolled and the per tap accumulators are kept in registers.
+//
+#define __VOLK_GNSSSDR_SPECIALIZE_TAPS(num_a_vectors, call) \
+    switch (num_a_vectors)                                  \
+        {                                                   \
+        case 1:                                             \
+            {                                               \
+                const int taps = 1;                         \
+                call;                                       \
+                break;                                      \
+            }                                               \
+        case 3:                                             \
+            {                                               \
+                const int taps = 3;                         \
+                call;                                       \
+                break;                                      \
+            }                                               \
+        case 4:                                             \
+            {                                               \
+                const int taps = 4;                         \
+                call;                                       \
+                break;                                      \
+            }                                               \
+        case 5:                                             \
+            {                                               \
+                const int taps = 5;                         \
+                call;                                       \
+                break;                                      \
+            }                                               \
+        case 6:                                             \
+            {                                               \
+                const int taps = 6;                         \
+                call;                                       \
+                break;                                      \
+            }                                               \
+        default:                                            \
+            {                                               \
+                const int taps = num_a_vectors;             \
+                call;                                       \
+            }                                               \
+        }
+
 #ifndef INCLUDED_LIBVOLK_COMMON_H
 #define INCLUDED_LIBVOLK_COMMON_H
 
@@ -62,6 +62,83 @@ VOLK_API void *volk_gnsssdr_malloc(size_t size, size_t alignment);
  */
 VOLK_API void volk_gnsssdr_free(void *aptr);
 
+
+/*!
+ * \brief Backing store of the large allocations made with volk_gnsssdr_malloc_sized.
+ */
+typedef enum
+{
+    VOLK_GNSSSDR_PAGES_DEFAULT = 0,       /*!< volk_gnsssdr_malloc */
+    VOLK_GNSSSDR_PAGES_TRANSPARENT_HUGE,  /*!< 2 MiB aligned mappings advised with MADV_HUGEPAGE */
+    VOLK_GNSSSDR_PAGES_EXPLICIT_HUGE      /*!< MAP_HUGETLB mappings, falling back to transparent huge pages */
+} volk_gnsssdr_page_mode_t;
+
+/*!
+ * \brief Allocations of at least this number of bytes are served by the
+ * huge page pools and accounted per subsystem.
+ */
+#define VOLK_GNSSSDR_LARGE_ALLOC_MIN_BYTES 65536
+
+
+/*!
+ * \brief Selects the backing store of the large allocations made from now on.
+ *
+ * \details
+ * The initial mode is read from the VOLK_GNSSSDR_HUGE_PAGES environment
+ * variable ("transparent" or "explicit"), and defaults to
+ * VOLK_GNSSSDR_PAGES_DEFAULT. Huge pages are only available on Linux; on other
+ * platforms the mode is ignored.
+ * Allocations between VOLK_GNSSSDR_LARGE_ALLOC_MIN_BYTES and 1 MiB are carved
+ * from 2 MiB huge pages, larger ones get their own mapping. Freed blocks are
+ * kept in per NUMA node pools and reused by the threads running on that node.
+ */
+VOLK_API void volk_gnsssdr_set_page_mode(volk_gnsssdr_page_mode_t mode);
+
+VOLK_API volk_gnsssdr_page_mode_t volk_gnsssdr_get_page_mode(void);
+
+
+/*!
+ * \brief Sets the subsystem (e.g. "Tracking") that the large allocations made by
+ * the calling thread are accounted to. At most 31 characters are kept.
+ * NULL restores the default subsystem, "Unassigned".
+ */
+VOLK_API void volk_gnsssdr_set_alloc_subsystem(const char *subsystem);
+
+VOLK_API const char *volk_gnsssdr_get_alloc_subsystem(void);
+
+
+/*!
+ * \brief Allocates \p size bytes aligned to \p alignment. Allocations of at
+ * least VOLK_GNSSSDR_LARGE_ALLOC_MIN_BYTES follow the page mode and are
+ * accounted to the subsystem of the calling thread.
+ *
+ * \details
+ * Memory allocated with volk_gnsssdr_malloc_sized must be released with
+ * volk_gnsssdr_free_sized and the same \p size. It is used by volk_gnsssdr::alloc.
+ */
+VOLK_API void *volk_gnsssdr_malloc_sized(size_t size, size_t alignment);
+
+VOLK_API void volk_gnsssdr_free_sized(void *aptr, size_t size);
+
+
+/*!
+ * \brief Large allocations of a subsystem.
+ */
+typedef struct
+{
+    char subsystem[32];
+    size_t bytes;            /*!< Bytes currently allocated */
+    size_t peak_bytes;       /*!< Maximum value of bytes */
+    size_t huge_page_bytes;  /*!< Bytes currently served from huge pages */
+    size_t allocations;      /*!< Number of live allocations */
+} volk_gnsssdr_alloc_stats_t;
+
+/*!
+ * \brief Copies the statistics of up to \p max_stats subsystems into \p stats.
+ * \return The number of subsystems with large allocations since startup.
+ */
+VOLK_API size_t volk_gnsssdr_get_alloc_stats(volk_gnsssdr_alloc_stats_t *stats, size_t max_stats);
+
 __VOLK_DECL_END
 
 #endif /* INCLUDED_VOLK_GNSSSDR_MALLOC_H */
@@ -0,0 +1,91 @@
+/*!
+ * \file volk_gnsssdr_nco.h
+ * \brief Carrier NCO shared by the rotator kernels.
+ *
+ * The carrier phase is kept in 64-bit fixed point, where the whole uint64_t
+ * range spans one cycle, so that it wraps exactly and does not drift over long
+ * integrations. The rotators are regenerated from it every
+ * VOLK_GNSSSDR_NCO_RELOAD samples with a polynomial sincos, instead of being
+ * renormalised. The SIMD versions of volk_gnsssdr_nco_phasor() are in the
+ * intrinsics headers.
+ *
+ * Copyright (C) 2010-2020 (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software-defined Global Navigation Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#ifndef INCLUDED_VOLK_GNSSSDR_NCO_H
+#define INCLUDED_VOLK_GNSSSDR_NCO_H
+
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+#include <math.h>
+#include <stdint.h>
+
+// Number of samples between two regenerations of the rotators
+#define VOLK_GNSSSDR_NCO_RELOAD 256
+
+// Polynomial approximations of sin and cos in [-pi/4, pi/4] (Cephes sinf and cosf)
+#define VOLK_GNSSSDR_NCO_SIN_C1 (-1.6666654611e-1f)
+#define VOLK_GNSSSDR_NCO_SIN_C2 (8.3321608736e-3f)
+#define VOLK_GNSSSDR_NCO_SIN_C3 (-1.9515295891e-4f)
+#define VOLK_GNSSSDR_NCO_COS_C1 (4.166664568298827e-2f)
+#define VOLK_GNSSSDR_NCO_COS_C2 (-1.388731625493765e-3f)
+#define VOLK_GNSSSDR_NCO_COS_C3 (2.443315711809948e-5f)
+#define VOLK_GNSSSDR_NCO_RAD_PER_UNIT (1.4629180792671596e-9f)  // 2 pi / 2^32
+
+
+//! Converts a phase in radians to the NCO fixed point representation
+static inline uint64_t volk_gnsssdr_nco_phase_from_rad(double phase_rad)
+{
+    double cycles = phase_rad / (2.0 * 3.14159265358979323846);
+    cycles -= floor(cycles);  // [0, 1)
+    if (cycles >= 0.5)
+        {
+            cycles -= 1.0;  // [-0.5, 0.5), so that the product fits in int64_t
+        }
+    return (uint64_t)(int64_t)(cycles * 18446744073709551616.0);
+}
+
+
+//! Converts the phase of a phasor to the NCO fixed point representation
+static inline uint64_t volk_gnsssdr_nco_phase_from_phasor(lv_32fc_t phasor)
+{
+    return volk_gnsssdr_nco_phase_from_rad(atan2((double)lv_cimag(phasor), (double)lv_creal(phasor)));
+}
+
+
+//! Converts an NCO phase back to radians, in [-pi, pi)
+static inline double volk_gnsssdr_nco_phase_to_rad(uint64_t phase)
+{
+    return (double)(int64_t)phase * (2.0 * 3.14159265358979323846 / 18446744073709551616.0);
+}
+
+
+//! Unit phasor of the upper 32 bits of an NCO phase
+static inline lv_32fc_t volk_gnsssdr_nco_phasor(uint32_t phase_hi)
+{
+    // quadrant and remainder in [-pi/4, pi/4)
+    const uint32_t q = (phase_hi + 0x20000000U) >> 30;
+    const float x = (float)(int32_t)(phase_hi - (q << 30)) * VOLK_GNSSSDR_NCO_RAD_PER_UNIT;
+    const float z = x * x;
+    const float s = x + x * z * (VOLK_GNSSSDR_NCO_SIN_C1 + z * (VOLK_GNSSSDR_NCO_SIN_C2 + z * VOLK_GNSSSDR_NCO_SIN_C3));
+    const float c = 1.0f - 0.5f * z + z * z * (VOLK_GNSSSDR_NCO_COS_C1 + z * (VOLK_GNSSSDR_NCO_COS_C2 + z * VOLK_GNSSSDR_NCO_COS_C3));
+    switch (q & 3U)
+        {
+        case 0:
+            return lv_cmake(c, s);
+        case 1:
+            return lv_cmake(-s, c);
+        case 2:
+            return lv_cmake(-c, -s);
+        default:
+            return lv_cmake(s, -c);
+        }
+}
+
+#endif /* INCLUDED_VOLK_GNSSSDR_NCO_H */
@@ -29,6 +29,14 @@ typedef struct volk_gnsssdr_arch_pref
     char impl_u[128];  // best unaligned impl
 } volk_gnsssdr_arch_pref_t;
 
+typedef struct volk_gnsssdr_shape_pref
+{
+    char name[128];                  // name of the kernel
+    unsigned int num_points_bucket;  // power of two holding num_points
+    unsigned int num_vectors;        // number of vectors, 0 for any
+    char impl_u[128];                // best unaligned impl for that shape
+} volk_gnsssdr_shape_pref_t;
+
 ////////////////////////////////////////////////////////////////////////
 // get path to volk_gnsssdr_config profiling info; second arguments specifies
 // if config file should be tested on existence for reading.
@@ -41,6 +49,28 @@ VOLK_API void volk_gnsssdr_get_config_path(char *, bool);
 ////////////////////////////////////////////////////////////////////////
 VOLK_API size_t volk_gnsssdr_load_preferences(volk_gnsssdr_arch_pref_t **);
 
+////////////////////////////////////////////////////////////////////////
+// get path to volk_gnsssdr_shape_config, which holds the preferred
+// implementation per kernel, num_points bucket and number of vectors
+////////////////////////////////////////////////////////////////////////
+VOLK_API void volk_gnsssdr_get_shape_config_path(char *, bool);
+
+////////////////////////////////////////////////////////////////////////
+// smallest power of two not lower than num_points
+////////////////////////////////////////////////////////////////////////
+VOLK_API unsigned int volk_gnsssdr_num_points_bucket(unsigned int);
+
+////////////////////////////////////////////////////////////////////////
+// load the per-shape prefs; later entries override earlier ones
+////////////////////////////////////////////////////////////////////////
+VOLK_API size_t volk_gnsssdr_load_shape_preferences(volk_gnsssdr_shape_pref_t **);
+
+////////////////////////////////////////////////////////////////////////
+// add or replace a per-shape pref in volk_gnsssdr_shape_config.
+// returns false if the file cannot be written
+////////////////////////////////////////////////////////////////////////
+VOLK_API bool volk_gnsssdr_store_shape_preference(const volk_gnsssdr_shape_pref_t *);
+
 __VOLK_DECL_END
 
 #endif /* INCLUDED_VOLK_GNSSSDR_PREFS_H */
@@ -17,6 +17,7 @@
 #ifndef INCLUDED_VOLK_VOLK_SSE3_INTRINSICS_H
 #define INCLUDED_VOLK_VOLK_SSE3_INTRINSICS_H
 #include <pmmintrin.h>
+#include <volk_gnsssdr/volk_gnsssdr_nco.h>
 
 static inline __m128
 _mm_complexmul_ps(__m128 x, __m128 y)
@@ -52,4 +53,30 @@ _mm_magnitude_ps_sse3(__m128 cplxValue1, __m128 cplxValue2)
     return _mm_sqrt_ps(_mm_magnitudesquared_ps_sse3(cplxValue1, cplxValue2));
 }
 
+static inline void
+_mm_nco_phasors_ps(__m128i phase_hi, __m128* z0, __m128* z1)
+{
+    // Unit phasors of 4 NCO phases (upper 32 bits), see volk_gnsssdr_nco_phasor()
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i two = _mm_set1_epi32(2);
+    const __m128i q = _mm_srli_epi32(_mm_add_epi32(phase_hi, _mm_set1_epi32(0x20000000)), 30);
+    const __m128 x = _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(phase_hi, _mm_slli_epi32(q, 30))), _mm_set1_ps(VOLK_GNSSSDR_NCO_RAD_PER_UNIT));
+    const __m128 z = _mm_mul_ps(x, x);
+    __m128 s, c, swap, cq, sq;
+    s = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(VOLK_GNSSSDR_NCO_SIN_C3)), _mm_set1_ps(VOLK_GNSSSDR_NCO_SIN_C2));
+    s = _mm_add_ps(_mm_mul_ps(z, s), _mm_set1_ps(VOLK_GNSSSDR_NCO_SIN_C1));
+    s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(x, z), s), x);
+    c = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(VOLK_GNSSSDR_NCO_COS_C3)), _mm_set1_ps(VOLK_GNSSSDR_NCO_COS_C2));
+    c = _mm_add_ps(_mm_mul_ps(z, c), _mm_set1_ps(VOLK_GNSSSDR_NCO_COS_C1));
+    c = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(z, z), c), _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), z)));
+    // Quadrants 1 and 3 swap sin and cos, then the signs follow the quadrant
+    swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, one), one));
+    cq = _mm_or_ps(_mm_andnot_ps(swap, c), _mm_and_ps(swap, s));
+    sq = _mm_or_ps(_mm_andnot_ps(swap, s), _mm_and_ps(swap, c));
+    cq = _mm_xor_ps(cq, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, one), two), 30)));
+    sq = _mm_xor_ps(sq, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, two), 30)));
+    *z0 = _mm_unpacklo_ps(cq, sq);
+    *z1 = _mm_unpackhi_ps(cq, sq);
+}
+
 #endif /* INCLUDE_VOLK_VOLK_SSE3_INTRINSICS_H_ */
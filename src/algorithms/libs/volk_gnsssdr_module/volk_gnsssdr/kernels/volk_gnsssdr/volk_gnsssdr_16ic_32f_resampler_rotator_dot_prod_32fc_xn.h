@@ -0,0 +1,567 @@
+/*!
+ * \file volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn.h
+ * \brief VOLK_GNSSSDR kernel: resamples a real local code into N delayed replicas
+ * on the fly, multiplies them by a common 16 bits short complex vector, phase rotated,
+ * and accumulates the results in N float complex outputs.
+ *
+ * VOLK_GNSSSDR kernel that reads the input samples as 16 bits short complex values and
+ * widens them to float only inside the registers, so the sample stream keeps
+ * its narrow width in memory. Apart from that it works as
+ * volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn.
+ * It is optimized to perform the N tap correlation process in GNSS receivers.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn
+ *
+ * \b Overview
+ *
+ * Rotates the reference 16 bits short complex vector, multiplies it by an arbitrary number of
+ * delayed replicas of a real local code, resampled on the fly, accumulates the
+ * results and stores them in the output vector.
+ * The rotation and the accumulation are done in single precision floating point.
+ * The carrier is generated by the fixed point NCO of volk_gnsssdr_nco.h.
+ * The code phase of sample n in tap k is
+ * code_phase_step_chips * n + code_phase_rate_step_chips * n^2 + shifts_chips[k] - rem_code_phase_chips.
+ * Each tap reads its own code, so the pilot and data codes of a signal can be
+ * correlated with a single carrier wipe-off.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn(lv_32fc_t* result, const lv_16sc_t* in_common, const double phase_inc_rad, double* phase_rad, const float** local_codes, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li in_common:                  Pointer to the vector to be rotated, multiplied and accumulated (reference vector).
+ * \li phase_inc_rad:              Phase increment per sample [rad].
+ * \li phase_rad:                  Initial phase [rad].
+ * \li local_codes:                One period of the local code of each tap, with one value per chip. All the codes have \p code_length_chips chips.
+ * \li rem_code_phase_chips:       Remnant code phase [chips].
+ * \li code_phase_step_chips:      Phase increment per sample [chips/sample].
+ * \li code_phase_rate_step_chips: Phase increment rate per sample [chips/sample^2].
+ * \li shifts_chips:               Vector with the shift of each tap [chips].
+ * \li code_length_chips:          Code length [chips].
+ * \li num_a_vectors:              Number of taps.
+ * \li num_points:                 Number of complex values to be rotated, multiplied, accumulated and stored into \p result.
+ *
+ * \b Outputs
+ * \li phase_rad:                  Final phase [rad], wrapped to [-pi, pi).
+ * \li result:                     Vector of \p num_a_vectors components with the correlation of \p in_common with each tap.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_H
+#define INCLUDED_volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_H
+
+
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr_nco.h>
+#include <math.h>
+#include <stdlib.h> /* abs */
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_generic(lv_32fc_t* result, const lv_16sc_t* in_common, const double phase_inc_rad, double* phase_rad, const float** local_codes, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    lv_32fc_t tmp32_1;
+    int local_code_chip_index;
+    int n_vec;
+    unsigned int n;
+    float code_phase;
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0, 0);
+        }
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_rad(phase_inc_rad);
+    const lv_32fc_t phase_inc = volk_gnsssdr_nco_phasor((uint32_t)(nco_step >> 32));
+    uint64_t nco_phase = volk_gnsssdr_nco_phase_from_rad(*phase_rad);
+    lv_32fc_t phase = lv_cmake(1.0f, 0.0f);
+    for (n = 0; n < num_points; n++)
+        {
+            // Regenerate the rotator from the NCO
+            if (n % VOLK_GNSSSDR_NCO_RELOAD == 0)
+                {
+                    phase = volk_gnsssdr_nco_phasor((uint32_t)(nco_phase >> 32));
+                }
+            tmp32_1 = lv_cmake((float)lv_creal(*in_common), (float)lv_cimag(*in_common)) * phase;
+            in_common++;
+            phase *= phase_inc;
+            nco_phase += nco_step;
+            code_phase = code_phase_step_chips * (float)n + code_phase_rate_step_chips * (float)(n * n);
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    local_code_chip_index = (int)floor(code_phase + shifts_chips[n_vec] - rem_code_phase_chips);
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index < 0) local_code_chip_index += (int)code_length_chips * (abs(local_code_chip_index) / code_length_chips + 1);
+                    local_code_chip_index = local_code_chip_index % code_length_chips;
+                    result[n_vec] += tmp32_1 * local_codes[n_vec][local_code_chip_index];
+                }
+        }
+    *phase_rad = volk_gnsssdr_nco_phase_to_rad(nco_phase);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <volk_gnsssdr/volk_gnsssdr_sse3_intrinsics.h>
+#include <smmintrin.h>
+static inline void volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_sse4_1_taps(lv_32fc_t* result, const lv_16sc_t* in_common, const double phase_inc_rad, double* phase_rad, const float** local_codes, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points);
+
+static inline void volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_sse4_1(lv_32fc_t* result, const lv_16sc_t* in_common, const double phase_inc_rad, double* phase_rad, const float** local_codes, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    __VOLK_GNSSSDR_SPECIALIZE_TAPS(num_a_vectors, volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_sse4_1_taps(result, in_common, phase_inc_rad, phase_rad, local_codes, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips, shifts_chips, code_length_chips, taps, num_points));
+}
+
+
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_sse4_1_taps(lv_32fc_t* result, const lv_16sc_t* in_common, const double phase_inc_rad, double* phase_rad, const float** local_codes, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int quarterPoints = num_points / 4;
+
+    const int16_t* aPtr = (const int16_t*)in_common;
+
+    lv_32fc_t wo;
+    int local_code_chip_index;
+    float code_phase;
+
+    __m128 a0Val, a1Val, codeVal;
+
+    __m128 dotProdVal0[num_a_vectors];
+    __m128 dotProdVal1[num_a_vectors];
+    __m128 shifts_chips_reg[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm_setzero_ps();
+            dotProdVal1[vec_ind] = _mm_setzero_ps();
+            shifts_chips_reg[vec_ind] = _mm_set_ps1(shifts_chips[vec_ind]);
+        }
+
+    // Code phase registers. The chip index is computed with the same operations
+    // as in the generic implementation, so that both pick the same chips.
+    const __m128 fours = _mm_set1_ps(4.0f);
+    const __m128 rem_code_phase_chips_reg = _mm_set_ps1(rem_code_phase_chips);
+    const __m128 code_phase_step_chips_reg = _mm_set_ps1(code_phase_step_chips);
+    const __m128 code_phase_rate_step_chips_reg = _mm_set_ps1(code_phase_rate_step_chips);
+    const __m128 code_length_chips_reg_f = _mm_set_ps1((float)code_length_chips);
+    const __m128 inv_code_length_chips_reg_f = _mm_set_ps1(1.0f / (float)code_length_chips);
+    const __m128 zeros = _mm_setzero_ps();
+    __m128 indexn = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+    __m128 code_phase_reg, aux, cTrunc;
+
+    __VOLK_ATTR_ALIGNED(16)
+    int local_code_chip_index_vec[4];
+
+    // Set up the carrier NCO and the complex rotators
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_rad(phase_inc_rad);
+    const uint64_t nco_phase = volk_gnsssdr_nco_phase_from_rad(*phase_rad);
+    __m128 z0 = _mm_setzero_ps(), z1 = _mm_setzero_ps();  // regenerated in the first iteration
+    __VOLK_ATTR_ALIGNED(16)
+    uint32_t lane_phase_vec[4];
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            lane_phase_vec[vec_ind] = (uint32_t)(((uint64_t)vec_ind * nco_step) >> 32);
+        }
+    const __m128i lane_phases = _mm_load_si128((__m128i*)lane_phase_vec);
+
+    const lv_32fc_t dz = volk_gnsssdr_nco_phasor((uint32_t)((4 * nco_step) >> 32));
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t phase_vec[2];
+    for (vec_ind = 0; vec_ind < 2; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+    const __m128 dz_reg = _mm_load_ps((float*)phase_vec);
+
+    for (; number < quarterPoints; number++)
+        {
+            // Regenerate the rotators from the NCO
+            if ((number % (VOLK_GNSSSDR_NCO_RELOAD / 4)) == 0)
+                {
+                    _mm_nco_phasors_ps(_mm_add_epi32(_mm_set1_epi32((int)(uint32_t)((nco_phase + (uint64_t)number * 4 * nco_step) >> 32)), lane_phases), &z0, &z1);
+                }
+
+            a0Val = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)aPtr)));
+            a1Val = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)(aPtr + 4))));
+
+            a0Val = _mm_complexmul_ps(a0Val, z0);
+            a1Val = _mm_complexmul_ps(a1Val, z1);
+
+            z0 = _mm_complexmul_ps(z0, dz_reg);
+            z1 = _mm_complexmul_ps(z1, dz_reg);
+
+            code_phase_reg = _mm_add_ps(_mm_mul_ps(code_phase_step_chips_reg, indexn), _mm_mul_ps(code_phase_rate_step_chips_reg, _mm_mul_ps(indexn, indexn)));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    aux = _mm_sub_ps(_mm_add_ps(code_phase_reg, shifts_chips_reg[vec_ind]), rem_code_phase_chips_reg);
+
+                    // Inside [0, code_length_chips) truncation is the floor and no wrap is needed,
+                    // which is the case for almost every block of a one code period integration
+                    if (_mm_movemask_ps(_mm_or_ps(_mm_cmplt_ps(aux, zeros), _mm_cmpge_ps(aux, code_length_chips_reg_f))) != 0)
+                        {
+                            // floor
+                            aux = _mm_floor_ps(aux);
+
+                            // fmod, with the remainder brought back into [0, code_length_chips)
+                            cTrunc = _mm_round_ps(_mm_mul_ps(aux, inv_code_length_chips_reg_f), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                            aux = _mm_sub_ps(aux, _mm_mul_ps(cTrunc, code_length_chips_reg_f));
+                            aux = _mm_add_ps(aux, _mm_and_ps(code_length_chips_reg_f, _mm_cmplt_ps(aux, zeros)));
+                            aux = _mm_sub_ps(aux, _mm_and_ps(code_length_chips_reg_f, _mm_cmpge_ps(aux, code_length_chips_reg_f)));
+                        }
+                    _mm_store_si128((__m128i*)local_code_chip_index_vec, _mm_cvttps_epi32(aux));
+
+                    // fetch the chips and accumulate
+                    codeVal = _mm_set_ps(local_codes[vec_ind][local_code_chip_index_vec[3]], local_codes[vec_ind][local_code_chip_index_vec[2]], local_codes[vec_ind][local_code_chip_index_vec[1]], local_codes[vec_ind][local_code_chip_index_vec[0]]);
+                    dotProdVal0[vec_ind] = _mm_add_ps(dotProdVal0[vec_ind], _mm_mul_ps(a0Val, _mm_unpacklo_ps(codeVal, codeVal)));
+                    dotProdVal1[vec_ind] = _mm_add_ps(dotProdVal1[vec_ind], _mm_mul_ps(a1Val, _mm_unpackhi_ps(codeVal, codeVal)));
+                }
+
+            indexn = _mm_add_ps(indexn, fours);
+            aPtr += 8;
+        }
+    __VOLK_ATTR_ALIGNED(16)
+    lv_32fc_t dotProductVector[2];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 2; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    number = quarterPoints * 4;
+    for (; number < num_points; number++)
+        {
+            wo = lv_cmake((float)lv_creal(in_common[number]), (float)lv_cimag(in_common[number])) * volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)number * nco_step) >> 32));
+            code_phase = code_phase_step_chips * (float)number + code_phase_rate_step_chips * (float)(number * number);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    local_code_chip_index = (int)floor(code_phase + shifts_chips[vec_ind] - rem_code_phase_chips);
+                    if (local_code_chip_index < 0) local_code_chip_index += (int)code_length_chips * (abs(local_code_chip_index) / code_length_chips + 1);
+                    local_code_chip_index = local_code_chip_index % code_length_chips;
+                    result[vec_ind] += wo * local_codes[vec_ind][local_code_chip_index];
+                }
+        }
+
+    *phase_rad = volk_gnsssdr_nco_phase_to_rad(nco_phase + (uint64_t)num_points * nco_step);
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <volk_gnsssdr/volk_gnsssdr_avx2_fma_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_avx2_fma_taps(lv_32fc_t* result, const lv_16sc_t* in_common, const double phase_inc_rad, double* phase_rad, const float** local_codes, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points);
+
+static inline void volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_avx2_fma(lv_32fc_t* result, const lv_16sc_t* in_common, const double phase_inc_rad, double* phase_rad, const float** local_codes, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    __VOLK_GNSSSDR_SPECIALIZE_TAPS(num_a_vectors, volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_avx2_fma_taps(result, in_common, phase_inc_rad, phase_rad, local_codes, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips, shifts_chips, code_length_chips, taps, num_points));
+}
+
+
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_avx2_fma_taps(lv_32fc_t* result, const lv_16sc_t* in_common, const double phase_inc_rad, double* phase_rad, const float** local_codes, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const int16_t* aPtr = (const int16_t*)in_common;
+
+    lv_32fc_t wo;
+    int local_code_chip_index;
+    float code_phase;
+
+    __m256 a0Val, a1Val, codeVal;
+
+    __m256 dotProdVal0[num_a_vectors];
+    __m256 dotProdVal1[num_a_vectors];
+    __m256 shifts_chips_reg[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm256_setzero_ps();
+            dotProdVal1[vec_ind] = _mm256_setzero_ps();
+            shifts_chips_reg[vec_ind] = _mm256_set1_ps(shifts_chips[vec_ind]);
+        }
+
+    // Code phase registers. The chip index is computed with the same operations
+    // as in the generic implementation, so that both pick the same chips.
+    const __m256 eights = _mm256_set1_ps(8.0f);
+    const __m256 rem_code_phase_chips_reg = _mm256_set1_ps(rem_code_phase_chips);
+    const __m256 code_phase_step_chips_reg = _mm256_set1_ps(code_phase_step_chips);
+    const __m256 code_phase_rate_step_chips_reg = _mm256_set1_ps(code_phase_rate_step_chips);
+    const __m256 code_length_chips_reg_f = _mm256_set1_ps((float)code_length_chips);
+    const __m256 inv_code_length_chips_reg_f = _mm256_set1_ps(1.0f / (float)code_length_chips);
+    __m256 indexn = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+    __m256 code_phase_reg, aux;
+    __m256i local_code_chip_index_reg;
+
+    // Duplicates each chip into the real and imaginary lanes
+    const __m256i lo_idx = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i hi_idx = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+    // Set up the carrier NCO and the complex rotators
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_rad(phase_inc_rad);
+    const uint64_t nco_phase = volk_gnsssdr_nco_phase_from_rad(*phase_rad);
+    __m256 z0 = _mm256_setzero_ps(), z1 = _mm256_setzero_ps();  // regenerated in the first iteration
+    __VOLK_ATTR_ALIGNED(32)
+    uint32_t lane_phase_vec[8];
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            lane_phase_vec[vec_ind] = (uint32_t)(((uint64_t)vec_ind * nco_step) >> 32);
+        }
+    const __m256i lane_phases = _mm256_load_si256((__m256i*)lane_phase_vec);
+
+    const lv_32fc_t dz = volk_gnsssdr_nco_phasor((uint32_t)((8 * nco_step) >> 32));
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[4];
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+    const __m256 dz_reg = _mm256_load_ps((float*)phase_vec);
+
+    for (; number < eighthPoints; number++)
+        {
+            // Regenerate the rotators from the NCO
+            if ((number % (VOLK_GNSSSDR_NCO_RELOAD / 8)) == 0)
+                {
+                    _mm256_nco_phasors_fma_ps(_mm256_add_epi32(_mm256_set1_epi32((int)(uint32_t)((nco_phase + (uint64_t)number * 8 * nco_step) >> 32)), lane_phases), &z0, &z1);
+                }
+
+            a0Val = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)aPtr)));
+            a1Val = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(aPtr + 8))));
+
+            a0Val = _mm256_complexmul_fma_ps(a0Val, z0);
+            a1Val = _mm256_complexmul_fma_ps(a1Val, z1);
+
+            z0 = _mm256_complexmul_fma_ps(z0, dz_reg);
+            z1 = _mm256_complexmul_fma_ps(z1, dz_reg);
+
+            code_phase_reg = _mm256_add_ps(_mm256_mul_ps(code_phase_step_chips_reg, indexn), _mm256_mul_ps(code_phase_rate_step_chips_reg, _mm256_mul_ps(indexn, indexn)));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    aux = _mm256_sub_ps(_mm256_add_ps(code_phase_reg, shifts_chips_reg[vec_ind]), rem_code_phase_chips_reg);
+                    local_code_chip_index_reg = _mm256_code_chip_index_fma_ps(aux, code_length_chips_reg_f, inv_code_length_chips_reg_f);
+
+                    // gather the chips and accumulate
+                    codeVal = _mm256_i32gather_ps(local_codes[vec_ind], local_code_chip_index_reg, 4);
+                    dotProdVal0[vec_ind] = _mm256_fmadd_ps(a0Val, _mm256_permutevar8x32_ps(codeVal, lo_idx), dotProdVal0[vec_ind]);
+                    dotProdVal1[vec_ind] = _mm256_fmadd_ps(a1Val, _mm256_permutevar8x32_ps(codeVal, hi_idx), dotProdVal1[vec_ind]);
+                }
+
+            indexn = _mm256_add_ps(indexn, eights);
+            aPtr += 16;
+        }
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm256_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    _mm256_zeroupper();
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++)
+        {
+            wo = lv_cmake((float)lv_creal(in_common[number]), (float)lv_cimag(in_common[number])) * volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)number * nco_step) >> 32));
+            code_phase = code_phase_step_chips * (float)number + code_phase_rate_step_chips * (float)(number * number);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    local_code_chip_index = (int)floor(code_phase + shifts_chips[vec_ind] - rem_code_phase_chips);
+                    if (local_code_chip_index < 0) local_code_chip_index += (int)code_length_chips * (abs(local_code_chip_index) / code_length_chips + 1);
+                    local_code_chip_index = local_code_chip_index % code_length_chips;
+                    result[vec_ind] += wo * local_codes[vec_ind][local_code_chip_index];
+                }
+        }
+
+    *phase_rad = volk_gnsssdr_nco_phase_to_rad(nco_phase + (uint64_t)num_points * nco_step);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_avx512f_taps(lv_32fc_t* result, const lv_16sc_t* in_common, const double phase_inc_rad, double* phase_rad, const float** local_codes, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points);
+
+static inline void volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_avx512f(lv_32fc_t* result, const lv_16sc_t* in_common, const double phase_inc_rad, double* phase_rad, const float** local_codes, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    __VOLK_GNSSSDR_SPECIALIZE_TAPS(num_a_vectors, volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_avx512f_taps(result, in_common, phase_inc_rad, phase_rad, local_codes, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips, shifts_chips, code_length_chips, taps, num_points));
+}
+
+
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_avx512f_taps(lv_32fc_t* result, const lv_16sc_t* in_common, const double phase_inc_rad, double* phase_rad, const float** local_codes, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, const float* shifts_chips, unsigned int code_length_chips, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const int16_t* aPtr = (const int16_t*)in_common;
+
+    lv_32fc_t wo;
+    int local_code_chip_index;
+    float code_phase;
+
+    __m512 a0Val, a1Val, codeVal;
+
+    __m512 dotProdVal0[num_a_vectors];
+    __m512 dotProdVal1[num_a_vectors];
+    __m512 shifts_chips_reg[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm512_setzero_ps();
+            dotProdVal1[vec_ind] = _mm512_setzero_ps();
+            shifts_chips_reg[vec_ind] = _mm512_set1_ps(shifts_chips[vec_ind]);
+        }
+
+    // Code phase registers. The chip index is computed with the same operations
+    // as in the generic implementation, so that both pick the same chips.
+    const __m512 sixteens = _mm512_set1_ps(16.0f);
+    const __m512 rem_code_phase_chips_reg = _mm512_set1_ps(rem_code_phase_chips);
+    const __m512 code_phase_step_chips_reg = _mm512_set1_ps(code_phase_step_chips);
+    const __m512 code_phase_rate_step_chips_reg = _mm512_set1_ps(code_phase_rate_step_chips);
+    const __m512 code_length_chips_reg_f = _mm512_set1_ps((float)code_length_chips);
+    const __m512 inv_code_length_chips_reg_f = _mm512_set1_ps(1.0f / (float)code_length_chips);
+    __m512 indexn = _mm512_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f);
+    __m512 code_phase_reg, aux;
+    __m512i local_code_chip_index_reg;
+
+    // Duplicates each chip into the real and imaginary lanes
+    const __m512i lo_idx = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i hi_idx = _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+
+    // Set up the carrier NCO and the complex rotators
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_rad(phase_inc_rad);
+    const uint64_t nco_phase = volk_gnsssdr_nco_phase_from_rad(*phase_rad);
+    __m512 z0 = _mm512_setzero_ps(), z1 = _mm512_setzero_ps();  // regenerated in the first iteration
+    __VOLK_ATTR_ALIGNED(64)
+    uint32_t lane_phase_vec[16];
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            lane_phase_vec[vec_ind] = (uint32_t)(((uint64_t)vec_ind * nco_step) >> 32);
+        }
+    const __m512i lane_phases = _mm512_load_si512((__m512i*)lane_phase_vec);
+
+    const lv_32fc_t dz = volk_gnsssdr_nco_phasor((uint32_t)((16 * nco_step) >> 32));
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_vec[8];
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+    const __m512 dz_reg = _mm512_load_ps((float*)phase_vec);
+
+    for (; number < sixteenthPoints; number++)
+        {
+            // Regenerate the rotators from the NCO
+            if ((number % (VOLK_GNSSSDR_NCO_RELOAD / 16)) == 0)
+                {
+                    _mm512_nco_phasors_ps(_mm512_add_epi32(_mm512_set1_epi32((int)(uint32_t)((nco_phase + (uint64_t)number * 16 * nco_step) >> 32)), lane_phases), &z0, &z1);
+                }
+
+            a0Val = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)aPtr)));
+            a1Val = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)(aPtr + 16))));
+
+            a0Val = _mm512_complexmul_ps(a0Val, z0);
+            a1Val = _mm512_complexmul_ps(a1Val, z1);
+
+            z0 = _mm512_complexmul_ps(z0, dz_reg);
+            z1 = _mm512_complexmul_ps(z1, dz_reg);
+
+            code_phase_reg = _mm512_add_ps(_mm512_mul_ps(code_phase_step_chips_reg, indexn), _mm512_mul_ps(code_phase_rate_step_chips_reg, _mm512_mul_ps(indexn, indexn)));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    aux = _mm512_sub_ps(_mm512_add_ps(code_phase_reg, shifts_chips_reg[vec_ind]), rem_code_phase_chips_reg);
+                    local_code_chip_index_reg = _mm512_code_chip_index_ps(aux, code_length_chips_reg_f, inv_code_length_chips_reg_f);
+
+                    // gather the chips and accumulate
+                    codeVal = _mm512_i32gather_ps(local_code_chip_index_reg, local_codes[vec_ind], 4);
+                    dotProdVal0[vec_ind] = _mm512_fmadd_ps(a0Val, _mm512_permutexvar_ps(lo_idx, codeVal), dotProdVal0[vec_ind]);
+                    dotProdVal1[vec_ind] = _mm512_fmadd_ps(a1Val, _mm512_permutexvar_ps(hi_idx, codeVal), dotProdVal1[vec_ind]);
+                }
+
+            indexn = _mm512_add_ps(indexn, sixteens);
+            aPtr += 32;
+        }
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm512_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 8; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++)
+        {
+            wo = lv_cmake((float)lv_creal(in_common[number]), (float)lv_cimag(in_common[number])) * volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)number * nco_step) >> 32));
+            code_phase = code_phase_step_chips * (float)number + code_phase_rate_step_chips * (float)(number * number);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    local_code_chip_index = (int)floor(code_phase + shifts_chips[vec_ind] - rem_code_phase_chips);
+                    if (local_code_chip_index < 0) local_code_chip_index += (int)code_length_chips * (abs(local_code_chip_index) / code_length_chips + 1);
+                    local_code_chip_index = local_code_chip_index % code_length_chips;
+                    result[vec_ind] += wo * local_codes[vec_ind][local_code_chip_index];
+                }
+        }
+
+    *phase_rad = volk_gnsssdr_nco_phase_to_rad(nco_phase + (uint64_t)num_points * nco_step);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_H */
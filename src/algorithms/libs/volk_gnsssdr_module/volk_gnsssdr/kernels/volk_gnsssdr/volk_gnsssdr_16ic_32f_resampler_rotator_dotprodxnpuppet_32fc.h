@@ -0,0 +1,102 @@
+/*!
+ * \file volk_gnsssdr_16ic_32f_resampler_rotator_dotprodxnpuppet_32fc.h
+ * \brief Volk puppet for the fused resampler and rotator dot product kernel
+ * with 16 bits short complex inputs.
+ *
+ * Volk puppet for integrating the fused resampler and rotator dot product
+ * into volk's test system
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_16ic_32f_resampler_rotator_dotprodxnpuppet_32fc_H
+#define INCLUDED_volk_gnsssdr_16ic_32f_resampler_rotator_dotprodxnpuppet_32fc_H
+
+#include "volk_gnsssdr/volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+#include <math.h>
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_16ic_32f_resampler_rotator_dotprodxnpuppet_32fc_generic(lv_32fc_t* result, const lv_16sc_t* local_code, const float* in, unsigned int num_points)
+{
+    double phase_rad = 0.25;
+    double phase_step_rad = 0.1;
+    unsigned int code_length_chips = 2046;
+    float code_phase_step_chips = ((float)(code_length_chips) + 0.1) / ((float)num_points);
+    float code_phase_rate_step_chips = 1e-8;
+    float rem_code_phase_chips = -0.234;
+    int num_a_vectors = 3;
+    float shifts_chips[3] = {-0.1, 0.0, 0.1};
+    const float* local_codes[3] = {in, in, in + 1};  // the last tap reads a second code
+
+    volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_generic(result, local_code, phase_step_rad, &phase_rad, local_codes, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+#endif  // Generic
+
+
+#ifdef LV_HAVE_SSE4_1
+static inline void volk_gnsssdr_16ic_32f_resampler_rotator_dotprodxnpuppet_32fc_u_sse4_1(lv_32fc_t* result, const lv_16sc_t* local_code, const float* in, unsigned int num_points)
+{
+    double phase_rad = 0.25;
+    double phase_step_rad = 0.1;
+    unsigned int code_length_chips = 2046;
+    float code_phase_step_chips = ((float)(code_length_chips) + 0.1) / ((float)num_points);
+    float code_phase_rate_step_chips = 1e-8;
+    float rem_code_phase_chips = -0.234;
+    int num_a_vectors = 3;
+    float shifts_chips[3] = {-0.1, 0.0, 0.1};
+    const float* local_codes[3] = {in, in, in + 1};  // the last tap reads a second code
+
+    volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_sse4_1(result, local_code, phase_step_rad, &phase_rad, local_codes, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+#endif  // SSE4.1
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void volk_gnsssdr_16ic_32f_resampler_rotator_dotprodxnpuppet_32fc_u_avx2_fma(lv_32fc_t* result, const lv_16sc_t* local_code, const float* in, unsigned int num_points)
+{
+    double phase_rad = 0.25;
+    double phase_step_rad = 0.1;
+    unsigned int code_length_chips = 2046;
+    float code_phase_step_chips = ((float)(code_length_chips) + 0.1) / ((float)num_points);
+    float code_phase_rate_step_chips = 1e-8;
+    float rem_code_phase_chips = -0.234;
+    int num_a_vectors = 3;
+    float shifts_chips[3] = {-0.1, 0.0, 0.1};
+    const float* local_codes[3] = {in, in, in + 1};  // the last tap reads a second code
+
+    volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_avx2_fma(result, local_code, phase_step_rad, &phase_rad, local_codes, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+#endif  // AVX2 && FMA
+
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_gnsssdr_16ic_32f_resampler_rotator_dotprodxnpuppet_32fc_u_avx512f(lv_32fc_t* result, const lv_16sc_t* local_code, const float* in, unsigned int num_points)
+{
+    double phase_rad = 0.25;
+    double phase_step_rad = 0.1;
+    unsigned int code_length_chips = 2046;
+    float code_phase_step_chips = ((float)(code_length_chips) + 0.1) / ((float)num_points);
+    float code_phase_rate_step_chips = 1e-8;
+    float rem_code_phase_chips = -0.234;
+    int num_a_vectors = 3;
+    float shifts_chips[3] = {-0.1, 0.0, 0.1};
+    const float* local_codes[3] = {in, in, in + 1};  // the last tap reads a second code
+
+    volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_u_avx512f(result, local_code, phase_step_rad, &phase_rad, local_codes, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips, shifts_chips, code_length_chips, num_a_vectors, num_points);
+}
+#endif  // AVX512F
+
+#endif  // INCLUDED_volk_gnsssdr_16ic_32f_resampler_rotator_dotprodxnpuppet_32fc_H
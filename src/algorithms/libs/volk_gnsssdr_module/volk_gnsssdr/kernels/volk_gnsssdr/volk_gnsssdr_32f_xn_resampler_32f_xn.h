@@ -516,6 +516,272 @@ static inline void volk_gnsssdr_32f_xn_resampler_32f_xn_u_avx(float** result, co
 #endif
 
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+static inline void volk_gnsssdr_32f_xn_resampler_32f_xn_u_avx2_fma(float** result, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_out_vectors, unsigned int num_points)
+{
+    float** _result = result;
+    const unsigned int avx_iters = num_points / 8;
+    int current_correlator_tap;
+    unsigned int n;
+    const __m256 eights = _mm256_set1_ps(8.0f);
+    const __m256 rem_code_phase_chips_reg = _mm256_set1_ps(rem_code_phase_chips);
+    const __m256 code_phase_step_chips_reg = _mm256_set1_ps(code_phase_step_chips);
+
+    int local_code_chip_index_;
+
+    const __m256 zeros = _mm256_setzero_ps();
+    const __m256 code_length_chips_reg_f = _mm256_set1_ps((float)code_length_chips);
+    const __m256 n0 = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+
+    __m256i local_code_chip_index_reg, i;
+    __m256 aux, aux2, aux3, shifts_chips_reg, c, cTrunc, base, negatives, indexn;
+
+    for (current_correlator_tap = 0; current_correlator_tap < num_out_vectors; current_correlator_tap++)
+        {
+            shifts_chips_reg = _mm256_set1_ps((float)shifts_chips[current_correlator_tap]);
+            aux2 = _mm256_sub_ps(shifts_chips_reg, rem_code_phase_chips_reg);
+            indexn = n0;
+            for (n = 0; n < avx_iters; n++)
+                {
+                    __VOLK_GNSSSDR_PREFETCH_LOCALITY(&_result[current_correlator_tap][8 * n + 7], 1, 0);
+                    aux = _mm256_fmadd_ps(code_phase_step_chips_reg, indexn, aux2);
+                    // floor
+                    aux = _mm256_floor_ps(aux);
+
+                    // fmod
+                    c = _mm256_div_ps(aux, code_length_chips_reg_f);
+                    i = _mm256_cvttps_epi32(c);
+                    cTrunc = _mm256_cvtepi32_ps(i);
+                    base = _mm256_fnmadd_ps(cTrunc, code_length_chips_reg_f, aux);
+
+                    // no negatives
+                    negatives = _mm256_cmp_ps(base, zeros, 0x01);
+                    aux3 = _mm256_and_ps(code_length_chips_reg_f, negatives);
+                    local_code_chip_index_reg = _mm256_cvttps_epi32(_mm256_add_ps(base, aux3));
+
+                    // gather the code chips
+                    _mm256_storeu_ps(&_result[current_correlator_tap][n * 8], _mm256_i32gather_ps(local_code, local_code_chip_index_reg, 4));
+                    indexn = _mm256_add_ps(indexn, eights);
+                }
+        }
+    _mm256_zeroupper();
+    for (current_correlator_tap = 0; current_correlator_tap < num_out_vectors; current_correlator_tap++)
+        {
+            for (n = avx_iters * 8; n < num_points; n++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index_ = (int)floor(code_phase_step_chips * (float)n + shifts_chips[current_correlator_tap] - rem_code_phase_chips);
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index_ < 0) local_code_chip_index_ += (int)code_length_chips * (abs(local_code_chip_index_) / code_length_chips + 1);
+                    local_code_chip_index_ = local_code_chip_index_ % code_length_chips;
+                    _result[current_correlator_tap][n] = local_code[local_code_chip_index_];
+                }
+        }
+}
+
+#endif
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <immintrin.h>
+static inline void volk_gnsssdr_32f_xn_resampler_32f_xn_a_avx2_fma(float** result, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_out_vectors, unsigned int num_points)
+{
+    float** _result = result;
+    const unsigned int avx_iters = num_points / 8;
+    int current_correlator_tap;
+    unsigned int n;
+    const __m256 eights = _mm256_set1_ps(8.0f);
+    const __m256 rem_code_phase_chips_reg = _mm256_set1_ps(rem_code_phase_chips);
+    const __m256 code_phase_step_chips_reg = _mm256_set1_ps(code_phase_step_chips);
+
+    int local_code_chip_index_;
+
+    const __m256 zeros = _mm256_setzero_ps();
+    const __m256 code_length_chips_reg_f = _mm256_set1_ps((float)code_length_chips);
+    const __m256 n0 = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+
+    __m256i local_code_chip_index_reg, i;
+    __m256 aux, aux2, aux3, shifts_chips_reg, c, cTrunc, base, negatives, indexn;
+
+    for (current_correlator_tap = 0; current_correlator_tap < num_out_vectors; current_correlator_tap++)
+        {
+            shifts_chips_reg = _mm256_set1_ps((float)shifts_chips[current_correlator_tap]);
+            aux2 = _mm256_sub_ps(shifts_chips_reg, rem_code_phase_chips_reg);
+            indexn = n0;
+            for (n = 0; n < avx_iters; n++)
+                {
+                    __VOLK_GNSSSDR_PREFETCH_LOCALITY(&_result[current_correlator_tap][8 * n + 7], 1, 0);
+                    aux = _mm256_fmadd_ps(code_phase_step_chips_reg, indexn, aux2);
+                    // floor
+                    aux = _mm256_floor_ps(aux);
+
+                    // fmod
+                    c = _mm256_div_ps(aux, code_length_chips_reg_f);
+                    i = _mm256_cvttps_epi32(c);
+                    cTrunc = _mm256_cvtepi32_ps(i);
+                    base = _mm256_fnmadd_ps(cTrunc, code_length_chips_reg_f, aux);
+
+                    // no negatives
+                    negatives = _mm256_cmp_ps(base, zeros, 0x01);
+                    aux3 = _mm256_and_ps(code_length_chips_reg_f, negatives);
+                    local_code_chip_index_reg = _mm256_cvttps_epi32(_mm256_add_ps(base, aux3));
+
+                    // gather the code chips
+                    _mm256_store_ps(&_result[current_correlator_tap][n * 8], _mm256_i32gather_ps(local_code, local_code_chip_index_reg, 4));
+                    indexn = _mm256_add_ps(indexn, eights);
+                }
+        }
+    _mm256_zeroupper();
+    for (current_correlator_tap = 0; current_correlator_tap < num_out_vectors; current_correlator_tap++)
+        {
+            for (n = avx_iters * 8; n < num_points; n++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index_ = (int)floor(code_phase_step_chips * (float)n + shifts_chips[current_correlator_tap] - rem_code_phase_chips);
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index_ < 0) local_code_chip_index_ += (int)code_length_chips * (abs(local_code_chip_index_) / code_length_chips + 1);
+                    local_code_chip_index_ = local_code_chip_index_ % code_length_chips;
+                    _result[current_correlator_tap][n] = local_code[local_code_chip_index_];
+                }
+        }
+}
+
+#endif
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+static inline void volk_gnsssdr_32f_xn_resampler_32f_xn_u_avx512f(float** result, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_out_vectors, unsigned int num_points)
+{
+    float** _result = result;
+    const unsigned int avx512_iters = num_points / 16;
+    int current_correlator_tap;
+    unsigned int n;
+    const __m512 sixteens = _mm512_set1_ps(16.0f);
+    const __m512 rem_code_phase_chips_reg = _mm512_set1_ps(rem_code_phase_chips);
+    const __m512 code_phase_step_chips_reg = _mm512_set1_ps(code_phase_step_chips);
+
+    int local_code_chip_index_;
+
+    const __m512 zeros = _mm512_setzero_ps();
+    const __m512 code_length_chips_reg_f = _mm512_set1_ps((float)code_length_chips);
+    const __m512 n0 = _mm512_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f);
+
+    __m512i local_code_chip_index_reg;
+    __m512 aux, aux2, shifts_chips_reg, c, cTrunc, base, indexn;
+    __mmask16 negatives;
+
+    for (current_correlator_tap = 0; current_correlator_tap < num_out_vectors; current_correlator_tap++)
+        {
+            shifts_chips_reg = _mm512_set1_ps((float)shifts_chips[current_correlator_tap]);
+            aux2 = _mm512_sub_ps(shifts_chips_reg, rem_code_phase_chips_reg);
+            indexn = n0;
+            for (n = 0; n < avx512_iters; n++)
+                {
+                    __VOLK_GNSSSDR_PREFETCH_LOCALITY(&_result[current_correlator_tap][16 * n + 15], 1, 0);
+                    aux = _mm512_fmadd_ps(code_phase_step_chips_reg, indexn, aux2);
+                    // floor
+                    aux = _mm512_roundscale_ps(aux, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+
+                    // fmod
+                    c = _mm512_div_ps(aux, code_length_chips_reg_f);
+                    cTrunc = _mm512_roundscale_ps(c, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                    base = _mm512_fnmadd_ps(cTrunc, code_length_chips_reg_f, aux);
+
+                    // no negatives
+                    negatives = _mm512_cmp_ps_mask(base, zeros, _CMP_LT_OS);
+                    base = _mm512_mask_add_ps(base, negatives, base, code_length_chips_reg_f);
+                    local_code_chip_index_reg = _mm512_cvttps_epi32(base);
+
+                    // gather the code chips
+                    _mm512_storeu_ps(&_result[current_correlator_tap][n * 16], _mm512_i32gather_ps(local_code_chip_index_reg, local_code, 4));
+                    indexn = _mm512_add_ps(indexn, sixteens);
+                }
+        }
+    for (current_correlator_tap = 0; current_correlator_tap < num_out_vectors; current_correlator_tap++)
+        {
+            for (n = avx512_iters * 16; n < num_points; n++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index_ = (int)floor(code_phase_step_chips * (float)n + shifts_chips[current_correlator_tap] - rem_code_phase_chips);
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index_ < 0) local_code_chip_index_ += (int)code_length_chips * (abs(local_code_chip_index_) / code_length_chips + 1);
+                    local_code_chip_index_ = local_code_chip_index_ % code_length_chips;
+                    _result[current_correlator_tap][n] = local_code[local_code_chip_index_];
+                }
+        }
+}
+
+#endif
+
+
+#ifdef LV_HAVE_AVX512F
+#include <immintrin.h>
+static inline void volk_gnsssdr_32f_xn_resampler_32f_xn_a_avx512f(float** result, const float* local_code, float rem_code_phase_chips, float code_phase_step_chips, float* shifts_chips, unsigned int code_length_chips, int num_out_vectors, unsigned int num_points)
+{
+    float** _result = result;
+    const unsigned int avx512_iters = num_points / 16;
+    int current_correlator_tap;
+    unsigned int n;
+    const __m512 sixteens = _mm512_set1_ps(16.0f);
+    const __m512 rem_code_phase_chips_reg = _mm512_set1_ps(rem_code_phase_chips);
+    const __m512 code_phase_step_chips_reg = _mm512_set1_ps(code_phase_step_chips);
+
+    int local_code_chip_index_;
+
+    const __m512 zeros = _mm512_setzero_ps();
+    const __m512 code_length_chips_reg_f = _mm512_set1_ps((float)code_length_chips);
+    const __m512 n0 = _mm512_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f);
+
+    __m512i local_code_chip_index_reg;
+    __m512 aux, aux2, shifts_chips_reg, c, cTrunc, base, indexn;
+    __mmask16 negatives;
+
+    for (current_correlator_tap = 0; current_correlator_tap < num_out_vectors; current_correlator_tap++)
+        {
+            shifts_chips_reg = _mm512_set1_ps((float)shifts_chips[current_correlator_tap]);
+            aux2 = _mm512_sub_ps(shifts_chips_reg, rem_code_phase_chips_reg);
+            indexn = n0;
+            for (n = 0; n < avx512_iters; n++)
+                {
+                    __VOLK_GNSSSDR_PREFETCH_LOCALITY(&_result[current_correlator_tap][16 * n + 15], 1, 0);
+                    aux = _mm512_fmadd_ps(code_phase_step_chips_reg, indexn, aux2);
+                    // floor
+                    aux = _mm512_roundscale_ps(aux, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+
+                    // fmod
+                    c = _mm512_div_ps(aux, code_length_chips_reg_f);
+                    cTrunc = _mm512_roundscale_ps(c, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                    base = _mm512_fnmadd_ps(cTrunc, code_length_chips_reg_f, aux);
+
+                    // no negatives
+                    negatives = _mm512_cmp_ps_mask(base, zeros, _CMP_LT_OS);
+                    base = _mm512_mask_add_ps(base, negatives, base, code_length_chips_reg_f);
+                    local_code_chip_index_reg = _mm512_cvttps_epi32(base);
+
+                    // gather the code chips
+                    _mm512_store_ps(&_result[current_correlator_tap][n * 16], _mm512_i32gather_ps(local_code_chip_index_reg, local_code, 4));
+                    indexn = _mm512_add_ps(indexn, sixteens);
+                }
+        }
+    for (current_correlator_tap = 0; current_correlator_tap < num_out_vectors; current_correlator_tap++)
+        {
+            for (n = avx512_iters * 16; n < num_points; n++)
+                {
+                    // resample code for current tap
+                    local_code_chip_index_ = (int)floor(code_phase_step_chips * (float)n + shifts_chips[current_correlator_tap] - rem_code_phase_chips);
+                    // Take into account that in multitap correlators, the shifts can be negative!
+                    if (local_code_chip_index_ < 0) local_code_chip_index_ += (int)code_length_chips * (abs(local_code_chip_index_) / code_length_chips + 1);
+                    local_code_chip_index_ = local_code_chip_index_ % code_length_chips;
+                    _result[current_correlator_tap][n] = local_code[local_code_chip_index_];
+                }
+        }
+}
+
+#endif
+
+
 #ifdef LV_HAVE_NEONV7
 #include <arm_neon.h>
 
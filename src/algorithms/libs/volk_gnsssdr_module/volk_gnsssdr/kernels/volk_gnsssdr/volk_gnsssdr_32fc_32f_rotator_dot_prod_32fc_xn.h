@@ -33,6 +33,8 @@
  * Rotates and multiplies the reference complex vector with an arbitrary number of other real vectors,
  * accumulates the results and stores them in the output vector.
  * The rotation is done at a fixed rate per sample, from an initial \p phase offset.
+ * Except for the plain generic implementation, the rotators are regenerated
+ * from the fixed point NCO of volk_gnsssdr_nco.h instead of being renormalised.
  * This function can be used for Doppler wipe-off and multiple correlator.
  *
  * <b>Dispatcher Prototype</b>
@@ -62,6 +64,7 @@
 #include <volk_gnsssdr/volk_gnsssdr.h>
 #include <volk_gnsssdr/volk_gnsssdr_complex.h>
 #include <volk_gnsssdr/volk_gnsssdr_malloc.h>
+#include <volk_gnsssdr/volk_gnsssdr_nco.h>
 #include <math.h>
 // #include <stdio.h>
 
@@ -109,7 +112,9 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_generic(lv_32f
 static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_generic_reload(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
 {
     lv_32fc_t tmp32_1, tmp32_2;
-    const unsigned int ROTATOR_RELOAD = 256;
+    const unsigned int ROTATOR_RELOAD = VOLK_GNSSSDR_NCO_RELOAD;
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_phasor(phase_inc);
+    uint64_t nco_phase = volk_gnsssdr_nco_phase_from_phasor(*phase);
     int n_vec;
     unsigned int n;
     unsigned int j;
@@ -120,6 +125,9 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_generic_reload
 
     for (n = 0; n < num_points / ROTATOR_RELOAD; n++)
         {
+            /* Regenerate phase from the NCO */
+            (*phase) = volk_gnsssdr_nco_phasor((uint32_t)(nco_phase >> 32));
+            nco_phase += ROTATOR_RELOAD * nco_step;
             for (j = 0; j < ROTATOR_RELOAD; j++)
                 {
                     tmp32_1 = *in_common++ * (*phase);
@@ -130,15 +138,9 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_generic_reload
                             result[n_vec] += tmp32_2;
                         }
                 }
-                /* Regenerate phase */
-#ifdef __cplusplus
-            (*phase) /= std::abs((*phase));
-#else
-            // (*phase) /= cabsf((*phase));
-            (*phase) /= hypotf(lv_creal(*phase), lv_cimag(*phase));
-#endif
         }
 
+    (*phase) = volk_gnsssdr_nco_phasor((uint32_t)(nco_phase >> 32));
     for (j = 0; j < num_points % ROTATOR_RELOAD; j++)
         {
             tmp32_1 = *in_common++ * (*phase);
@@ -149,6 +151,8 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_generic_reload
                     result[n_vec] += tmp32_2;
                 }
         }
+    nco_phase += (num_points % ROTATOR_RELOAD) * nco_step;
+    (*phase) = volk_gnsssdr_nco_phasor((uint32_t)(nco_phase >> 32));
 }
 
 #endif /* LV_HAVE_GENERIC */
@@ -156,7 +160,15 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_generic_reload
 #ifdef LV_HAVE_AVX
 #include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
 #include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points);
+
 static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    __VOLK_GNSSSDR_SPECIALIZE_TAPS(num_a_vectors, volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx_taps(result, in_common, phase_inc, phase, in_a, taps, num_points));
+}
+
+
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
 {
     unsigned int number = 0;
     int vec_ind = 0;
@@ -170,7 +182,6 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx(lv_32fc_
             bPtr[vec_ind] = in_a[vec_ind];
         }
 
-    lv_32fc_t _phase = (*phase);
     lv_32fc_t wo;
 
     __m256 a0Val, a1Val, a2Val, a3Val;
@@ -191,37 +202,37 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx(lv_32fc_
             dotProdVal3[vec_ind] = _mm256_setzero_ps();
         }
 
-    // Set up the complex rotator
-    __m256 z0, z1, z2, z3;
+    // Set up the carrier NCO and the complex rotators
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_phasor(phase_inc);
+    const uint64_t nco_phase = volk_gnsssdr_nco_phase_from_phasor(*phase);
+    uint64_t block_phase;
+    __m256 z0 = _mm256_setzero_ps(), z1 = _mm256_setzero_ps(), z2 = _mm256_setzero_ps(), z3 = _mm256_setzero_ps();  // regenerated in the first iteration
     __VOLK_ATTR_ALIGNED(32)
-    lv_32fc_t phase_vec[16];
-    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
-        {
-            phase_vec[vec_ind] = _phase;
-            _phase *= phase_inc;
-        }
-
-    z0 = _mm256_load_ps((float*)phase_vec);
-    z1 = _mm256_load_ps((float*)(phase_vec + 4));
-    z2 = _mm256_load_ps((float*)(phase_vec + 8));
-    z3 = _mm256_load_ps((float*)(phase_vec + 12));
-
-    lv_32fc_t dz = phase_inc;
-    dz *= dz;
-    dz *= dz;
-    dz *= dz;
-    dz *= dz;  // dz = phase_inc^16;
+    uint32_t lane_phase_vec[16];
 
+    const lv_32fc_t dz = volk_gnsssdr_nco_phasor((uint32_t)((16 * nco_step) >> 32));
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[4];
     for (vec_ind = 0; vec_ind < 4; ++vec_ind)
         {
             phase_vec[vec_ind] = dz;
         }
-
-    __m256 dz_reg = _mm256_load_ps((float*)phase_vec);
-    dz_reg = _mm256_complexnormalise_ps(dz_reg);
+    const __m256 dz_reg = _mm256_load_ps((float*)phase_vec);
 
     for (; number < sixteenthPoints; number++)
         {
+            // Regenerate the rotators from the NCO
+            if ((number % (VOLK_GNSSSDR_NCO_RELOAD / 16)) == 0)
+                {
+                    block_phase = nco_phase + (uint64_t)number * 16 * nco_step;
+                    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+                        {
+                            lane_phase_vec[vec_ind] = (uint32_t)((block_phase + (uint64_t)vec_ind * nco_step) >> 32);
+                        }
+                    _mm256_nco_phasors_ps(_mm256_load_si256((__m256i*)lane_phase_vec), &z0, &z1);
+                    _mm256_nco_phasors_ps(_mm256_load_si256((__m256i*)(lane_phase_vec + 8)), &z2, &z3);
+                }
+
             a0Val = _mm256_loadu_ps(aPtr);
             a1Val = _mm256_loadu_ps(aPtr + 8);
             a2Val = _mm256_loadu_ps(aPtr + 16);
@@ -265,15 +276,6 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx(lv_32fc_
                     bPtr[vec_ind] += 16;
                 }
 
-            // Force the rotators back onto the unit circle
-            if ((number % 64) == 0)
-                {
-                    z0 = _mm256_complexnormalise_ps(z0);
-                    z1 = _mm256_complexnormalise_ps(z1);
-                    z2 = _mm256_complexnormalise_ps(z2);
-                    z3 = _mm256_complexnormalise_ps(z3);
-                }
-
             aPtr += 32;
         }
     __VOLK_ATTR_ALIGNED(32)
@@ -294,16 +296,12 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx(lv_32fc_
                 }
         }
 
-    z0 = _mm256_complexnormalise_ps(z0);
-    _mm256_store_ps((float*)phase_vec, z0);
-    _phase = phase_vec[0];
     _mm256_zeroupper();
 
     number = sixteenthPoints * 16;
     for (; number < num_points; number++)
         {
-            wo = in_common[number] * _phase;
-            _phase *= phase_inc;
+            wo = in_common[number] * volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)number * nco_step) >> 32));
 
             for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
                 {
@@ -311,7 +309,7 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx(lv_32fc_
                 }
         }
 
-    *phase = _phase;
+    *phase = volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)num_points * nco_step) >> 32));
 }
 
 #endif /* LV_HAVE_AVX */
@@ -320,7 +318,15 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx(lv_32fc_
 #ifdef LV_HAVE_AVX
 #include <volk_gnsssdr/volk_gnsssdr_avx_intrinsics.h>
 #include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points);
+
 static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    __VOLK_GNSSSDR_SPECIALIZE_TAPS(num_a_vectors, volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx_taps(result, in_common, phase_inc, phase, in_a, taps, num_points));
+}
+
+
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
 {
     unsigned int number = 0;
     int vec_ind = 0;
@@ -334,7 +340,6 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_
             bPtr[vec_ind] = in_a[vec_ind];
         }
 
-    lv_32fc_t _phase = (*phase);
     lv_32fc_t wo;
 
     __m256 a0Val, a1Val, a2Val, a3Val;
@@ -355,37 +360,37 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_
             dotProdVal3[vec_ind] = _mm256_setzero_ps();
         }
 
-    // Set up the complex rotator
-    __m256 z0, z1, z2, z3;
+    // Set up the carrier NCO and the complex rotators
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_phasor(phase_inc);
+    const uint64_t nco_phase = volk_gnsssdr_nco_phase_from_phasor(*phase);
+    uint64_t block_phase;
+    __m256 z0 = _mm256_setzero_ps(), z1 = _mm256_setzero_ps(), z2 = _mm256_setzero_ps(), z3 = _mm256_setzero_ps();  // regenerated in the first iteration
     __VOLK_ATTR_ALIGNED(32)
-    lv_32fc_t phase_vec[16];
-    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
-        {
-            phase_vec[vec_ind] = _phase;
-            _phase *= phase_inc;
-        }
-
-    z0 = _mm256_load_ps((float*)phase_vec);
-    z1 = _mm256_load_ps((float*)(phase_vec + 4));
-    z2 = _mm256_load_ps((float*)(phase_vec + 8));
-    z3 = _mm256_load_ps((float*)(phase_vec + 12));
-
-    lv_32fc_t dz = phase_inc;
-    dz *= dz;
-    dz *= dz;
-    dz *= dz;
-    dz *= dz;  // dz = phase_inc^16;
+    uint32_t lane_phase_vec[16];
 
+    const lv_32fc_t dz = volk_gnsssdr_nco_phasor((uint32_t)((16 * nco_step) >> 32));
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[4];
     for (vec_ind = 0; vec_ind < 4; ++vec_ind)
         {
             phase_vec[vec_ind] = dz;
         }
-
-    __m256 dz_reg = _mm256_load_ps((float*)phase_vec);
-    dz_reg = _mm256_complexnormalise_ps(dz_reg);
+    const __m256 dz_reg = _mm256_load_ps((float*)phase_vec);
 
     for (; number < sixteenthPoints; number++)
         {
+            // Regenerate the rotators from the NCO
+            if ((number % (VOLK_GNSSSDR_NCO_RELOAD / 16)) == 0)
+                {
+                    block_phase = nco_phase + (uint64_t)number * 16 * nco_step;
+                    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+                        {
+                            lane_phase_vec[vec_ind] = (uint32_t)((block_phase + (uint64_t)vec_ind * nco_step) >> 32);
+                        }
+                    _mm256_nco_phasors_ps(_mm256_load_si256((__m256i*)lane_phase_vec), &z0, &z1);
+                    _mm256_nco_phasors_ps(_mm256_load_si256((__m256i*)(lane_phase_vec + 8)), &z2, &z3);
+                }
+
             a0Val = _mm256_load_ps(aPtr);
             a1Val = _mm256_load_ps(aPtr + 8);
             a2Val = _mm256_load_ps(aPtr + 16);
@@ -429,13 +434,150 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_
                     bPtr[vec_ind] += 16;
                 }
 
-            // Force the rotators back onto the unit circle
-            if ((number % 64) == 0)
+            aPtr += 32;
+        }
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal2[vec_ind]);
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal3[vec_ind]);
+
+            _mm256_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    _mm256_zeroupper();
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)number * nco_step) >> 32));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
                 {
-                    z0 = _mm256_complexnormalise_ps(z0);
-                    z1 = _mm256_complexnormalise_ps(z1);
-                    z2 = _mm256_complexnormalise_ps(z2);
-                    z3 = _mm256_complexnormalise_ps(z3);
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)num_points * nco_step) >> 32));
+}
+
+
+#endif /* LV_HAVE_AVX */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <volk_gnsssdr/volk_gnsssdr_avx2_fma_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx2_fma_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points);
+
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx2_fma(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    __VOLK_GNSSSDR_SPECIALIZE_TAPS(num_a_vectors, volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx2_fma_taps(result, in_common, phase_inc, phase, in_a, taps, num_points));
+}
+
+
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx2_fma_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t wo;
+
+    __m256 a0Val, a1Val, a2Val, a3Val;
+    __m256 x0Val, x1Val;
+
+    __m256 dotProdVal0[num_a_vectors];
+    __m256 dotProdVal1[num_a_vectors];
+    __m256 dotProdVal2[num_a_vectors];
+    __m256 dotProdVal3[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm256_setzero_ps();
+            dotProdVal1[vec_ind] = _mm256_setzero_ps();
+            dotProdVal2[vec_ind] = _mm256_setzero_ps();
+            dotProdVal3[vec_ind] = _mm256_setzero_ps();
+        }
+
+    // Duplicates each real tap into the real and imaginary lanes
+    const __m256i lo_idx = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i hi_idx = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+    // Set up the carrier NCO and the complex rotators
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_phasor(phase_inc);
+    const uint64_t nco_phase = volk_gnsssdr_nco_phase_from_phasor(*phase);
+    uint64_t block_phase;
+    __m256 z0 = _mm256_setzero_ps(), z1 = _mm256_setzero_ps(), z2 = _mm256_setzero_ps(), z3 = _mm256_setzero_ps();  // regenerated in the first iteration
+    __VOLK_ATTR_ALIGNED(32)
+    uint32_t lane_phase_vec[16];
+
+    const lv_32fc_t dz = volk_gnsssdr_nco_phasor((uint32_t)((16 * nco_step) >> 32));
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[4];
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+    const __m256 dz_reg = _mm256_load_ps((float*)phase_vec);
+
+    for (; number < sixteenthPoints; number++)
+        {
+            // Regenerate the rotators from the NCO
+            if ((number % (VOLK_GNSSSDR_NCO_RELOAD / 16)) == 0)
+                {
+                    block_phase = nco_phase + (uint64_t)number * 16 * nco_step;
+                    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+                        {
+                            lane_phase_vec[vec_ind] = (uint32_t)((block_phase + (uint64_t)vec_ind * nco_step) >> 32);
+                        }
+                    _mm256_nco_phasors_fma_ps(_mm256_load_si256((__m256i*)lane_phase_vec), &z0, &z1);
+                    _mm256_nco_phasors_fma_ps(_mm256_load_si256((__m256i*)(lane_phase_vec + 8)), &z2, &z3);
+                }
+
+            a0Val = _mm256_loadu_ps(aPtr);
+            a1Val = _mm256_loadu_ps(aPtr + 8);
+            a2Val = _mm256_loadu_ps(aPtr + 16);
+            a3Val = _mm256_loadu_ps(aPtr + 24);
+
+            a0Val = _mm256_complexmul_fma_ps(a0Val, z0);
+            a1Val = _mm256_complexmul_fma_ps(a1Val, z1);
+            a2Val = _mm256_complexmul_fma_ps(a2Val, z2);
+            a3Val = _mm256_complexmul_fma_ps(a3Val, z3);
+
+            z0 = _mm256_complexmul_fma_ps(z0, dz_reg);
+            z1 = _mm256_complexmul_fma_ps(z1, dz_reg);
+            z2 = _mm256_complexmul_fma_ps(z2, dz_reg);
+            z3 = _mm256_complexmul_fma_ps(z3, dz_reg);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    x0Val = _mm256_loadu_ps(bPtr[vec_ind]);  // t0|t1|t2|t3|t4|t5|t6|t7
+                    x1Val = _mm256_loadu_ps(bPtr[vec_ind] + 8);
+
+                    dotProdVal0[vec_ind] = _mm256_fmadd_ps(a0Val, _mm256_permutevar8x32_ps(x0Val, lo_idx), dotProdVal0[vec_ind]);  // t0|t0|t1|t1|t2|t2|t3|t3
+                    dotProdVal1[vec_ind] = _mm256_fmadd_ps(a1Val, _mm256_permutevar8x32_ps(x0Val, hi_idx), dotProdVal1[vec_ind]);  // t4|t4|t5|t5|t6|t6|t7|t7
+                    dotProdVal2[vec_ind] = _mm256_fmadd_ps(a2Val, _mm256_permutevar8x32_ps(x1Val, lo_idx), dotProdVal2[vec_ind]);
+                    dotProdVal3[vec_ind] = _mm256_fmadd_ps(a3Val, _mm256_permutevar8x32_ps(x1Val, hi_idx), dotProdVal3[vec_ind]);
+
+                    bPtr[vec_ind] += 16;
                 }
 
             aPtr += 32;
@@ -458,16 +600,12 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_
                 }
         }
 
-    z0 = _mm256_complexnormalise_ps(z0);
-    _mm256_store_ps((float*)phase_vec, z0);
-    _phase = phase_vec[0];
     _mm256_zeroupper();
 
     number = sixteenthPoints * 16;
     for (; number < num_points; number++)
         {
-            wo = in_common[number] * _phase;
-            _phase *= phase_inc;
+            wo = in_common[number] * volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)number * nco_step) >> 32));
 
             for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
                 {
@@ -475,10 +613,440 @@ static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_
                 }
         }
 
-    *phase = _phase;
+    *phase = volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)num_points * nco_step) >> 32));
 }
 
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
 
-#endif /* LV_HAVE_AVX */
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <volk_gnsssdr/volk_gnsssdr_avx2_fma_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx2_fma_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points);
+
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx2_fma(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    __VOLK_GNSSSDR_SPECIALIZE_TAPS(num_a_vectors, volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx2_fma_taps(result, in_common, phase_inc, phase, in_a, taps, num_points));
+}
+
+
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx2_fma_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t wo;
+
+    __m256 a0Val, a1Val, a2Val, a3Val;
+    __m256 x0Val, x1Val;
+
+    __m256 dotProdVal0[num_a_vectors];
+    __m256 dotProdVal1[num_a_vectors];
+    __m256 dotProdVal2[num_a_vectors];
+    __m256 dotProdVal3[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm256_setzero_ps();
+            dotProdVal1[vec_ind] = _mm256_setzero_ps();
+            dotProdVal2[vec_ind] = _mm256_setzero_ps();
+            dotProdVal3[vec_ind] = _mm256_setzero_ps();
+        }
+
+    // Duplicates each real tap into the real and imaginary lanes
+    const __m256i lo_idx = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    const __m256i hi_idx = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+
+    // Set up the carrier NCO and the complex rotators
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_phasor(phase_inc);
+    const uint64_t nco_phase = volk_gnsssdr_nco_phase_from_phasor(*phase);
+    uint64_t block_phase;
+    __m256 z0 = _mm256_setzero_ps(), z1 = _mm256_setzero_ps(), z2 = _mm256_setzero_ps(), z3 = _mm256_setzero_ps();  // regenerated in the first iteration
+    __VOLK_ATTR_ALIGNED(32)
+    uint32_t lane_phase_vec[16];
+
+    const lv_32fc_t dz = volk_gnsssdr_nco_phasor((uint32_t)((16 * nco_step) >> 32));
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[4];
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+    const __m256 dz_reg = _mm256_load_ps((float*)phase_vec);
+
+    for (; number < sixteenthPoints; number++)
+        {
+            // Regenerate the rotators from the NCO
+            if ((number % (VOLK_GNSSSDR_NCO_RELOAD / 16)) == 0)
+                {
+                    block_phase = nco_phase + (uint64_t)number * 16 * nco_step;
+                    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+                        {
+                            lane_phase_vec[vec_ind] = (uint32_t)((block_phase + (uint64_t)vec_ind * nco_step) >> 32);
+                        }
+                    _mm256_nco_phasors_fma_ps(_mm256_load_si256((__m256i*)lane_phase_vec), &z0, &z1);
+                    _mm256_nco_phasors_fma_ps(_mm256_load_si256((__m256i*)(lane_phase_vec + 8)), &z2, &z3);
+                }
+
+            a0Val = _mm256_load_ps(aPtr);
+            a1Val = _mm256_load_ps(aPtr + 8);
+            a2Val = _mm256_load_ps(aPtr + 16);
+            a3Val = _mm256_load_ps(aPtr + 24);
+
+            a0Val = _mm256_complexmul_fma_ps(a0Val, z0);
+            a1Val = _mm256_complexmul_fma_ps(a1Val, z1);
+            a2Val = _mm256_complexmul_fma_ps(a2Val, z2);
+            a3Val = _mm256_complexmul_fma_ps(a3Val, z3);
+
+            z0 = _mm256_complexmul_fma_ps(z0, dz_reg);
+            z1 = _mm256_complexmul_fma_ps(z1, dz_reg);
+            z2 = _mm256_complexmul_fma_ps(z2, dz_reg);
+            z3 = _mm256_complexmul_fma_ps(z3, dz_reg);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    x0Val = _mm256_loadu_ps(bPtr[vec_ind]);  // t0|t1|t2|t3|t4|t5|t6|t7
+                    x1Val = _mm256_loadu_ps(bPtr[vec_ind] + 8);
+
+                    dotProdVal0[vec_ind] = _mm256_fmadd_ps(a0Val, _mm256_permutevar8x32_ps(x0Val, lo_idx), dotProdVal0[vec_ind]);  // t0|t0|t1|t1|t2|t2|t3|t3
+                    dotProdVal1[vec_ind] = _mm256_fmadd_ps(a1Val, _mm256_permutevar8x32_ps(x0Val, hi_idx), dotProdVal1[vec_ind]);  // t4|t4|t5|t5|t6|t6|t7|t7
+                    dotProdVal2[vec_ind] = _mm256_fmadd_ps(a2Val, _mm256_permutevar8x32_ps(x1Val, lo_idx), dotProdVal2[vec_ind]);
+                    dotProdVal3[vec_ind] = _mm256_fmadd_ps(a3Val, _mm256_permutevar8x32_ps(x1Val, hi_idx), dotProdVal3[vec_ind]);
+
+                    bPtr[vec_ind] += 16;
+                }
+
+            aPtr += 32;
+        }
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal2[vec_ind]);
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal3[vec_ind]);
+
+            _mm256_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    _mm256_zeroupper();
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)number * nco_step) >> 32));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)num_points * nco_step) >> 32));
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx512f_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points);
+
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    __VOLK_GNSSSDR_SPECIALIZE_TAPS(num_a_vectors, volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx512f_taps(result, in_common, phase_inc, phase, in_a, taps, num_points));
+}
+
+
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_u_avx512f_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t wo;
+
+    __m512 a0Val, a1Val, a2Val, a3Val;
+    __m512 x0Val, x1Val;
+
+    __m512 dotProdVal0[num_a_vectors];
+    __m512 dotProdVal1[num_a_vectors];
+    __m512 dotProdVal2[num_a_vectors];
+    __m512 dotProdVal3[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm512_setzero_ps();
+            dotProdVal1[vec_ind] = _mm512_setzero_ps();
+            dotProdVal2[vec_ind] = _mm512_setzero_ps();
+            dotProdVal3[vec_ind] = _mm512_setzero_ps();
+        }
+
+    // Duplicates each real tap into the real and imaginary lanes
+    const __m512i lo_idx = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i hi_idx = _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+
+    // Set up the carrier NCO and the complex rotators
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_phasor(phase_inc);
+    const uint64_t nco_phase = volk_gnsssdr_nco_phase_from_phasor(*phase);
+    uint64_t block_phase;
+    __m512 z0 = _mm512_setzero_ps(), z1 = _mm512_setzero_ps(), z2 = _mm512_setzero_ps(), z3 = _mm512_setzero_ps();  // regenerated in the first iteration
+    __VOLK_ATTR_ALIGNED(64)
+    uint32_t lane_phase_vec[32];
+
+    const lv_32fc_t dz = volk_gnsssdr_nco_phasor((uint32_t)((32 * nco_step) >> 32));
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_vec[8];
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+    const __m512 dz_reg = _mm512_load_ps((float*)phase_vec);
+
+    for (; number < thirtysecondPoints; number++)
+        {
+            // Regenerate the rotators from the NCO
+            if ((number % (VOLK_GNSSSDR_NCO_RELOAD / 32)) == 0)
+                {
+                    block_phase = nco_phase + (uint64_t)number * 32 * nco_step;
+                    for (vec_ind = 0; vec_ind < 32; ++vec_ind)
+                        {
+                            lane_phase_vec[vec_ind] = (uint32_t)((block_phase + (uint64_t)vec_ind * nco_step) >> 32);
+                        }
+                    _mm512_nco_phasors_ps(_mm512_load_si512((__m512i*)lane_phase_vec), &z0, &z1);
+                    _mm512_nco_phasors_ps(_mm512_load_si512((__m512i*)(lane_phase_vec + 16)), &z2, &z3);
+                }
+
+            a0Val = _mm512_loadu_ps(aPtr);
+            a1Val = _mm512_loadu_ps(aPtr + 16);
+            a2Val = _mm512_loadu_ps(aPtr + 32);
+            a3Val = _mm512_loadu_ps(aPtr + 48);
+
+            a0Val = _mm512_complexmul_ps(a0Val, z0);
+            a1Val = _mm512_complexmul_ps(a1Val, z1);
+            a2Val = _mm512_complexmul_ps(a2Val, z2);
+            a3Val = _mm512_complexmul_ps(a3Val, z3);
+
+            z0 = _mm512_complexmul_ps(z0, dz_reg);
+            z1 = _mm512_complexmul_ps(z1, dz_reg);
+            z2 = _mm512_complexmul_ps(z2, dz_reg);
+            z3 = _mm512_complexmul_ps(z3, dz_reg);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    x0Val = _mm512_loadu_ps(bPtr[vec_ind]);  // t0|t1|...|t15
+                    x1Val = _mm512_loadu_ps(bPtr[vec_ind] + 16);
+
+                    dotProdVal0[vec_ind] = _mm512_fmadd_ps(a0Val, _mm512_permutexvar_ps(lo_idx, x0Val), dotProdVal0[vec_ind]);  // t0|t0|...|t7|t7
+                    dotProdVal1[vec_ind] = _mm512_fmadd_ps(a1Val, _mm512_permutexvar_ps(hi_idx, x0Val), dotProdVal1[vec_ind]);  // t8|t8|...|t15|t15
+                    dotProdVal2[vec_ind] = _mm512_fmadd_ps(a2Val, _mm512_permutexvar_ps(lo_idx, x1Val), dotProdVal2[vec_ind]);
+                    dotProdVal3[vec_ind] = _mm512_fmadd_ps(a3Val, _mm512_permutexvar_ps(hi_idx, x1Val), dotProdVal3[vec_ind]);
+
+                    bPtr[vec_ind] += 32;
+                }
+
+            aPtr += 64;
+        }
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal2[vec_ind]);
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal3[vec_ind]);
+
+            _mm512_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 8; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)number * nco_step) >> 32));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)num_points * nco_step) >> 32));
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx512f_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points);
+
+static inline void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    __VOLK_GNSSSDR_SPECIALIZE_TAPS(num_a_vectors, volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx512f_taps(result, in_common, phase_inc, phase, in_a, taps, num_points));
+}
+
+
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_a_avx512f_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const float** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int thirtysecondPoints = num_points / 32;
+
+    const float* aPtr = (float*)in_common;
+    const float* bPtr[num_a_vectors];
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            bPtr[vec_ind] = in_a[vec_ind];
+        }
+
+    lv_32fc_t wo;
+
+    __m512 a0Val, a1Val, a2Val, a3Val;
+    __m512 x0Val, x1Val;
+
+    __m512 dotProdVal0[num_a_vectors];
+    __m512 dotProdVal1[num_a_vectors];
+    __m512 dotProdVal2[num_a_vectors];
+    __m512 dotProdVal3[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm512_setzero_ps();
+            dotProdVal1[vec_ind] = _mm512_setzero_ps();
+            dotProdVal2[vec_ind] = _mm512_setzero_ps();
+            dotProdVal3[vec_ind] = _mm512_setzero_ps();
+        }
+
+    // Duplicates each real tap into the real and imaginary lanes
+    const __m512i lo_idx = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m512i hi_idx = _mm512_setr_epi32(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+
+    // Set up the carrier NCO and the complex rotators
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_phasor(phase_inc);
+    const uint64_t nco_phase = volk_gnsssdr_nco_phase_from_phasor(*phase);
+    uint64_t block_phase;
+    __m512 z0 = _mm512_setzero_ps(), z1 = _mm512_setzero_ps(), z2 = _mm512_setzero_ps(), z3 = _mm512_setzero_ps();  // regenerated in the first iteration
+    __VOLK_ATTR_ALIGNED(64)
+    uint32_t lane_phase_vec[32];
+
+    const lv_32fc_t dz = volk_gnsssdr_nco_phasor((uint32_t)((32 * nco_step) >> 32));
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_vec[8];
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+    const __m512 dz_reg = _mm512_load_ps((float*)phase_vec);
+
+    for (; number < thirtysecondPoints; number++)
+        {
+            // Regenerate the rotators from the NCO
+            if ((number % (VOLK_GNSSSDR_NCO_RELOAD / 32)) == 0)
+                {
+                    block_phase = nco_phase + (uint64_t)number * 32 * nco_step;
+                    for (vec_ind = 0; vec_ind < 32; ++vec_ind)
+                        {
+                            lane_phase_vec[vec_ind] = (uint32_t)((block_phase + (uint64_t)vec_ind * nco_step) >> 32);
+                        }
+                    _mm512_nco_phasors_ps(_mm512_load_si512((__m512i*)lane_phase_vec), &z0, &z1);
+                    _mm512_nco_phasors_ps(_mm512_load_si512((__m512i*)(lane_phase_vec + 16)), &z2, &z3);
+                }
+
+            a0Val = _mm512_load_ps(aPtr);
+            a1Val = _mm512_load_ps(aPtr + 16);
+            a2Val = _mm512_load_ps(aPtr + 32);
+            a3Val = _mm512_load_ps(aPtr + 48);
+
+            a0Val = _mm512_complexmul_ps(a0Val, z0);
+            a1Val = _mm512_complexmul_ps(a1Val, z1);
+            a2Val = _mm512_complexmul_ps(a2Val, z2);
+            a3Val = _mm512_complexmul_ps(a3Val, z3);
+
+            z0 = _mm512_complexmul_ps(z0, dz_reg);
+            z1 = _mm512_complexmul_ps(z1, dz_reg);
+            z2 = _mm512_complexmul_ps(z2, dz_reg);
+            z3 = _mm512_complexmul_ps(z3, dz_reg);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    x0Val = _mm512_loadu_ps(bPtr[vec_ind]);  // t0|t1|...|t15
+                    x1Val = _mm512_loadu_ps(bPtr[vec_ind] + 16);
+
+                    dotProdVal0[vec_ind] = _mm512_fmadd_ps(a0Val, _mm512_permutexvar_ps(lo_idx, x0Val), dotProdVal0[vec_ind]);  // t0|t0|...|t7|t7
+                    dotProdVal1[vec_ind] = _mm512_fmadd_ps(a1Val, _mm512_permutexvar_ps(hi_idx, x0Val), dotProdVal1[vec_ind]);  // t8|t8|...|t15|t15
+                    dotProdVal2[vec_ind] = _mm512_fmadd_ps(a2Val, _mm512_permutexvar_ps(lo_idx, x1Val), dotProdVal2[vec_ind]);
+                    dotProdVal3[vec_ind] = _mm512_fmadd_ps(a3Val, _mm512_permutexvar_ps(hi_idx, x1Val), dotProdVal3[vec_ind]);
+
+                    bPtr[vec_ind] += 32;
+                }
+
+            aPtr += 64;
+        }
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal2[vec_ind]);
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal3[vec_ind]);
+
+            _mm512_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 8; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    number = thirtysecondPoints * 32;
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)number * nco_step) >> 32));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    result[vec_ind] += wo * in_a[vec_ind][number];
+                }
+        }
+
+    *phase = volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)num_points * nco_step) >> 32));
+}
+
+#endif /* LV_HAVE_AVX512F */
 
 #endif /* INCLUDED_volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_H */
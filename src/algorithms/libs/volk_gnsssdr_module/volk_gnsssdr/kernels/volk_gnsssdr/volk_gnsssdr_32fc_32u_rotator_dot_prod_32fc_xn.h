@@ -0,0 +1,365 @@
+/*!
+ * \file volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn.h
+ * \brief VOLK_GNSSSDR kernel: multiplies N binary local code replicas, packed
+ * one bit per sample, by a common phase rotated complex vector and accumulates
+ * the results in N float complex outputs.
+ *
+ * VOLK_GNSSSDR kernel that implements a bit-wise correlator: the replicas only
+ * carry the sign of the code, so multiplying by the code is a conditional sign
+ * flip, applied with an XOR on the float sign bits.
+ * It is optimized to perform the N tap correlation process in GNSS receivers
+ * with binary (+1/-1) codes.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn
+ *
+ * \b Overview
+ *
+ * Rotates the reference complex vector, multiplies it by an arbitrary number of
+ * binary replicas packed one bit per sample, accumulates the results and stores
+ * them in the output vector.
+ * Bit n % 32 of word n / 32 of each replica is set when the code is -1 at sample n.
+ * The rotation is done at a fixed rate per sample, from an initial \p phase_rad offset,
+ * with the fixed point NCO of volk_gnsssdr_nco.h.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn(lv_32fc_t* result, const lv_32fc_t* in_common, const double phase_inc_rad, double* phase_rad, const uint32_t** in_a, int num_a_vectors, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li in_common:     Pointer to the vector to be rotated, multiplied and accumulated (reference vector).
+ * \li phase_inc_rad: Phase increment per sample [rad].
+ * \li phase_rad:     Initial phase [rad].
+ * \li in_a:          Pointer to an array of pointers to the packed replicas, with at least (num_points + 31) / 32 words each.
+ * \li num_a_vectors: Number of replicas to be multiplied by the reference vector and accumulated.
+ * \li num_points:    Number of complex values to be rotated, multiplied, accumulated and stored into \p result.
+ *
+ * \b Outputs
+ * \li phase_rad:     Final phase [rad], wrapped to [-pi, pi).
+ * \li result:        Vector of \p num_a_vectors components with the correlation of \p in_common with each replica.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_H
+#define INCLUDED_volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_H
+
+
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr_nco.h>
+#include <math.h>
+#include <stdint.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_generic(lv_32fc_t* result, const lv_32fc_t* in_common, const double phase_inc_rad, double* phase_rad, const uint32_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    lv_32fc_t tmp32_1;
+    int n_vec;
+    unsigned int n;
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            result[n_vec] = lv_cmake(0, 0);
+        }
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_rad(phase_inc_rad);
+    const lv_32fc_t phase_inc = volk_gnsssdr_nco_phasor((uint32_t)(nco_step >> 32));
+    uint64_t nco_phase = volk_gnsssdr_nco_phase_from_rad(*phase_rad);
+    lv_32fc_t phase = lv_cmake(1.0f, 0.0f);
+    for (n = 0; n < num_points; n++)
+        {
+            // Regenerate the rotator from the NCO
+            if (n % VOLK_GNSSSDR_NCO_RELOAD == 0)
+                {
+                    phase = volk_gnsssdr_nco_phasor((uint32_t)(nco_phase >> 32));
+                }
+            tmp32_1 = *in_common++ * phase;
+            phase *= phase_inc;
+            nco_phase += nco_step;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    if ((in_a[n_vec][n >> 5] >> (n & 31)) & 1U)
+                        {
+                            result[n_vec] -= tmp32_1;
+                        }
+                    else
+                        {
+                            result[n_vec] += tmp32_1;
+                        }
+                }
+        }
+    *phase_rad = volk_gnsssdr_nco_phase_to_rad(nco_phase);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <volk_gnsssdr/volk_gnsssdr_avx2_fma_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_u_avx2_fma_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const double phase_inc_rad, double* phase_rad, const uint32_t** in_a, int num_a_vectors, unsigned int num_points);
+
+static inline void volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_u_avx2_fma(lv_32fc_t* result, const lv_32fc_t* in_common, const double phase_inc_rad, double* phase_rad, const uint32_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    __VOLK_GNSSSDR_SPECIALIZE_TAPS(num_a_vectors, volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_u_avx2_fma_taps(result, in_common, phase_inc_rad, phase_rad, in_a, taps, num_points));
+}
+
+
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_u_avx2_fma_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const double phase_inc_rad, double* phase_rad, const uint32_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int eighthPoints = num_points / 8;
+
+    const float* aPtr = (float*)in_common;
+
+    lv_32fc_t wo;
+    __m256 a0Val, a1Val;
+    __m256i bits;
+
+    __m256 dotProdVal0[num_a_vectors];
+    __m256 dotProdVal1[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm256_setzero_ps();
+            dotProdVal1[vec_ind] = _mm256_setzero_ps();
+        }
+
+    // Moves the bit of each sample to the sign bit of its real and imaginary lanes
+    const __m256i lo_shifts = _mm256_setr_epi32(31, 31, 30, 30, 29, 29, 28, 28);
+    const __m256i hi_shifts = _mm256_setr_epi32(27, 27, 26, 26, 25, 25, 24, 24);
+    const __m256i sign_mask = _mm256_set1_epi32((int)0x80000000U);
+
+    // Set up the carrier NCO and the complex rotators
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_rad(phase_inc_rad);
+    const uint64_t nco_phase = volk_gnsssdr_nco_phase_from_rad(*phase_rad);
+    __m256 z0 = _mm256_setzero_ps(), z1 = _mm256_setzero_ps();  // regenerated in the first iteration
+    __VOLK_ATTR_ALIGNED(32)
+    uint32_t lane_phase_vec[8];
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            lane_phase_vec[vec_ind] = (uint32_t)(((uint64_t)vec_ind * nco_step) >> 32);
+        }
+    const __m256i lane_phases = _mm256_load_si256((__m256i*)lane_phase_vec);
+
+    const lv_32fc_t dz = volk_gnsssdr_nco_phasor((uint32_t)((8 * nco_step) >> 32));
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t phase_vec[4];
+    for (vec_ind = 0; vec_ind < 4; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+    const __m256 dz_reg = _mm256_load_ps((float*)phase_vec);
+
+    for (; number < eighthPoints; number++)
+        {
+            // Regenerate the rotators from the NCO
+            if ((number % (VOLK_GNSSSDR_NCO_RELOAD / 8)) == 0)
+                {
+                    _mm256_nco_phasors_fma_ps(_mm256_add_epi32(_mm256_set1_epi32((int)(uint32_t)((nco_phase + (uint64_t)number * 8 * nco_step) >> 32)), lane_phases), &z0, &z1);
+                }
+
+            a0Val = _mm256_loadu_ps(aPtr);
+            a1Val = _mm256_loadu_ps(aPtr + 8);
+
+            a0Val = _mm256_complexmul_fma_ps(a0Val, z0);
+            a1Val = _mm256_complexmul_fma_ps(a1Val, z1);
+
+            z0 = _mm256_complexmul_fma_ps(z0, dz_reg);
+            z1 = _mm256_complexmul_fma_ps(z1, dz_reg);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    // the 8 bits of this block, flipping the sign of the samples where the code is -1
+                    bits = _mm256_set1_epi32((int)(in_a[vec_ind][number >> 2] >> ((number & 3) * 8)));
+                    dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], _mm256_xor_ps(a0Val, _mm256_castsi256_ps(_mm256_and_si256(_mm256_sllv_epi32(bits, lo_shifts), sign_mask))));
+                    dotProdVal1[vec_ind] = _mm256_add_ps(dotProdVal1[vec_ind], _mm256_xor_ps(a1Val, _mm256_castsi256_ps(_mm256_and_si256(_mm256_sllv_epi32(bits, hi_shifts), sign_mask))));
+                }
+
+            aPtr += 16;
+        }
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm256_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm256_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 4; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    _mm256_zeroupper();
+
+    number = eighthPoints * 8;
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)number * nco_step) >> 32));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    if ((in_a[vec_ind][number >> 5] >> (number & 31)) & 1U)
+                        {
+                            result[vec_ind] -= wo;
+                        }
+                    else
+                        {
+                            result[vec_ind] += wo;
+                        }
+                }
+        }
+
+    *phase_rad = volk_gnsssdr_nco_phase_to_rad(nco_phase + (uint64_t)num_points * nco_step);
+}
+
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_u_avx512f_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const double phase_inc_rad, double* phase_rad, const uint32_t** in_a, int num_a_vectors, unsigned int num_points);
+
+static inline void volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_u_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const double phase_inc_rad, double* phase_rad, const uint32_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    __VOLK_GNSSSDR_SPECIALIZE_TAPS(num_a_vectors, volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_u_avx512f_taps(result, in_common, phase_inc_rad, phase_rad, in_a, taps, num_points));
+}
+
+
+static inline __VOLK_ATTR_INLINE void volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_u_avx512f_taps(lv_32fc_t* result, const lv_32fc_t* in_common, const double phase_inc_rad, double* phase_rad, const uint32_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int number = 0;
+    int vec_ind = 0;
+    unsigned int i = 0;
+    const unsigned int sixteenthPoints = num_points / 16;
+
+    const float* aPtr = (float*)in_common;
+
+    lv_32fc_t wo;
+    __m512 a0Val, a1Val;
+    __m512i bits;
+
+    __m512 dotProdVal0[num_a_vectors];
+    __m512 dotProdVal1[num_a_vectors];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; vec_ind++)
+        {
+            dotProdVal0[vec_ind] = _mm512_setzero_ps();
+            dotProdVal1[vec_ind] = _mm512_setzero_ps();
+        }
+
+    // Moves the bit of each sample to the sign bit of its real and imaginary lanes
+    const __m512i lo_shifts = _mm512_setr_epi32(31, 31, 30, 30, 29, 29, 28, 28, 27, 27, 26, 26, 25, 25, 24, 24);
+    const __m512i hi_shifts = _mm512_setr_epi32(23, 23, 22, 22, 21, 21, 20, 20, 19, 19, 18, 18, 17, 17, 16, 16);
+    const __m512i sign_mask = _mm512_set1_epi32((int)0x80000000U);
+
+    // Set up the carrier NCO and the complex rotators
+    const uint64_t nco_step = volk_gnsssdr_nco_phase_from_rad(phase_inc_rad);
+    const uint64_t nco_phase = volk_gnsssdr_nco_phase_from_rad(*phase_rad);
+    __m512 z0 = _mm512_setzero_ps(), z1 = _mm512_setzero_ps();  // regenerated in the first iteration
+    __VOLK_ATTR_ALIGNED(64)
+    uint32_t lane_phase_vec[16];
+    for (vec_ind = 0; vec_ind < 16; ++vec_ind)
+        {
+            lane_phase_vec[vec_ind] = (uint32_t)(((uint64_t)vec_ind * nco_step) >> 32);
+        }
+    const __m512i lane_phases = _mm512_load_si512((__m512i*)lane_phase_vec);
+
+    const lv_32fc_t dz = volk_gnsssdr_nco_phasor((uint32_t)((16 * nco_step) >> 32));
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t phase_vec[8];
+    for (vec_ind = 0; vec_ind < 8; ++vec_ind)
+        {
+            phase_vec[vec_ind] = dz;
+        }
+    const __m512 dz_reg = _mm512_load_ps((float*)phase_vec);
+
+    for (; number < sixteenthPoints; number++)
+        {
+            // Regenerate the rotators from the NCO
+            if ((number % (VOLK_GNSSSDR_NCO_RELOAD / 16)) == 0)
+                {
+                    _mm512_nco_phasors_ps(_mm512_add_epi32(_mm512_set1_epi32((int)(uint32_t)((nco_phase + (uint64_t)number * 16 * nco_step) >> 32)), lane_phases), &z0, &z1);
+                }
+
+            a0Val = _mm512_loadu_ps(aPtr);
+            a1Val = _mm512_loadu_ps(aPtr + 16);
+
+            a0Val = _mm512_complexmul_ps(a0Val, z0);
+            a1Val = _mm512_complexmul_ps(a1Val, z1);
+
+            z0 = _mm512_complexmul_ps(z0, dz_reg);
+            z1 = _mm512_complexmul_ps(z1, dz_reg);
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    // the 16 bits of this block, flipping the sign of the samples where the code is -1
+                    bits = _mm512_set1_epi32((int)(in_a[vec_ind][number >> 1] >> ((number & 1) * 16)));
+                    dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a0Val), _mm512_and_si512(_mm512_sllv_epi32(bits, lo_shifts), sign_mask))));
+                    dotProdVal1[vec_ind] = _mm512_add_ps(dotProdVal1[vec_ind], _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a1Val), _mm512_and_si512(_mm512_sllv_epi32(bits, hi_shifts), sign_mask))));
+                }
+
+            aPtr += 32;
+        }
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+        {
+            dotProdVal0[vec_ind] = _mm512_add_ps(dotProdVal0[vec_ind], dotProdVal1[vec_ind]);
+
+            _mm512_store_ps((float*)dotProductVector, dotProdVal0[vec_ind]);  // Store the results back into the dot product vector
+
+            result[vec_ind] = lv_cmake(0, 0);
+            for (i = 0; i < 8; ++i)
+                {
+                    result[vec_ind] += dotProductVector[i];
+                }
+        }
+
+    number = sixteenthPoints * 16;
+    for (; number < num_points; number++)
+        {
+            wo = in_common[number] * volk_gnsssdr_nco_phasor((uint32_t)((nco_phase + (uint64_t)number * nco_step) >> 32));
+
+            for (vec_ind = 0; vec_ind < num_a_vectors; ++vec_ind)
+                {
+                    if ((in_a[vec_ind][number >> 5] >> (number & 31)) & 1U)
+                        {
+                            result[vec_ind] -= wo;
+                        }
+                    else
+                        {
+                            result[vec_ind] += wo;
+                        }
+                }
+        }
+
+    *phase_rad = volk_gnsssdr_nco_phase_to_rad(nco_phase + (uint64_t)num_points * nco_step);
+}
+
+#endif /* LV_HAVE_AVX512F */
+
+#endif /* INCLUDED_volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_H */
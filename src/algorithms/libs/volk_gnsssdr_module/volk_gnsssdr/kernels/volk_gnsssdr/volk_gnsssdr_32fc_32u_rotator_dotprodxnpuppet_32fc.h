@@ -0,0 +1,111 @@
+/*!
+ * \file volk_gnsssdr_32fc_32u_rotator_dotprodxnpuppet_32fc.h
+ * \brief Volk puppet for the bit-wise multiple complex dot product kernel.
+ *
+ * Volk puppet for integrating the bit-wise correlator into volk's test system
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_32u_rotator_dotprodxnpuppet_32fc_H
+#define INCLUDED_volk_gnsssdr_32fc_32u_rotator_dotprodxnpuppet_32fc_H
+
+#include "volk_gnsssdr/volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_malloc.h>
+#include <stdint.h>
+
+
+// Packs the signs of the test vector, one bit per sample, into num_a_vectors replicas
+static inline uint32_t** packed_replicas_from_signs(const float* in, int num_a_vectors, unsigned int num_points)
+{
+    int n;
+    unsigned int k;
+    const unsigned int num_words = (num_points + 31) / 32;
+    uint32_t** in_a = (uint32_t**)volk_gnsssdr_malloc(sizeof(uint32_t*) * num_a_vectors, volk_gnsssdr_get_alignment());
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            in_a[n] = (uint32_t*)volk_gnsssdr_malloc(sizeof(uint32_t) * num_words, volk_gnsssdr_get_alignment());
+            for (k = 0; k < num_words; k++)
+                {
+                    in_a[n][k] = 0;
+                }
+            for (k = 0; k < num_points; k++)
+                {
+                    if (in[k] < 0.0f)
+                        {
+                            in_a[n][k / 32] |= 1U << (k % 32);
+                        }
+                }
+        }
+    return in_a;
+}
+
+
+static inline void free_packed_replicas(uint32_t** in_a, int num_a_vectors)
+{
+    int n;
+    for (n = 0; n < num_a_vectors; n++)
+        {
+            volk_gnsssdr_free(in_a[n]);
+        }
+    volk_gnsssdr_free(in_a);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_32fc_32u_rotator_dotprodxnpuppet_32fc_generic(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    double phase_rad = 0.25;
+    double phase_step_rad = 0.1;
+    int num_a_vectors = 3;
+    uint32_t** in_a = packed_replicas_from_signs(in, num_a_vectors, num_points);
+
+    volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_generic(result, local_code, phase_step_rad, &phase_rad, (const uint32_t**)in_a, num_a_vectors, num_points);
+
+    free_packed_replicas(in_a, num_a_vectors);
+}
+#endif  // Generic
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+static inline void volk_gnsssdr_32fc_32u_rotator_dotprodxnpuppet_32fc_u_avx2_fma(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    double phase_rad = 0.25;
+    double phase_step_rad = 0.1;
+    int num_a_vectors = 3;
+    uint32_t** in_a = packed_replicas_from_signs(in, num_a_vectors, num_points);
+
+    volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_u_avx2_fma(result, local_code, phase_step_rad, &phase_rad, (const uint32_t**)in_a, num_a_vectors, num_points);
+
+    free_packed_replicas(in_a, num_a_vectors);
+}
+#endif  // AVX2 && FMA
+
+
+#ifdef LV_HAVE_AVX512F
+static inline void volk_gnsssdr_32fc_32u_rotator_dotprodxnpuppet_32fc_u_avx512f(lv_32fc_t* result, const lv_32fc_t* local_code, const float* in, unsigned int num_points)
+{
+    double phase_rad = 0.25;
+    double phase_step_rad = 0.1;
+    int num_a_vectors = 3;
+    uint32_t** in_a = packed_replicas_from_signs(in, num_a_vectors, num_points);
+
+    volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_u_avx512f(result, local_code, phase_step_rad, &phase_rad, (const uint32_t**)in_a, num_a_vectors, num_points);
+
+    free_packed_replicas(in_a, num_a_vectors);
+}
+#endif  // AVX512F
+
+#endif  // INCLUDED_volk_gnsssdr_32fc_32u_rotator_dotprodxnpuppet_32fc_H
@@ -636,6 +636,442 @@ static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_a_avx(lv_32fc_t
 #endif /* LV_HAVE_AVX */
 
 
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <volk_gnsssdr/volk_gnsssdr_avx2_fma_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_u_avx2_fma(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_32fc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    lv_32fc_t dotProduct = lv_cmake(0, 0);
+    lv_32fc_t tmp32_1, tmp32_2;
+    const unsigned int avx_iters = num_points / 4;
+    int n_vec;
+    int i;
+    unsigned int number;
+    unsigned int n;
+    const lv_32fc_t** _in_a = in_a;
+    const lv_32fc_t* _in_common = in_common;
+    lv_32fc_t _phase = (*phase);
+
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    __m256 acc[num_a_vectors];
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            acc[n_vec] = _mm256_setzero_ps();
+            result[n_vec] = lv_cmake(0, 0);
+        }
+
+    // phase rotation registers
+    __m256 a, four_phase_acc_reg, z, zl, zh;
+    const __m256 real_sign = _mm256_setr_ps(-0.f, 0, -0.f, 0, -0.f, 0, -0.f, 0);
+
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t four_phase_inc[4];
+    const lv_32fc_t phase_inc2 = phase_inc * phase_inc;
+    const lv_32fc_t phase_inc3 = phase_inc2 * phase_inc;
+    const lv_32fc_t phase_inc4 = phase_inc3 * phase_inc;
+    four_phase_inc[0] = phase_inc4;
+    four_phase_inc[1] = phase_inc4;
+    four_phase_inc[2] = phase_inc4;
+    four_phase_inc[3] = phase_inc4;
+    const __m256 four_phase_inc_reg = _mm256_load_ps((float*)four_phase_inc);
+
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t four_phase_acc[4];
+    four_phase_acc[0] = _phase;
+    four_phase_acc[1] = _phase * phase_inc;
+    four_phase_acc[2] = _phase * phase_inc2;
+    four_phase_acc[3] = _phase * phase_inc3;
+    four_phase_acc_reg = _mm256_load_ps((float*)four_phase_acc);
+
+    for (number = 0; number < avx_iters; number++)
+        {
+            // Phase rotation on operand in_common starts here:
+            a = _mm256_loadu_ps((float*)_in_common);
+            __VOLK_GNSSSDR_PREFETCH(_in_common + 16);
+            z = _mm256_complexmul_fma_ps(a, four_phase_acc_reg);
+            four_phase_acc_reg = _mm256_complexmul_fma_ps(four_phase_acc_reg, four_phase_inc_reg);
+
+            // z * a = a * zl + swap(a) * (-zi, zi, ...), two FMAs per vector
+            zl = _mm256_moveldup_ps(z);                             // Load zl with cr,cr,dr,dr
+            zh = _mm256_xor_ps(_mm256_movehdup_ps(z), real_sign);  // Load zh with -ci,ci,-di,di
+
+            // next four samples
+            _in_common += 4;
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    a = _mm256_loadu_ps((float*)&(_in_a[n_vec][number * 4]));
+                    acc[n_vec] = _mm256_fmadd_ps(a, zl, acc[n_vec]);
+                    a = _mm256_shuffle_ps(a, a, 0xB1);
+                    acc[n_vec] = _mm256_fmadd_ps(a, zh, acc[n_vec]);
+                }
+            // Regenerate phase
+            if ((number % 128) == 0)
+                {
+                    four_phase_acc_reg = _mm256_complexnormalise_fma_ps(four_phase_acc_reg);
+                }
+        }
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            _mm256_store_ps((float*)dotProductVector, acc[n_vec]);  // Store the results back into the dot product vector
+            dotProduct = lv_cmake(0, 0);
+            for (i = 0; i < 4; ++i)
+                {
+                    dotProduct = dotProduct + dotProductVector[i];
+                }
+            result[n_vec] = dotProduct;
+        }
+
+    four_phase_acc_reg = _mm256_complexnormalise_fma_ps(four_phase_acc_reg);
+    _mm256_store_ps((float*)four_phase_acc, four_phase_acc_reg);
+    _phase = four_phase_acc[0];
+    _mm256_zeroupper();
+
+    for (n = avx_iters * 4; n < num_points; n++)
+        {
+            tmp32_1 = *_in_common++ * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    tmp32_2 = tmp32_1 * _in_a[n_vec][n];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+    (*phase) = _phase;
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#if LV_HAVE_AVX2 && LV_HAVE_FMA
+#include <volk_gnsssdr/volk_gnsssdr_avx2_fma_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_a_avx2_fma(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_32fc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    lv_32fc_t dotProduct = lv_cmake(0, 0);
+    lv_32fc_t tmp32_1, tmp32_2;
+    const unsigned int avx_iters = num_points / 4;
+    int n_vec;
+    int i;
+    unsigned int number;
+    unsigned int n;
+    const lv_32fc_t** _in_a = in_a;
+    const lv_32fc_t* _in_common = in_common;
+    lv_32fc_t _phase = (*phase);
+
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t dotProductVector[4];
+
+    __m256 acc[num_a_vectors];
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            acc[n_vec] = _mm256_setzero_ps();
+            result[n_vec] = lv_cmake(0, 0);
+        }
+
+    // phase rotation registers
+    __m256 a, four_phase_acc_reg, z, zl, zh;
+    const __m256 real_sign = _mm256_setr_ps(-0.f, 0, -0.f, 0, -0.f, 0, -0.f, 0);
+
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t four_phase_inc[4];
+    const lv_32fc_t phase_inc2 = phase_inc * phase_inc;
+    const lv_32fc_t phase_inc3 = phase_inc2 * phase_inc;
+    const lv_32fc_t phase_inc4 = phase_inc3 * phase_inc;
+    four_phase_inc[0] = phase_inc4;
+    four_phase_inc[1] = phase_inc4;
+    four_phase_inc[2] = phase_inc4;
+    four_phase_inc[3] = phase_inc4;
+    const __m256 four_phase_inc_reg = _mm256_load_ps((float*)four_phase_inc);
+
+    __VOLK_ATTR_ALIGNED(32)
+    lv_32fc_t four_phase_acc[4];
+    four_phase_acc[0] = _phase;
+    four_phase_acc[1] = _phase * phase_inc;
+    four_phase_acc[2] = _phase * phase_inc2;
+    four_phase_acc[3] = _phase * phase_inc3;
+    four_phase_acc_reg = _mm256_load_ps((float*)four_phase_acc);
+
+    for (number = 0; number < avx_iters; number++)
+        {
+            // Phase rotation on operand in_common starts here:
+            a = _mm256_load_ps((float*)_in_common);
+            __VOLK_GNSSSDR_PREFETCH(_in_common + 16);
+            z = _mm256_complexmul_fma_ps(a, four_phase_acc_reg);
+            four_phase_acc_reg = _mm256_complexmul_fma_ps(four_phase_acc_reg, four_phase_inc_reg);
+
+            // z * a = a * zl + swap(a) * (-zi, zi, ...), two FMAs per vector
+            zl = _mm256_moveldup_ps(z);                             // Load zl with cr,cr,dr,dr
+            zh = _mm256_xor_ps(_mm256_movehdup_ps(z), real_sign);  // Load zh with -ci,ci,-di,di
+
+            // next four samples
+            _in_common += 4;
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    a = _mm256_load_ps((float*)&(_in_a[n_vec][number * 4]));
+                    acc[n_vec] = _mm256_fmadd_ps(a, zl, acc[n_vec]);
+                    a = _mm256_shuffle_ps(a, a, 0xB1);
+                    acc[n_vec] = _mm256_fmadd_ps(a, zh, acc[n_vec]);
+                }
+            // Regenerate phase
+            if ((number % 128) == 0)
+                {
+                    four_phase_acc_reg = _mm256_complexnormalise_fma_ps(four_phase_acc_reg);
+                }
+        }
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            _mm256_store_ps((float*)dotProductVector, acc[n_vec]);  // Store the results back into the dot product vector
+            dotProduct = lv_cmake(0, 0);
+            for (i = 0; i < 4; ++i)
+                {
+                    dotProduct = dotProduct + dotProductVector[i];
+                }
+            result[n_vec] = dotProduct;
+        }
+
+    four_phase_acc_reg = _mm256_complexnormalise_fma_ps(four_phase_acc_reg);
+    _mm256_store_ps((float*)four_phase_acc, four_phase_acc_reg);
+    _phase = four_phase_acc[0];
+    _mm256_zeroupper();
+
+    for (n = avx_iters * 4; n < num_points; n++)
+        {
+            tmp32_1 = *_in_common++ * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    tmp32_2 = tmp32_1 * _in_a[n_vec][n];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+    (*phase) = _phase;
+}
+#endif /* LV_HAVE_AVX2 && LV_HAVE_FMA */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_u_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_32fc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    lv_32fc_t dotProduct = lv_cmake(0, 0);
+    lv_32fc_t tmp32_1, tmp32_2;
+    const unsigned int avx512_iters = num_points / 8;
+    int n_vec;
+    int i;
+    unsigned int number;
+    unsigned int n;
+    const lv_32fc_t** _in_a = in_a;
+    const lv_32fc_t* _in_common = in_common;
+    lv_32fc_t _phase = (*phase);
+
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    __m512 acc[num_a_vectors];
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            acc[n_vec] = _mm512_setzero_ps();
+            result[n_vec] = lv_cmake(0, 0);
+        }
+
+    // phase rotation registers
+    __m512 a, eight_phase_acc_reg, z, zl, zh;
+
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t eight_phase_acc[8];
+    lv_32fc_t phase_inc8 = phase_inc;
+    phase_inc8 *= phase_inc8;
+    phase_inc8 *= phase_inc8;
+    phase_inc8 *= phase_inc8;  // phase_inc8 = phase_inc^8
+    for (i = 0; i < 8; ++i)
+        {
+            eight_phase_acc[i] = phase_inc8;
+        }
+    const __m512 eight_phase_inc_reg = _mm512_load_ps((float*)eight_phase_acc);
+
+    for (i = 0; i < 8; ++i)
+        {
+            eight_phase_acc[i] = _phase;
+            _phase *= phase_inc;
+        }
+    eight_phase_acc_reg = _mm512_load_ps((float*)eight_phase_acc);
+
+    for (number = 0; number < avx512_iters; number++)
+        {
+            // Phase rotation on operand in_common starts here:
+            a = _mm512_loadu_ps((float*)_in_common);
+            __VOLK_GNSSSDR_PREFETCH(_in_common + 16);
+            z = _mm512_complexmul_ps(a, eight_phase_acc_reg);
+            eight_phase_acc_reg = _mm512_complexmul_ps(eight_phase_acc_reg, eight_phase_inc_reg);
+
+            // z * a = a * zl + swap(a) * (-zi, zi, ...), two FMAs per vector
+            zl = _mm512_moveldup_ps(z);                          // Load zl with cr,cr,dr,dr
+            zh = _mm512_negate_real_ps(_mm512_movehdup_ps(z));  // Load zh with -ci,ci,-di,di
+
+            // next eight samples
+            _in_common += 8;
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    a = _mm512_loadu_ps((float*)&(_in_a[n_vec][number * 8]));
+                    acc[n_vec] = _mm512_fmadd_ps(a, zl, acc[n_vec]);
+                    a = _mm512_shuffle_ps(a, a, 0xB1);
+                    acc[n_vec] = _mm512_fmadd_ps(a, zh, acc[n_vec]);
+                }
+            // Regenerate phase
+            if ((number % 64) == 0)
+                {
+                    eight_phase_acc_reg = _mm512_complexnormalise_ps(eight_phase_acc_reg);
+                }
+        }
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            _mm512_store_ps((float*)dotProductVector, acc[n_vec]);  // Store the results back into the dot product vector
+            dotProduct = lv_cmake(0, 0);
+            for (i = 0; i < 8; ++i)
+                {
+                    dotProduct = dotProduct + dotProductVector[i];
+                }
+            result[n_vec] = dotProduct;
+        }
+
+    eight_phase_acc_reg = _mm512_complexnormalise_ps(eight_phase_acc_reg);
+    _mm512_store_ps((float*)eight_phase_acc, eight_phase_acc_reg);
+    _phase = eight_phase_acc[0];
+
+    for (n = avx512_iters * 8; n < num_points; n++)
+        {
+            tmp32_1 = *_in_common++ * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    tmp32_2 = tmp32_1 * _in_a[n_vec][n];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+    (*phase) = _phase;
+}
+#endif /* LV_HAVE_AVX512F */
+
+
+#ifdef LV_HAVE_AVX512F
+#include <volk_gnsssdr/volk_gnsssdr_avx512_intrinsics.h>
+#include <immintrin.h>
+static inline void volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_a_avx512f(lv_32fc_t* result, const lv_32fc_t* in_common, const lv_32fc_t phase_inc, lv_32fc_t* phase, const lv_32fc_t** in_a, int num_a_vectors, unsigned int num_points)
+{
+    lv_32fc_t dotProduct = lv_cmake(0, 0);
+    lv_32fc_t tmp32_1, tmp32_2;
+    const unsigned int avx512_iters = num_points / 8;
+    int n_vec;
+    int i;
+    unsigned int number;
+    unsigned int n;
+    const lv_32fc_t** _in_a = in_a;
+    const lv_32fc_t* _in_common = in_common;
+    lv_32fc_t _phase = (*phase);
+
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t dotProductVector[8];
+
+    __m512 acc[num_a_vectors];
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            acc[n_vec] = _mm512_setzero_ps();
+            result[n_vec] = lv_cmake(0, 0);
+        }
+
+    // phase rotation registers
+    __m512 a, eight_phase_acc_reg, z, zl, zh;
+
+    __VOLK_ATTR_ALIGNED(64)
+    lv_32fc_t eight_phase_acc[8];
+    lv_32fc_t phase_inc8 = phase_inc;
+    phase_inc8 *= phase_inc8;
+    phase_inc8 *= phase_inc8;
+    phase_inc8 *= phase_inc8;  // phase_inc8 = phase_inc^8
+    for (i = 0; i < 8; ++i)
+        {
+            eight_phase_acc[i] = phase_inc8;
+        }
+    const __m512 eight_phase_inc_reg = _mm512_load_ps((float*)eight_phase_acc);
+
+    for (i = 0; i < 8; ++i)
+        {
+            eight_phase_acc[i] = _phase;
+            _phase *= phase_inc;
+        }
+    eight_phase_acc_reg = _mm512_load_ps((float*)eight_phase_acc);
+
+    for (number = 0; number < avx512_iters; number++)
+        {
+            // Phase rotation on operand in_common starts here:
+            a = _mm512_load_ps((float*)_in_common);
+            __VOLK_GNSSSDR_PREFETCH(_in_common + 16);
+            z = _mm512_complexmul_ps(a, eight_phase_acc_reg);
+            eight_phase_acc_reg = _mm512_complexmul_ps(eight_phase_acc_reg, eight_phase_inc_reg);
+
+            // z * a = a * zl + swap(a) * (-zi, zi, ...), two FMAs per vector
+            zl = _mm512_moveldup_ps(z);                          // Load zl with cr,cr,dr,dr
+            zh = _mm512_negate_real_ps(_mm512_movehdup_ps(z));  // Load zh with -ci,ci,-di,di
+
+            // next eight samples
+            _in_common += 8;
+
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    a = _mm512_load_ps((float*)&(_in_a[n_vec][number * 8]));
+                    acc[n_vec] = _mm512_fmadd_ps(a, zl, acc[n_vec]);
+                    a = _mm512_shuffle_ps(a, a, 0xB1);
+                    acc[n_vec] = _mm512_fmadd_ps(a, zh, acc[n_vec]);
+                }
+            // Regenerate phase
+            if ((number % 64) == 0)
+                {
+                    eight_phase_acc_reg = _mm512_complexnormalise_ps(eight_phase_acc_reg);
+                }
+        }
+
+    for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+        {
+            _mm512_store_ps((float*)dotProductVector, acc[n_vec]);  // Store the results back into the dot product vector
+            dotProduct = lv_cmake(0, 0);
+            for (i = 0; i < 8; ++i)
+                {
+                    dotProduct = dotProduct + dotProductVector[i];
+                }
+            result[n_vec] = dotProduct;
+        }
+
+    eight_phase_acc_reg = _mm512_complexnormalise_ps(eight_phase_acc_reg);
+    _mm512_store_ps((float*)eight_phase_acc, eight_phase_acc_reg);
+    _phase = eight_phase_acc[0];
+
+    for (n = avx512_iters * 8; n < num_points; n++)
+        {
+            tmp32_1 = *_in_common++ * _phase;
+            _phase *= phase_inc;
+            for (n_vec = 0; n_vec < num_a_vectors; n_vec++)
+                {
+                    tmp32_2 = tmp32_1 * _in_a[n_vec][n];
+                    result[n_vec] += tmp32_2;
+                }
+        }
+    (*phase) = _phase;
+}
+#endif /* LV_HAVE_AVX512F */
+
+
 #ifdef LV_HAVE_NEONV7
 #include <arm_neon.h>
 
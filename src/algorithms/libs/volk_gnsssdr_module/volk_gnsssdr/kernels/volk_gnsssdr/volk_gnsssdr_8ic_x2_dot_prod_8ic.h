@@ -405,6 +405,148 @@ static inline void volk_gnsssdr_8ic_x2_dot_prod_8ic_a_sse4_1(lv_8sc_t* result, c
 #endif /*LV_HAVE_SSE4_1*/
 
 
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_x2_dot_prod_8ic_u_avx2(lv_8sc_t* result, const lv_8sc_t* in_a, const lv_8sc_t* in_b, unsigned int num_points)
+{
+    lv_8sc_t dotProduct;
+    memset(&dotProduct, 0x0, 2 * sizeof(char));
+    unsigned int number;
+    unsigned int i;
+    const lv_8sc_t* a = in_a;
+    const lv_8sc_t* b = in_b;
+
+    const unsigned int avx2_iters = num_points / 16;
+
+    if (avx2_iters > 0)
+        {
+            __m256i x, y, mult1, realx, imagx, realy, imagy, realc, imagc, totalc, realcacc, imagcacc;
+
+            mult1 = _mm256_set1_epi16(0x00FF);
+            realcacc = _mm256_setzero_si256();
+            imagcacc = _mm256_setzero_si256();
+
+            for (number = 0; number < avx2_iters; number++)
+                {
+                    x = _mm256_loadu_si256((__m256i*)a);
+                    y = _mm256_loadu_si256((__m256i*)b);
+
+                    imagx = _mm256_srli_si256(x, 1);
+                    imagx = _mm256_and_si256(imagx, mult1);
+                    realx = _mm256_and_si256(x, mult1);
+
+                    imagy = _mm256_srli_si256(y, 1);
+                    imagy = _mm256_and_si256(imagy, mult1);
+                    realy = _mm256_and_si256(y, mult1);
+
+                    realc = _mm256_sub_epi16(_mm256_mullo_epi16(realx, realy), _mm256_mullo_epi16(imagx, imagy));
+                    imagc = _mm256_add_epi16(_mm256_mullo_epi16(realx, imagy), _mm256_mullo_epi16(imagx, realy));
+
+                    realcacc = _mm256_add_epi16(realcacc, realc);
+                    imagcacc = _mm256_add_epi16(imagcacc, imagc);
+
+                    a += 16;
+                    b += 16;
+                }
+
+            imagcacc = _mm256_slli_si256(imagcacc, 1);
+
+            totalc = _mm256_blendv_epi8(imagcacc, realcacc, mult1);
+
+            __VOLK_ATTR_ALIGNED(32)
+            lv_8sc_t dotProductVector[16];
+
+            _mm256_store_si256((__m256i*)dotProductVector, totalc);  // Store the results back into the dot product vector
+
+            for (i = 0; i < 16; ++i)
+                {
+                    dotProduct += dotProductVector[i];
+                }
+        }
+
+    for (i = avx2_iters * 16; i < num_points; ++i)
+        {
+            dotProduct += (*a++) * (*b++);
+        }
+
+    *result = dotProduct;
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_x2_dot_prod_8ic_a_avx2(lv_8sc_t* result, const lv_8sc_t* in_a, const lv_8sc_t* in_b, unsigned int num_points)
+{
+    lv_8sc_t dotProduct;
+    memset(&dotProduct, 0x0, 2 * sizeof(char));
+    unsigned int number;
+    unsigned int i;
+    const lv_8sc_t* a = in_a;
+    const lv_8sc_t* b = in_b;
+
+    const unsigned int avx2_iters = num_points / 16;
+
+    if (avx2_iters > 0)
+        {
+            __m256i x, y, mult1, realx, imagx, realy, imagy, realc, imagc, totalc, realcacc, imagcacc;
+
+            mult1 = _mm256_set1_epi16(0x00FF);
+            realcacc = _mm256_setzero_si256();
+            imagcacc = _mm256_setzero_si256();
+
+            for (number = 0; number < avx2_iters; number++)
+                {
+                    x = _mm256_load_si256((__m256i*)a);
+                    y = _mm256_load_si256((__m256i*)b);
+
+                    imagx = _mm256_srli_si256(x, 1);
+                    imagx = _mm256_and_si256(imagx, mult1);
+                    realx = _mm256_and_si256(x, mult1);
+
+                    imagy = _mm256_srli_si256(y, 1);
+                    imagy = _mm256_and_si256(imagy, mult1);
+                    realy = _mm256_and_si256(y, mult1);
+
+                    realc = _mm256_sub_epi16(_mm256_mullo_epi16(realx, realy), _mm256_mullo_epi16(imagx, imagy));
+                    imagc = _mm256_add_epi16(_mm256_mullo_epi16(realx, imagy), _mm256_mullo_epi16(imagx, realy));
+
+                    realcacc = _mm256_add_epi16(realcacc, realc);
+                    imagcacc = _mm256_add_epi16(imagcacc, imagc);
+
+                    a += 16;
+                    b += 16;
+                }
+
+            imagcacc = _mm256_slli_si256(imagcacc, 1);
+
+            totalc = _mm256_blendv_epi8(imagcacc, realcacc, mult1);
+
+            __VOLK_ATTR_ALIGNED(32)
+            lv_8sc_t dotProductVector[16];
+
+            _mm256_store_si256((__m256i*)dotProductVector, totalc);  // Store the results back into the dot product vector
+
+            for (i = 0; i < 16; ++i)
+                {
+                    dotProduct += dotProductVector[i];
+                }
+        }
+
+    for (i = avx2_iters * 16; i < num_points; ++i)
+        {
+            dotProduct += (*a++) * (*b++);
+        }
+
+    *result = dotProduct;
+}
+
+#endif /*LV_HAVE_AVX2*/
+
+
 #ifdef LV_HAVE_ORC
 
 extern void volk_gnsssdr_8ic_x2_dot_prod_8ic_a_orc_impl(short* resRealShort, short* resImagShort, const lv_8sc_t* in_a, const lv_8sc_t* in_b, unsigned int num_points);
@@ -0,0 +1,222 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack2bit_32f.h
+ * \brief VOLK_GNSSSDR kernel: unpacks 2-bit samples packed into bytes to
+ * floats.
+ *
+ * VOLK_GNSSSDR kernel that expands bytes holding four 2-bit two's complement
+ * samples into one float per sample, by table lookup.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack2bit_32f
+ *
+ * \b Overview
+ *
+ * Unpacks bytes holding four 2-bit two's complement samples each, least
+ * significant bits first, into their values as floats: the 2-bit codes
+ * 0, 1, 2, 3 become 0.0, 1.0, -2.0, -1.0.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack2bit_32f(float* result, const unsigned char* packed, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed: Packed samples. (num_points + 3) / 4 bytes are read.
+ * \li num_points: The number of unpacked samples.
+ *
+ * \b Outputs
+ * \li result: One float per sample.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack2bit_32f_H
+#define INCLUDED_volk_gnsssdr_8u_unpack2bit_32f_H
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack2bit_32f_generic(float* result, const unsigned char* packed, unsigned int num_points)
+{
+    const float levels[4] = {0.0F, 1.0F, -2.0F, -1.0F};
+    unsigned int n;
+    for (n = 0; n < num_points; n++)
+        {
+            result[n] = levels[(packed[n / 4] >> (2 * (n % 4))) & 3];
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_32f_u_sse4_1(float* result, const unsigned char* packed, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 64;
+    unsigned int number;
+    unsigned int k;
+    const unsigned char* in = packed;
+    float* out = result;
+
+    const __m128i low_field = _mm_setr_epi8(0, 1, -2, -1, 0, 1, -2, -1, 0, 1, -2, -1, 0, 1, -2, -1);
+    const __m128i high_field = _mm_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, -2, -2, -2, -2, -1, -1, -1, -1);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    __m128i x, lo, hi, s0, s1, s2, s3, a, b;
+    __m128i o[4];
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            x = _mm_loadu_si128((const __m128i*)in);
+            lo = _mm_and_si128(x, nibble_mask);
+            hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble_mask);
+            s0 = _mm_shuffle_epi8(low_field, lo);
+            s1 = _mm_shuffle_epi8(high_field, lo);
+            s2 = _mm_shuffle_epi8(low_field, hi);
+            s3 = _mm_shuffle_epi8(high_field, hi);
+
+            a = _mm_unpacklo_epi8(s0, s1);
+            b = _mm_unpacklo_epi8(s2, s3);
+            o[0] = _mm_unpacklo_epi16(a, b);
+            o[1] = _mm_unpackhi_epi16(a, b);
+            a = _mm_unpackhi_epi8(s0, s1);
+            b = _mm_unpackhi_epi8(s2, s3);
+            o[2] = _mm_unpacklo_epi16(a, b);
+            o[3] = _mm_unpackhi_epi16(a, b);
+
+            for (k = 0; k < 4; k++)
+                {
+                    _mm_storeu_ps(out, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(o[k])));
+                    _mm_storeu_ps(out + 4, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(o[k], 4))));
+                    _mm_storeu_ps(out + 8, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(o[k], 8))));
+                    _mm_storeu_ps(out + 12, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(o[k], 12))));
+                    out += 16;
+                }
+            in += 16;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_32f_generic(out, in, num_points - sse_iters * 64);
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_32f_u_avx2(float* result, const unsigned char* packed, unsigned int num_points)
+{
+    const unsigned int avx2_iters = num_points / 64;
+    unsigned int number;
+    unsigned int k;
+    const unsigned char* in = packed;
+    float* out = result;
+
+    const __m128i low_field = _mm_setr_epi8(0, 1, -2, -1, 0, 1, -2, -1, 0, 1, -2, -1, 0, 1, -2, -1);
+    const __m128i high_field = _mm_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1, -2, -2, -2, -2, -1, -1, -1, -1);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    __m128i x, lo, hi, s0, s1, s2, s3, a, b;
+    __m128i o[4];
+
+    for (number = 0; number < avx2_iters; number++)
+        {
+            x = _mm_loadu_si128((const __m128i*)in);
+            lo = _mm_and_si128(x, nibble_mask);
+            hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble_mask);
+            s0 = _mm_shuffle_epi8(low_field, lo);
+            s1 = _mm_shuffle_epi8(high_field, lo);
+            s2 = _mm_shuffle_epi8(low_field, hi);
+            s3 = _mm_shuffle_epi8(high_field, hi);
+
+            a = _mm_unpacklo_epi8(s0, s1);
+            b = _mm_unpacklo_epi8(s2, s3);
+            o[0] = _mm_unpacklo_epi16(a, b);
+            o[1] = _mm_unpackhi_epi16(a, b);
+            a = _mm_unpackhi_epi8(s0, s1);
+            b = _mm_unpackhi_epi8(s2, s3);
+            o[2] = _mm_unpacklo_epi16(a, b);
+            o[3] = _mm_unpackhi_epi16(a, b);
+
+            // the conversion to float is the bottleneck: do it eight samples at a time
+            for (k = 0; k < 4; k++)
+                {
+                    _mm256_storeu_ps(out, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(o[k])));
+                    _mm256_storeu_ps(out + 8, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(o[k], 8))));
+                    out += 16;
+                }
+            in += 16;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_32f_generic(out, in, num_points - avx2_iters * 64);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEONV7
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack2bit_32f_neon(float* result, const unsigned char* packed, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 32;
+    unsigned int number;
+    unsigned int k;
+    const unsigned char* in = packed;
+    float* out = result;
+
+    const int8_t low_field_values[16] = {0, 1, -2, -1, 0, 1, -2, -1, 0, 1, -2, -1, 0, 1, -2, -1};
+    const int8_t high_field_values[16] = {0, 0, 0, 0, 1, 1, 1, 1, -2, -2, -2, -2, -1, -1, -1, -1};
+    int8x8x2_t low_field, high_field;
+    low_field.val[0] = vld1_s8(low_field_values);
+    low_field.val[1] = vld1_s8(low_field_values + 8);
+    high_field.val[0] = vld1_s8(high_field_values);
+    high_field.val[1] = vld1_s8(high_field_values + 8);
+    const uint8x8_t nibble_mask = vdup_n_u8(0x0F);
+    uint8x8_t x;
+    int8x8_t lo, hi;
+    int8x8x4_t samples;
+    int8_t interleaved[32];
+    int16x8_t wide;
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            x = vld1_u8(in);
+            __VOLK_GNSSSDR_PREFETCH(in + 32);
+            lo = vreinterpret_s8_u8(vand_u8(x, nibble_mask));
+            hi = vreinterpret_s8_u8(vshr_n_u8(x, 4));
+            samples.val[0] = vtbl2_s8(low_field, lo);
+            samples.val[1] = vtbl2_s8(high_field, lo);
+            samples.val[2] = vtbl2_s8(low_field, hi);
+            samples.val[3] = vtbl2_s8(high_field, hi);
+            vst4_s8(interleaved, samples);
+
+            for (k = 0; k < 4; k++)
+                {
+                    wide = vmovl_s8(vld1_s8(interleaved + 8 * k));
+                    vst1q_f32(out, vcvtq_f32_s32(vmovl_s16(vget_low_s16(wide))));
+                    vst1q_f32(out + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(wide))));
+                    out += 8;
+                }
+            in += 8;
+        }
+
+    volk_gnsssdr_8u_unpack2bit_32f_generic(out, in, num_points - neon_iters * 32);
+}
+
+#endif /* LV_HAVE_NEONV7 */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack2bit_32f_H */
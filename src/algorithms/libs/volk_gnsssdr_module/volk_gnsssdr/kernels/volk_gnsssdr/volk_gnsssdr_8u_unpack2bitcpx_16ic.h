@@ -0,0 +1,222 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack2bitcpx_16ic.h
+ * \brief VOLK_GNSSSDR kernel: unpacks 2-bit complex samples packed into
+ * bytes to 16 bits complex samples.
+ *
+ * VOLK_GNSSSDR kernel that expands bytes holding two complex samples with
+ * 2-bit I and Q components into 16 bits complex samples, by table lookup.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack2bitcpx_16ic
+ *
+ * \b Overview
+ *
+ * Unpacks bytes holding two complex samples each. The most significant
+ * nibble holds the first sample and the least significant nibble the second
+ * one; within a nibble, the two least significant bits are the in-phase
+ * component and the two most significant bits the quadrature component
+ * (Q1 Q0 I1 I0). Each 2-bit two's complement component s is mapped to the
+ * odd level 2 * s + 1, that is, the 2-bit codes 0, 1, 2, 3 become
+ * 1, 3, -3, -1.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack2bitcpx_16ic(lv_16sc_t* result, const unsigned char* packed, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed: Packed samples. (num_points + 1) / 2 bytes are read.
+ * \li num_points: The number of unpacked complex samples.
+ *
+ * \b Outputs
+ * \li result: The unpacked complex samples.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack2bitcpx_16ic_H
+#define INCLUDED_volk_gnsssdr_8u_unpack2bitcpx_16ic_H
+
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack2bitcpx_16ic_generic(lv_16sc_t* result, const unsigned char* packed, unsigned int num_points)
+{
+    const int16_t levels[4] = {1, 3, -3, -1};
+    int16_t* out = (int16_t*)result;
+    unsigned int n;
+    unsigned char nibble;
+    for (n = 0; n < num_points; n++)
+        {
+            nibble = (n % 2) ? (packed[n / 2] & 0x0F) : (packed[n / 2] >> 4);
+            out[2 * n] = levels[nibble & 3];
+            out[2 * n + 1] = levels[nibble >> 2];
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bitcpx_16ic_u_ssse3(lv_16sc_t* result, const unsigned char* packed, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 32;
+    unsigned int number;
+    const unsigned char* in = packed;
+    int16_t* out = (int16_t*)result;
+
+    const __m128i low_field = _mm_setr_epi8(1, 3, -3, -1, 1, 3, -3, -1, 1, 3, -3, -1, 1, 3, -3, -1);
+    const __m128i high_field = _mm_setr_epi8(1, 1, 1, 1, 3, 3, 3, 3, -3, -3, -3, -3, -1, -1, -1, -1);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i x, lo, hi, i0, q0, i1, q1, a, b, o, sign;
+    unsigned int k;
+    __m128i halves[4];
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            x = _mm_loadu_si128((const __m128i*)in);
+            lo = _mm_and_si128(x, nibble_mask);
+            hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble_mask);
+            i0 = _mm_shuffle_epi8(low_field, hi);
+            q0 = _mm_shuffle_epi8(high_field, hi);
+            i1 = _mm_shuffle_epi8(low_field, lo);
+            q1 = _mm_shuffle_epi8(high_field, lo);
+
+            a = _mm_unpacklo_epi8(i0, q0);
+            b = _mm_unpacklo_epi8(i1, q1);
+            halves[0] = _mm_unpacklo_epi16(a, b);
+            halves[1] = _mm_unpackhi_epi16(a, b);
+            a = _mm_unpackhi_epi8(i0, q0);
+            b = _mm_unpackhi_epi8(i1, q1);
+            halves[2] = _mm_unpacklo_epi16(a, b);
+            halves[3] = _mm_unpackhi_epi16(a, b);
+
+            // sign extension to 16 bits
+            for (k = 0; k < 4; k++)
+                {
+                    o = halves[k];
+                    sign = _mm_cmpgt_epi8(zero, o);
+                    _mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi8(o, sign));
+                    _mm_storeu_si128((__m128i*)(out + 8), _mm_unpackhi_epi8(o, sign));
+                    out += 16;
+                }
+            in += 16;
+        }
+
+    volk_gnsssdr_8u_unpack2bitcpx_16ic_generic((lv_16sc_t*)out, in, num_points - sse_iters * 32);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack2bitcpx_16ic_u_avx2(lv_16sc_t* result, const unsigned char* packed, unsigned int num_points)
+{
+    const unsigned int avx2_iters = num_points / 32;
+    unsigned int number;
+    const unsigned char* in = packed;
+    int16_t* out = (int16_t*)result;
+
+    const __m128i low_field = _mm_setr_epi8(1, 3, -3, -1, 1, 3, -3, -1, 1, 3, -3, -1, 1, 3, -3, -1);
+    const __m128i high_field = _mm_setr_epi8(1, 1, 1, 1, 3, 3, 3, 3, -3, -3, -3, -3, -1, -1, -1, -1);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    __m128i x, lo, hi, i0, q0, i1, q1, a, b;
+    unsigned int k;
+    __m128i halves[4];
+
+    for (number = 0; number < avx2_iters; number++)
+        {
+            x = _mm_loadu_si128((const __m128i*)in);
+            lo = _mm_and_si128(x, nibble_mask);
+            hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble_mask);
+            i0 = _mm_shuffle_epi8(low_field, hi);
+            q0 = _mm_shuffle_epi8(high_field, hi);
+            i1 = _mm_shuffle_epi8(low_field, lo);
+            q1 = _mm_shuffle_epi8(high_field, lo);
+
+            a = _mm_unpacklo_epi8(i0, q0);
+            b = _mm_unpacklo_epi8(i1, q1);
+            halves[0] = _mm_unpacklo_epi16(a, b);
+            halves[1] = _mm_unpackhi_epi16(a, b);
+            a = _mm_unpackhi_epi8(i0, q0);
+            b = _mm_unpackhi_epi8(i1, q1);
+            halves[2] = _mm_unpacklo_epi16(a, b);
+            halves[3] = _mm_unpackhi_epi16(a, b);
+
+            for (k = 0; k < 4; k++)
+                {
+                    _mm256_storeu_si256((__m256i*)out, _mm256_cvtepi8_epi16(halves[k]));
+                    out += 16;
+                }
+            in += 16;
+        }
+
+    volk_gnsssdr_8u_unpack2bitcpx_16ic_generic((lv_16sc_t*)out, in, num_points - avx2_iters * 32);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEONV7
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack2bitcpx_16ic_neon(lv_16sc_t* result, const unsigned char* packed, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 16;
+    unsigned int number;
+    const unsigned char* in = packed;
+    int16_t* out = (int16_t*)result;
+
+    const int8_t low_field_values[16] = {1, 3, -3, -1, 1, 3, -3, -1, 1, 3, -3, -1, 1, 3, -3, -1};
+    const int8_t high_field_values[16] = {1, 1, 1, 1, 3, 3, 3, 3, -3, -3, -3, -3, -1, -1, -1, -1};
+    int8x8x2_t low_field, high_field;
+    low_field.val[0] = vld1_s8(low_field_values);
+    low_field.val[1] = vld1_s8(low_field_values + 8);
+    high_field.val[0] = vld1_s8(high_field_values);
+    high_field.val[1] = vld1_s8(high_field_values + 8);
+    const uint8x8_t nibble_mask = vdup_n_u8(0x0F);
+    uint8x8_t x;
+    int8x8_t lo, hi;
+    int16x8x4_t samples;
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            x = vld1_u8(in);
+            __VOLK_GNSSSDR_PREFETCH(in + 32);
+            lo = vreinterpret_s8_u8(vand_u8(x, nibble_mask));
+            hi = vreinterpret_s8_u8(vshr_n_u8(x, 4));
+            samples.val[0] = vmovl_s8(vtbl2_s8(low_field, hi));
+            samples.val[1] = vmovl_s8(vtbl2_s8(high_field, hi));
+            samples.val[2] = vmovl_s8(vtbl2_s8(low_field, lo));
+            samples.val[3] = vmovl_s8(vtbl2_s8(high_field, lo));
+            vst4q_s16(out, samples);
+            in += 8;
+            out += 32;
+        }
+
+    volk_gnsssdr_8u_unpack2bitcpx_16ic_generic((lv_16sc_t*)out, in, num_points - neon_iters * 16);
+}
+
+#endif /* LV_HAVE_NEONV7 */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack2bitcpx_16ic_H */
@@ -0,0 +1,164 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack4bit_8i.h
+ * \brief VOLK_GNSSSDR kernel: unpacks 4-bit samples packed into bytes.
+ *
+ * VOLK_GNSSSDR kernel that expands bytes holding two 4-bit two's complement
+ * samples into one signed char per sample, by table lookup.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack4bit_8i
+ *
+ * \b Overview
+ *
+ * Unpacks bytes holding two 4-bit two's complement samples each, least
+ * significant nibble first. Each sample s is mapped to the odd level
+ * 2 * s + 1, from -15 to 15.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack4bit_8i(char* result, const unsigned char* packed, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed: Packed samples. (num_points + 1) / 2 bytes are read.
+ * \li num_points: The number of unpacked samples.
+ *
+ * \b Outputs
+ * \li result: One signed char per sample.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack4bit_8i_H
+#define INCLUDED_volk_gnsssdr_8u_unpack4bit_8i_H
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack4bit_8i_generic(char* result, const unsigned char* packed, unsigned int num_points)
+{
+    const char levels[16] = {1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1};
+    unsigned int n;
+    for (n = 0; n < num_points; n++)
+        {
+            result[n] = levels[(packed[n / 2] >> (4 * (n % 2))) & 0x0F];
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack4bit_8i_u_ssse3(char* result, const unsigned char* packed, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 32;
+    unsigned int number;
+    const unsigned char* in = packed;
+    char* out = result;
+
+    const __m128i levels = _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    __m128i x, lo, hi;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            x = _mm_loadu_si128((const __m128i*)in);
+            lo = _mm_shuffle_epi8(levels, _mm_and_si128(x, nibble_mask));
+            hi = _mm_shuffle_epi8(levels, _mm_and_si128(_mm_srli_epi16(x, 4), nibble_mask));
+            _mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi8(lo, hi));
+            _mm_storeu_si128((__m128i*)(out + 16), _mm_unpackhi_epi8(lo, hi));
+            in += 16;
+            out += 32;
+        }
+
+    volk_gnsssdr_8u_unpack4bit_8i_generic(out, in, num_points - sse_iters * 32);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack4bit_8i_u_avx2(char* result, const unsigned char* packed, unsigned int num_points)
+{
+    const unsigned int avx2_iters = num_points / 64;
+    unsigned int number;
+    const unsigned char* in = packed;
+    char* out = result;
+
+    const __m256i levels = _mm256_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1,
+        1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1);
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+    __m256i x, lo, hi, o0, o1;
+
+    for (number = 0; number < avx2_iters; number++)
+        {
+            x = _mm256_loadu_si256((const __m256i*)in);
+            lo = _mm256_shuffle_epi8(levels, _mm256_and_si256(x, nibble_mask));
+            hi = _mm256_shuffle_epi8(levels, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble_mask));
+            // o0 holds the samples of bytes 0-7 and 16-23, o1 those of 8-15 and 24-31
+            o0 = _mm256_unpacklo_epi8(lo, hi);
+            o1 = _mm256_unpackhi_epi8(lo, hi);
+            _mm256_storeu_si256((__m256i*)out, _mm256_permute2x128_si256(o0, o1, 0x20));
+            _mm256_storeu_si256((__m256i*)(out + 32), _mm256_permute2x128_si256(o0, o1, 0x31));
+            in += 32;
+            out += 64;
+        }
+
+    volk_gnsssdr_8u_unpack4bit_8i_generic(out, in, num_points - avx2_iters * 64);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEONV7
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack4bit_8i_neon(char* result, const unsigned char* packed, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 16;
+    unsigned int number;
+    const unsigned char* in = packed;
+    char* out = result;
+
+    const int8_t level_values[16] = {1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1};
+    int8x8x2_t levels;
+    levels.val[0] = vld1_s8(level_values);
+    levels.val[1] = vld1_s8(level_values + 8);
+    const uint8x8_t nibble_mask = vdup_n_u8(0x0F);
+    uint8x8_t x;
+    int8x8x2_t samples;
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            x = vld1_u8(in);
+            __VOLK_GNSSSDR_PREFETCH(in + 32);
+            samples.val[0] = vtbl2_s8(levels, vreinterpret_s8_u8(vand_u8(x, nibble_mask)));
+            samples.val[1] = vtbl2_s8(levels, vreinterpret_s8_u8(vshr_n_u8(x, 4)));
+            vst2_s8((int8_t*)out, samples);
+            in += 8;
+            out += 16;
+        }
+
+    volk_gnsssdr_8u_unpack4bit_8i_generic(out, in, num_points - neon_iters * 16);
+}
+
+#endif /* LV_HAVE_NEONV7 */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack4bit_8i_H */
@@ -66,6 +66,10 @@ std::vector<volk_gnsssdr_test_case_t> init_test_list(volk_gnsssdr_test_params_t
     QA(VOLK_INIT_TEST(volk_gnsssdr_8ic_x2_multiply_8ic, test_params))
     QA(VOLK_INIT_TEST(volk_gnsssdr_8ic_s8ic_multiply_8ic, test_params))
     QA(VOLK_INIT_TEST(volk_gnsssdr_8u_x2_multiply_8u, test_params_more_iters))
+    QA(VOLK_INIT_TEST(volk_gnsssdr_8u_unpack2bit_8i, test_params))
+    QA(VOLK_INIT_TEST(volk_gnsssdr_8u_unpack2bit_32f, test_params))
+    QA(VOLK_INIT_TEST(volk_gnsssdr_8u_unpack4bit_8i, test_params))
+    QA(VOLK_INIT_TEST(volk_gnsssdr_8u_unpack2bitcpx_16ic, test_params))
     QA(VOLK_INIT_TEST(volk_gnsssdr_64f_accumulator_64f, test_params))
     QA(VOLK_INIT_TEST(volk_gnsssdr_32f_sincos_32fc, test_params_inacc))
     QA(VOLK_INIT_TEST(volk_gnsssdr_32f_index_max_32u, test_params))
@@ -89,6 +93,10 @@ std::vector<volk_gnsssdr_test_case_t> init_test_list(volk_gnsssdr_test_params_t
     QA(VOLK_INIT_PUPP(volk_gnsssdr_16ic_16i_rotator_dotprodxnpuppet_16ic, volk_gnsssdr_16ic_16i_rotator_dot_prod_16ic_xn, test_params_int16))
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_x2_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn, test_params_inacc))
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn, test_params_inacc));
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32u_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn, test_params_inacc));
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_resampler_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn, test_params_inacc));
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_16ic_32f_resampler_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn, test_params_inacc));
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8ic_32f_resampler_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_8ic_32f_resampler_rotator_dot_prod_32fc_xn, test_params_inacc));
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_high_dynamic_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn, test_params_inacc));
 
     return test_cases;
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2010-2020 (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software-defined Global Navigation Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+/*
+ * Checks that the dispatcher of a kernel calls the implementation stored in
+ * volk_gnsssdr_shape_config for the matching num_points bucket, and the one
+ * of volk_gnsssdr_config otherwise.
+ *
+ * The dispatchers read both files once per process, at the first call of
+ * each kernel, so this check runs in its own executable. It writes the files
+ * where the library reads them, so VOLK_CONFIGPATH must point to a scratch
+ * folder.
+ */
+
+#include "volk_gnsssdr/volk_gnsssdr.h"        // for volk_gnsssdr_64f_accumulator_64f
+#include "volk_gnsssdr/volk_gnsssdr_prefs.h"  // for volk_gnsssdr_store_shape_preference
+#include <cstdio>                             // for remove
+#include <cstdlib>                            // for getenv
+#include <cstring>                            // for strncpy
+#include <fstream>                            // for ofstream
+#include <iostream>                           // for cerr, cout
+#include <string>                             // for string
+#include <vector>                             // for vector
+
+int main()
+{
+    if (getenv("VOLK_CONFIGPATH") == nullptr)
+        {
+            std::cerr << "VOLK_CONFIGPATH must point to a scratch folder, since this test writes the volk_gnsssdr config files\n";
+            return 1;
+        }
+
+    // The summation order of the accumulator differs between the generic
+    // implementation and the SIMD ones, and so does the result for this input
+    const std::string kernel("volk_gnsssdr_64f_accumulator_64f");
+    const volk_gnsssdr_func_desc_t desc = volk_gnsssdr_64f_accumulator_64f_get_func_desc();
+    std::string other;
+    for (size_t i = 0; i < desc.n_impls; i++)
+        {
+            if (!desc.impl_alignment[i] && std::string(desc.impl_names[i]) != "generic")
+                {
+                    other = desc.impl_names[i];
+                }
+        }
+    if (other.empty())
+        {
+            std::cout << "Only the generic implementation of " << kernel << " is available: nothing to check\n";
+            return 0;
+        }
+
+    std::vector<double> input(4096, 0.0);
+    input[0] = 1e17;
+    input[1] = 1.0;
+    input[2] = 1.0;
+    input[3] = 1.0;
+    input[4] = -1e17;
+    double generic_result = 0.0;
+    double other_result = 0.0;
+    volk_gnsssdr_64f_accumulator_64f_manual(&generic_result, input.data(), 1000, "generic");
+    volk_gnsssdr_64f_accumulator_64f_manual(&other_result, input.data(), 1000, other.c_str());
+    if (generic_result == other_result)
+        {
+            std::cout << "generic and " << other << " give the same result: nothing to check\n";
+            return 0;
+        }
+
+    // other by default, generic for calls of 513 to 1024 points
+    char path[512];
+    volk_gnsssdr_get_config_path(path, false);
+    std::remove(path);
+    std::ofstream config(path);
+    config << kernel << ' ' << other << ' ' << other << '\n';
+    config.close();
+    volk_gnsssdr_get_shape_config_path(path, false);
+    std::remove(path);
+    volk_gnsssdr_shape_pref_t pref{};
+    strncpy(pref.name, kernel.c_str(), sizeof(pref.name) - 1);
+    pref.num_points_bucket = volk_gnsssdr_num_points_bucket(1000);
+    pref.num_vectors = 0;
+    strncpy(pref.impl_u, "generic", sizeof(pref.impl_u) - 1);
+    if (!volk_gnsssdr_store_shape_preference(&pref))
+        {
+            std::cerr << "Cannot write " << path << '\n';
+            return 1;
+        }
+
+    // first call of the dispatcher: the files are read now
+    int failures = 0;
+    double result = 0.0;
+    volk_gnsssdr_64f_accumulator_64f(&result, input.data(), 1000);
+    if (result != generic_result)
+        {
+            std::cerr << "1000 points: expected the generic implementation from volk_gnsssdr_shape_config\n";
+            failures++;
+        }
+    volk_gnsssdr_64f_accumulator_64f(&result, input.data(), 3000);
+    if (result != other_result)
+        {
+            std::cerr << "3000 points: expected " << other << " from volk_gnsssdr_config\n";
+            failures++;
+        }
+    volk_gnsssdr_64f_accumulator_64f(&result, input.data(), 513);
+    if (result != generic_result)
+        {
+            std::cerr << "513 points: expected the generic implementation from volk_gnsssdr_shape_config\n";
+            failures++;
+        }
+    volk_gnsssdr_64f_accumulator_64f(&result, input.data(), 512);
+    if (result != other_result)
+        {
+            std::cerr << "512 points: expected " << other << " from volk_gnsssdr_config\n";
+            failures++;
+        }
+
+    std::cout << "Shape dispatch of " << kernel << ": " << failures << " failures\n";
+    return failures == 0 ? 0 : 1;
+}
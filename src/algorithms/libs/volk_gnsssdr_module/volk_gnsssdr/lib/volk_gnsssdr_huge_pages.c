@@ -0,0 +1,463 @@
+/*
+ * Copyright (C) 2010-2020 (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software-defined Global Navigation Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // for syscall and MAP_ANONYMOUS
+#endif
+
+#include "volk_gnsssdr/volk_gnsssdr_malloc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if HAVE_HUGE_PAGES
+
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+
+#define HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+#define MAX_NUMA_NODES 16
+#define NUM_SIZE_CLASSES 5  // 64 KiB, 128 KiB, 256 KiB, 512 KiB and 1 MiB blocks
+#define MAX_SUBSYSTEMS 32
+#define HEADER_SIZE 64
+
+/*
+ * Large allocations are preceded by a header, so that they can be released
+ * without looking them up. The header is stored just before the returned pointer.
+ */
+enum
+{
+    BACKEND_MALLOC = 0,  // volk_gnsssdr_malloc
+    BACKEND_CLASS,       // block of a size class, carved from a huge page
+    BACKEND_REGION       // dedicated huge page mapping
+};
+
+typedef struct
+{
+    void *block;
+    size_t block_size;
+    size_t size;
+    int backend;
+    int node;
+    int size_class;
+    int subsystem;
+} alloc_header_t;
+
+typedef struct free_block
+{
+    struct free_block *next;
+    size_t size;
+} free_block_t;
+
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static struct
+{
+    int mode_initialized;
+    volk_gnsssdr_page_mode_t mode;
+    int explicit_warning_shown;
+    free_block_t *class_free[MAX_NUMA_NODES][NUM_SIZE_CLASSES];
+    free_block_t *region_free[MAX_NUMA_NODES];
+    volk_gnsssdr_alloc_stats_t stats[MAX_SUBSYSTEMS];
+    size_t n_subsystems;
+} pool;  // zero-initialized: VOLK_GNSSSDR_PAGES_DEFAULT and empty pools
+
+static __thread char current_subsystem[32];
+
+
+static size_t class_size(int size_class)
+{
+    return (size_t)VOLK_GNSSSDR_LARGE_ALLOC_MIN_BYTES << size_class;
+}
+
+
+// must be called with the mutex locked
+static void init_page_mode(void)
+{
+    if (!pool.mode_initialized)
+        {
+            const char *env = getenv("VOLK_GNSSSDR_HUGE_PAGES");
+            if (env != NULL && strcmp(env, "transparent") == 0)
+                {
+                    pool.mode = VOLK_GNSSSDR_PAGES_TRANSPARENT_HUGE;
+                }
+            else if (env != NULL && strcmp(env, "explicit") == 0)
+                {
+                    pool.mode = VOLK_GNSSSDR_PAGES_EXPLICIT_HUGE;
+                }
+            pool.mode_initialized = 1;
+        }
+}
+
+
+static int current_numa_node(void)
+{
+    unsigned int cpu = 0;
+    unsigned int node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, NULL) != 0 || node >= MAX_NUMA_NODES)
+        {
+            return 0;
+        }
+    return (int)node;
+}
+
+
+// prefers the pages of a new mapping to be placed in node, before they are touched
+static void bind_to_node(void *ptr, size_t size, int node)
+{
+#ifdef SYS_mbind
+    unsigned long nodemask = 1UL << node;
+    (void)syscall(SYS_mbind, ptr, size, MPOL_PREFERRED, &nodemask, sizeof(nodemask) * 8, 0);
+#else
+    (void)ptr;
+    (void)size;
+    (void)node;
+#endif
+}
+
+
+// maps size bytes (a multiple of HUGE_PAGE_SIZE) backed by huge pages, or returns NULL
+static void *map_huge_pages(size_t size, int node)
+{
+#ifdef MAP_HUGETLB
+    if (pool.mode == VOLK_GNSSSDR_PAGES_EXPLICIT_HUGE)
+        {
+            void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (ptr != MAP_FAILED)
+                {
+                    bind_to_node(ptr, size, node);
+                    return ptr;
+                }
+            if (!pool.explicit_warning_shown)
+                {
+                    fprintf(stderr, "VOLK_GNSSSDR: No explicit huge pages available (see /proc/sys/vm/nr_hugepages), using transparent huge pages\n");
+                    pool.explicit_warning_shown = 1;
+                }
+        }
+#endif
+    // over-map to get a mapping aligned to a huge page, then trim it
+    char *raw = (char *)mmap(NULL, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == (char *)MAP_FAILED)
+        {
+            return NULL;
+        }
+    char *aligned = (char *)(((size_t)raw + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1));
+    if (aligned > raw)
+        {
+            munmap(raw, (size_t)(aligned - raw));
+        }
+    if (aligned + size < raw + size + HUGE_PAGE_SIZE)
+        {
+            munmap(aligned + size, (size_t)(raw + size + HUGE_PAGE_SIZE - (aligned + size)));
+        }
+#ifdef MADV_HUGEPAGE
+    madvise(aligned, size, MADV_HUGEPAGE);
+#endif
+    bind_to_node(aligned, size, node);
+    return aligned;
+}
+
+
+// must be called with the mutex locked
+static void *get_class_block(int node, int size_class)
+{
+    free_block_t *block = pool.class_free[node][size_class];
+    if (block == NULL)
+        {
+            // carve a new huge page into blocks of this class
+            const size_t block_size = class_size(size_class);
+            char *page = (char *)map_huge_pages(HUGE_PAGE_SIZE, node);
+            if (page == NULL)
+                {
+                    return NULL;
+                }
+            for (size_t offset = HUGE_PAGE_SIZE; offset > 0; offset -= block_size)
+                {
+                    free_block_t *b = (free_block_t *)(page + offset - block_size);
+                    b->next = pool.class_free[node][size_class];
+                    b->size = block_size;
+                    pool.class_free[node][size_class] = b;
+                }
+            block = pool.class_free[node][size_class];
+        }
+    pool.class_free[node][size_class] = block->next;
+    return block;
+}
+
+
+// must be called with the mutex locked
+static void *get_region(int node, size_t region_size)
+{
+    free_block_t **link = &pool.region_free[node];
+    while (*link != NULL)
+        {
+            if ((*link)->size == region_size)
+                {
+                    free_block_t *region = *link;
+                    *link = region->next;
+                    return region;
+                }
+            link = &(*link)->next;
+        }
+    return map_huge_pages(region_size, node);
+}
+
+
+// must be called with the mutex locked
+static int subsystem_index(const char *name)
+{
+    if (name[0] == '\0')
+        {
+            name = "Unassigned";
+        }
+    for (size_t i = 0; i < pool.n_subsystems; i++)
+        {
+            if (strncmp(pool.stats[i].subsystem, name, sizeof(pool.stats[i].subsystem) - 1) == 0)
+                {
+                    return (int)i;
+                }
+        }
+    if (pool.n_subsystems == MAX_SUBSYSTEMS)
+        {
+            return MAX_SUBSYSTEMS - 1;  // the last subsystem gathers the overflow
+        }
+    volk_gnsssdr_alloc_stats_t *stats = &pool.stats[pool.n_subsystems];
+    snprintf(stats->subsystem, sizeof(stats->subsystem), "%s", name);
+    return (int)pool.n_subsystems++;
+}
+
+
+void volk_gnsssdr_set_page_mode(volk_gnsssdr_page_mode_t mode)
+{
+    pthread_mutex_lock(&pool_mutex);
+    pool.mode = mode;
+    pool.mode_initialized = 1;
+    pthread_mutex_unlock(&pool_mutex);
+}
+
+
+volk_gnsssdr_page_mode_t volk_gnsssdr_get_page_mode(void)
+{
+    pthread_mutex_lock(&pool_mutex);
+    init_page_mode();
+    const volk_gnsssdr_page_mode_t mode = pool.mode;
+    pthread_mutex_unlock(&pool_mutex);
+    return mode;
+}
+
+
+void volk_gnsssdr_set_alloc_subsystem(const char *subsystem)
+{
+    if (subsystem == NULL)
+        {
+            current_subsystem[0] = '\0';
+            return;
+        }
+    snprintf(current_subsystem, sizeof(current_subsystem), "%s", subsystem);
+}
+
+
+const char *volk_gnsssdr_get_alloc_subsystem(void)
+{
+    return current_subsystem;
+}
+
+
+void *volk_gnsssdr_malloc_sized(size_t size, size_t alignment)
+{
+    if (size < VOLK_GNSSSDR_LARGE_ALLOC_MIN_BYTES)
+        {
+            return volk_gnsssdr_malloc(size, alignment);
+        }
+    const size_t header_size = alignment > HEADER_SIZE ? alignment : HEADER_SIZE;
+    if (size > (size_t)-1 - header_size - HUGE_PAGE_SIZE)
+        {
+            return NULL;
+        }
+    const size_t total_size = size + header_size;
+
+    pthread_mutex_lock(&pool_mutex);
+    init_page_mode();
+    void *block = NULL;
+    size_t block_size = total_size;
+    int backend = BACKEND_MALLOC;
+    int node = 0;
+    int size_class = 0;
+    if (pool.mode != VOLK_GNSSSDR_PAGES_DEFAULT && header_size < HUGE_PAGE_SIZE)
+        {
+            node = current_numa_node();
+            while (size_class < NUM_SIZE_CLASSES && class_size(size_class) < total_size)
+                {
+                    size_class++;
+                }
+            if (size_class < NUM_SIZE_CLASSES && header_size <= class_size(size_class) / 2)
+                {
+                    block_size = class_size(size_class);
+                    block = get_class_block(node, size_class);
+                    backend = BACKEND_CLASS;
+                }
+            else
+                {
+                    block_size = (total_size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+                    block = get_region(node, block_size);
+                    backend = BACKEND_REGION;
+                }
+        }
+    if (block == NULL)
+        {
+            backend = BACKEND_MALLOC;
+            block_size = total_size;
+            block = volk_gnsssdr_malloc(total_size, header_size);
+            if (block == NULL)
+                {
+                    pthread_mutex_unlock(&pool_mutex);
+                    return NULL;
+                }
+        }
+
+    alloc_header_t *header = (alloc_header_t *)((char *)block + header_size - sizeof(alloc_header_t));
+    header->block = block;
+    header->block_size = block_size;
+    header->size = size;
+    header->backend = backend;
+    header->node = node;
+    header->size_class = size_class;
+    header->subsystem = subsystem_index(current_subsystem);
+
+    volk_gnsssdr_alloc_stats_t *stats = &pool.stats[header->subsystem];
+    stats->bytes += size;
+    stats->allocations++;
+    if (backend != BACKEND_MALLOC)
+        {
+            stats->huge_page_bytes += size;
+        }
+    if (stats->bytes > stats->peak_bytes)
+        {
+            stats->peak_bytes = stats->bytes;
+        }
+    pthread_mutex_unlock(&pool_mutex);
+    return (char *)block + header_size;
+}
+
+
+void volk_gnsssdr_free_sized(void *aptr, size_t size)
+{
+    if (aptr == NULL)
+        {
+            return;
+        }
+    if (size < VOLK_GNSSSDR_LARGE_ALLOC_MIN_BYTES)
+        {
+            volk_gnsssdr_free(aptr);
+            return;
+        }
+    const alloc_header_t *header = (const alloc_header_t *)((char *)aptr - sizeof(alloc_header_t));
+    void *block = header->block;
+    const size_t block_size = header->block_size;
+    const int backend = header->backend;
+    const int node = header->node;
+    const int size_class = header->size_class;
+
+    pthread_mutex_lock(&pool_mutex);
+    volk_gnsssdr_alloc_stats_t *stats = &pool.stats[header->subsystem];
+    stats->bytes -= header->size;
+    stats->allocations--;
+    if (backend != BACKEND_MALLOC)
+        {
+            stats->huge_page_bytes -= header->size;
+        }
+    if (backend == BACKEND_MALLOC)
+        {
+            pthread_mutex_unlock(&pool_mutex);
+            volk_gnsssdr_free(block);
+            return;
+        }
+    // huge pages are kept in the pool of the node they were bound to
+    free_block_t *b = (free_block_t *)block;
+    b->size = block_size;
+    if (backend == BACKEND_CLASS)
+        {
+            b->next = pool.class_free[node][size_class];
+            pool.class_free[node][size_class] = b;
+        }
+    else
+        {
+            b->next = pool.region_free[node];
+            pool.region_free[node] = b;
+        }
+    pthread_mutex_unlock(&pool_mutex);
+}
+
+
+size_t volk_gnsssdr_get_alloc_stats(volk_gnsssdr_alloc_stats_t *stats, size_t max_stats)
+{
+    pthread_mutex_lock(&pool_mutex);
+    const size_t n_subsystems = pool.n_subsystems;
+    for (size_t i = 0; i < n_subsystems && i < max_stats && stats != NULL; i++)
+        {
+            stats[i] = pool.stats[i];
+        }
+    pthread_mutex_unlock(&pool_mutex);
+    return n_subsystems;
+}
+
+#else  // HAVE_HUGE_PAGES
+
+void volk_gnsssdr_set_page_mode(volk_gnsssdr_page_mode_t mode)
+{
+    (void)mode;
+}
+
+
+volk_gnsssdr_page_mode_t volk_gnsssdr_get_page_mode(void)
+{
+    return VOLK_GNSSSDR_PAGES_DEFAULT;
+}
+
+
+void volk_gnsssdr_set_alloc_subsystem(const char *subsystem)
+{
+    (void)subsystem;
+}
+
+
+const char *volk_gnsssdr_get_alloc_subsystem(void)
+{
+    return "";
+}
+
+
+void *volk_gnsssdr_malloc_sized(size_t size, size_t alignment)
+{
+    return volk_gnsssdr_malloc(size, alignment);
+}
+
+
+void volk_gnsssdr_free_sized(void *aptr, size_t size)
+{
+    (void)size;
+    volk_gnsssdr_free(aptr);
+}
+
+
+size_t volk_gnsssdr_get_alloc_stats(volk_gnsssdr_alloc_stats_t *stats, size_t max_stats)
+{
+    (void)stats;
+    (void)max_stats;
+    return 0;
+}
+
+#endif  // HAVE_HUGE_PAGES
@@ -21,12 +21,14 @@
 #include <volk_gnsssdr/volk_gnsssdr_prefs.h>
 
 
-void volk_gnsssdr_get_config_path(char *path, bool read)
+static void volk_gnsssdr_get_path(char *path, bool read, const char *filename)
 {
     if (!path) return;
-    const char *suffix = "/.volk_gnsssdr/volk_gnsssdr_config";
-    const char *suffix2 = "/volk_gnsssdr/volk_gnsssdr_config";  // non-hidden
+    char suffix[64];
+    char suffix2[64];  // non-hidden
     char *home = NULL;
+    snprintf(suffix, sizeof(suffix), "/.volk_gnsssdr/%s", filename);
+    snprintf(suffix2, sizeof(suffix2), "/volk_gnsssdr/%s", filename);
 
     // allows config redirection via env variable
     home = getenv("VOLK_CONFIGPATH");
@@ -65,10 +67,10 @@ void volk_gnsssdr_get_config_path(char *path, bool read)
         }
 
     // check for system-wide config file
-    if (access("/etc/volk_gnsssdr/volk_gnsssdr_config", F_OK) != -1)
+    strncpy(path, "/etc", 512);
+    strcat(path, suffix2);
+    if (access(path, F_OK) != -1)
         {
-            strncpy(path, "/etc", 512);
-            strcat(path, suffix2);
             return;
         }
 
@@ -86,6 +88,18 @@ void volk_gnsssdr_get_config_path(char *path, bool read)
 }
 
 
+void volk_gnsssdr_get_config_path(char *path, bool read)
+{
+    volk_gnsssdr_get_path(path, read, "volk_gnsssdr_config");
+}
+
+
+void volk_gnsssdr_get_shape_config_path(char *path, bool read)
+{
+    volk_gnsssdr_get_path(path, read, "volk_gnsssdr_shape_config");
+}
+
+
 size_t volk_gnsssdr_load_preferences(volk_gnsssdr_arch_pref_t **prefs_res)
 {
     FILE *config_file;
@@ -119,3 +133,87 @@ size_t volk_gnsssdr_load_preferences(volk_gnsssdr_arch_pref_t **prefs_res)
     *prefs_res = prefs;
     return n_arch_prefs;
 }
+
+
+unsigned int volk_gnsssdr_num_points_bucket(unsigned int num_points)
+{
+    unsigned int bucket = 1;
+    while (bucket < num_points && bucket < 0x80000000U)
+        {
+            bucket <<= 1U;
+        }
+    return bucket;
+}
+
+
+size_t volk_gnsssdr_load_shape_preferences(volk_gnsssdr_shape_pref_t **prefs_res)
+{
+    FILE *config_file;
+    char path[512], line[512];
+    size_t n_shape_prefs = 0;
+    volk_gnsssdr_shape_pref_t *prefs = NULL;
+
+    volk_gnsssdr_get_shape_config_path(path, true);
+    if (!path[0]) return n_shape_prefs;  //no prefs found
+    config_file = fopen(path, "r");
+    if (!config_file) return n_shape_prefs;  //no prefs found
+
+    // each line holds: kernel_name num_points_bucket num_vectors impl_u
+    while (fgets(line, sizeof(line), config_file) != NULL)
+        {
+            void *new_prefs = realloc(prefs, (n_shape_prefs + 1) * sizeof(*prefs));
+            if (!new_prefs)
+                {
+                    printf("volk_gnsssdr_load_shape_preferences: bad malloc\n");
+                    break;
+                }
+            prefs = (volk_gnsssdr_shape_pref_t *)new_prefs;
+            volk_gnsssdr_shape_pref_t *p = prefs + n_shape_prefs;
+            if (sscanf(line, "%127s %u %u %127s", p->name, &p->num_points_bucket, &p->num_vectors, p->impl_u) == 4 && !strncmp(p->name, "volk_gnsssdr_", 13))
+                {
+                    n_shape_prefs++;
+                }
+        }
+    fclose(config_file);
+    *prefs_res = prefs;
+    return n_shape_prefs;
+}
+
+
+bool volk_gnsssdr_store_shape_preference(const volk_gnsssdr_shape_pref_t *pref)
+{
+    FILE *config_file;
+    char path[512];
+    size_t i;
+    volk_gnsssdr_shape_pref_t *prefs = NULL;
+    const size_t n_shape_prefs = volk_gnsssdr_load_shape_preferences(&prefs);
+
+    volk_gnsssdr_get_shape_config_path(path, false);
+    if (!path[0])
+        {
+            free(prefs);
+            return false;
+        }
+    config_file = fopen(path, "w");
+    if (!config_file)
+        {
+            free(prefs);
+            return false;
+        }
+
+    // rewrite the file, replacing the entry with the same shape if there is one
+    fprintf(config_file, "#this file is generated by volk_gnsssdr_profile and by the receiver kernel calibration.\n");
+    fprintf(config_file, "#each line holds the function name, the num_points bucket, the number of vectors (0 for any) and the preferred architecture.\n");
+    for (i = 0; i < n_shape_prefs; i++)
+        {
+            const volk_gnsssdr_shape_pref_t *p = prefs + i;
+            if (strncmp(p->name, pref->name, sizeof(p->name)) || p->num_points_bucket != pref->num_points_bucket || p->num_vectors != pref->num_vectors)
+                {
+                    fprintf(config_file, "%s %u %u %s\n", p->name, p->num_points_bucket, p->num_vectors, p->impl_u);
+                }
+        }
+    fprintf(config_file, "%s %u %u %s\n", pref->name, pref->num_points_bucket, pref->num_vectors, pref->impl_u);
+    fclose(config_file);
+    free(prefs);
+    return true;
+}
@@ -114,3 +114,90 @@ int volk_gnsssdr_rank_archs(
     //otherwise return the best unaligned
     return best_index_u;
 }
+
+
+size_t volk_gnsssdr_rank_archs_by_shape(
+    const char *kern_name,              //name of the kernel to rank
+    const char *impl_names[],           //list of implementations by name
+    const bool *alignment,              //alignment status of each implementation
+    size_t n_impls,                     //number of implementations available
+    volk_gnsssdr_shape_impl_t **shapes  //per-shape implementations found for the kernel
+)
+{
+    size_t i, j, k;
+    size_t n_shapes = 0;
+    volk_gnsssdr_shape_impl_t *kern_shapes = NULL;
+    static volk_gnsssdr_shape_pref_t *volk_gnsssdr_shape_prefs;
+    static size_t n_shape_prefs = 0;
+    static int shape_prefs_loaded = 0;
+    if (!shape_prefs_loaded)
+        {
+            n_shape_prefs = volk_gnsssdr_load_shape_preferences(&volk_gnsssdr_shape_prefs);
+            shape_prefs_loaded = 1;
+        }
+
+    *shapes = NULL;
+    if (getenv("VOLK_GENERIC")) return 0;
+
+    for (i = 0; i < n_shape_prefs; i++)
+        {
+            const volk_gnsssdr_shape_pref_t *p = volk_gnsssdr_shape_prefs + i;
+            if (strncmp(kern_name, p->name, sizeof(p->name))) continue;
+
+            // only unaligned implementations are eligible, since the
+            // dispatcher does not check the pointers of per-shape calls
+            int index = -1;
+            for (j = 0; j < n_impls; j++)
+                {
+                    if (!alignment[j] && !strncmp(impl_names[j], p->impl_u, sizeof(p->impl_u)))
+                        {
+                            index = (int)j;
+                            break;
+                        }
+                }
+            if (index < 0) continue;
+
+            // later entries override earlier ones for the same shape
+            for (k = 0; k < n_shapes; k++)
+                {
+                    if (kern_shapes[k].num_points_bucket == p->num_points_bucket && kern_shapes[k].num_vectors == p->num_vectors) break;
+                }
+            if (k == n_shapes)
+                {
+                    void *new_shapes = realloc(kern_shapes, (n_shapes + 1) * sizeof(*kern_shapes));
+                    if (!new_shapes)
+                        {
+                            printf("volk_gnsssdr_rank_archs_by_shape: bad malloc\n");
+                            break;
+                        }
+                    kern_shapes = (volk_gnsssdr_shape_impl_t *)new_shapes;
+                    n_shapes++;
+                }
+            kern_shapes[k].num_points_bucket = p->num_points_bucket;
+            kern_shapes[k].num_vectors = p->num_vectors;
+            kern_shapes[k].index = index;
+        }
+
+    *shapes = kern_shapes;
+    return n_shapes;
+}
+
+
+int volk_gnsssdr_shape_index(
+    const volk_gnsssdr_shape_impl_t *shapes,  //per-shape implementations of the kernel
+    size_t n_shapes,                          //number of shapes
+    unsigned int num_points,                  //num_points of the call
+    unsigned int num_vectors                  //number of vectors of the call
+)
+{
+    size_t i;
+    int any_vectors_index = -1;
+    const unsigned int bucket = volk_gnsssdr_num_points_bucket(num_points);
+    for (i = 0; i < n_shapes; i++)
+        {
+            if (shapes[i].num_points_bucket != bucket) continue;
+            if (shapes[i].num_vectors == num_vectors) return shapes[i].index;
+            if (shapes[i].num_vectors == 0) any_vectors_index = shapes[i].index;
+        }
+    return any_vectors_index;
+}
@@ -18,6 +18,13 @@ extern "C"
 {
 #endif
 
+    typedef struct volk_gnsssdr_shape_impl
+    {
+        unsigned int num_points_bucket;  // power of two holding num_points
+        unsigned int num_vectors;        // number of vectors, 0 for any
+        int index;                       // index of the implementation to call
+    } volk_gnsssdr_shape_impl_t;
+
     int volk_gnsssdr_get_index(
         const char *impl_names[],  // list of implementations by name
         const size_t n_impls,      // number of implementations available
@@ -33,6 +40,21 @@ extern "C"
         const bool align           // if false, filter aligned implementations
     );
 
+    size_t volk_gnsssdr_rank_archs_by_shape(
+        const char *kern_name,              // name of the kernel to rank
+        const char *impl_names[],           // list of implementations by name
+        const bool *alignment,              // alignment status of each implementation
+        size_t n_impls,                     // number of implementations available
+        volk_gnsssdr_shape_impl_t **shapes  // per-shape implementations found for the kernel
+    );
+
+    int volk_gnsssdr_shape_index(
+        const volk_gnsssdr_shape_impl_t *shapes,  // per-shape implementations of the kernel
+        size_t n_shapes,                          // number of shapes
+        unsigned int num_points,                  // num_points of the call
+        unsigned int num_vectors                  // number of vectors of the call
+    );
+
 #ifdef __cplusplus
 }
 #endif
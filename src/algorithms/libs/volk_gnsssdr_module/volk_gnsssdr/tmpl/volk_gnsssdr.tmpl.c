@@ -121,8 +121,31 @@ bool volk_gnsssdr_is_aligned(const void *ptr)
 #include <volk_gnsssdr/${kern.name}.h> //pulls in the dispatcher
 %endif
 
+<%
+    arg_names = [arg_name for arg_type, arg_name in kern.args]
+    vectors_args = [arg_name for arg_name in arg_names if arg_name.startswith('num_') and arg_name.endswith('_vectors')]
+    has_shapes = 'num_points' in arg_names
+%>
+%if has_shapes:
+static volk_gnsssdr_shape_impl_t *__${kern.name}_shapes = NULL;
+static size_t __${kern.name}_n_shapes = 0;
+%endif
+
 static inline void __${kern.name}_d(${kern.arglist_full})
 {
+    %if has_shapes:
+    if (__${kern.name}_n_shapes)
+        {
+            const int index = volk_gnsssdr_shape_index(__${kern.name}_shapes, __${kern.name}_n_shapes,
+                (unsigned int)num_points, (unsigned int)${vectors_args[0] if vectors_args else '0'});
+            if (index >= 0)
+                {
+                    get_machine()->${kern.name}_impls[index](${kern.arglist_names});
+                    return;
+                }
+        }
+    %endif
+
     %if kern.has_dispatcher:
     ${kern.name}_dispatcher(${kern.arglist_names});
     return;
@@ -154,6 +177,9 @@ static inline void __init_${kern.name}(void)
     const size_t index_u = volk_gnsssdr_rank_archs(name, impl_names, impl_deps, alignment, n_impls, false/*unaligned*/);
     ${kern.name}_a = get_machine()->${kern.name}_impls[index_a];
     ${kern.name}_u = get_machine()->${kern.name}_impls[index_u];
+    %if has_shapes:
+    __${kern.name}_n_shapes = volk_gnsssdr_rank_archs_by_shape(name, impl_names, alignment, n_impls, &__${kern.name}_shapes);
+    %endif
 
     assert(${kern.name}_a);
     assert(${kern.name}_u);
@@ -24,6 +24,7 @@
 
 #include <gnuradio/block.h>
 #include <cstdint>
+#include <vector>
 #if GNURADIO_USES_STD_POINTERS
 #include <memory>
 #else
@@ -45,7 +46,9 @@ direct_resampler_conditioner_cb_sptr direct_resampler_make_conditioner_cb(
 /*!
  * \brief This class implements a direct resampler conditioner for std::complex<signed char>
  *
- * Direct resampling without interpolation
+ * Direct resampling without interpolation. Each call to general_work()
+ * computes the input item copied by every output item, and then copies them
+ * in a single branch-free loop.
  */
 class direct_resampler_conditioner_cb : public gr::block
 {
@@ -82,6 +85,7 @@ private:
     uint32_t d_phase;
     uint32_t d_lphase;
     uint32_t d_phase_step;
+    std::vector<int32_t> d_index;  // input item copied by each output item
 };
 
 #endif  // GNSS_SDR_DIRECT_RESAMPLER_CONDITIONER_CB_H
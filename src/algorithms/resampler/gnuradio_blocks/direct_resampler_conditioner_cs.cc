@@ -21,6 +21,7 @@
 
 
 #include "direct_resampler_conditioner_cs.h"
+#include "direct_resampler_index.h"
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>  // for lv_16sc_t
 #include <algorithm>    // for min
@@ -81,41 +82,12 @@ int direct_resampler_conditioner_cs::general_work(int noutput_items,
     const auto *in = reinterpret_cast<const lv_16sc_t *>(input_items[0]);
     auto *out = reinterpret_cast<lv_16sc_t *>(output_items[0]);
 
-    int lcv = 0;
-    int count = 0;
+    // Input index of every output item, then a branch-free copy
+    int consumed = 0;
+    const int nout = direct_resampler_index(d_index, noutput_items, ninput_items[0],
+        d_sample_freq_in >= d_sample_freq_out, d_phase_step, d_phase, d_lphase, consumed);
+    direct_resampler_gather(in, out, d_index, nout);
 
-    if (d_sample_freq_in >= d_sample_freq_out)
-        {
-            while ((lcv < noutput_items))
-                {
-                    if (d_phase <= d_lphase)
-                        {
-                            out[lcv] = *in;
-                            lcv++;
-                        }
-
-                    d_lphase = d_phase;
-                    d_phase += d_phase_step;
-                    in++;
-                    count++;
-                }
-        }
-    else
-        {
-            while ((lcv < noutput_items))
-                {
-                    d_lphase = d_phase;
-                    d_phase += d_phase_step;
-                    if (d_phase <= d_lphase)
-                        {
-                            in++;
-                            count++;
-                        }
-                    out[lcv] = *in;
-                    lcv++;
-                }
-        }
-
-    consume_each(std::min(count, ninput_items[0]));
-    return lcv;
+    consume_each(consumed);
+    return nout;
 }
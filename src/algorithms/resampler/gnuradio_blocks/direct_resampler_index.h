@@ -0,0 +1,143 @@
+/*!
+ * \file direct_resampler_index.h
+ * \brief Input index tables and gather loop shared by the direct resampler
+ * conditioners
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_DIRECT_RESAMPLER_INDEX_H
+#define GNSS_SDR_DIRECT_RESAMPLER_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/*!
+ * \brief Computes, for a block of output items, the index of the input item
+ * that each of them copies, and advances the 32-bit phase accumulator of the
+ * direct resampler as if the inputs had been processed one by one.
+ *
+ * The output is exactly the one of the per-sample loop (an input is emitted
+ * when the accumulator wraps around when downsampling, and the input advances
+ * when it wraps around when upsampling), but the positions of the wraps are
+ * computed in closed form, so the copy itself becomes a branch-free gather.
+ *
+ * Returns the number of valid entries in index, which is noutput_items unless
+ * there are not enough input items, and stores in consumed the number of
+ * input items to be consumed.
+ */
+inline int direct_resampler_index(std::vector<int32_t>& index,
+    int noutput_items,
+    int ninput_items,
+    bool downsampling,
+    uint32_t phase_step,
+    uint32_t& phase,
+    uint32_t& lphase,
+    int& consumed)
+{
+    const uint64_t two_32 = 4294967296ULL;
+    const uint64_t step = phase_step;
+    const uint64_t phase0 = phase;
+    int n = 0;
+    consumed = 0;
+    if (noutput_items <= 0 or ninput_items <= 0)
+        {
+            return 0;
+        }
+    if (index.size() < static_cast<size_t>(noutput_items))
+        {
+            index.resize(noutput_items);
+        }
+
+    if (downsampling)
+        {
+            if (step == 0)
+                {
+                    // the accumulator never moves: every input is emitted
+                    for (; n < noutput_items and n < ninput_items; n++)
+                        {
+                            index[n] = n;
+                        }
+                }
+            else
+                {
+                    if (phase <= lphase and n < noutput_items)
+                        {
+                            index[n++] = 0;
+                        }
+                    // the m-th wrap after input 0 happens at input
+                    // k_m = ceil((m * 2^32 - phase0) / step), with
+                    // rem = k_m * step - (m * 2^32 - phase0) in [0, step)
+                    const int64_t q = static_cast<int64_t>(two_32 / step);
+                    const uint64_t r = two_32 % step;
+                    const uint64_t target = two_32 - phase0;
+                    auto k = static_cast<int64_t>((target + step - 1) / step);
+                    uint64_t rem = static_cast<uint64_t>(k) * step - target;
+                    while (n < noutput_items and k < ninput_items)
+                        {
+                            index[n++] = static_cast<int32_t>(k);
+                            const uint64_t carry = r > rem ? 1 : 0;
+                            k += q + static_cast<int64_t>(carry);
+                            rem = rem + carry * step - r;
+                        }
+                }
+
+            // last input processed: the one of the last output item, or all
+            // of them if the input ran out first
+            const int64_t last = n == noutput_items and n > 0 ? index[n - 1] : ninput_items - 1;
+            lphase = static_cast<uint32_t>(phase0 + static_cast<uint64_t>(last) * step);
+            phase = static_cast<uint32_t>(phase0 + static_cast<uint64_t>(last + 1) * step);
+            consumed = static_cast<int>(last + 1);
+        }
+    else
+        {
+            // output j copies input floor((phase0 + (j + 1) * step) / 2^32)
+            uint64_t acc = phase0 + step;
+            for (; n < noutput_items; n++)
+                {
+                    const uint64_t k = acc >> 32U;
+                    if (k >= static_cast<uint64_t>(ninput_items))
+                        {
+                            break;
+                        }
+                    index[n] = static_cast<int32_t>(k);
+                    acc += step;
+                }
+            if (n > 0)
+                {
+                    consumed = index[n - 1];
+                    lphase = static_cast<uint32_t>(acc - step - step);
+                    phase = static_cast<uint32_t>(acc - step);
+                }
+        }
+    return n;
+}
+
+
+/*!
+ * \brief Copies in[index[j]] into out[j] for the first n entries of index.
+ */
+template <typename T>
+inline void direct_resampler_gather(const T* in, T* out, const std::vector<int32_t>& index, int n)
+{
+    const int32_t* idx = index.data();
+    for (int j = 0; j < n; j++)
+        {
+            out[j] = in[idx[j]];
+        }
+}
+
+#endif  // GNSS_SDR_DIRECT_RESAMPLER_INDEX_H
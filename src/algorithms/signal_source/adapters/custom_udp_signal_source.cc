@@ -1,7 +1,8 @@
 /*!
  * \file custom_udp_signal_source.cc
  * \brief Receives ip frames containing samples in UDP frame encapsulation
- * using a high performance packet capture library (libpcap)
+ * using a high performance packet capture library (libpcap) or batched reads
+ * from a UDP socket
  * \author Javier Arribas jarribas (at) cttc.es
  * -----------------------------------------------------------------------------
  *
@@ -45,6 +46,14 @@ CustomUDPSignalSource::CustomUDPSignalSource(const ConfigurationInterface* confi
     std::string capture_device = configuration->property(role + ".capture_device", default_capture_device);
     int port = configuration->property(role + ".port", default_port);
     int payload_bytes = configuration->property(role + ".payload_bytes", 1024);
+    // read the UDP socket instead of capturing the Ethernet frames with libpcap
+    bool use_pcap = configuration->property(role + ".use_pcap", true);
+    // FIFO between the receiving thread and the flowgraph, in samples
+    uint64_t fifo_samples = configuration->property(role + ".fifo_samples", static_cast<uint64_t>(1048576));
+    // length of the big-endian packet counter at the start of each payload, 0 if none
+    int sequence_number_bytes = configuration->property(role + ".sequence_number_bytes", 0);
+    // CPU the receiving thread is pinned to, -1 to let the scheduler choose
+    int rx_thread_cpu = configuration->property(role + ".rx_thread_cpu", -1);
 
     RF_channels_ = configuration->property(role + ".RF_channels", 1);
     channels_in_udp_ = configuration->property(role + ".channels_in_udp", 1);
@@ -63,7 +72,11 @@ CustomUDPSignalSource::CustomUDPSignalSource(const ConfigurationInterface* confi
         channels_in_udp_,
         sample_type,
         item_size_,
-        IQ_swap_);
+        IQ_swap_,
+        use_pcap,
+        fifo_samples,
+        sequence_number_bytes,
+        rx_thread_cpu);
 
     if (channels_in_udp_ >= RF_channels_)
         {
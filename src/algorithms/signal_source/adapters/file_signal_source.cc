@@ -23,6 +23,7 @@
 #include "configuration_interface.h"
 #include "gnss_sdr_flags.h"
 #include "gnss_sdr_valve.h"
+#include "mmap_file_source.h"
 #include <glog/logging.h>
 #include <exception>
 #include <fstream>
@@ -60,6 +61,8 @@ FileSignalSource::FileSignalSource(const ConfigurationInterface* configuration,
     dump_ = configuration->property(role + ".dump", false);
     dump_filename_ = configuration->property(role + ".dump_filename", default_dump_filename);
     enable_throttle_control_ = configuration->property(role + ".enable_throttle_control", false);
+    use_mmap_ = configuration->property(role + ".use_mmap", false);
+    const size_t mmap_readahead_mb = configuration->property(role + ".mmap_readahead_mb", 64);
 
     const double seconds_to_skip = configuration->property(role + ".seconds_to_skip", default_seconds_to_skip);
     const size_t header_size = configuration->property(role + ".header_size", 0);
@@ -101,7 +104,14 @@ FileSignalSource::FileSignalSource(const ConfigurationInterface* configuration,
         }
     try
         {
-            file_source_ = gr::blocks::file_source::make(item_size_, filename_.c_str(), repeat_);
+            if (use_mmap_)
+                {
+                    mmap_source_ = mmap_make_file_source(item_size_, filename_, repeat_, mmap_readahead_mb * 1024 * 1024);
+                }
+            else
+                {
+                    file_source_ = gr::blocks::file_source::make(item_size_, filename_.c_str(), repeat_);
+                }
 
             if (seconds_to_skip > 0)
                 {
@@ -120,7 +130,8 @@ FileSignalSource::FileSignalSource(const ConfigurationInterface* configuration,
             if (samples_to_skip > 0)
                 {
                     LOG(INFO) << "Skipping " << samples_to_skip << " samples of the input file";
-                    if (not file_source_->seek(samples_to_skip, SEEK_SET))
+                    const bool seek_ok = use_mmap_ ? mmap_source_->seek(samples_to_skip, SEEK_SET) : file_source_->seek(samples_to_skip, SEEK_SET);
+                    if (not seek_ok)
                         {
                             LOG(INFO) << "Error skipping bytes!";
                         }
@@ -153,7 +164,7 @@ FileSignalSource::FileSignalSource(const ConfigurationInterface* configuration,
             throw(e);
         }
 
-    DLOG(INFO) << "file_source(" << file_source_->unique_id() << ")";
+    DLOG(INFO) << "file_source(" << source()->unique_id() << ")";
 
     if (samples_ == 0)  // read all file
         {
@@ -219,6 +230,7 @@ FileSignalSource::FileSignalSource(const ConfigurationInterface* configuration,
     DLOG(INFO) << "Item type " << item_type_;
     DLOG(INFO) << "Item size " << item_size_;
     DLOG(INFO) << "Repeat " << repeat_;
+    DLOG(INFO) << "Memory mapped " << use_mmap_;
     DLOG(INFO) << "Dump " << dump_;
     DLOG(INFO) << "Dump filename " << dump_filename_;
     if (in_streams_ > 0)
@@ -238,7 +250,7 @@ void FileSignalSource::connect(gr::top_block_sptr top_block)
         {
             if (enable_throttle_control_ == true)
                 {
-                    top_block->connect(file_source_, 0, throttle_, 0);
+                    top_block->connect(source(), 0, throttle_, 0);
                     DLOG(INFO) << "connected file source to throttle";
                     top_block->connect(throttle_, 0, valve_, 0);
                     DLOG(INFO) << "connected throttle to valve";
@@ -250,7 +262,7 @@ void FileSignalSource::connect(gr::top_block_sptr top_block)
                 }
             else
                 {
-                    top_block->connect(file_source_, 0, valve_, 0);
+                    top_block->connect(source(), 0, valve_, 0);
                     DLOG(INFO) << "connected file source to valve";
                     if (dump_)
                         {
@@ -263,11 +275,11 @@ void FileSignalSource::connect(gr::top_block_sptr top_block)
         {
             if (enable_throttle_control_ == true)
                 {
-                    top_block->connect(file_source_, 0, throttle_, 0);
+                    top_block->connect(source(), 0, throttle_, 0);
                     DLOG(INFO) << "connected file source to throttle";
                     if (dump_)
                         {
-                            top_block->connect(file_source_, 0, sink_, 0);
+                            top_block->connect(source(), 0, sink_, 0);
                             DLOG(INFO) << "connected file source to sink";
                         }
                 }
@@ -275,7 +287,7 @@ void FileSignalSource::connect(gr::top_block_sptr top_block)
                 {
                     if (dump_)
                         {
-                            top_block->connect(file_source_, 0, sink_, 0);
+                            top_block->connect(source(), 0, sink_, 0);
                             DLOG(INFO) << "connected file source to sink";
                         }
                 }
@@ -289,7 +301,7 @@ void FileSignalSource::disconnect(gr::top_block_sptr top_block)
         {
             if (enable_throttle_control_ == true)
                 {
-                    top_block->disconnect(file_source_, 0, throttle_, 0);
+                    top_block->disconnect(source(), 0, throttle_, 0);
                     DLOG(INFO) << "disconnected file source to throttle";
                     top_block->disconnect(throttle_, 0, valve_, 0);
                     DLOG(INFO) << "disconnected throttle to valve";
@@ -301,7 +313,7 @@ void FileSignalSource::disconnect(gr::top_block_sptr top_block)
                 }
             else
                 {
-                    top_block->disconnect(file_source_, 0, valve_, 0);
+                    top_block->disconnect(source(), 0, valve_, 0);
                     DLOG(INFO) << "disconnected file source to valve";
                     if (dump_)
                         {
@@ -314,11 +326,11 @@ void FileSignalSource::disconnect(gr::top_block_sptr top_block)
         {
             if (enable_throttle_control_ == true)
                 {
-                    top_block->disconnect(file_source_, 0, throttle_, 0);
+                    top_block->disconnect(source(), 0, throttle_, 0);
                     DLOG(INFO) << "disconnected file source to throttle";
                     if (dump_)
                         {
-                            top_block->disconnect(file_source_, 0, sink_, 0);
+                            top_block->disconnect(source(), 0, sink_, 0);
                             DLOG(INFO) << "disconnected file source to sink";
                         }
                 }
@@ -326,7 +338,7 @@ void FileSignalSource::disconnect(gr::top_block_sptr top_block)
                 {
                     if (dump_)
                         {
-                            top_block->disconnect(file_source_, 0, sink_, 0);
+                            top_block->disconnect(source(), 0, sink_, 0);
                             DLOG(INFO) << "disconnected file source to sink";
                         }
                 }
@@ -351,5 +363,15 @@ gr::basic_block_sptr FileSignalSource::get_right_block()
         {
             return throttle_;
         }
+    return source();
+}
+
+
+gr::basic_block_sptr FileSignalSource::source() const
+{
+    if (use_mmap_)
+        {
+            return mmap_source_;
+        }
     return file_source_;
 }
@@ -26,6 +26,7 @@
 
 #include "concurrent_queue.h"
 #include "gnss_block_interface.h"
+#include "mmap_file_source.h"
 #include <gnuradio/blocks/file_sink.h>
 #include <gnuradio/blocks/file_source.h>
 #include <gnuradio/blocks/throttle.h>
@@ -103,7 +104,10 @@ public:
     }
 
 private:
+    gr::basic_block_sptr source() const;
+
     gr::blocks::file_source::sptr file_source_;
+    mmap_file_source_sptr mmap_source_;
 #if GNURADIO_USES_STD_POINTERS
     std::shared_ptr<gr::block> valve_;
 #else
@@ -125,6 +129,7 @@ private:
     uint32_t out_streams_;
 
     bool enable_throttle_control_;
+    bool use_mmap_;
     bool repeat_;
     bool dump_;
 };
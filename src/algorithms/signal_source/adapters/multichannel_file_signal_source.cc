@@ -22,7 +22,9 @@
 #include "configuration_interface.h"
 #include "gnss_sdr_flags.h"
 #include "gnss_sdr_valve.h"
+#include "multichannel_file_source.h"
 #include <glog/logging.h>
+#include <algorithm>
 #include <exception>
 #include <fstream>
 #include <iomanip>
@@ -51,6 +53,9 @@ MultichannelFileSignalSource::MultichannelFileSignalSource(const ConfigurationIn
     item_type_ = configuration->property(role + ".item_type", default_item_type);
     repeat_ = configuration->property(role + ".repeat", false);
     enable_throttle_control_ = configuration->property(role + ".enable_throttle_control", false);
+    lockstep_ = configuration->property(role + ".lockstep", false);
+    const bool use_mmap = configuration->property(role + ".use_mmap", false);
+    const size_t mmap_readahead_mb = configuration->property(role + ".mmap_readahead_mb", 64);
 
     const double seconds_to_skip = configuration->property(role + ".seconds_to_skip", default_seconds_to_skip);
     size_t header_size = configuration->property(role + ".header_size", 0);
@@ -90,32 +95,52 @@ MultichannelFileSignalSource::MultichannelFileSignalSource(const ConfigurationIn
                          << " unrecognized item type. Using gr_complex.";
             item_size_ = sizeof(gr_complex);
         }
-    try
+    if (seconds_to_skip > 0)
         {
-            for (int32_t n = 0; n < n_channels_; n++)
+            samples_to_skip = static_cast<int64_t>(seconds_to_skip * sampling_frequency_);
+
+            if (is_complex)
                 {
-                    file_source_vec_.push_back(gr::blocks::file_source::make(item_size_, filename_vec_.at(n).c_str(), repeat_));
+                    samples_to_skip *= 2;
+                }
+        }
+    if (header_size > 0)
+        {
+            samples_to_skip += header_size;
+        }
 
-                    if (seconds_to_skip > 0)
-                        {
-                            samples_to_skip = static_cast<int64_t>(seconds_to_skip * sampling_frequency_);
+    // Per-file offsets, on top of the common ones, to align captures that
+    // did not start at the same sampling instant
+    std::vector<uint64_t> items_to_skip;
+    for (int32_t n = 0; n < n_channels_; n++)
+        {
+            int64_t stream_samples_to_skip = configuration->property(role + ".samples_to_skip" + std::to_string(n), static_cast<int64_t>(0));
+            if (is_complex)
+                {
+                    stream_samples_to_skip *= 2;
+                }
+            items_to_skip.push_back(static_cast<uint64_t>(std::max(samples_to_skip + stream_samples_to_skip, static_cast<int64_t>(0))));
+        }
 
-                            if (is_complex)
-                                {
-                                    samples_to_skip *= 2;
-                                }
-                        }
-                    if (header_size > 0)
+    try
+        {
+            if (lockstep_)
+                {
+                    multichannel_source_ = multichannel_make_file_source(item_size_, filename_vec_, items_to_skip, repeat_, use_mmap, mmap_readahead_mb * 1024 * 1024);
+                }
+            else
+                {
+                    for (int32_t n = 0; n < n_channels_; n++)
                         {
-                            samples_to_skip += header_size;
-                        }
+                            file_source_vec_.push_back(gr::blocks::file_source::make(item_size_, filename_vec_.at(n).c_str(), repeat_));
 
-                    if (samples_to_skip > 0)
-                        {
-                            LOG(INFO) << "Skipping " << samples_to_skip << " samples of the input file #" << n;
-                            if (not file_source_vec_.back()->seek(samples_to_skip, SEEK_SET))
+                            if (items_to_skip[n] > 0)
                                 {
-                                    LOG(INFO) << "Error skipping bytes!";
+                                    LOG(INFO) << "Skipping " << items_to_skip[n] << " samples of the input file #" << n;
+                                    if (not file_source_vec_.back()->seek(items_to_skip[n], SEEK_SET))
+                                        {
+                                            LOG(INFO) << "Error skipping bytes!";
+                                        }
                                 }
                         }
                 }
@@ -173,9 +198,15 @@ MultichannelFileSignalSource::MultichannelFileSignalSource(const ConfigurationIn
             std::cout << "Processing file " << filename_vec_.at(0) << ", which contains " << static_cast<double>(size) << " [bytes]\n";
             std::cout.precision(ss);
 
-            if (size > 0)
+            if (lockstep_)
+                {
+                    // the shortest file, after the offsets, limits all the streams
+                    const double available = static_cast<double>(multichannel_source_->items_available()) - ceil(0.002 * static_cast<double>(sampling_frequency_));
+                    samples_ = available > 0.0 ? static_cast<uint64_t>(available) : 0;
+                }
+            else if (size > 0)
                 {
-                    int64_t bytes_to_skip = samples_to_skip * item_size_;
+                    int64_t bytes_to_skip = static_cast<int64_t>(items_to_skip.at(0) * item_size_);
                     int64_t bytes_to_process = static_cast<int64_t>(size) - bytes_to_skip;
                     samples_ = floor(static_cast<double>(bytes_to_process) / static_cast<double>(item_size()) - ceil(0.002 * static_cast<double>(sampling_frequency_)));  // process all the samples available in the file excluding at least the last 1 ms
                 }
@@ -213,6 +244,7 @@ MultichannelFileSignalSource::MultichannelFileSignalSource(const ConfigurationIn
     DLOG(INFO) << "Item type " << item_type_;
     DLOG(INFO) << "Item size " << item_size_;
     DLOG(INFO) << "Repeat " << repeat_;
+    DLOG(INFO) << "Lockstep " << lockstep_;
 
     if (in_streams_ > 0)
         {
@@ -231,7 +263,7 @@ void MultichannelFileSignalSource::connect(gr::top_block_sptr top_block)
         {
             for (int32_t n = 0; n < n_channels_; n++)
                 {
-                    top_block->connect(file_source_vec_.at(n), 0, throttle_vec_.at(n), 0);
+                    top_block->connect(source(n), source_port(n), throttle_vec_.at(n), 0);
                     DLOG(INFO) << "connected file_source #" << n << " to throttle";
                     top_block->connect(throttle_vec_.at(n), 0, valve_, n);
                     DLOG(INFO) << "connected throttle #" << n << " to valve_";
@@ -241,7 +273,7 @@ void MultichannelFileSignalSource::connect(gr::top_block_sptr top_block)
         {
             for (int32_t n = 0; n < n_channels_; n++)
                 {
-                    top_block->connect(file_source_vec_.at(n), 0, valve_, n);
+                    top_block->connect(source(n), source_port(n), valve_, n);
                     DLOG(INFO) << "connected file_source #" << n << " to valve_";
                 }
         }
@@ -254,7 +286,7 @@ void MultichannelFileSignalSource::disconnect(gr::top_block_sptr top_block)
         {
             for (int32_t n = 0; n < n_channels_; n++)
                 {
-                    top_block->disconnect(file_source_vec_.at(n), 0, throttle_vec_.at(n), 0);
+                    top_block->disconnect(source(n), source_port(n), throttle_vec_.at(n), 0);
                     DLOG(INFO) << "disconnected file_source #" << n << " to throttle";
                     top_block->disconnect(throttle_vec_.at(n), 0, valve_, n);
                     DLOG(INFO) << "disconnected throttle #" << n << " to valve_";
@@ -264,7 +296,7 @@ void MultichannelFileSignalSource::disconnect(gr::top_block_sptr top_block)
         {
             for (int32_t n = 0; n < n_channels_; n++)
                 {
-                    top_block->disconnect(file_source_vec_.at(n), 0, valve_, n);
+                    top_block->disconnect(source(n), source_port(n), valve_, n);
                     DLOG(INFO) << "disconnected file_source #" << n << " to valve_";
                 }
         }
@@ -282,3 +314,19 @@ gr::basic_block_sptr MultichannelFileSignalSource::get_right_block()
 {
     return valve_;
 }
+
+
+gr::basic_block_sptr MultichannelFileSignalSource::source(int32_t n) const
+{
+    if (lockstep_)
+        {
+            return multichannel_source_;
+        }
+    return file_source_vec_.at(n);
+}
+
+
+int32_t MultichannelFileSignalSource::source_port(int32_t n) const
+{
+    return lockstep_ ? n : 0;
+}
@@ -26,6 +26,7 @@
 
 #include "concurrent_queue.h"
 #include "gnss_block_interface.h"
+#include "multichannel_file_source.h"
 #include <gnuradio/blocks/file_sink.h>
 #include <gnuradio/blocks/file_source.h>
 #include <gnuradio/blocks/throttle.h>
@@ -104,7 +105,11 @@ public:
     }
 
 private:
+    gr::basic_block_sptr source(int32_t n) const;
+    int32_t source_port(int32_t n) const;
+
     std::vector<gr::blocks::file_source::sptr> file_source_vec_;
+    multichannel_file_source_sptr multichannel_source_;
 #if GNURADIO_USES_STD_POINTERS
     std::shared_ptr<gr::block> valve_;
 #else
@@ -122,6 +127,7 @@ private:
     uint32_t in_streams_;
     uint32_t out_streams_;
     bool repeat_;
+    bool lockstep_;
     // Throttle control
     bool enable_throttle_control_;
 };
@@ -0,0 +1,76 @@
+/*!
+ * \file capture_tap.cc
+ * \brief Sink block that records the raw front-end samples to disk from a
+ * writer thread, without ever blocking the flowgraph.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "capture_tap.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+
+
+capture_tap_sptr capture_make_tap(size_t item_size,
+    const std::string& filename,
+    double sampling_frequency,
+    const std::string& item_type,
+    uint64_t rotation_items,
+    size_t buffer_bytes,
+    bool direct_io)
+{
+    return capture_tap_sptr(new capture_tap(item_size, filename, sampling_frequency, item_type, rotation_items, buffer_bytes, direct_io));
+}
+
+
+capture_tap::capture_tap(size_t item_size,
+    const std::string& filename,
+    double sampling_frequency,
+    const std::string& item_type,
+    uint64_t rotation_items,
+    size_t buffer_bytes,
+    bool direct_io) : gr::sync_block("capture_tap",
+                          gr::io_signature::make(1, 1, item_size),
+                          gr::io_signature::make(0, 0, 0)),
+                      d_writer(item_size, filename, sampling_frequency, item_type, rotation_items, buffer_bytes, direct_io),
+                      d_filename(filename)
+{
+}
+
+
+bool capture_tap::start()
+{
+    d_writer.start();
+    return true;
+}
+
+
+bool capture_tap::stop()
+{
+    d_writer.stop();
+    if (d_writer.dropped_items() > 0)
+        {
+            LOG(WARNING) << "capture_tap: " << d_writer.dropped_items() << " items could not be recorded in " << d_filename;
+        }
+    return true;
+}
+
+
+int capture_tap::work(int noutput_items,
+    gr_vector_const_void_star& input_items,
+    gr_vector_void_star& output_items __attribute__((unused)))
+{
+    d_writer.push(input_items[0], nitems_read(0), static_cast<uint64_t>(noutput_items));
+    return noutput_items;
+}
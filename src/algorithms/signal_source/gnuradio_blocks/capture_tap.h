@@ -0,0 +1,114 @@
+/*!
+ * \file capture_tap.h
+ * \brief Sink block that records the raw front-end samples to disk from a
+ * writer thread, without ever blocking the flowgraph.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CAPTURE_TAP_H
+#define GNSS_SDR_CAPTURE_TAP_H
+
+#include "capture_file_writer.h"
+#include <gnuradio/sync_block.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#if GNURADIO_USES_STD_POINTERS
+#include <memory>
+#else
+#include <boost/shared_ptr.hpp>
+#endif
+
+class capture_tap;
+
+#if GNURADIO_USES_STD_POINTERS
+using capture_tap_sptr = std::shared_ptr<capture_tap>;
+#else
+using capture_tap_sptr = boost::shared_ptr<capture_tap>;
+#endif
+
+/*!
+ * \brief Returns a capture_tap writing to filename. If rotation_items is not
+ * zero, a new file is started every rotation_items items. Files other than the
+ * first one of a session without rotation get a four-digit index inserted
+ * before the extension of filename. buffer_bytes is the size of the ring
+ * buffer between the flowgraph and the writer thread.
+ */
+capture_tap_sptr capture_make_tap(size_t item_size,
+    const std::string& filename,
+    double sampling_frequency,
+    const std::string& item_type,
+    uint64_t rotation_items = 0,
+    size_t buffer_bytes = 256 * 1024 * 1024,
+    bool direct_io = true);
+
+/*!
+ * \brief Records its input stream to disk for as long as the flowgraph runs,
+ * through a Capture_File_Writer.
+ *
+ * work() only copies the samples into the ring buffer of the writer. If the
+ * disk does not keep up, the samples that do not fit are dropped and counted,
+ * instead of slowing down the receiver, and a new file is started after the
+ * gap.
+ */
+class capture_tap : public gr::sync_block
+{
+public:
+    /*!
+     * \brief Number of input items that could not be recorded.
+     */
+    inline uint64_t dropped_items() const
+    {
+        return d_writer.dropped_items();
+    }
+
+    /*!
+     * \brief Number of files started so far.
+     */
+    inline uint32_t files() const
+    {
+        return d_writer.files();
+    }
+
+    bool start() override;
+
+    bool stop() override;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items) override;
+
+private:
+    friend capture_tap_sptr capture_make_tap(size_t item_size,
+        const std::string& filename,
+        double sampling_frequency,
+        const std::string& item_type,
+        uint64_t rotation_items,
+        size_t buffer_bytes,
+        bool direct_io);
+
+    capture_tap(size_t item_size,
+        const std::string& filename,
+        double sampling_frequency,
+        const std::string& item_type,
+        uint64_t rotation_items,
+        size_t buffer_bytes,
+        bool direct_io);
+
+    Capture_File_Writer d_writer;
+    std::string d_filename;
+};
+
+#endif  // GNSS_SDR_CAPTURE_TAP_H
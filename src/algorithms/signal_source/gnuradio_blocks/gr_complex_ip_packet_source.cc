@@ -2,7 +2,8 @@
  * \file gr_complex_ip_packet_source.cc
  *
  * \brief Receives ip frames containing samples in UDP frame encapsulation
- * using a high performance packet capture library (libpcap)
+ * using a high performance packet capture library (libpcap) or batched reads
+ * from a UDP socket
  * \author Javier Arribas jarribas (at) cttc.es
  * -----------------------------------------------------------------------------
  *
@@ -21,15 +22,41 @@
 
 #include "gr_complex_ip_packet_source.h"
 #include <gnuradio/io_signature.h>
+#include <sys/socket.h>  // for recvmmsg, setsockopt
+#include <sys/time.h>    // for timeval
+#include <unistd.h>      // for close
+#include <algorithm>  // for std::min
 #include <array>
+#include <cerrno>
 #include <cstdint>
+#include <cstring>  // for memset
+#include <iostream>
 #include <utility>
 #if HAS_GENERIC_LAMBDA
 #else
 #include <boost/bind/bind.hpp>
 #endif
+#ifdef __linux__
+#include <pthread.h>  // for pthread_setaffinity_np
+#include <sched.h>    // for cpu_set_t
+#endif
 
-const int FIFO_SIZE = 1472000;
+// UDP datagrams read from the socket in a single system call
+const int RECV_BATCH = 32;
+const int MAX_UDP_PAYLOAD = 65536;
+const int UDP_RECEIVE_BUFFER_BYTES = 32 * 1024 * 1024;
+
+namespace
+{
+int wire_bytes_per_sample(const std::string &wire_sample_type, int n_baseband_channels)
+{
+    if (wire_sample_type == "c4bits")
+        {
+            return n_baseband_channels;
+        }
+    return n_baseband_channels * 2;
+}
+}  // namespace
 
 
 /* 4 bytes IP address */
@@ -77,7 +104,11 @@ Gr_Complex_Ip_Packet_Source::make(std::string src_device,
     int n_baseband_channels,
     const std::string &wire_sample_type,
     size_t item_size,
-    bool IQ_swap_)
+    bool IQ_swap_,
+    bool use_pcap,
+    size_t fifo_samples,
+    int sequence_number_bytes,
+    int rx_thread_cpu)
 {
     return gnuradio::get_initial_sptr(new Gr_Complex_Ip_Packet_Source(std::move(src_device),
         origin_address,
@@ -86,7 +117,11 @@ Gr_Complex_Ip_Packet_Source::make(std::string src_device,
         n_baseband_channels,
         wire_sample_type,
         item_size,
-        IQ_swap_));
+        IQ_swap_,
+        use_pcap,
+        fifo_samples,
+        sequence_number_bytes,
+        rx_thread_cpu));
 }
 
 
@@ -100,23 +135,28 @@ Gr_Complex_Ip_Packet_Source::Gr_Complex_Ip_Packet_Source(std::string src_device,
     int n_baseband_channels,
     const std::string &wire_sample_type,
     size_t item_size,
-    bool IQ_swap_)
+    bool IQ_swap_,
+    bool use_pcap,
+    size_t fifo_samples,
+    int sequence_number_bytes,
+    int rx_thread_cpu)
     : gr::sync_block("gr_complex_ip_packet_source",
           gr::io_signature::make(0, 0, 0),
-          gr::io_signature::make(1, 4, item_size))  // 1 to 4 baseband complex channels
+          gr::io_signature::make(1, 4, item_size)),  // 1 to 4 baseband complex channels
+      d_fifo(fifo_samples * wire_bytes_per_sample(wire_sample_type, n_baseband_channels), sequence_number_bytes),
+      d_stop_rx(false)
 {
     std::cout << "Start Ethernet packet capture\n";
 
     d_n_baseband_channels = n_baseband_channels;
+    d_bytes_per_sample = wire_bytes_per_sample(wire_sample_type, n_baseband_channels);
     if (wire_sample_type == "cbyte")
         {
             d_wire_sample_type = 1;
-            d_bytes_per_sample = d_n_baseband_channels * 2;
         }
     else if (wire_sample_type == "c4bits")
         {
             d_wire_sample_type = 2;
-            d_bytes_per_sample = d_n_baseband_channels;
         }
     else
         {
@@ -127,18 +167,23 @@ Gr_Complex_Ip_Packet_Source::Gr_Complex_Ip_Packet_Source(std::string src_device,
     d_src_device = std::move(src_device);
     d_udp_port = udp_port;
     d_udp_payload_size = udp_packet_size;
-    d_fifo_full = false;
+    d_use_pcap = use_pcap;
+    d_rx_thread_cpu = rx_thread_cpu;
+
+    // optional big-endian packet counter at the start of each payload
+    if (sequence_number_bytes < 0 or sequence_number_bytes > 8)
+        {
+            std::cout << "Unsupported sequence number length: " << sequence_number_bytes << " bytes\n";
+            exit(0);
+        }
 
-    // allocate signal samples buffer
-    fifo_buff = new char[FIFO_SIZE];
     fifo_read_ptr = 0;
-    fifo_write_ptr = 0;
-    fifo_items = 0;
     d_item_size = item_size;
     d_IQ_swap = IQ_swap_;
-    d_sock_raw = 0;
-    d_pcap_thread = nullptr;
+    d_sock_raw = -1;
+    d_rx_thread = nullptr;
     descr = nullptr;
+    std::cout << "FIFO size: " << d_fifo.capacity() / d_bytes_per_sample << " samples\n";
 
     memset(reinterpret_cast<char *>(&si_me), 0, sizeof(si_me));
 }
@@ -151,28 +196,80 @@ bool Gr_Complex_Ip_Packet_Source::start()
     // open the ethernet device
     if (open() == true)
         {
-            // start pcap capture thread
-            d_pcap_thread = new boost::thread(
+            d_stop_rx = false;
+            if (d_use_pcap)
+                {
+                    // start pcap capture thread
+                    d_rx_thread = new boost::thread(
+#if HAS_GENERIC_LAMBDA
+                        [this] { my_pcap_loop_thread(descr); });
+#else
+                        boost::bind(&Gr_Complex_Ip_Packet_Source::my_pcap_loop_thread, this, descr));
+#endif
+                }
+            else
+                {
+                    // start socket receiving thread
+                    d_rx_thread = new boost::thread(
 #if HAS_GENERIC_LAMBDA
-                [this] { my_pcap_loop_thread(descr); });
+                        [this] { my_socket_loop_thread(); });
 #else
-                boost::bind(&Gr_Complex_Ip_Packet_Source::my_pcap_loop_thread, this, descr));
+                        boost::bind(&Gr_Complex_Ip_Packet_Source::my_socket_loop_thread, this));
 #endif
+                }
+            pin_rx_thread();
             return true;
         }
     return false;
 }
 
 
+void Gr_Complex_Ip_Packet_Source::pin_rx_thread()
+{
+    if (d_rx_thread_cpu < 0)
+        {
+            return;
+        }
+#ifdef __linux__
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(d_rx_thread_cpu, &cpuset);
+    if (pthread_setaffinity_np(d_rx_thread->native_handle(), sizeof(cpu_set_t), &cpuset) != 0)
+        {
+            std::cout << "Unable to pin the receiving thread to CPU " << d_rx_thread_cpu << '\n';
+        }
+#else
+    std::cout << "Pinning the receiving thread is not supported on this system\n";
+#endif
+}
+
+
 // Called by gnuradio to disable drivers, etc for i/o devices.
 bool Gr_Complex_Ip_Packet_Source::stop()
 {
     std::cout << "gr_complex_ip_packet_source STOP\n";
+    d_stop_rx = true;
     if (descr != nullptr)
         {
             pcap_breakloop(descr);
-            d_pcap_thread->join();
+        }
+    if (d_rx_thread != nullptr)
+        {
+            d_rx_thread->join();
+        }
+    if (descr != nullptr)
+        {
             pcap_close(descr);
+            descr = nullptr;
+        }
+    if (d_sock_raw != -1)
+        {
+            close(d_sock_raw);
+            d_sock_raw = -1;
+        }
+    if (d_fifo.lost_packets() > 0 or d_fifo.overflows() > 0)
+        {
+            std::cout << "UDP packets lost: " << d_fifo.lost_packets() << ", packets dropped by FIFO overflow: " << d_fifo.overflows() << '\n';
         }
     return true;
 }
@@ -181,16 +278,19 @@ bool Gr_Complex_Ip_Packet_Source::stop()
 bool Gr_Complex_Ip_Packet_Source::open()
 {
     std::array<char, PCAP_ERRBUF_SIZE> errbuf{};
-    boost::mutex::scoped_lock lock(d_mutex);  // hold mutex for duration of this function
-    // open device for reading
-    descr = pcap_open_live(d_src_device.c_str(), 1500, 1, 1000, errbuf.data());
-    if (descr == nullptr)
+    if (d_use_pcap)
         {
-            std::cout << "Error opening Ethernet device " << d_src_device << '\n';
-            std::cout << "Fatal Error in pcap_open_live(): " << std::string(errbuf.data()) << '\n';
-            return false;
+            // open device for reading
+            descr = pcap_open_live(d_src_device.c_str(), 1500, 1, 1000, errbuf.data());
+            if (descr == nullptr)
+                {
+                    std::cout << "Error opening Ethernet device " << d_src_device << '\n';
+                    std::cout << "Fatal Error in pcap_open_live(): " << std::string(errbuf.data()) << '\n';
+                    return false;
+                }
         }
     // bind UDP port to avoid automatic reply with ICMP port unreachable packets from kernel
+    // (and read the samples from it if libpcap is not used)
     d_sock_raw = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
     if (d_sock_raw == -1)
         {
@@ -211,17 +311,28 @@ bool Gr_Complex_Ip_Packet_Source::open()
             std::cout << "Error opening UDP socket\n";
             return false;
         }
+    if (not d_use_pcap)
+        {
+            // a large kernel buffer absorbs bursts while the receiving thread is descheduled,
+            // and a timeout lets it check the stop flag
+            int rcvbuf = UDP_RECEIVE_BUFFER_BYTES;
+            setsockopt(d_sock_raw, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+            struct timeval timeout
+            {
+            };
+            timeout.tv_usec = 100000;
+            setsockopt(d_sock_raw, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        }
     return true;
 }
 
 
 Gr_Complex_Ip_Packet_Source::~Gr_Complex_Ip_Packet_Source()
 {
-    if (d_pcap_thread != nullptr)
+    if (d_rx_thread != nullptr)
         {
-            delete d_pcap_thread;
+            delete d_rx_thread;
         }
-    delete fifo_buff;
     std::cout << "Stop Ethernet packet capture\n";
 }
 
@@ -237,8 +348,6 @@ void Gr_Complex_Ip_Packet_Source::static_pcap_callback(u_char *args, const struc
 void Gr_Complex_Ip_Packet_Source::pcap_callback(__attribute__((unused)) u_char *args, __attribute__((unused)) const struct pcap_pkthdr *pkthdr,
     const u_char *packet)
 {
-    boost::mutex::scoped_lock lock(d_mutex);  // hold mutex for duration of this function
-
     const gr_ip_header *ih;
     const gr_udp_header *uh;
 
@@ -278,34 +387,7 @@ void Gr_Complex_Ip_Packet_Source::pcap_callback(__attribute__((unused)) u_char *
                     int payload_length_bytes = ntohs(uh->len) - 8;  // total udp packet length minus the header length
                     // read the payload bytes and insert them into the shared circular buffer
                     const u_char *udp_payload = (reinterpret_cast<const u_char *>(uh) + sizeof(gr_udp_header));
-                    if (fifo_items <= (FIFO_SIZE - payload_length_bytes))
-                        {
-                            int aligned_write_items = FIFO_SIZE - fifo_write_ptr;
-                            if (aligned_write_items >= payload_length_bytes)
-                                {
-                                    // write all in a single memcpy
-                                    memcpy(&fifo_buff[fifo_write_ptr], &udp_payload[0], payload_length_bytes);  // size in bytes
-                                    fifo_write_ptr += payload_length_bytes;
-                                    if (fifo_write_ptr == FIFO_SIZE)
-                                        {
-                                            fifo_write_ptr = 0;
-                                        }
-                                    fifo_items += payload_length_bytes;
-                                }
-                            else
-                                {
-                                    // two step wrap write
-                                    memcpy(&fifo_buff[fifo_write_ptr], &udp_payload[0], aligned_write_items);  // size in bytes
-                                    fifo_write_ptr = payload_length_bytes - aligned_write_items;
-                                    memcpy(&fifo_buff[0], &udp_payload[aligned_write_items], fifo_write_ptr);  // size in bytes
-                                    fifo_items += payload_length_bytes;
-                                }
-                        }
-                    else
-                        {
-                            // notify overflow
-                            std::cout << "O" << std::flush;
-                        }
+                    d_fifo.push_payload(udp_payload, payload_length_bytes);
                 }
         }
 }
@@ -317,11 +399,63 @@ void Gr_Complex_Ip_Packet_Source::my_pcap_loop_thread(pcap_t *pcap_handle)
 }
 
 
+void Gr_Complex_Ip_Packet_Source::my_socket_loop_thread()
+{
+    std::vector<u_char> buffers(static_cast<size_t>(RECV_BATCH) * MAX_UDP_PAYLOAD);
+#ifdef __linux__
+    // read up to RECV_BATCH datagrams per system call
+    std::vector<struct iovec> iovecs(RECV_BATCH);
+    std::vector<struct mmsghdr> msgs(RECV_BATCH);
+    for (int i = 0; i < RECV_BATCH; i++)
+        {
+            iovecs[i].iov_base = &buffers[static_cast<size_t>(i) * MAX_UDP_PAYLOAD];
+            iovecs[i].iov_len = MAX_UDP_PAYLOAD;
+            memset(&msgs[i], 0, sizeof(struct mmsghdr));
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+    while (not d_stop_rx)
+        {
+            const int received = recvmmsg(d_sock_raw, msgs.data(), RECV_BATCH, MSG_WAITFORONE, nullptr);
+            if (received < 0)
+                {
+                    if (errno == EAGAIN or errno == EWOULDBLOCK or errno == EINTR)
+                        {
+                            continue;
+                        }
+                    std::cout << "Error reading UDP socket: " << strerror(errno) << '\n';
+                    break;
+                }
+            for (int i = 0; i < received; i++)
+                {
+                    d_fifo.push_payload(&buffers[static_cast<size_t>(i) * MAX_UDP_PAYLOAD], static_cast<int>(msgs[i].msg_len));
+                }
+        }
+#else
+    while (not d_stop_rx)
+        {
+            const ssize_t received = recv(d_sock_raw, buffers.data(), MAX_UDP_PAYLOAD, 0);
+            if (received < 0)
+                {
+                    if (errno == EAGAIN or errno == EWOULDBLOCK or errno == EINTR)
+                        {
+                            continue;
+                        }
+                    std::cout << "Error reading UDP socket: " << strerror(errno) << '\n';
+                    break;
+                }
+            d_fifo.push_payload(buffers.data(), static_cast<int>(received));
+        }
+#endif
+}
+
+
 void Gr_Complex_Ip_Packet_Source::demux_samples(const gr_vector_void_star &output_items, int num_samples_readed)
 {
     int8_t real;
     int8_t imag;
     uint8_t tmp_char2;
+    fifo_read_ptr = 0;
     for (int n = 0; n < num_samples_readed; n++)
         {
             switch (d_wire_sample_type)
@@ -377,10 +511,6 @@ void Gr_Complex_Ip_Packet_Source::demux_samples(const gr_vector_void_star &outpu
                     std::cout << "Unknown wire sample type\n";
                     exit(0);
                 }
-            if (fifo_read_ptr == FIFO_SIZE)
-                {
-                    fifo_read_ptr = 0;
-                }
         }
 }
 
@@ -390,8 +520,8 @@ int Gr_Complex_Ip_Packet_Source::work(int noutput_items,
     gr_vector_void_star &output_items)
 {
     // send samples to next GNU Radio block
-    boost::mutex::scoped_lock lock(d_mutex);  // hold mutex for duration of this function
-    if (fifo_items == 0)
+    const int fifo_items = static_cast<int>(std::min(d_fifo.size(), static_cast<size_t>(INT32_MAX)));
+    if (fifo_items < d_bytes_per_sample)
         {
             return 0;
         }
@@ -430,10 +560,13 @@ int Gr_Complex_Ip_Packet_Source::work(int noutput_items,
         }
 
     bytes_requested = num_samples_readed * d_bytes_per_sample;
-    // read all in a single loop
-    demux_samples(output_items, num_samples_readed);  // it also increases the fifo read pointer
-    // update fifo items
-    fifo_items = fifo_items - bytes_requested;
+    // take the samples out of the lock-free FIFO, then demultiplex them
+    if (fifo_buff.size() < static_cast<size_t>(bytes_requested))
+        {
+            fifo_buff.resize(bytes_requested);
+        }
+    d_fifo.read(fifo_buff.data(), bytes_requested);
+    demux_samples(output_items, num_samples_readed);
 
     for (uint64_t n = 0; n < output_items.size(); n++)
         {
@@ -2,7 +2,8 @@
  * \file gr_complex_ip_packet_source.h
  *
  * \brief Receives ip frames containing samples in UDP frame encapsulation
- * using a high performance packet capture library (libpcap)
+ * using a high performance packet capture library (libpcap) or batched reads
+ * from a UDP socket
  * \author Javier Arribas jarribas (at) cttc.es
  * -----------------------------------------------------------------------------
  *
@@ -22,6 +23,7 @@
 #ifndef GNSS_SDR_GR_COMPLEX_IP_PACKET_SOURCE_H
 #define GNSS_SDR_GR_COMPLEX_IP_PACKET_SOURCE_H
 
+#include "udp_payload_fifo.h"
 #include <boost/thread.hpp>
 #include <gnuradio/sync_block.h>
 #include <arpa/inet.h>
@@ -29,8 +31,11 @@
 #include <net/if.h>
 #include <netinet/if_ether.h>
 #include <pcap.h>
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <sys/ioctl.h>
+#include <vector>
 #if GNURADIO_USES_STD_POINTERS
 #include <memory>
 #else
@@ -52,7 +57,11 @@ public:
         int n_baseband_channels,
         const std::string &wire_sample_type,
         size_t item_size,
-        bool IQ_swap_);
+        bool IQ_swap_,
+        bool use_pcap = true,
+        size_t fifo_samples = 1048576,
+        int sequence_number_bytes = 0,
+        int rx_thread_cpu = -1);
     Gr_Complex_Ip_Packet_Source(std::string src_device,
         const std::string &origin_address,
         int udp_port,
@@ -60,7 +69,11 @@ public:
         int n_baseband_channels,
         const std::string &wire_sample_type,
         size_t item_size,
-        bool IQ_swap_);
+        bool IQ_swap_,
+        bool use_pcap = true,
+        size_t fifo_samples = 1048576,
+        int sequence_number_bytes = 0,
+        int rx_thread_cpu = -1);
     ~Gr_Complex_Ip_Packet_Source();
 
     // Called by gnuradio to enable drivers, etc for i/o devices.
@@ -74,9 +87,23 @@ public:
         gr_vector_const_void_star &input_items,
         gr_vector_void_star &output_items);
 
+    // Packets lost, as given by the sequence numbers, and replaced by zeros
+    inline uint64_t lost_packets() const
+    {
+        return d_fifo.lost_packets();
+    }
+
+    // Packets dropped because the FIFO was full
+    inline uint64_t overflows() const
+    {
+        return d_fifo.overflows();
+    }
+
 private:
     void demux_samples(const gr_vector_void_star &output_items, int num_samples_readed);
+    void pin_rx_thread();
     void my_pcap_loop_thread(pcap_t *pcap_handle);
+    void my_socket_loop_thread();
     void pcap_callback(u_char *args, const struct pcap_pkthdr *pkthdr, const u_char *packet);
     static void static_pcap_callback(u_char *args, const struct pcap_pkthdr *pkthdr, const u_char *packet);
     /*
@@ -85,8 +112,10 @@ private:
      */
     bool open();
 
-    boost::thread *d_pcap_thread;
-    boost::mutex d_mutex;
+    Udp_Payload_Fifo d_fifo;
+    std::vector<char> fifo_buff;  // samples being demultiplexed
+    std::atomic<bool> d_stop_rx;
+    boost::thread *d_rx_thread;
     struct sockaddr_in si_me
     {
     };
@@ -94,18 +123,16 @@ private:
     std::string d_origin_address;
     pcap_t *descr;  // ethernet pcap device descriptor
     size_t d_item_size;
-    char *fifo_buff;
     int fifo_read_ptr;
-    int fifo_write_ptr;
-    int fifo_items;
     int d_sock_raw;
     int d_udp_port;
     int d_udp_payload_size;
     int d_n_baseband_channels;
     int d_wire_sample_type;
     int d_bytes_per_sample;
+    int d_rx_thread_cpu;
     bool d_IQ_swap;
-    bool d_fifo_full;
+    bool d_use_pcap;
 };
 
 #endif  //  GNSS_SDR_GR_COMPLEX_IP_PACKET_SOURCE_H
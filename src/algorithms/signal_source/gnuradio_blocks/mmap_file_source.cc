@@ -0,0 +1,141 @@
+/*!
+ * \file mmap_file_source.cc
+ * \brief Reads samples from a file through a read-only memory mapping,
+ * with sequential access hints, explicit readahead and O(1) seek.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "mmap_file_source.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <algorithm>  // for std::min
+#include <cstdio>     // for SEEK_SET, SEEK_CUR, SEEK_END
+#include <cstring>    // for memcpy
+
+
+mmap_file_source_sptr mmap_make_file_source(size_t item_size,
+    const std::string& filename,
+    bool repeat,
+    size_t readahead_bytes)
+{
+    return mmap_file_source_sptr(new mmap_file_source(item_size, filename, repeat, readahead_bytes));
+}
+
+
+mmap_file_source::mmap_file_source(size_t item_size,
+    const std::string& filename,
+    bool repeat,
+    size_t readahead_bytes) : gr::sync_block("mmap_file_source",
+                                  gr::io_signature::make(0, 0, 0),
+                                  gr::io_signature::make(1, 1, item_size)),
+                              d_file(filename, true, readahead_bytes),
+                              d_item_size(item_size),
+                              d_items(static_cast<uint64_t>(d_file.size() / item_size)),
+                              d_position(0),
+                              d_bytes_read(0),
+                              d_repeat(repeat),
+                              d_started(false)
+{
+    d_file.reset(0);
+    DLOG(INFO) << "mmap_file_source: mapped " << d_file.size() << " bytes (" << d_items << " items) of " << filename;
+}
+
+
+bool mmap_file_source::seek(int64_t seek_point, int whence)
+{
+    int64_t target = seek_point;
+    if (whence == SEEK_CUR)
+        {
+            target += static_cast<int64_t>(d_position);
+        }
+    else if (whence == SEEK_END)
+        {
+            target += static_cast<int64_t>(d_items);
+        }
+    else if (whence != SEEK_SET)
+        {
+            return false;
+        }
+    if (target < 0 or static_cast<uint64_t>(target) > d_items)
+        {
+            LOG(WARNING) << "mmap_file_source: seek to item " << target << " is out of the file (" << d_items << " items)";
+            return false;
+        }
+
+    d_position = static_cast<uint64_t>(target);
+    d_file.reset(d_position * d_item_size);
+    return true;
+}
+
+
+double mmap_file_source::bandwidth() const
+{
+    if (not d_started)
+        {
+            return 0.0;
+        }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - d_start_time;
+    return elapsed.count() > 0.0 ? static_cast<double>(d_bytes_read) / elapsed.count() : 0.0;
+}
+
+
+bool mmap_file_source::stop()
+{
+    if (d_started)
+        {
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - d_start_time;
+            LOG(INFO) << "mmap_file_source: read " << d_bytes_read << " bytes from " << d_file.filename()
+                      << " in " << elapsed.count() << " s (" << bandwidth() / 1.0e6 << " MB/s)";
+        }
+    return true;
+}
+
+
+int mmap_file_source::work(int noutput_items,
+    gr_vector_const_void_star& input_items __attribute__((unused)),
+    gr_vector_void_star& output_items)
+{
+    if (not d_started)
+        {
+            d_start_time = std::chrono::steady_clock::now();
+            d_started = true;
+        }
+    auto* out = static_cast<uint8_t*>(output_items[0]);
+    uint64_t produced = 0;
+    while (produced < static_cast<uint64_t>(noutput_items))
+        {
+            if (d_position >= d_items)
+                {
+                    if (not d_repeat or d_items == 0)
+                        {
+                            break;
+                        }
+                    seek(0, SEEK_SET);
+                }
+            const uint64_t n = std::min(static_cast<uint64_t>(noutput_items) - produced, d_items - d_position);
+            std::memcpy(out + produced * d_item_size, d_file.data() + d_position * d_item_size, n * d_item_size);
+            d_position += n;
+            produced += n;
+        }
+
+    d_file.advance(d_position * d_item_size);
+    d_bytes_read += produced * d_item_size;
+
+    if (produced == 0)
+        {
+            return WORK_DONE;
+        }
+    return static_cast<int>(produced);
+}
@@ -0,0 +1,115 @@
+/*!
+ * \file mmap_file_source.h
+ * \brief Reads samples from a file through a read-only memory mapping,
+ * with sequential access hints, explicit readahead and O(1) seek.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_MMAP_FILE_SOURCE_H
+#define GNSS_SDR_MMAP_FILE_SOURCE_H
+
+#include "sequential_file.h"
+#include <gnuradio/sync_block.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#if GNURADIO_USES_STD_POINTERS
+#include <memory>
+#else
+#include <boost/shared_ptr.hpp>
+#endif
+
+class mmap_file_source;
+
+#if GNURADIO_USES_STD_POINTERS
+using mmap_file_source_sptr = std::shared_ptr<mmap_file_source>;
+#else
+using mmap_file_source_sptr = boost::shared_ptr<mmap_file_source>;
+#endif
+
+/*!
+ * \brief Returns a mmap_file_source. readahead_bytes is the size of the
+ * window ahead of the read position that the kernel is asked to prefetch.
+ * Throws std::runtime_error if the file cannot be opened or mapped.
+ */
+mmap_file_source_sptr mmap_make_file_source(size_t item_size,
+    const std::string& filename,
+    bool repeat,
+    size_t readahead_bytes = 64 * 1024 * 1024);
+
+/*!
+ * \brief Drop-in replacement for gr::blocks::file_source. The whole file is
+ * mapped read-only and advised as sequential, so the kernel reads ahead
+ * aggressively and the pages already consumed are released behind the read
+ * position. Samples go from the page cache to the output buffer in a single
+ * copy, without any intermediate stdio buffer, and seeking is just moving the
+ * read offset, which makes skipping to any point of a very long capture free.
+ */
+class mmap_file_source : public gr::sync_block
+{
+public:
+    /*!
+     * \brief Moves the read position to item seek_point (whence = SEEK_SET),
+     * or relative to the current position (SEEK_CUR) or to the end of the
+     * file (SEEK_END). Returns false if the resulting position is out of the
+     * file.
+     */
+    bool seek(int64_t seek_point, int whence);
+
+    inline uint64_t items() const
+    {
+        return d_items;
+    }
+
+    inline uint64_t position() const
+    {
+        return d_position;
+    }
+
+    /*!
+     * \brief Average read bandwidth since the first call to work(), in
+     * bytes per second.
+     */
+    double bandwidth() const;
+
+    bool stop() override;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items) override;
+
+private:
+    friend mmap_file_source_sptr mmap_make_file_source(size_t item_size,
+        const std::string& filename,
+        bool repeat,
+        size_t readahead_bytes);
+
+    mmap_file_source(size_t item_size,
+        const std::string& filename,
+        bool repeat,
+        size_t readahead_bytes);
+
+    Sequential_File d_file;
+    std::chrono::time_point<std::chrono::steady_clock> d_start_time;
+    size_t d_item_size;
+    uint64_t d_items;
+    uint64_t d_position;
+    uint64_t d_bytes_read;
+    bool d_repeat;
+    bool d_started;
+};
+
+#endif  // GNSS_SDR_MMAP_FILE_SOURCE_H
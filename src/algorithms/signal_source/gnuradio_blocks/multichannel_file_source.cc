@@ -0,0 +1,156 @@
+/*!
+ * \file multichannel_file_source.cc
+ * \brief Reads N sample files in lockstep, one output stream per file,
+ * so that multi-band captures stay sample-aligned.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "multichannel_file_source.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <unistd.h>   // for pread
+#include <algorithm>  // for std::min
+#include <cerrno>     // for errno
+#include <cstring>    // for memcpy, strerror
+#include <utility>    // for std::move
+
+
+multichannel_file_source_sptr multichannel_make_file_source(size_t item_size,
+    const std::vector<std::string>& filenames,
+    const std::vector<uint64_t>& items_to_skip,
+    bool repeat,
+    bool use_mmap,
+    size_t readahead_bytes)
+{
+    return multichannel_file_source_sptr(new multichannel_file_source(item_size, filenames, items_to_skip, repeat, use_mmap, readahead_bytes));
+}
+
+
+multichannel_file_source::multichannel_file_source(size_t item_size,
+    const std::vector<std::string>& filenames,
+    const std::vector<uint64_t>& items_to_skip,
+    bool repeat,
+    bool use_mmap,
+    size_t readahead_bytes) : gr::sync_block("multichannel_file_source",
+                                  gr::io_signature::make(0, 0, 0),
+                                  gr::io_signature::make(filenames.size(), filenames.size(), item_size)),
+                              d_item_size(item_size),
+                              d_sample_counter(0),
+                              d_repeat(repeat)
+{
+    for (size_t n = 0; n < filenames.size(); n++)
+        {
+            Stream stream{};
+            stream.file = std::unique_ptr<Sequential_File>(new Sequential_File(filenames[n], use_mmap, readahead_bytes));
+            stream.first_item = n < items_to_skip.size() ? items_to_skip[n] : 0;
+            if (stream.first_item * d_item_size > stream.file->size())
+                {
+                    LOG(WARNING) << "multichannel_file_source: skipping " << stream.first_item << " items goes beyond the end of " << filenames[n];
+                }
+            DLOG(INFO) << "multichannel_file_source: stream " << n << " reads " << filenames[n]
+                       << " (" << stream.file->size() / d_item_size << " items) from item " << stream.first_item;
+            d_streams.push_back(std::move(stream));
+        }
+    rewind();
+}
+
+
+uint64_t multichannel_file_source::items_available() const
+{
+    uint64_t available = UINT64_MAX;
+    for (const auto& stream : d_streams)
+        {
+            const uint64_t items = stream.file->size() / d_item_size;
+            available = std::min(available, stream.position < items ? items - stream.position : 0);
+        }
+    return d_streams.empty() ? 0 : available;
+}
+
+
+void multichannel_file_source::rewind()
+{
+    // The readahead is requested for every file in turn, so the kernel keeps
+    // reading all of them while the samples already in memory are consumed
+    for (auto& stream : d_streams)
+        {
+            stream.position = stream.first_item;
+            stream.file->reset(stream.position * d_item_size);
+        }
+}
+
+
+bool multichannel_file_source::read(Stream& stream, uint8_t* out, uint64_t nitems)
+{
+    const uint64_t offset = stream.position * d_item_size;
+    const uint64_t nbytes = nitems * d_item_size;
+    if (stream.file->data() != nullptr)
+        {
+            std::memcpy(out, stream.file->data() + offset, nbytes);
+            return true;
+        }
+    uint64_t done = 0;
+    while (done < nbytes)
+        {
+            const ssize_t ret = pread(stream.file->fd(), out + done, nbytes - done, static_cast<off_t>(offset + done));
+            if (ret < 0 and errno == EINTR)
+                {
+                    continue;
+                }
+            if (ret <= 0)
+                {
+                    LOG(ERROR) << "multichannel_file_source: error reading " << stream.file->filename() << ": " << std::strerror(errno);
+                    return false;
+                }
+            done += static_cast<uint64_t>(ret);
+        }
+    return true;
+}
+
+
+int multichannel_file_source::work(int noutput_items,
+    gr_vector_const_void_star& input_items __attribute__((unused)),
+    gr_vector_void_star& output_items)
+{
+    uint64_t nitems = std::min(static_cast<uint64_t>(noutput_items), items_available());
+    if (nitems == 0)
+        {
+            if (not d_repeat)
+                {
+                    return WORK_DONE;
+                }
+            rewind();
+            nitems = std::min(static_cast<uint64_t>(noutput_items), items_available());
+            if (nitems == 0)
+                {
+                    return WORK_DONE;
+                }
+        }
+
+    // The same number of items is read from every file
+    for (size_t n = 0; n < d_streams.size(); n++)
+        {
+            if (not read(d_streams[n], static_cast<uint8_t*>(output_items[n]), nitems))
+                {
+                    return WORK_DONE;
+                }
+        }
+    for (auto& stream : d_streams)
+        {
+            stream.position += nitems;
+            stream.file->advance(stream.position * d_item_size);
+        }
+    d_sample_counter += nitems;
+    return static_cast<int>(nitems);
+}
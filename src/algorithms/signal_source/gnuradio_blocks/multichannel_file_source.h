@@ -0,0 +1,118 @@
+/*!
+ * \file multichannel_file_source.h
+ * \brief Reads N sample files in lockstep, one output stream per file,
+ * so that multi-band captures stay sample-aligned.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_MULTICHANNEL_FILE_SOURCE_H
+#define GNSS_SDR_MULTICHANNEL_FILE_SOURCE_H
+
+#include "sequential_file.h"
+#include <gnuradio/sync_block.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#if GNURADIO_USES_STD_POINTERS
+#else
+#include <boost/shared_ptr.hpp>
+#endif
+
+class multichannel_file_source;
+
+#if GNURADIO_USES_STD_POINTERS
+using multichannel_file_source_sptr = std::shared_ptr<multichannel_file_source>;
+#else
+using multichannel_file_source_sptr = boost::shared_ptr<multichannel_file_source>;
+#endif
+
+/*!
+ * \brief Returns a multichannel_file_source reading filenames[n] into output
+ * stream n, starting at item items_to_skip[n] of each file. If use_mmap is
+ * false, the files are read with pread(). Throws std::runtime_error if a file
+ * cannot be opened or mapped.
+ */
+multichannel_file_source_sptr multichannel_make_file_source(size_t item_size,
+    const std::vector<std::string>& filenames,
+    const std::vector<uint64_t>& items_to_skip,
+    bool repeat,
+    bool use_mmap,
+    size_t readahead_bytes = 64 * 1024 * 1024);
+
+/*!
+ * \brief Reads several files in lockstep: every call to work() produces the
+ * same number of items on all the output streams, so item k of every stream
+ * corresponds to the same sampling instant (given the per-file skip offsets)
+ * whatever the scheduling of the downstream blocks. Readahead is requested for
+ * all the files at once, so the kernel reads them in parallel.
+ * The source stops when the shortest file ends or, if repeat is set, all files
+ * go back to their start offsets together.
+ */
+class multichannel_file_source : public gr::sync_block
+{
+public:
+    /*!
+     * \brief Number of items produced on each output stream so far, common to
+     * all the streams.
+     */
+    inline uint64_t sample_counter() const
+    {
+        return d_sample_counter;
+    }
+
+    /*!
+     * \brief Number of items that can be produced on each output stream
+     * before the shortest file ends.
+     */
+    uint64_t items_available() const;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items) override;
+
+private:
+    friend multichannel_file_source_sptr multichannel_make_file_source(size_t item_size,
+        const std::vector<std::string>& filenames,
+        const std::vector<uint64_t>& items_to_skip,
+        bool repeat,
+        bool use_mmap,
+        size_t readahead_bytes);
+
+    multichannel_file_source(size_t item_size,
+        const std::vector<std::string>& filenames,
+        const std::vector<uint64_t>& items_to_skip,
+        bool repeat,
+        bool use_mmap,
+        size_t readahead_bytes);
+
+    struct Stream
+    {
+        std::unique_ptr<Sequential_File> file;
+        uint64_t first_item;
+        uint64_t position;
+    };
+
+    void rewind();
+    bool read(Stream& stream, uint8_t* out, uint64_t nitems);
+
+    std::vector<Stream> d_streams;
+    size_t d_item_size;
+    uint64_t d_sample_counter;
+    bool d_repeat;
+};
+
+#endif  // GNSS_SDR_MULTICHANNEL_FILE_SOURCE_H
@@ -20,21 +20,8 @@
 
 #include "unpack_2bit_samples.h"
 #include <gnuradio/io_signature.h>
-
-struct byte_2bit_struct
-{
-    signed sample_0 : 2;  // <- 2 bits wide only
-    signed sample_1 : 2;  // <- 2 bits wide only
-    signed sample_2 : 2;  // <- 2 bits wide only
-    signed sample_3 : 2;  // <- 2 bits wide only
-};
-
-
-union byte_and_samples
-{
-    int8_t byte;
-    byte_2bit_struct samples;
-};
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <utility>
 
 
 bool systemIsBigEndian()
@@ -49,39 +36,6 @@ bool systemIsBigEndian()
 }
 
 
-bool systemBytesAreBigEndian()
-{
-    byte_and_samples b{};
-    b.byte = static_cast<int8_t>(0x01);
-    if (*reinterpret_cast<char *>(&b.byte) == 1)
-        {
-            return false;
-        }
-
-    return true;
-}
-
-
-void swapEndianness(int8_t const *in, std::vector<int8_t> &out, size_t item_size, unsigned int ninput_items)
-{
-    unsigned int i;
-    unsigned int j = 0;
-    int k = 0;
-    int l = 0;
-    size_t skip = item_size - 1;
-
-    for (i = 0; i < ninput_items; ++i)
-        {
-            k = static_cast<int>(j + skip);
-            l = static_cast<int>(j);
-            while (k >= l)
-                {
-                    out[j++] = in[k--];
-                }
-        }
-}
-
-
 unpack_2bit_samples_sptr make_unpack_2bit_samples(bool big_endian_bytes,
     size_t item_size,
     bool big_endian_items,
@@ -107,7 +61,8 @@ unpack_2bit_samples::unpack_2bit_samples(bool big_endian_bytes,
       big_endian_bytes_(big_endian_bytes),
       big_endian_items_(big_endian_items),
       swap_endian_items_(false),
-      reverse_interleaving_(reverse_interleaving)
+      reverse_interleaving_(reverse_interleaving),
+      use_kernel_(false)
 {
     bool big_endian_system = systemIsBigEndian();
 
@@ -116,9 +71,34 @@ unpack_2bit_samples::unpack_2bit_samples(bool big_endian_bytes,
     swap_endian_items_ = (item_size_ > 1) &&
                          (big_endian_system != big_endian_items);
 
-    bool big_endian_bytes_system = systemBytesAreBigEndian();
+    // Position in the byte of each output sample, counted in 2-bit fields
+    // from the least significant bits (little endian bytes):
+    // 1) The samples in a byte are in big endian order: 3, 2, 1, 0
+    // 2) The samples in a byte are in little endian order: 0, 1, 2, 3
+    // and reverse interleaving swaps the I and Q samples of each pair.
+    std::array<uint32_t, 4> field{{0, 1, 2, 3}};
+    if (big_endian_bytes_)
+        {
+            field = {{3, 2, 1, 0}};
+        }
+    if (reverse_interleaving_)
+        {
+            std::swap(field[0], field[1]);
+            std::swap(field[2], field[3]);
+        }
+
+    // The most common layout is the one the VOLK_GNSSSDR kernel handles
+    use_kernel_ = not swap_endian_items_ and field[0] == 0 and field[1] == 1;
 
-    swap_endian_bytes_ = (big_endian_bytes_system != big_endian_bytes_);
+    for (uint32_t byte = 0; byte < 256; byte++)
+        {
+            for (uint32_t k = 0; k < 4; k++)
+                {
+                    // signed 2-bit value s, mapped to 2 * s + 1
+                    const int32_t code = static_cast<int32_t>((byte >> (2 * field[k])) & 3U);
+                    lut_[4 * byte + k] = static_cast<int8_t>(2 * (code >= 2 ? code - 4 : code) + 1);
+                }
+        }
 }
 
 
@@ -126,85 +106,29 @@ int unpack_2bit_samples::work(int noutput_items,
     gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
-    auto const *in = reinterpret_cast<signed char const *>(input_items[0]);
+    const auto *in = reinterpret_cast<const uint8_t *>(input_items[0]);
     auto *out = reinterpret_cast<int8_t *>(output_items[0]);
 
-    size_t ninput_bytes = noutput_items / 4;
-    size_t ninput_items = ninput_bytes / item_size_;
+    const size_t ninput_bytes = noutput_items / 4;
 
-    // Handle endian swap if needed
-    if (swap_endian_items_)
+    if (use_kernel_)
         {
-            work_buffer_.reserve(ninput_bytes);
-            swapEndianness(in, work_buffer_, item_size_, ninput_items);
-
-            in = const_cast<signed char const *>(&work_buffer_[0]);
+            volk_gnsssdr_8u_unpack2bit_8i(reinterpret_cast<char *>(out), in, noutput_items);
+            return noutput_items;
         }
 
-    // Here the in pointer can be interpreted as a stream of bytes to be
-    // converted. But we now have two possibilities:
-    // 1) The samples in a byte are in big endian order
-    // 2) The samples in a byte are in little endian order
-
-    byte_and_samples raw_byte{};
-    int n = 0;
-
-    if (!reverse_interleaving_)
-        {
-            if (swap_endian_bytes_)
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                        }
-                }
-            else
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                        }
-                }
-        }
-    else
+    // Other layouts go through the 256-entry table. Item bytes are swapped by
+    // reading them in reverse order, so no intermediate buffer is needed.
+    for (size_t item = 0; item < ninput_bytes; item += item_size_)
         {
-            if (swap_endian_bytes_)
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                        }
-                }
-            else
+            for (size_t b = 0; b < item_size_; b++)
                 {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                        }
+                    const size_t byte_index = swap_endian_items_ ? item_size_ - 1 - b : b;
+                    const int8_t *samples = &lut_[4 * in[item + byte_index]];
+                    *out++ = samples[0];
+                    *out++ = samples[1];
+                    *out++ = samples[2];
+                    *out++ = samples[3];
                 }
         }
 
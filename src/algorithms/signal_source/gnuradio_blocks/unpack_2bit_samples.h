@@ -58,8 +58,8 @@
 #define GNSS_SDR_UNPACK_2BIT_SAMPLES_H
 
 #include <gnuradio/sync_interpolator.h>
+#include <array>
 #include <cstdint>
-#include <vector>
 #if GNURADIO_USES_STD_POINTERS
 #include <memory>
 #else
@@ -106,13 +106,13 @@ private:
         bool big_endian_items,
         bool reverse_interleaving);
 
-    std::vector<int8_t> work_buffer_;
+    std::array<int8_t, 1024> lut_;  // four output samples for each byte value
     size_t item_size_;
     bool big_endian_bytes_;
     bool big_endian_items_;
     bool swap_endian_items_;
-    bool swap_endian_bytes_;
     bool reverse_interleaving_;
+    bool use_kernel_;
 };
 
 #endif  // GNSS_SDR_UNPACK_2BIT_SAMPLES_H
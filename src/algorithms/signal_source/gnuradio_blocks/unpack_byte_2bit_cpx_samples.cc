@@ -24,13 +24,9 @@
 
 #include "unpack_byte_2bit_cpx_samples.h"
 #include <gnuradio/io_signature.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
 #include <cstdint>
 
-struct byte_2bit_struct
-{
-    signed two_bit_sample : 2;  // <- 2 bits wide only
-};
-
 
 unpack_byte_2bit_cpx_samples_sptr make_unpack_byte_2bit_cpx_samples()
 {
@@ -50,47 +46,12 @@ int unpack_byte_2bit_cpx_samples::work(int noutput_items,
     gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
-    const auto *in = reinterpret_cast<const int8_t *>(input_items[0]);
-    auto *out = reinterpret_cast<int16_t *>(output_items[0]);
-
-    byte_2bit_struct sample{};
-    int n = 0;
-    for (int i = 0; i < noutput_items / 4; i++)
-        {
-            // Read packed input sample (1 byte = 2 complex samples)
-            // *     Packing Order
-            // *     Most Significant Nibble  - Sample n
-            // *     Least Significant Nibble - Sample n+1
-            // *     Packing order in Nibble Q1 Q0 I1 I0
-            // normal
-            //  int8_t c = in[i];
-            //  //Q[n]
-            //  sample.two_bit_sample = (c>>6) & 3;
-            //  out[n++] = (2*(int16_t)sample.two_bit_sample+1);
-            //  //I[n]
-            //  sample.two_bit_sample = (c>>4) & 3;
-            //  out[n++] = (2*(int16_t)sample.two_bit_sample+1);
-            //  //Q[n+1]
-            //  sample.two_bit_sample = (c>>2) & 3;
-            //  out[n++] = (2*(int16_t)sample.two_bit_sample+1);
-            //  //I[n+1]
-            //  sample.two_bit_sample = c & 3;
-            //  out[n++] = (2*(int16_t)sample.two_bit_sample+1);
+    const auto *in = reinterpret_cast<const unsigned char *>(input_items[0]);
+    auto *out = reinterpret_cast<lv_16sc_t *>(output_items[0]);
 
-            // I/Q swap
-            int8_t c = in[i];
-            // I[n]
-            sample.two_bit_sample = (c >> 4) & 3;
-            out[n++] = (2 * static_cast<int16_t>(sample.two_bit_sample) + 1);
-            // Q[n]
-            sample.two_bit_sample = (c >> 6) & 3;
-            out[n++] = (2 * static_cast<int16_t>(sample.two_bit_sample) + 1);
-            // I[n+1]
-            sample.two_bit_sample = c & 3;
-            out[n++] = (2 * static_cast<int16_t>(sample.two_bit_sample) + 1);
-            // Q[n+1]
-            sample.two_bit_sample = (c >> 2) & 3;
-            out[n++] = (2 * static_cast<int16_t>(sample.two_bit_sample) + 1);
-        }
+    // 1 byte = 2 complex samples. The most significant nibble holds sample n,
+    // and the least significant one sample n + 1, packed as Q1 Q0 I1 I0.
+    // Output items are the I and Q components, interleaved.
+    volk_gnsssdr_8u_unpack2bitcpx_16ic(out, in, noutput_items / 2);
     return noutput_items;
 }
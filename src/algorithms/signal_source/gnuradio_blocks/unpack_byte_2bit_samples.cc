@@ -20,11 +20,7 @@
 
 #include "unpack_byte_2bit_samples.h"
 #include <gnuradio/io_signature.h>
-
-struct byte_2bit_struct
-{
-    signed two_bit_sample : 2;  // <- 2 bits wide only
-};
+#include <volk_gnsssdr/volk_gnsssdr.h>
 
 
 unpack_byte_2bit_samples_sptr make_unpack_byte_2bit_samples()
@@ -45,26 +41,10 @@ int unpack_byte_2bit_samples::work(int noutput_items,
     gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
-    const auto *in = reinterpret_cast<const signed char *>(input_items[0]);
+    const auto *in = reinterpret_cast<const unsigned char *>(input_items[0]);
     auto *out = reinterpret_cast<float *>(output_items[0]);
 
-    byte_2bit_struct sample{};
-    int n = 0;
-    for (int i = 0; i < noutput_items / 4; i++)
-        {
-            // Read packed input sample (1 byte = 4 samples)
-            signed char c = in[i];
-            sample.two_bit_sample = c & 3;
-            out[n++] = static_cast<float>(sample.two_bit_sample);
-
-            sample.two_bit_sample = (c >> 2) & 3;
-            out[n++] = static_cast<float>(sample.two_bit_sample);
-
-            sample.two_bit_sample = (c >> 4) & 3;
-            out[n++] = static_cast<float>(sample.two_bit_sample);
-
-            sample.two_bit_sample = (c >> 6) & 3;
-            out[n++] = static_cast<float>(sample.two_bit_sample);
-        }
+    // 1 byte = 4 samples, least significant bits first
+    volk_gnsssdr_8u_unpack2bit_32f(out, in, noutput_items);
     return noutput_items;
 }
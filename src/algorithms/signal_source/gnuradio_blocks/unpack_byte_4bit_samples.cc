@@ -21,6 +21,7 @@
 
 #include "unpack_byte_4bit_samples.h"
 #include <gnuradio/io_signature.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
 
 unpack_byte_4bit_samples_sptr make_unpack_byte_4bit_samples()
 {
@@ -40,31 +41,10 @@ int unpack_byte_4bit_samples::work(int noutput_items,
     gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
-    const auto *in = reinterpret_cast<const signed char *>(input_items[0]);
-    auto *out = reinterpret_cast<signed char *>(output_items[0]);
-    int n = 0;
-    unsigned char tmp_char2;
-    for (int i = 0; i < noutput_items / 2; i++)
-        {
-            tmp_char2 = in[i] & 0x0F;
-            if (tmp_char2 >= 8)
-                {
-                    out[n++] = 2 * (tmp_char2 - 16) + 1;
-                }
-            else
-                {
-                    out[n++] = 2 * tmp_char2 + 1;
-                }
-            tmp_char2 = in[i] >> 4;
-            tmp_char2 = tmp_char2 & 0x0F;
-            if (tmp_char2 >= 8)
-                {
-                    out[n++] = 2 * (tmp_char2 - 16) + 1;
-                }
-            else
-                {
-                    out[n++] = 2 * tmp_char2 + 1;
-                }
-        }
+    const auto *in = reinterpret_cast<const unsigned char *>(input_items[0]);
+    auto *out = reinterpret_cast<char *>(output_items[0]);
+
+    // 1 byte = 2 samples, least significant nibble first
+    volk_gnsssdr_8u_unpack4bit_8i(out, in, noutput_items);
     return noutput_items;
 }
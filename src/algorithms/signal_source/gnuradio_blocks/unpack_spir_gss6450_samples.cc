@@ -21,7 +21,6 @@
 
 #include "unpack_spir_gss6450_samples.h"
 #include <gnuradio/io_signature.h>
-#include <cmath>
 
 unpack_spir_gss6450_samples_sptr make_unpack_spir_gss6450_samples(int adc_nbit_)
 {
@@ -35,72 +34,43 @@ unpack_spir_gss6450_samples::unpack_spir_gss6450_samples(int adc_nbit) : gr::syn
 {
     adc_bits = adc_nbit;
     samples_per_int = 16 / adc_bits;
+
+    // Two's complement value of each 2-bit and 4-bit code
+    auto two_bit = [](uint32_t code) { return static_cast<float>(code >= 2 ? static_cast<int32_t>(code) - 4 : static_cast<int32_t>(code)); };
+    auto four_bit = [](uint32_t code) { return static_cast<float>(code >= 8 ? static_cast<int32_t>(code) - 16 : static_cast<int32_t>(code)); };
+    for (uint32_t code = 0; code < 16; code++)
+        {
+            // I in the two least significant bits, Q in the two most significant ones
+            lut_2bit_[code] = gr_complex(two_bit(code & 3), two_bit(code >> 2));
+        }
+    for (uint32_t code = 0; code < 256; code++)
+        {
+            // I in the least significant nibble, Q in the most significant one
+            lut_4bit_[code] = gr_complex(four_bit(code & 0x0F), four_bit(code >> 4));
+        }
 }
 
 
 void unpack_spir_gss6450_samples::decode_4bits_word(uint32_t input_uint32, gr_complex* out, int adc_bits_)
 {
-    int8_t tmp_char;
-    float Q;
-    float I;
     switch (adc_bits_)
         {
         case 2:
             // four bits per complex sample (2 I + 2 Q), 8 samples per int32[s0,s1,s2,s3,s4,s5,s6,s7]
+            // s7 is in the least significant nibble
             for (int i = 0; i < 8; i++)
                 {
-                    tmp_char = input_uint32 & 3;
-
-                    if (tmp_char >= 2)
-                        {
-                            I = static_cast<float>(tmp_char - 4);
-                        }
-                    else
-                        {
-                            I = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 2;
-                    tmp_char = input_uint32 & 3;
-                    if (tmp_char >= 2)
-                        {
-                            Q = static_cast<float>(tmp_char - 4);
-                        }
-                    else
-                        {
-                            Q = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 2;
-
-                    out[7 - i] = gr_complex(I, Q);
+                    out[7 - i] = lut_2bit_[input_uint32 & 0x0F];
+                    input_uint32 = input_uint32 >> 4;
                 }
             break;
         case 4:
             // eight bits per complex sample (4 I + 4 Q), 4 samples per int32= [s0,s1,s2,s3]
+            // s3 is in the least significant byte
             for (int i = 0; i < 4; i++)
                 {
-                    tmp_char = input_uint32 & 0x0F;
-
-                    if (tmp_char >= 8)
-                        {
-                            I = static_cast<float>(tmp_char - 16);
-                        }
-                    else
-                        {
-                            I = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 4;
-                    tmp_char = input_uint32 & 0x0F;
-                    if (tmp_char >= 8)
-                        {
-                            Q = static_cast<float>(tmp_char - 16);
-                        }
-                    else
-                        {
-                            Q = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 4;
-
-                    out[3 - i] = gr_complex(I, Q);
+                    out[3 - i] = lut_4bit_[input_uint32 & 0xFF];
+                    input_uint32 = input_uint32 >> 8;
                 }
             break;
         }
@@ -22,6 +22,8 @@
 #define GNSS_SDR_UNPACK_SPIR_GSS6450_SAMPLES_H
 
 #include <gnuradio/sync_interpolator.h>
+#include <array>
+#include <cstdint>
 #if GNURADIO_USES_STD_POINTERS
 #include <memory>
 #else
@@ -50,6 +52,8 @@ public:
 
 private:
     friend unpack_spir_gss6450_samples_sptr make_unpack_spir_gss6450_samples_sptr(int adc_nbit);
+    std::array<gr_complex, 16> lut_2bit_;   // complex sample in each nibble
+    std::array<gr_complex, 256> lut_4bit_;  // complex sample in each byte
     int adc_bits;
     int samples_per_int;
 };
@@ -0,0 +1,333 @@
+/*!
+ * \file capture_file_writer.cc
+ * \brief Records a stream of samples to disk from a writer thread, dropping
+ * what does not fit in its ring buffer instead of making the producer wait.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "capture_file_writer.h"
+#include <glog/logging.h>
+#include <fcntl.h>     // for open, fcntl, O_DIRECT
+#include <unistd.h>    // for write, ftruncate, close
+#include <algorithm>   // for std::min
+#include <array>       // for std::array
+#include <cerrno>      // for errno
+#include <cstdio>      // for snprintf
+#include <cstdlib>     // for posix_memalign, free
+#include <cstring>     // for memset, strerror
+#include <ctime>       // for gmtime_r, strftime
+#include <fstream>     // for std::ofstream
+#include <iomanip>     // for std::setprecision
+#include <stdexcept>   // for std::runtime_error
+
+
+// Alignment and size of the blocks written to disk. Direct I/O requires the
+// memory address, file offset and length of each write to be aligned
+const size_t CAPTURE_FILE_WRITER_ALIGNMENT = 4096;
+const size_t CAPTURE_FILE_WRITER_BLOCK_SIZE = 4 * 1024 * 1024;
+
+
+Capture_File_Writer::Capture_File_Writer(size_t item_size,
+    const std::string& filename,
+    double sampling_frequency,
+    const std::string& item_type,
+    uint64_t rotation_items,
+    size_t buffer_bytes,
+    bool direct_io) : d_fifo(buffer_bytes),
+                      d_filename(filename),
+                      d_item_type(item_type),
+                      d_block(nullptr),
+                      d_fs(sampling_frequency),
+                      d_item_size(item_size),
+                      d_block_size(CAPTURE_FILE_WRITER_BLOCK_SIZE),
+                      d_block_fill(0),
+                      d_rotation_items(rotation_items),
+                      d_start_counter(0),
+                      d_file_first_item(0),
+                      d_file_gap_items(0),
+                      d_file_bytes(0),
+                      d_next_item(0),
+                      d_dropped_items(0),
+                      d_file_index(0),
+                      d_stop(false),
+                      d_fd(-1),
+                      d_direct_io(direct_io),
+                      d_started(false)
+{
+    void* block = nullptr;
+    if (posix_memalign(&block, CAPTURE_FILE_WRITER_ALIGNMENT, d_block_size) != 0)
+        {
+            throw std::runtime_error("Capture_File_Writer: cannot allocate the write buffer");
+        }
+    d_block = static_cast<uint8_t*>(block);
+}
+
+
+Capture_File_Writer::~Capture_File_Writer()
+{
+    if (d_writer.joinable())
+        {
+            stop();
+        }
+    if (d_fd >= 0)
+        {
+            close(d_fd);
+        }
+    std::free(d_block);
+}
+
+
+void Capture_File_Writer::start()
+{
+    d_stop = false;
+    d_writer = std::thread([this] { writer_thread(); });
+}
+
+
+void Capture_File_Writer::stop()
+{
+    d_stop = true;
+    if (d_writer.joinable())
+        {
+            d_writer.join();
+        }
+}
+
+
+void Capture_File_Writer::push(const void* items, uint64_t first_item, uint64_t nitems)
+{
+    const auto* in = static_cast<const uint8_t*>(items);
+    if (not d_started)
+        {
+            // read by the writer thread only after the first chunk, which publishes them
+            d_start_time = std::chrono::system_clock::now();
+            d_start_counter = first_item;
+            d_started = true;
+        }
+
+    // never wait for the writer: what does not fit in the ring buffer is dropped
+    const uint64_t max_chunk_items = std::max(static_cast<uint64_t>(1), static_cast<uint64_t>(d_fifo.capacity() / 4 / d_item_size));
+    uint64_t item = first_item;
+    uint64_t remaining = nitems;
+    while (remaining > 0)
+        {
+            const uint64_t n = std::min(remaining, max_chunk_items);
+            const Chunk chunk{item, n * d_item_size};
+            if (d_fifo.space() >= sizeof(Chunk) + chunk.nbytes)
+                {
+                    d_fifo.write(&chunk, sizeof(Chunk));
+                    d_fifo.write(in, chunk.nbytes);
+                }
+            else
+                {
+                    d_dropped_items += n;
+                }
+            in += chunk.nbytes;
+            item += n;
+            remaining -= n;
+        }
+}
+
+
+void Capture_File_Writer::writer_thread()
+{
+    Chunk chunk{};
+    while (not d_stop or d_fifo.size() > 0)
+        {
+            if (d_fifo.size() < sizeof(Chunk))
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    continue;
+                }
+            d_fifo.read(&chunk, sizeof(Chunk));
+            if (d_file_index == 0 or chunk.first_item != d_next_item)
+                {
+                    // first samples, or samples dropped before this chunk
+                    flush(true);
+                    open_file(chunk.first_item, d_file_index == 0 ? 0 : chunk.first_item - d_next_item);
+                }
+
+            uint64_t remaining = chunk.nbytes;
+            while (remaining > 0)
+                {
+                    if (d_rotation_items > 0 and d_file_bytes == d_rotation_items * d_item_size)
+                        {
+                            flush(true);
+                            open_file(d_file_first_item + d_rotation_items, 0);
+                        }
+                    uint64_t nbytes = std::min(remaining, static_cast<uint64_t>(d_block_size - d_block_fill));
+                    if (d_rotation_items > 0)
+                        {
+                            nbytes = std::min(nbytes, d_rotation_items * d_item_size - d_file_bytes);
+                        }
+                    // the producer writes the chunk payload right after its header
+                    const size_t n = d_fifo.read(d_block + d_block_fill, nbytes);
+                    if (n == 0)
+                        {
+                            std::this_thread::yield();
+                            continue;
+                        }
+                    d_block_fill += n;
+                    d_file_bytes += n;
+                    remaining -= n;
+                    if (d_block_fill == d_block_size)
+                        {
+                            flush(false);
+                        }
+                }
+            d_next_item = chunk.first_item + chunk.nbytes / d_item_size;
+        }
+    flush(true);
+}
+
+
+std::string Capture_File_Writer::file_name(uint32_t index) const
+{
+    if (d_rotation_items == 0 and index == 0)
+        {
+            return d_filename;
+        }
+    std::array<char, 8> suffix{};
+    snprintf(suffix.data(), suffix.size(), "_%04u", index);
+    const size_t dot = d_filename.find_last_of('.');
+    const size_t slash = d_filename.find_last_of('/');
+    if (dot == std::string::npos or (slash != std::string::npos and dot < slash))
+        {
+            return d_filename + suffix.data();
+        }
+    return d_filename.substr(0, dot) + suffix.data() + d_filename.substr(dot);
+}
+
+
+void Capture_File_Writer::open_file(uint64_t first_item, uint64_t gap_items)
+{
+    d_current_filename = file_name(d_file_index.load());
+    d_file_first_item = first_item;
+    d_file_gap_items = gap_items;
+    d_next_item = first_item;
+    d_file_bytes = 0;
+    d_block_fill = 0;
+    d_fd = -1;
+#ifdef O_DIRECT
+    if (d_direct_io)
+        {
+            d_fd = open(d_current_filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+            if (d_fd < 0 and errno == EINVAL)
+                {
+                    LOG(INFO) << "Capture_File_Writer: direct I/O not supported for " << d_current_filename;
+                    d_direct_io = false;
+                }
+        }
+#else
+    d_direct_io = false;
+#endif
+    if (d_fd < 0)
+        {
+            d_fd = open(d_current_filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        }
+    if (d_fd < 0)
+        {
+            LOG(ERROR) << "Capture_File_Writer: cannot open " << d_current_filename << ": " << std::strerror(errno);
+        }
+    d_file_index++;
+    write_sidecar();
+    DLOG(INFO) << "Capture_File_Writer: recording " << d_current_filename << " from item " << first_item;
+}
+
+
+void Capture_File_Writer::flush(bool close_file)
+{
+    if (d_block_fill > 0 and d_fd >= 0)
+        {
+            size_t nbytes = d_block_fill;
+            if (d_direct_io and nbytes % CAPTURE_FILE_WRITER_ALIGNMENT != 0)
+                {
+                    // last block of the file: pad it to the alignment, and cut the file afterwards
+                    const size_t padded = nbytes + CAPTURE_FILE_WRITER_ALIGNMENT - nbytes % CAPTURE_FILE_WRITER_ALIGNMENT;
+                    std::memset(d_block + nbytes, 0, padded - nbytes);
+                    nbytes = padded;
+                }
+            write_block(nbytes);
+            if (nbytes != d_block_fill and ftruncate(d_fd, static_cast<off_t>(d_file_bytes)) != 0)
+                {
+                    LOG(ERROR) << "Capture_File_Writer: error truncating " << d_current_filename << ": " << std::strerror(errno);
+                }
+        }
+    d_block_fill = 0;
+    if (close_file and d_fd >= 0)
+        {
+            close(d_fd);
+            d_fd = -1;
+            write_sidecar();
+        }
+}
+
+
+void Capture_File_Writer::write_block(size_t nbytes)
+{
+    size_t done = 0;
+    while (done < nbytes)
+        {
+            const ssize_t ret = write(d_fd, d_block + done, nbytes - done);
+            if (ret < 0 and errno == EINTR)
+                {
+                    continue;
+                }
+#ifdef O_DIRECT
+            if (ret < 0 and errno == EINVAL and d_direct_io)
+                {
+                    // some file systems accept O_DIRECT at open() but not at write(): go on with buffered writes
+                    LOG(INFO) << "Capture_File_Writer: direct I/O not supported for " << d_current_filename;
+                    d_direct_io = false;
+                    const int flags = fcntl(d_fd, F_GETFL);
+                    if (flags >= 0 and fcntl(d_fd, F_SETFL, flags & ~O_DIRECT) == 0)
+                        {
+                            continue;
+                        }
+                }
+#endif
+            if (ret <= 0)
+                {
+                    LOG(ERROR) << "Capture_File_Writer: error writing " << d_current_filename << ": " << std::strerror(errno);
+                    break;
+                }
+            done += static_cast<size_t>(ret);
+        }
+}
+
+
+void Capture_File_Writer::write_sidecar() const
+{
+    // UTC time of the first sample of the file, from the time the first sample was pushed
+    const auto offset = std::chrono::duration<double>(d_fs > 0.0 ? static_cast<double>(d_file_first_item - d_start_counter) / d_fs : 0.0);
+    const auto file_start = d_start_time + std::chrono::duration_cast<std::chrono::system_clock::duration>(offset);
+    const std::time_t seconds = std::chrono::system_clock::to_time_t(file_start);
+    const auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(file_start.time_since_epoch()).count() % 1000000;
+    std::tm utc{};
+    gmtime_r(&seconds, &utc);
+    std::array<char, 32> date{};
+    strftime(date.data(), date.size(), "%Y-%m-%dT%H:%M:%S", &utc);
+
+    std::ofstream sidecar(d_current_filename + ".hdr", std::ios::out | std::ios::trunc);
+    sidecar << "[capture]\n"
+            << "filename=" << d_current_filename << '\n'
+            << "sampling_frequency=" << std::setprecision(16) << d_fs << '\n'
+            << "item_type=" << d_item_type << '\n'
+            << "item_size=" << d_item_size << '\n'
+            << "start_sample_counter=" << d_file_first_item << '\n'
+            << "start_utc=" << date.data() << '.' << std::setfill('0') << std::setw(6) << microseconds << "Z\n"
+            << "dropped_items_before=" << d_file_gap_items << '\n'
+            << "items=" << d_file_bytes / d_item_size << '\n';
+}
@@ -0,0 +1,140 @@
+/*!
+ * \file capture_file_writer.h
+ * \brief Records a stream of samples to disk from a writer thread, dropping
+ * what does not fit in its ring buffer instead of making the producer wait.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#ifndef GNSS_SDR_CAPTURE_FILE_WRITER_H
+#define GNSS_SDR_CAPTURE_FILE_WRITER_H
+
+#include "spsc_ring_buffer.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>  // for size_t
+#include <cstdint>
+#include <string>
+#include <thread>
+
+/*!
+ * \brief Disk recorder behind the capture_tap block.
+ *
+ * push() only copies the samples into a ring buffer, which a writer thread
+ * drains to disk in large aligned blocks, bypassing the page cache with
+ * O_DIRECT if the file system supports it (buffered writes are used
+ * otherwise). The samples that do not fit in the ring buffer are dropped and
+ * counted, and a new file is started after the gap, so that every file holds
+ * contiguous samples. If rotation_items is not zero, a new file is also
+ * started every rotation_items items. Files other than the first one of a
+ * session without rotation get a four-digit index inserted before the
+ * extension of filename.
+ *
+ * Each file comes with a metadata sidecar, named as the file plus ".hdr",
+ * giving the sampling frequency, item type, sample counter and UTC time of its
+ * first sample, the number of items dropped just before it, and its length.
+ */
+class Capture_File_Writer
+{
+public:
+    Capture_File_Writer(size_t item_size,
+        const std::string& filename,
+        double sampling_frequency,
+        const std::string& item_type,
+        uint64_t rotation_items,
+        size_t buffer_bytes,
+        bool direct_io);
+
+    ~Capture_File_Writer();
+
+    /*!
+     * \brief Starts the writer thread.
+     */
+    void start();
+
+    /*!
+     * \brief Writes what is left in the ring buffer, closes the last file and
+     * stops the writer thread.
+     */
+    void stop();
+
+    /*!
+     * \brief Stores nitems items, the first one being item number first_item
+     * of the stream, or drops them if they do not fit. Producer thread only.
+     * Never waits for the writer thread.
+     */
+    void push(const void* items, uint64_t first_item, uint64_t nitems);
+
+    /*!
+     * \brief Number of items that could not be recorded.
+     */
+    inline uint64_t dropped_items() const
+    {
+        return d_dropped_items.load();
+    }
+
+    /*!
+     * \brief Number of files started so far.
+     */
+    inline uint32_t files() const
+    {
+        return d_file_index.load();
+    }
+
+    /*!
+     * \brief Name of the file number index (0 for the first one).
+     */
+    std::string file_name(uint32_t index) const;
+
+private:
+    // Header preceding each block of samples in the ring buffer
+    struct Chunk
+    {
+        uint64_t first_item;
+        uint64_t nbytes;
+    };
+
+    void writer_thread();
+    void open_file(uint64_t first_item, uint64_t gap_items);
+    void flush(bool close_file);
+    void write_block(size_t nbytes);
+    void write_sidecar() const;
+
+    Spsc_Ring_Buffer d_fifo;
+    std::thread d_writer;
+    std::chrono::system_clock::time_point d_start_time;
+    std::string d_filename;
+    std::string d_item_type;
+    std::string d_current_filename;
+    uint8_t* d_block;  // aligned staging block for O_DIRECT writes
+    double d_fs;
+    size_t d_item_size;
+    size_t d_block_size;
+    size_t d_block_fill;
+    uint64_t d_rotation_items;
+    uint64_t d_start_counter;
+    uint64_t d_file_first_item;
+    uint64_t d_file_gap_items;
+    uint64_t d_file_bytes;
+    uint64_t d_next_item;
+    std::atomic<uint64_t> d_dropped_items;
+    std::atomic<uint32_t> d_file_index;
+    std::atomic<bool> d_stop;
+    int d_fd;
+    bool d_direct_io;
+    bool d_started;
+};
+
+#endif  // GNSS_SDR_CAPTURE_FILE_WRITER_H
@@ -22,6 +22,7 @@
 
 #include "gnss_sdr_valve.h"
 #include "command_event.h"
+#include "replay_clock.h"
 #include <glog/logging.h>           // for LOG
 #include <gnuradio/io_signature.h>  // for io_signature
 #include <algorithm>                // for min
@@ -86,6 +87,12 @@ int Gnss_Sdr_Valve::work(int noutput_items,
             if (d_ncopied_items >= d_nitems)
                 {
                     LOG(INFO) << "Stopping receiver, " << d_ncopied_items << " samples processed";
+                    if (d_stop_flowgraph and Replay_Clock::get().enabled())
+                        {
+                            // deterministic replay: the receiver stops once the flowgraph
+                            // has processed all the samples
+                            return -1;
+                        }
                     d_queue->push(pmt::make_any(command_event_make(200, 0)));
                     if (d_stop_flowgraph)
                         {
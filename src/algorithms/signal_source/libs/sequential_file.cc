@@ -0,0 +1,156 @@
+/*!
+ * \file sequential_file.cc
+ * \brief Read-only sample file, optionally memory mapped, that keeps the
+ * kernel reading ahead of the read position and releases the pages behind it.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "sequential_file.h"
+#include <fcntl.h>     // for open, posix_fadvise
+#include <sys/mman.h>  // for mmap, madvise, munmap
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close, sysconf
+#include <algorithm>   // for std::min, std::max
+#include <cerrno>      // for errno
+#include <cstring>     // for strerror
+#include <stdexcept>   // for std::runtime_error
+
+
+Sequential_File::Sequential_File(const std::string& filename,
+    bool use_mmap,
+    size_t readahead_bytes) : d_filename(filename),
+                              d_data(nullptr),
+                              d_size(0),
+                              d_readahead_bytes(readahead_bytes),
+                              d_page_size(static_cast<size_t>(sysconf(_SC_PAGESIZE))),
+                              d_prefetched_until(0),
+                              d_released_until(0),
+                              d_fd(-1)
+{
+    d_fd = open(filename.c_str(), O_RDONLY);
+    if (d_fd < 0)
+        {
+            throw std::runtime_error("can't open file " + filename + ": " + std::strerror(errno));
+        }
+
+    struct stat st
+    {
+    };
+    if (fstat(d_fd, &st) < 0)
+        {
+            close(d_fd);
+            throw std::runtime_error("can't stat file " + filename + ": " + std::strerror(errno));
+        }
+    d_size = static_cast<size_t>(st.st_size);
+
+    if (use_mmap and d_size > 0)
+        {
+            void* addr = mmap(nullptr, d_size, PROT_READ, MAP_SHARED, d_fd, 0);
+            if (addr == MAP_FAILED)
+                {
+                    close(d_fd);
+                    throw std::runtime_error("can't map file " + filename + ": " + std::strerror(errno));
+                }
+            d_data = static_cast<const uint8_t*>(addr);
+
+            // Hints only: failures are harmless, so the return values are not checked
+            madvise(addr, d_size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+            // Lets the kernel back the mapping with huge pages where read-only
+            // file THP is available, reducing TLB misses on very large files
+            madvise(addr, d_size, MADV_HUGEPAGE);
+#endif
+        }
+#ifdef POSIX_FADV_SEQUENTIAL
+    else
+        {
+            posix_fadvise(d_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+        }
+#endif
+
+    // readahead windows are page multiples
+    d_readahead_bytes = std::max(d_page_size, (d_readahead_bytes / d_page_size) * d_page_size);
+}
+
+
+Sequential_File::~Sequential_File()
+{
+    if (d_data != nullptr)
+        {
+            munmap(const_cast<uint8_t*>(d_data), d_size);
+        }
+    if (d_fd >= 0)
+        {
+            close(d_fd);
+        }
+}
+
+
+void Sequential_File::reset(uint64_t byte_offset)
+{
+    d_released_until = byte_offset - byte_offset % d_page_size;
+    d_prefetched_until = d_released_until;
+    prefetch(byte_offset);
+}
+
+
+void Sequential_File::advance(uint64_t byte_offset)
+{
+    prefetch(byte_offset);
+    release(byte_offset);
+}
+
+
+void Sequential_File::prefetch(uint64_t byte_offset)
+{
+    // Asynchronous readahead request. The file sources issue them for every
+    // file in turn, so the kernel keeps reading all of them while the samples
+    // already in memory are consumed
+    if (byte_offset >= d_size or byte_offset + d_readahead_bytes / 2 < d_prefetched_until)
+        {
+            return;
+        }
+    const uint64_t start = std::max(d_prefetched_until, byte_offset - byte_offset % d_page_size);
+    const uint64_t end = std::min(static_cast<uint64_t>(d_size), byte_offset + d_readahead_bytes);
+    if (end <= start)
+        {
+            return;
+        }
+    if (d_data != nullptr)
+        {
+            madvise(const_cast<uint8_t*>(d_data) + start, end - start, MADV_WILLNEED);
+        }
+#ifdef POSIX_FADV_WILLNEED
+    else
+        {
+            posix_fadvise(d_fd, static_cast<off_t>(start), static_cast<off_t>(end - start), POSIX_FADV_WILLNEED);
+        }
+#endif
+    d_prefetched_until = end;
+}
+
+
+void Sequential_File::release(uint64_t byte_offset)
+{
+    // Pages behind the read position are not needed any more. Dropping them
+    // from the mapping keeps the resident set bounded on very long captures.
+    if (d_data == nullptr or byte_offset < d_released_until + d_readahead_bytes)
+        {
+            return;
+        }
+    const uint64_t end = byte_offset - byte_offset % d_page_size;
+    madvise(const_cast<uint8_t*>(d_data) + d_released_until, end - d_released_until, MADV_DONTNEED);
+    d_released_until = end;
+}
@@ -0,0 +1,112 @@
+/*!
+ * \file sequential_file.h
+ * \brief Read-only sample file, optionally memory mapped, that keeps the
+ * kernel reading ahead of the read position and releases the pages behind it.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#ifndef GNSS_SDR_SEQUENTIAL_FILE_H
+#define GNSS_SDR_SEQUENTIAL_FILE_H
+
+#include <cstddef>  // for size_t
+#include <cstdint>
+#include <string>
+
+/*!
+ * \brief File read from start to end, as the file sources do.
+ *
+ * If use_mmap is set, the whole file is mapped read-only and advised as
+ * sequential, and data() gives its contents. Otherwise data() is nullptr and
+ * the file is read through fd(). Either way, advance() asks the kernel for
+ * asynchronous readahead of the readahead_bytes following the read position,
+ * and, for a mapping, drops the pages more than readahead_bytes behind it,
+ * which keeps the resident set bounded on very long captures.
+ */
+class Sequential_File
+{
+public:
+    /*!
+     * \brief Opens (and maps) filename. Throws std::runtime_error on failure.
+     */
+    Sequential_File(const std::string& filename, bool use_mmap, size_t readahead_bytes);
+
+    ~Sequential_File();
+
+    Sequential_File(const Sequential_File&) = delete;
+    Sequential_File& operator=(const Sequential_File&) = delete;
+
+    inline const std::string& filename() const
+    {
+        return d_filename;
+    }
+
+    /*!
+     * \brief Contents of the file if it is mapped, nullptr otherwise.
+     */
+    inline const uint8_t* data() const
+    {
+        return d_data;
+    }
+
+    inline int fd() const
+    {
+        return d_fd;
+    }
+
+    /*!
+     * \brief File size in bytes.
+     */
+    inline size_t size() const
+    {
+        return d_size;
+    }
+
+    /*!
+     * \brief Offset below which the pages of the mapping have been released.
+     */
+    inline uint64_t released_until() const
+    {
+        return d_released_until;
+    }
+
+    /*!
+     * \brief Tells that the read position jumped to byte_offset (a seek or a
+     * rewind), and starts the readahead from there.
+     */
+    void reset(uint64_t byte_offset);
+
+    /*!
+     * \brief Tells that the read position moved forward to byte_offset:
+     * requests the readahead in front of it and releases the mapped pages
+     * behind it.
+     */
+    void advance(uint64_t byte_offset);
+
+private:
+    void prefetch(uint64_t byte_offset);
+    void release(uint64_t byte_offset);
+
+    std::string d_filename;
+    const uint8_t* d_data;
+    size_t d_size;
+    size_t d_readahead_bytes;
+    size_t d_page_size;
+    uint64_t d_prefetched_until;
+    uint64_t d_released_until;
+    int d_fd;
+};
+
+#endif  // GNSS_SDR_SEQUENTIAL_FILE_H
@@ -0,0 +1,105 @@
+/*!
+ * \file spsc_ring_buffer.cc
+ * \brief Lock-free single-producer, single-consumer byte ring buffer, used to
+ * hand samples from a receiving thread over to a GNU Radio source block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "spsc_ring_buffer.h"
+#include <algorithm>  // for std::min
+#include <cstring>    // for memcpy, memset
+
+
+Spsc_Ring_Buffer::Spsc_Ring_Buffer(size_t capacity_bytes) : d_write_position(0),
+                                                            d_read_position(0)
+{
+    size_t capacity = 1;
+    while (capacity < capacity_bytes)
+        {
+            capacity <<= 1U;
+        }
+    d_buffer = std::vector<uint8_t>(capacity, 0);
+    d_mask = capacity - 1;
+}
+
+
+size_t Spsc_Ring_Buffer::size() const
+{
+    const uint64_t write_position = d_write_position.load(std::memory_order_acquire);
+    return static_cast<size_t>(write_position - d_read_position.load(std::memory_order_relaxed));
+}
+
+
+size_t Spsc_Ring_Buffer::space() const
+{
+    const uint64_t read_position = d_read_position.load(std::memory_order_acquire);
+    return capacity() - static_cast<size_t>(d_write_position.load(std::memory_order_relaxed) - read_position);
+}
+
+
+void Spsc_Ring_Buffer::copy_in(uint64_t position, const uint8_t* data, size_t nbytes)
+{
+    const size_t offset = static_cast<size_t>(position) & d_mask;
+    const size_t first = std::min(nbytes, capacity() - offset);
+    if (data != nullptr)
+        {
+            std::memcpy(&d_buffer[offset], data, first);
+            std::memcpy(d_buffer.data(), data + first, nbytes - first);
+        }
+    else
+        {
+            std::memset(&d_buffer[offset], 0, first);
+            std::memset(d_buffer.data(), 0, nbytes - first);
+        }
+}
+
+
+bool Spsc_Ring_Buffer::write(const void* data, size_t nbytes)
+{
+    if (nbytes > space())
+        {
+            return false;
+        }
+    const uint64_t write_position = d_write_position.load(std::memory_order_relaxed);
+    copy_in(write_position, static_cast<const uint8_t*>(data), nbytes);
+    d_write_position.store(write_position + nbytes, std::memory_order_release);
+    return true;
+}
+
+
+bool Spsc_Ring_Buffer::write_zeros(size_t nbytes)
+{
+    if (nbytes > space())
+        {
+            return false;
+        }
+    const uint64_t write_position = d_write_position.load(std::memory_order_relaxed);
+    copy_in(write_position, nullptr, nbytes);
+    d_write_position.store(write_position + nbytes, std::memory_order_release);
+    return true;
+}
+
+
+size_t Spsc_Ring_Buffer::read(void* dest, size_t nbytes)
+{
+    const size_t n = std::min(nbytes, size());
+    const uint64_t read_position = d_read_position.load(std::memory_order_relaxed);
+    const size_t offset = static_cast<size_t>(read_position) & d_mask;
+    const size_t first = std::min(n, capacity() - offset);
+    std::memcpy(dest, &d_buffer[offset], first);
+    std::memcpy(static_cast<uint8_t*>(dest) + first, d_buffer.data(), n - first);
+    d_read_position.store(read_position + n, std::memory_order_release);
+    return n;
+}
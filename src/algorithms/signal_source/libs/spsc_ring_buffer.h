@@ -0,0 +1,90 @@
+/*!
+ * \file spsc_ring_buffer.h
+ * \brief Lock-free single-producer, single-consumer byte ring buffer, used to
+ * hand samples from a receiving thread over to a GNU Radio source block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#ifndef GNSS_SDR_SPSC_RING_BUFFER_H
+#define GNSS_SDR_SPSC_RING_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>  // for size_t
+#include <cstdint>
+#include <vector>
+
+/*!
+ * \brief Lock-free ring buffer of bytes for exactly one producer thread and
+ * one consumer thread.
+ *
+ * The capacity is rounded up to a power of two. The producer writes whole
+ * blocks (a packet payload is either stored entirely or rejected), and the
+ * consumer reads any number of bytes. Write and read positions are free
+ * running counters, each one written by a single thread, so no lock is needed.
+ */
+class Spsc_Ring_Buffer
+{
+public:
+    explicit Spsc_Ring_Buffer(size_t capacity_bytes);
+
+    inline size_t capacity() const
+    {
+        return d_mask + 1;
+    }
+
+    /*!
+     * \brief Bytes that can be read. Safe from the consumer thread.
+     */
+    size_t size() const;
+
+    /*!
+     * \brief Bytes that can be written. Safe from the producer thread.
+     */
+    size_t space() const;
+
+    /*!
+     * \brief Copies nbytes into the buffer. Producer thread only. Returns
+     * false, writing nothing, if there is not enough space.
+     */
+    bool write(const void* data, size_t nbytes);
+
+    /*!
+     * \brief Writes nbytes zeros. Producer thread only. Returns false, writing
+     * nothing, if there is not enough space.
+     */
+    bool write_zeros(size_t nbytes);
+
+    /*!
+     * \brief Copies up to nbytes into dest. Consumer thread only. Returns the
+     * number of bytes read.
+     */
+    size_t read(void* dest, size_t nbytes);
+
+private:
+    void copy_in(uint64_t position, const uint8_t* data, size_t nbytes);
+
+    std::vector<uint8_t> d_buffer;
+    size_t d_mask;
+    // written by the producer thread only
+    std::atomic<uint64_t> d_write_position;
+    // keeps the two positions in different cache lines
+    std::array<char, 64> d_padding{};
+    // written by the consumer thread only
+    std::atomic<uint64_t> d_read_position;
+};
+
+#endif  // GNSS_SDR_SPSC_RING_BUFFER_H
@@ -0,0 +1,95 @@
+/*!
+ * \file udp_payload_fifo.cc
+ * \brief FIFO of UDP payloads for the UDP sample source, which checks the
+ * optional packet counter at the start of each payload.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "udp_payload_fifo.h"
+#include <iostream>
+
+
+Udp_Payload_Fifo::Udp_Payload_Fifo(size_t capacity_bytes, int sequence_number_bytes) : d_ring(capacity_bytes),
+                                                                                       d_lost_packets(0),
+                                                                                       d_overflows(0),
+                                                                                       d_last_sequence_number(0),
+                                                                                       d_sequence_number_bytes(sequence_number_bytes),
+                                                                                       d_sequence_initialized(false)
+{
+    if (d_sequence_number_bytes <= 0)
+        {
+            d_sequence_number_bytes = 0;
+            d_sequence_mask = 0;
+        }
+    else if (d_sequence_number_bytes >= 8)
+        {
+            d_sequence_number_bytes = 8;
+            d_sequence_mask = UINT64_MAX;
+        }
+    else
+        {
+            d_sequence_mask = (uint64_t(1) << (8U * static_cast<uint32_t>(d_sequence_number_bytes))) - 1;
+        }
+}
+
+
+void Udp_Payload_Fifo::push_payload(const uint8_t* payload, int payload_length_bytes)
+{
+    if (d_sequence_number_bytes > 0)
+        {
+            if (payload_length_bytes < d_sequence_number_bytes)
+                {
+                    return;
+                }
+            uint64_t sequence_number = 0;
+            for (int i = 0; i < d_sequence_number_bytes; i++)
+                {
+                    sequence_number = (sequence_number << 8U) | payload[i];
+                }
+            payload += d_sequence_number_bytes;
+            payload_length_bytes -= d_sequence_number_bytes;
+
+            if (d_sequence_initialized)
+                {
+                    const uint64_t missing = (sequence_number - d_last_sequence_number - 1) & d_sequence_mask;
+                    if (missing > d_sequence_mask / 2)
+                        {
+                            // late or duplicated packet: its place has already been filled
+                            return;
+                        }
+                    if (missing > 0)
+                        {
+                            // keep the sample count (and thus the receiver time) right by
+                            // replacing the lost payloads by zeros, if they fit in the FIFO
+                            d_lost_packets += missing;
+                            const uint64_t gap_bytes = missing * static_cast<uint64_t>(payload_length_bytes);
+                            if (not d_ring.write_zeros(gap_bytes))
+                                {
+                                    d_overflows++;
+                                    std::cout << "O" << std::flush;
+                                }
+                        }
+                }
+            d_last_sequence_number = sequence_number;
+            d_sequence_initialized = true;
+        }
+
+    if (payload_length_bytes > 0 and not d_ring.write(payload, payload_length_bytes))
+        {
+            // notify overflow
+            d_overflows++;
+            std::cout << "O" << std::flush;
+        }
+}
@@ -0,0 +1,100 @@
+/*!
+ * \file udp_payload_fifo.h
+ * \brief FIFO of UDP payloads for the UDP sample source, which checks the
+ * optional packet counter at the start of each payload.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#ifndef GNSS_SDR_UDP_PAYLOAD_FIFO_H
+#define GNSS_SDR_UDP_PAYLOAD_FIFO_H
+
+#include "spsc_ring_buffer.h"
+#include <atomic>
+#include <cstddef>  // for size_t
+#include <cstdint>
+
+/*!
+ * \brief Hands the sample bytes of UDP payloads from a receiving thread over
+ * to a GNU Radio source block, through a Spsc_Ring_Buffer.
+ *
+ * If sequence_number_bytes is not zero, each payload starts with a big-endian
+ * packet counter of that many bytes (1 to 8), wrapping around at its maximum
+ * value. The counter is stripped; the payloads of lost packets are replaced
+ * by zeros, so that the sample count (and thus the receiver time) stays
+ * right, and late or duplicated packets are dropped.
+ */
+class Udp_Payload_Fifo
+{
+public:
+    Udp_Payload_Fifo(size_t capacity_bytes, int sequence_number_bytes);
+
+    inline size_t capacity() const
+    {
+        return d_ring.capacity();
+    }
+
+    /*!
+     * \brief Bytes that can be read. Safe from the consumer thread.
+     */
+    inline size_t size() const
+    {
+        return d_ring.size();
+    }
+
+    /*!
+     * \brief Stores the samples of a payload. Producer thread only. The
+     * payload is dropped, and an overflow counted, if it does not fit.
+     */
+    void push_payload(const uint8_t* payload, int payload_length_bytes);
+
+    /*!
+     * \brief Copies up to nbytes of samples into dest. Consumer thread only.
+     * Returns the number of bytes read.
+     */
+    inline size_t read(void* dest, size_t nbytes)
+    {
+        return d_ring.read(dest, nbytes);
+    }
+
+    /*!
+     * \brief Packets lost, as given by the sequence numbers
+     */
+    inline uint64_t lost_packets() const
+    {
+        return d_lost_packets.load();
+    }
+
+    /*!
+     * \brief Payloads (or runs of zeros for lost packets) dropped because
+     * the FIFO was full
+     */
+    inline uint64_t overflows() const
+    {
+        return d_overflows.load();
+    }
+
+private:
+    Spsc_Ring_Buffer d_ring;
+    std::atomic<uint64_t> d_lost_packets;
+    std::atomic<uint64_t> d_overflows;
+    // used by the producer thread only
+    uint64_t d_last_sequence_number;
+    uint64_t d_sequence_mask;
+    int d_sequence_number_bytes;
+    bool d_sequence_initialized;
+};
+
+#endif  // GNSS_SDR_UDP_PAYLOAD_FIFO_H
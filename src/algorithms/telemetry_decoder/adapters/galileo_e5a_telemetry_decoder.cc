@@ -40,8 +40,9 @@ GalileoE5aTelemetryDecoder::GalileoE5aTelemetryDecoder(
     DLOG(INFO) << "role " << role;
     dump_ = configuration->property(role + ".dump", false);
     dump_filename_ = configuration->property(role + ".dump_filename", default_dump_filename);
+    const bool offload_decoding = configuration->property(role + ".offload_decoding", false);
     // make telemetry decoder object
-    telemetry_decoder_ = galileo_make_telemetry_decoder_gs(satellite_, 2, dump_);  // unified galileo decoder set to FNAV (frame_type=2)
+    telemetry_decoder_ = galileo_make_telemetry_decoder_gs(satellite_, 2, dump_, offload_decoding);  // unified galileo decoder set to FNAV (frame_type=2)
     DLOG(INFO) << "telemetry_decoder(" << telemetry_decoder_->unique_id() << ")";
     channel_ = 0;
     if (in_streams_ > 1)
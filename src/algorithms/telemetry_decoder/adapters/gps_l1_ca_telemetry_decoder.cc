@@ -22,6 +22,46 @@
 #include "gps_l1_ca_telemetry_decoder.h"
 #include "configuration_interface.h"
 #include <glog/logging.h>
+#include <cmath>  // for fmod
+#include <ctime>  // for time_t, tm, timegm
+
+
+namespace
+{
+// Seconds between the Unix epoch and the GPS epoch (6 January 1980)
+constexpr double GPS_EPOCH_UNIX_S = 315964800.0;
+// GPS - UTC offset since 1 January 2017. It only needs to be roughly right.
+constexpr double GPS_UTC_LEAP_SECONDS = 18.0;
+
+/*
+ * Coarse GPS time of week at the first sample, from the same
+ * GNSS-SDR.AGNSS_ref_utc_time used for assisted acquisition,
+ * or from the system clock if it is not set.
+ */
+bool coarse_tow_at_start(const ConfigurationInterface* configuration, double& tow_s)
+{
+    const std::string empty_string;
+    const std::string ref_time_str = configuration->property("GNSS-SDR.AGNSS_ref_utc_time", empty_string);
+    time_t utc_s = time(nullptr);
+    if (ref_time_str != empty_string)
+        {
+            struct tm tm
+            {
+            };
+            if (strptime(ref_time_str.c_str(), "%d/%m/%Y %H:%M:%S", &tm) == nullptr)
+                {
+                    return false;
+                }
+            utc_s = timegm(&tm);
+        }
+    if (utc_s <= 0)
+        {
+            return false;
+        }
+    tow_s = std::fmod(static_cast<double>(utc_s) - GPS_EPOCH_UNIX_S + GPS_UTC_LEAP_SECONDS, 604800.0);
+    return true;
+}
+}  // namespace
 
 
 GpsL1CaTelemetryDecoder::GpsL1CaTelemetryDecoder(
@@ -39,6 +79,19 @@ GpsL1CaTelemetryDecoder::GpsL1CaTelemetryDecoder(
     // make telemetry decoder object
     telemetry_decoder_ = gps_l1_ca_make_telemetry_decoder_gs(satellite_, dump_);  // TODO fix me
     DLOG(INFO) << "telemetry_decoder(" << telemetry_decoder_->unique_id() << ")";
+    if (configuration->property(role + ".assisted_tow", false))
+        {
+            double ref_tow_s = 0.0;
+            if (coarse_tow_at_start(configuration, ref_tow_s))
+                {
+                    const double tolerance_s = configuration->property(role + ".assisted_tow_tolerance_s", 10.0);
+                    telemetry_decoder_->set_assisted_tow(ref_tow_s, tolerance_s);
+                }
+            else
+                {
+                    LOG(WARNING) << "GNSS-SDR.AGNSS_ref_utc_time is not well-formed, assisted TOW synchronization disabled";
+                }
+        }
     channel_ = 0;
     if (in_streams_ > 1)
         {
@@ -27,6 +27,7 @@
 #include "beidou_dnav_utc_model.h"
 #include "display.h"
 #include "gnss_synchro.h"
+#include "nav_bit_decoding.h"
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt.h>        // for make_any
@@ -118,103 +119,22 @@ beidou_b1i_telemetry_decoder_gs::~beidou_b1i_telemetry_decoder_gs()
 }
 
 
-void beidou_b1i_telemetry_decoder_gs::decode_bch15_11_01(const int32_t *bits, std::array<int32_t, 15> &decbits)
-{
-    int32_t bit;
-    int32_t err;
-    std::array<int32_t, 4> reg{-1, -1, -1, -1};
-    const std::array<int32_t, 15> errind{14, 13, 10, 12, 6, 9, 4, 11, 0, 5, 7, 8, 1, 3, 2};
-
-    for (uint32_t i = 0; i < 15; i++)
-        {
-            decbits[i] = bits[i];
-        }
-
-    for (uint32_t i = 0; i < 15; i++)
-        {
-            bit = reg[3];
-            reg[3] = reg[2];
-            reg[2] = reg[1];
-            reg[1] = reg[0];
-            reg[0] = bits[i] * bit;
-            reg[1] *= bit;
-        }
-
-    for (uint32_t i = 0; i < 4; ++i)
-        {
-            reg[i] = (reg[i] + 1) / 2;
-        }
-
-    err = reg[0] + reg[1] * 2 + reg[2] * 4 + reg[3] * 8;
-
-    if (err > 0 and err < 16)
-        {
-            decbits[errind[err - 1]] *= -1;
-        }
-}
-
-
-void beidou_b1i_telemetry_decoder_gs::decode_word(
-    int32_t word_counter,
-    const float *enc_word_symbols,
-    int32_t *dec_word_symbols)
-{
-    std::array<int32_t, 30> bitsbch{};
-    std::array<int32_t, 15> first_branch{};
-    std::array<int32_t, 15> second_branch{};
-
-    if (word_counter == 1)
-        {
-            for (uint32_t j = 0; j < 30; j++)
-                {
-                    dec_word_symbols[j] = static_cast<int32_t>(enc_word_symbols[j] > 0) ? (1) : (-1);
-                }
-        }
-    else
-        {
-            for (uint32_t r = 0; r < 2; r++)
-                {
-                    for (uint32_t c = 0; c < 15; c++)
-                        {
-                            bitsbch[r * 15 + c] = static_cast<int32_t>(enc_word_symbols[c * 2 + r] > 0) ? (1) : (-1);
-                        }
-                }
-
-            decode_bch15_11_01(&bitsbch[0], first_branch);
-            decode_bch15_11_01(&bitsbch[15], second_branch);
-
-            for (uint32_t j = 0; j < 11; j++)
-                {
-                    dec_word_symbols[j] = first_branch[j];
-                    dec_word_symbols[j + 11] = second_branch[j];
-                }
-
-            for (uint32_t j = 0; j < 4; j++)
-                {
-                    dec_word_symbols[j + 22] = first_branch[11 + j];
-                    dec_word_symbols[j + 26] = second_branch[11 + j];
-                }
-        }
-}
-
-
 void beidou_b1i_telemetry_decoder_gs::decode_subframe(float *frame_symbols)
 {
     // 1. Transform from symbols to bits
     std::string data_bits;
     data_bits.reserve(BEIDOU_DNAV_WORDS_SUBFRAME * BEIDOU_DNAV_WORD_LENGTH_BITS);
-    std::array<int32_t, 30> dec_word_bits{};
 
     // Decode each word in subframe
     for (uint32_t ii = 0; ii < BEIDOU_DNAV_WORDS_SUBFRAME; ii++)
         {
             // decode the word
-            decode_word((ii + 1), &frame_symbols[ii * 30], dec_word_bits.data());
+            const uint32_t dec_word_bits = beidou_dnav_decode_word(&frame_symbols[ii * BEIDOU_DNAV_WORD_LENGTH_BITS], ii == 0);
 
             // Save word to string format
-            for (uint32_t jj = 0; jj < (BEIDOU_DNAV_WORD_LENGTH_BITS); jj++)
+            for (int32_t jj = static_cast<int32_t>(BEIDOU_DNAV_WORD_LENGTH_BITS) - 1; jj >= 0; jj--)
                 {
-                    data_bits.push_back((dec_word_bits[jj] > 0) ? ('1') : ('0'));
+                    data_bits.push_back(((dec_word_bits >> static_cast<uint32_t>(jj)) & 1U) ? ('1') : ('0'));
                 }
         }
 
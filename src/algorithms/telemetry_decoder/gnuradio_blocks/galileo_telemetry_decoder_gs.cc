@@ -25,16 +25,19 @@
 #include "Galileo_E5a.h"  // for GALILEO_E5A_CODE_PERIO...
 #include "Galileo_E5b.h"  // for GALILEO_E5B_CODE_PERIOD_MS
 #include "convolutional.h"
+#include "deinterleaver.h"
 #include "display.h"
 #include "galileo_almanac_helper.h"  // for Galileo_Almanac_Helper
 #include "galileo_ephemeris.h"       // for Galileo_Ephemeris
 #include "galileo_iono.h"            // for Galileo_Iono
 #include "galileo_utc_model.h"       // for Galileo_Utc_Model
 #include "gnss_synchro.h"
+#include "tlm_decoding_pool.h"
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt.h>        // for make_any
 #include <pmt/pmt_sugar.h>  // for mp
+#include <chrono>           // for std::chrono::seconds
 #include <cmath>            // for fmod
 #include <cstdlib>          // for abs
 #include <exception>        // for exception
@@ -46,15 +49,15 @@
 
 
 galileo_telemetry_decoder_gs_sptr
-galileo_make_telemetry_decoder_gs(const Gnss_Satellite &satellite, int frame_type, bool dump)
+galileo_make_telemetry_decoder_gs(const Gnss_Satellite &satellite, int frame_type, bool dump, bool offload_decoding)
 {
-    return galileo_telemetry_decoder_gs_sptr(new galileo_telemetry_decoder_gs(satellite, frame_type, dump));
+    return galileo_telemetry_decoder_gs_sptr(new galileo_telemetry_decoder_gs(satellite, frame_type, dump, offload_decoding));
 }
 
 
 galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
     const Gnss_Satellite &satellite, int frame_type,
-    bool dump) : gr::block("galileo_telemetry_decoder_gs", gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)),
+    bool dump, bool offload_decoding) : gr::block("galileo_telemetry_decoder_gs", gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)),
                      gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)))
 {
     // prevent telemetry symbols accumulation in output buffers
@@ -69,6 +72,7 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
 
     // initialize internal vars
     d_dump = dump;
+    d_offload_decoding = offload_decoding;
     d_satellite = Gnss_Satellite(satellite.get_system(), satellite.get_PRN());
     d_frame_type = frame_type;
     DLOG(INFO) << "Initializing GALILEO UNIFIED TELEMETRY DECODER";
@@ -121,7 +125,10 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
             std::cout << "Galileo unified telemetry decoder error: Unknown frame type\n";
         }
 
-    d_page_part_symbols.reserve(d_frame_length_symbols);
+    // page buffers are allocated once, they are reused by every page
+    d_page_part_symbols_deint = std::vector<float>(d_frame_length_symbols);
+    d_page_part_bits = std::vector<int32_t>(d_frame_length_symbols / 2);
+    d_page_String.reserve(d_frame_length_symbols / 2);
     for (int32_t i = 0; i < d_bits_per_preamble; i++)
         {
             switch (d_frame_type)
@@ -155,6 +162,8 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
     d_sample_counter = 0ULL;
     d_stat = 0;
     d_preamble_index = 0ULL;
+    d_page_sample_counter = 0ULL;
+    d_decoding_delay_ms = 0U;
 
     d_flag_frame_sync = false;
 
@@ -186,6 +195,11 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
 galileo_telemetry_decoder_gs::~galileo_telemetry_decoder_gs()
 {
     DLOG(INFO) << "Galileo Telemetry decoder block (channel " << d_channel << ") destructor called.";
+    if (d_page_decoding.valid())
+        {
+            // the pending job refers to this object
+            d_page_decoding.wait();
+        }
     if (d_dump_file.is_open() == true)
         {
             try
@@ -207,54 +221,99 @@ void galileo_telemetry_decoder_gs::viterbi_decoder(float *page_part_symbols, int
 }
 
 
-void galileo_telemetry_decoder_gs::deinterleaver(int32_t rows, int32_t cols, const float *in, float *out)
+void galileo_telemetry_decoder_gs::fetch_page_symbols()
 {
-    for (int32_t r = 0; r < rows; r++)
+    // 0. Take the page symbols from the symbol history (the last symbol of the preamble is just received now!)
+    // 1. De-interleave
+    // 2.1 Take into account the NOT gate in G2 polynomial (Galileo ICD Figure 13, FEC encoder)
+    // 2.2 Take into account the possible inversion of the polarity due to PLL lock at 180º
+    const float polarity = d_flag_PLL_180_deg_phase_locked ? -1.0F : 1.0F;
+    const auto page_start = d_symbol_history.begin() + d_samples_per_preamble;
+    switch (d_frame_type)
         {
-            for (int32_t c = 0; c < cols; c++)
-                {
-                    out[c * rows + r] = in[r * cols + c];
-                }
+        case 1:  // INAV
+            Deinterleaver<GALILEO_INAV_INTERLEAVER_ROWS, GALILEO_INAV_INTERLEAVER_COLS>::run(page_start, d_page_part_symbols_deint.data(), polarity, -polarity);
+            break;
+        case 2:  // FNAV
+            Deinterleaver<GALILEO_FNAV_INTERLEAVER_ROWS, GALILEO_FNAV_INTERLEAVER_COLS>::run(page_start, d_page_part_symbols_deint.data(), polarity, -polarity);
+            break;
+        default:
+            break;
         }
 }
 
 
-void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, int32_t frame_length)
+void galileo_telemetry_decoder_gs::fec_decode_page()
 {
-    // 1. De-interleave
-    std::vector<float> page_part_symbols_deint(frame_length);
-    deinterleaver(GALILEO_INAV_INTERLEAVER_ROWS, GALILEO_INAV_INTERLEAVER_COLS, page_part_symbols, page_part_symbols_deint.data());
+    const auto frame_length = static_cast<int32_t>(d_frame_length_symbols);
 
-    // 2. Viterbi decoder
-    // 2.1 Take into account the NOT gate in G2 polynomial (Galileo ICD Figure 13, FEC encoder)
-    // 2.2 Take into account the possible inversion of the polarity due to PLL lock at 180º
-    for (int32_t i = 0; i < frame_length; i++)
+    // 2. Viterbi decoder, straight on the deinterleaved symbols
+    viterbi_decoder(d_page_part_symbols_deint.data(), d_page_part_bits.data());
+
+    // 3. Bits to the string expected by the Galileo page decoders
+    d_page_String.clear();
+    for (int32_t i = 0; i < (frame_length / 2); i++)
         {
-            if ((i + 1) % 2 == 0)
+            if (d_page_part_bits[i] > 0)
                 {
-                    page_part_symbols_deint[i] = -page_part_symbols_deint[i];
+                    d_page_String.push_back('1');
+                }
+            else
+                {
+                    d_page_String.push_back('0');
                 }
         }
+}
 
-    std::vector<int32_t> page_part_bits(frame_length / 2);
-    viterbi_decoder(page_part_symbols_deint.data(), page_part_bits.data());
 
-    // 3. Call the Galileo page decoder
-    std::string page_String;
-    page_String.reserve(frame_length / 2);
-    for (int32_t i = 0; i < (frame_length / 2); i++)
+void galileo_telemetry_decoder_gs::page_decoded()
+{
+    switch (d_frame_type)
+        {
+        case 1:  // INAV
+            decode_INAV_word(d_page_String);
+            break;
+        case 2:  // FNAV
+            decode_FNAV_word(d_page_String);
+            break;
+        default:
+            return;
+        }
+
+    if (d_inav_nav.get_flag_CRC_test() == true or d_fnav_nav.get_flag_CRC_test() == true)
         {
-            if (page_part_bits[i] > 0)
+            d_CRC_error_counter = 0;
+            d_flag_preamble = true;  // valid preamble indicator (initialized to false every work())
+            // symbols elapsed since the end of the page (non-zero only if the page was decoded in the pool)
+            d_decoding_delay_ms = static_cast<uint32_t>(d_sample_counter - d_page_sample_counter) * d_PRN_code_period_ms;
+            gr::thread::scoped_lock lock(d_setlock);
+            d_last_valid_preamble = d_page_sample_counter;
+            if (!d_flag_frame_sync)
                 {
-                    page_String.push_back('1');
+                    d_flag_frame_sync = true;
+                    DLOG(INFO) << " Frame sync SAT " << this->d_satellite;
                 }
-            else
+        }
+    else
+        {
+            d_CRC_error_counter++;
+            if (d_CRC_error_counter > CRC_ERROR_LIMIT)
                 {
-                    page_String.push_back('0');
+                    DLOG(INFO) << "Lost of frame sync SAT " << this->d_satellite;
+                    d_flag_frame_sync = false;
+                    d_stat = 0;
+                    d_TOW_at_current_symbol_ms = 0;
+                    d_TOW_at_Preamble_ms = 0;
+                    d_fnav_nav.set_flag_TOW_set(false);
+                    d_inav_nav.set_flag_TOW_set(false);
                 }
         }
+}
 
-    if (page_part_bits[0] == 1)
+
+void galileo_telemetry_decoder_gs::decode_INAV_word(const std::string &page_String)
+{
+    if (page_String[0] == '1')
         {
             // DECODE COMPLETE WORD (even + odd) and TEST CRC
             d_inav_nav.split_page(page_String, flag_even_word_arrived);
@@ -354,40 +413,8 @@ void galileo_telemetry_decoder_gs::decode_INAV_word(float *page_part_symbols, in
 }
 
 
-void galileo_telemetry_decoder_gs::decode_FNAV_word(float *page_symbols, int32_t frame_length)
+void galileo_telemetry_decoder_gs::decode_FNAV_word(const std::string &page_String)
 {
-    // 1. De-interleave
-    std::vector<float> page_symbols_deint(frame_length);
-    deinterleaver(GALILEO_FNAV_INTERLEAVER_ROWS, GALILEO_FNAV_INTERLEAVER_COLS, page_symbols, page_symbols_deint.data());
-
-    // 2. Viterbi decoder
-    // 2.1 Take into account the NOT gate in G2 polynomial (Galileo ICD Figure 13, FEC encoder)
-    // 2.2 Take into account the possible inversion of the polarity due to PLL lock at 180 degrees
-    for (int32_t i = 0; i < frame_length; i++)
-        {
-            if ((i + 1) % 2 == 0)
-                {
-                    page_symbols_deint[i] = -page_symbols_deint[i];
-                }
-        }
-    std::vector<int32_t> page_bits(frame_length / 2);
-    viterbi_decoder(page_symbols_deint.data(), page_bits.data());
-
-    // 3. Call the Galileo page decoder
-    std::string page_String;
-    page_String.reserve(frame_length);
-    for (int32_t i = 0; i < frame_length; i++)
-        {
-            if (page_bits[i] > 0)
-                {
-                    page_String.push_back('1');
-                }
-            else
-                {
-                    page_String.push_back('0');
-                }
-        }
-
     // DECODE COMPLETE WORD (even + odd) and TEST CRC
     d_fnav_nav.split_page(page_String);
     if (d_fnav_nav.get_flag_CRC_test() == true)
@@ -437,7 +464,7 @@ void galileo_telemetry_decoder_gs::reset()
     gr::thread::scoped_lock lock(d_setlock);
     d_last_valid_preamble = d_sample_counter;
     d_sent_tlm_failed_msg = false;
-    d_stat = 0;
+    d_stat = 0;  // a page still in the decoding pool will be discarded
     DLOG(INFO) << "Telemetry decoder reset for satellite " << d_satellite;
 }
 
@@ -503,6 +530,16 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
     consume_each(1);
     d_flag_preamble = false;
 
+    // collect the page handed to the decoding pool, if it is ready
+    if (d_page_decoding.valid() and d_page_decoding.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            d_page_decoding.get();
+            if (d_stat == 2)
+                {
+                    page_decoded();
+                }
+        }
+
     // check if there is a problem with the telemetry of the current satellite
     if (d_sent_tlm_failed_msg == false)
         {
@@ -599,77 +636,29 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
             {
                 if (d_sample_counter == d_preamble_index + static_cast<uint64_t>(d_preamble_period_symbols))
                     {
-                        // call the decoder
-                        switch (d_frame_type)
+                        if (d_page_decoding.valid())
                             {
-                            case 1:  // INAV
-                                     // NEW Galileo page part is received
-                                // 0. fetch the symbols into an array
-                                if (d_flag_PLL_180_deg_phase_locked == false)  // normal PLL lock
-                                    {
-                                        for (uint32_t i = 0; i < d_frame_length_symbols; i++)
-                                            {
-                                                d_page_part_symbols[i] = d_symbol_history[i + d_samples_per_preamble];  // because last symbol of the preamble is just received now!
-                                            }
-                                    }
-                                else  // 180 deg. inverted carrier phase PLL lock
-                                    {
-                                        for (uint32_t i = 0; i < d_frame_length_symbols; i++)
-                                            {
-                                                d_page_part_symbols[i] = -d_symbol_history[i + d_samples_per_preamble];  // because last symbol of the preamble is just received now!
-                                            }
-                                    }
-                                decode_INAV_word(d_page_part_symbols.data(), d_frame_length_symbols);
-                                break;
-                            case 2:  // FNAV
-                                     // NEW Galileo page part is received
-                                // 0. fetch the symbols into an array
-                                if (d_flag_PLL_180_deg_phase_locked == false)  // normal PLL lock
-                                    {
-                                        for (uint32_t i = 0; i < d_frame_length_symbols; i++)
-                                            {
-                                                d_page_part_symbols[i] = d_symbol_history[i + d_samples_per_preamble];  // because last symbol of the preamble is just received now!
-                                            }
-                                    }
-                                else  // 180 deg. inverted carrier phase PLL lock
+                                // the previous page is still in the decoding pool, it must be parsed first
+                                d_page_decoding.get();
+                                page_decoded();
+                                if (d_stat != 2)
                                     {
-                                        for (uint32_t i = 0; i < d_frame_length_symbols; i++)
-                                            {
-                                                d_page_part_symbols[i] = -d_symbol_history[i + d_samples_per_preamble];  // because last symbol of the preamble is just received now!
-                                            }
+                                        break;
                                     }
-                                decode_FNAV_word(d_page_part_symbols.data(), d_frame_length_symbols);
-                                break;
-                            default:
-                                return -1;
-                                break;
                             }
+                        // NEW Galileo page part is received
+                        fetch_page_symbols();
                         d_preamble_index = d_sample_counter;  // record the preamble sample stamp (t_P)
-                        if (d_inav_nav.get_flag_CRC_test() == true or d_fnav_nav.get_flag_CRC_test() == true)
+                        d_page_sample_counter = d_sample_counter;
+                        // call the decoder
+                        if (d_offload_decoding)
                             {
-                                d_CRC_error_counter = 0;
-                                d_flag_preamble = true;  // valid preamble indicator (initialized to false every work())
-                                gr::thread::scoped_lock lock(d_setlock);
-                                d_last_valid_preamble = d_sample_counter;
-                                if (!d_flag_frame_sync)
-                                    {
-                                        d_flag_frame_sync = true;
-                                        DLOG(INFO) << " Frame sync SAT " << this->d_satellite;
-                                    }
+                                d_page_decoding = Tlm_Decoding_Pool::instance().submit([this] { fec_decode_page(); });
                             }
                         else
                             {
-                                d_CRC_error_counter++;
-                                if (d_CRC_error_counter > CRC_ERROR_LIMIT)
-                                    {
-                                        DLOG(INFO) << "Lost of frame sync SAT " << this->d_satellite;
-                                        d_flag_frame_sync = false;
-                                        d_stat = 0;
-                                        d_TOW_at_current_symbol_ms = 0;
-                                        d_TOW_at_Preamble_ms = 0;
-                                        d_fnav_nav.set_flag_TOW_set(false);
-                                        d_inav_nav.set_flag_TOW_set(false);
-                                    }
+                                fec_decode_page();
+                                page_decoded();
                             }
                     }
                 break;
@@ -691,7 +680,7 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                                     {
                                         // TOW_5 refers to the even preamble, but when we decode it we are in the odd part, so 1 second later plus the decoding delay
                                         d_TOW_at_Preamble_ms = static_cast<uint32_t>(d_inav_nav.get_TOW5() * 1000.0);
-                                        d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>(GALILEO_INAV_PAGE_PART_MS + (d_required_symbols + 1) * d_PRN_code_period_ms);
+                                        d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>(GALILEO_INAV_PAGE_PART_MS + (d_required_symbols + 1) * d_PRN_code_period_ms) + d_decoding_delay_ms;
                                         d_inav_nav.set_TOW5_flag(false);
                                     }
 
@@ -699,7 +688,7 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                                     {
                                         // TOW_6 refers to the even preamble, but when we decode it we are in the odd part, so 1 second later plus the decoding delay
                                         d_TOW_at_Preamble_ms = static_cast<uint32_t>(d_inav_nav.get_TOW6() * 1000.0);
-                                        d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>(GALILEO_INAV_PAGE_PART_MS + (d_required_symbols + 1) * d_PRN_code_period_ms);
+                                        d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>(GALILEO_INAV_PAGE_PART_MS + (d_required_symbols + 1) * d_PRN_code_period_ms) + d_decoding_delay_ms;
                                         d_inav_nav.set_TOW6_flag(false);
                                     }
                                 else
@@ -717,7 +706,7 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                                 if (d_fnav_nav.is_TOW1_set() == true)
                                     {
                                         d_TOW_at_Preamble_ms = static_cast<uint32_t>(d_fnav_nav.get_TOW1() * 1000.0);
-                                        d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>((d_required_symbols + 1) * GALILEO_FNAV_CODES_PER_SYMBOL * GALILEO_E5A_CODE_PERIOD_MS);
+                                        d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>((d_required_symbols + 1) * GALILEO_FNAV_CODES_PER_SYMBOL * GALILEO_E5A_CODE_PERIOD_MS) + d_decoding_delay_ms;
                                         // d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>((GALILEO_FNAV_CODES_PER_PAGE + GALILEO_FNAV_CODES_PER_PREAMBLE) * GALILEO_E5a_CODE_PERIOD_MS);
                                         d_fnav_nav.set_TOW1_flag(false);
                                     }
@@ -725,21 +714,21 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
                                     {
                                         d_TOW_at_Preamble_ms = static_cast<uint32_t>(d_fnav_nav.get_TOW2() * 1000.0);
                                         // d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>((GALILEO_FNAV_CODES_PER_PAGE + GALILEO_FNAV_CODES_PER_PREAMBLE) * GALILEO_E5a_CODE_PERIOD_MS);
-                                        d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>((d_required_symbols + 1) * GALILEO_FNAV_CODES_PER_SYMBOL * GALILEO_E5A_CODE_PERIOD_MS);
+                                        d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>((d_required_symbols + 1) * GALILEO_FNAV_CODES_PER_SYMBOL * GALILEO_E5A_CODE_PERIOD_MS) + d_decoding_delay_ms;
                                         d_fnav_nav.set_TOW2_flag(false);
                                     }
                                 else if (d_fnav_nav.is_TOW3_set() == true)
                                     {
                                         d_TOW_at_Preamble_ms = static_cast<uint32_t>(d_fnav_nav.get_TOW3() * 1000.0);
                                         // d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>((GALILEO_FNAV_CODES_PER_PAGE + GALILEO_FNAV_CODES_PER_PREAMBLE) * GALILEO_E5a_CODE_PERIOD_MS);
-                                        d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>((d_required_symbols + 1) * GALILEO_FNAV_CODES_PER_SYMBOL * GALILEO_E5A_CODE_PERIOD_MS);
+                                        d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>((d_required_symbols + 1) * GALILEO_FNAV_CODES_PER_SYMBOL * GALILEO_E5A_CODE_PERIOD_MS) + d_decoding_delay_ms;
                                         d_fnav_nav.set_TOW3_flag(false);
                                     }
                                 else if (d_fnav_nav.is_TOW4_set() == true)
                                     {
                                         d_TOW_at_Preamble_ms = static_cast<uint32_t>(d_fnav_nav.get_TOW4() * 1000.0);
                                         // d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>((GALILEO_FNAV_CODES_PER_PAGE + GALILEO_FNAV_CODES_PER_PREAMBLE) * GALILEO_E5a_CODE_PERIOD_MS);
-                                        d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>((d_required_symbols + 1) * GALILEO_FNAV_CODES_PER_SYMBOL * GALILEO_E5A_CODE_PERIOD_MS);
+                                        d_TOW_at_current_symbol_ms = d_TOW_at_Preamble_ms + static_cast<uint32_t>((d_required_symbols + 1) * GALILEO_FNAV_CODES_PER_SYMBOL * GALILEO_E5A_CODE_PERIOD_MS) + d_decoding_delay_ms;
                                         d_fnav_nav.set_TOW4_flag(false);
                                     }
                                 else
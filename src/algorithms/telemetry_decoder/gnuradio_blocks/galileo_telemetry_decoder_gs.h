@@ -33,6 +33,7 @@
 #include <array>
 #include <cstdint>
 #include <fstream>
+#include <future>
 #include <string>
 #include <vector>
 #if GNURADIO_USES_STD_POINTERS
@@ -52,10 +53,16 @@ using galileo_telemetry_decoder_gs_sptr = boost::shared_ptr<galileo_telemetry_de
 galileo_telemetry_decoder_gs_sptr galileo_make_telemetry_decoder_gs(
     const Gnss_Satellite &satellite,
     int frame_type,
-    bool dump);
+    bool dump,
+    bool offload_decoding);
 
 /*!
  * \brief This class implements a block that decodes the INAV and FNAV data defined in Galileo ICD
+ *
+ * If offload_decoding is set, the Viterbi decoding of each page is handed to
+ * the shared Tlm_Decoding_Pool, and the decoded page is parsed when the result
+ * is collected in a later call to general_work(). The TOW is then propagated
+ * by the number of symbols elapsed since the end of the page.
  */
 class galileo_telemetry_decoder_gs : public gr::block
 {
@@ -77,21 +84,26 @@ private:
     friend galileo_telemetry_decoder_gs_sptr galileo_make_telemetry_decoder_gs(
         const Gnss_Satellite &satellite,
         int frame_type,
-        bool dump);
+        bool dump,
+        bool offload_decoding);
 
-    galileo_telemetry_decoder_gs(const Gnss_Satellite &satellite, int frame_type, bool dump);
+    galileo_telemetry_decoder_gs(const Gnss_Satellite &satellite, int frame_type, bool dump, bool offload_decoding);
 
     const int32_t d_nn = 2;  // Coding rate 1/n
     const int32_t d_KK = 7;  // Constraint Length
 
     void viterbi_decoder(float *page_part_symbols, int32_t *page_part_bits);
-    void deinterleaver(int32_t rows, int32_t cols, const float *in, float *out);
-    void decode_INAV_word(float *page_part_symbols, int32_t frame_length);
-    void decode_FNAV_word(float *page_symbols, int32_t frame_length);
+    void fetch_page_symbols();
+    void fec_decode_page();  // only touches the page buffers below, safe to run in the decoding pool
+    void page_decoded();
+    void decode_INAV_word(const std::string &page_String);
+    void decode_FNAV_word(const std::string &page_String);
 
     // vars for Viterbi decoder
     std::vector<int32_t> d_preamble_samples;
-    std::vector<float> d_page_part_symbols;
+    std::vector<float> d_page_part_symbols_deint;
+    std::vector<int32_t> d_page_part_bits;
+    std::string d_page_String;
     std::vector<int32_t> d_out0;
     std::vector<int32_t> d_out1;
     std::vector<int32_t> d_state0;
@@ -102,6 +114,8 @@ private:
 
     boost::circular_buffer<float> d_symbol_history;
 
+    std::future<void> d_page_decoding;  // pending page in the decoding pool, if any
+
     Gnss_Satellite d_satellite;
 
     // navigation message vars
@@ -113,6 +127,7 @@ private:
     uint64_t d_sample_counter;
     uint64_t d_preamble_index;
     uint64_t d_last_valid_preamble;
+    uint64_t d_page_sample_counter;  // symbol counter at the end of the last page sent to decoding
 
     int32_t d_mm = d_KK - 1;
     int32_t d_codelength;
@@ -130,6 +145,7 @@ private:
     uint32_t d_stat;
     uint32_t d_TOW_at_Preamble_ms;
     uint32_t d_TOW_at_current_symbol_ms;
+    uint32_t d_decoding_delay_ms;
     uint32_t d_max_symbols_without_valid_frame;
 
     char d_band;  // This variable will store which band we are dealing with (Galileo E1 or E5b)
@@ -140,6 +156,7 @@ private:
     bool d_flag_parity;
     bool d_flag_preamble;
     bool d_dump;
+    bool d_offload_decoding;
 };
 
 #endif  // GNSS_SDR_GALILEO_TELEMETRY_DECODER_GS_H
@@ -22,30 +22,21 @@
 #include "gps_ephemeris.h"  // for Gps_Ephemeris
 #include "gps_iono.h"       // for Gps_Iono
 #include "gps_utc_model.h"  // for Gps_Utc_Model
+#include "nav_bit_decoding.h"
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt.h>        // for make_any
 #include <pmt/pmt_sugar.h>  // for mp
-#include <cmath>            // for round
+#include <algorithm>        // for min
+#include <cmath>            // for round, fmod
 #include <cstring>          // for memcpy
 #include <exception>        // for exception
 #include <iostream>         // for cout
 #include <memory>           // for shared_ptr
 
-
-#ifdef COMPILER_HAS_ROTL
-#include <bit>
-namespace my_rotl = std;
-#else
-namespace my_rotl
-{
-#if HAS_GENERIC_LAMBDA
-auto rotl = [](auto x, auto n) { return (((x) << (n)) ^ ((x) >> (32 - (n)))); };
-#else
-auto rotl = [](uint32_t x, uint32_t n) { return (((x) << (n)) ^ ((x) >> (32 - (n)))); };
-#endif
-}  // namespace my_rotl
-#endif
+// Nominal signal travel time for a receiver on the Earth surface [s]
+constexpr double GPS_L1_CA_NOMINAL_TRAVEL_TIME_S = 0.075;
+constexpr double GPS_WEEK_SECONDS = 604800.0;
 
 
 gps_l1_ca_telemetry_decoder_gs_sptr
@@ -112,6 +103,9 @@ gps_l1_ca_telemetry_decoder_gs::gps_l1_ca_telemetry_decoder_gs(
     d_flag_TOW_set = false;
     d_flag_PLL_180_deg_phase_locked = false;
     d_prev_GPS_frame_4bytes = 0;
+    d_assisted_tow = false;
+    d_assisted_ref_tow_s = 0.0;
+    d_assisted_tow_tolerance_s = 0.0;
     d_symbol_history.set_capacity(d_required_symbols);
 }
 
@@ -133,29 +127,93 @@ gps_l1_ca_telemetry_decoder_gs::~gps_l1_ca_telemetry_decoder_gs()
 }
 
 
-bool gps_l1_ca_telemetry_decoder_gs::gps_word_parityCheck(uint32_t gpsword)
+void gps_l1_ca_telemetry_decoder_gs::set_assisted_tow(double ref_tow_s, double tolerance_s)
 {
-    // XOR as many bits in parallel as possible.  The magic constants pick
-    //   up bits which are to be XOR'ed together to implement the GPS parity
-    //   check algorithm described in IS-GPS-200K.  This avoids lengthy shift-
-    //   and-xor loops.
-    const uint32_t d1 = gpsword & 0xFBFFBF00U;
-    const uint32_t d2 = my_rotl::rotl(gpsword, 1U) & 0x07FFBF01U;
-    const uint32_t d3 = my_rotl::rotl(gpsword, 2U) & 0xFC0F8100U;
-    const uint32_t d4 = my_rotl::rotl(gpsword, 3U) & 0xF81FFE02U;
-    const uint32_t d5 = my_rotl::rotl(gpsword, 4U) & 0xFC00000EU;
-    const uint32_t d6 = my_rotl::rotl(gpsword, 5U) & 0x07F00001U;
-    const uint32_t d7 = my_rotl::rotl(gpsword, 6U) & 0x00003000U;
-    const uint32_t t = d1 ^ d2 ^ d3 ^ d4 ^ d5 ^ d6 ^ d7;
-    // Now XOR the 5 6-bit fields together to produce the 6-bit final result.
-    uint32_t parity = t ^ my_rotl::rotl(t, 6U) ^ my_rotl::rotl(t, 12U) ^ my_rotl::rotl(t, 18U) ^ my_rotl::rotl(t, 24U);
-    parity = parity & 0x3FU;
-    if (parity == (gpsword & 0x3FU))
+    gr::thread::scoped_lock lock(d_setlock);
+    d_assisted_ref_tow_s = ref_tow_s;
+    d_assisted_tow_tolerance_s = tolerance_s;
+    d_assisted_tow = true;
+    DLOG(INFO) << "Assisted TOW synchronization enabled for satellite " << d_satellite
+               << " with reference TOW " << ref_tow_s << " [s]";
+}
+
+
+bool gps_l1_ca_telemetry_decoder_gs::assisted_tow_sync(const Gnss_Synchro &current_symbol)
+{
+    // The newest 60 symbols must be the TLM and HOW words of a subframe
+    const int32_t num_symbols = 2 * GPS_WORD_BITS;
+    if (d_symbol_history.size() < static_cast<uint32_t>(num_symbols) or current_symbol.fs == 0)
         {
-            return true;
+            return false;
         }
+    const auto first = d_symbol_history.end() - num_symbols;
+    std::array<uint32_t, 2> words{{pack_symbols(first, GPS_WORD_BITS), pack_symbols(first + GPS_WORD_BITS, GPS_WORD_BITS)}};
 
-    return false;
+    // TLM preamble, with either polarity
+    const uint32_t preamble = words[0] >> 22U;
+    const bool inverted = (preamble == (~0x8BU & 0xFFU));
+    if (preamble != 0x8BU and not inverted)
+        {
+            return false;
+        }
+    if (inverted)
+        {
+            words[0] ^= 0x3FFFFFFFU;
+            words[1] ^= 0x3FFFFFFFU;
+        }
+
+    // The last word of every subframe ends with D29 = D30 = 0
+    uint32_t prev_word = 0U;
+    if (not gps_lnav_parity_check(words.data(), 2, prev_word))
+        {
+            return false;
+        }
+    const uint32_t tow_count = (words[1] >> 13U) & 0x1FFFFU;
+    const uint32_t subframe_id = (words[1] >> 8U) & 0x7U;
+    if (subframe_id < 1 or subframe_id > 5 or tow_count >= 100800U)
+        {
+            return false;
+        }
+
+    // The TOW count is the time at the start of the next subframe, 240 bits ahead
+    int64_t tow_ms = static_cast<int64_t>(tow_count) * 6000 - static_cast<int64_t>(GPS_SUBFRAME_BITS - num_symbols) * GPS_L1_CA_BIT_PERIOD_MS;
+    if (tow_ms < 0)
+        {
+            tow_ms += static_cast<int64_t>(GPS_WEEK_SECONDS * 1000.0);
+        }
+
+    // Reject false locks that do not agree with the coarse time
+    const double coarse_tow_s = d_assisted_ref_tow_s + static_cast<double>(current_symbol.Tracking_sample_counter) / static_cast<double>(current_symbol.fs) - GPS_L1_CA_NOMINAL_TRAVEL_TIME_S;
+    double diff_s = std::fmod(static_cast<double>(tow_ms) / 1000.0 - coarse_tow_s, GPS_WEEK_SECONDS);
+    if (diff_s > GPS_WEEK_SECONDS / 2.0)
+        {
+            diff_s -= GPS_WEEK_SECONDS;
+        }
+    else if (diff_s < -GPS_WEEK_SECONDS / 2.0)
+        {
+            diff_s += GPS_WEEK_SECONDS;
+        }
+    if (std::abs(diff_s) > d_assisted_tow_tolerance_s)
+        {
+            DLOG(INFO) << "Assisted TOW for satellite " << d_satellite << " rejected: TOW " << tow_ms
+                       << " [ms] is " << diff_s << " [s] away from the coarse time";
+            return false;
+        }
+
+    DLOG(INFO) << "Assisted TOW synchronization for satellite " << d_satellite << ": TOW " << tow_ms << " [ms]";
+    d_TOW_at_current_symbol_ms = static_cast<uint32_t>(tow_ms);
+    d_TOW_at_Preamble_ms = static_cast<uint32_t>(tow_ms);
+    d_flag_TOW_set = true;
+    d_flag_PLL_180_deg_phase_locked = inverted;
+    // Tail of the word before the TLM, as received
+    d_prev_GPS_frame_4bytes = inverted ? 3U : 0U;
+    d_CRC_error_counter = 0;
+    // Decode the full subframe when its preamble reaches the oldest symbol of the history
+    d_preamble_index = d_sample_counter - static_cast<uint64_t>(num_symbols);
+    d_stat = 2;
+    gr::thread::scoped_lock lock(d_setlock);
+    d_last_valid_preamble = d_sample_counter;
+    return true;
 }
 
 
@@ -201,61 +259,19 @@ void gps_l1_ca_telemetry_decoder_gs::set_channel(int32_t channel)
 bool gps_l1_ca_telemetry_decoder_gs::decode_subframe()
 {
     std::array<char, GPS_SUBFRAME_LENGTH> subframe{};
-    int32_t frame_bit_index = 0;
-    int32_t word_index = 0;
-    uint32_t GPS_frame_4bytes = 0;
-    bool subframe_synchro_confirmation = true;
-    for (float subframe_symbol : d_symbol_history)
-        {
-            // ******* SYMBOL TO BIT *******
-            // symbol to bit
-            if (subframe_symbol > 0)
-                {
-                    GPS_frame_4bytes += 1;  // insert the telemetry bit in LSB
-                }
+    std::array<uint32_t, GPS_SUBFRAME_LENGTH / GPS_WORD_LENGTH> words{};
 
-            // ******* bits to words ******
-            frame_bit_index++;
-            if (frame_bit_index == 30)
-                {
-                    frame_bit_index = 0;
-                    // parity check
-                    // Each word in wordbuff is composed of:
-                    //      Bits 0 to 29 = the GPS data word
-                    //      Bits 30 to 31 = 2 LSBs of the GPS word ahead.
-                    // prepare the extended frame [-2 -1 0 ... 30]
-                    if (d_prev_GPS_frame_4bytes & 0x00000001U)
-                        {
-                            GPS_frame_4bytes = GPS_frame_4bytes | 0x40000000U;
-                        }
-                    if (d_prev_GPS_frame_4bytes & 0x00000002U)
-                        {
-                            GPS_frame_4bytes = GPS_frame_4bytes | 0x80000000U;
-                        }
-                    // Check that the 2 most recently logged words pass parity. Have to first
-                    // invert the data bits according to bit 30 of the previous word.
-                    if (GPS_frame_4bytes & 0x40000000U)
-                        {
-                            GPS_frame_4bytes ^= 0x3FFFFFC0U;  // invert the data bits (using XOR)
-                        }
-                    // check parity. If ANY word inside the subframe fails the parity, set subframe_synchro_confirmation = false
-                    if (not gps_l1_ca_telemetry_decoder_gs::gps_word_parityCheck(GPS_frame_4bytes))
-                        {
-                            subframe_synchro_confirmation = false;
-                        }
-                    // add word to subframe
-                    // insert the word in the correct position of the subframe
-                    std::memcpy(&subframe[word_index * GPS_WORD_LENGTH], &GPS_frame_4bytes, sizeof(uint32_t));
-                    word_index++;
-                    d_prev_GPS_frame_4bytes = GPS_frame_4bytes;  // save the actual frame
-                    GPS_frame_4bytes = 0;
-                }
-            else
-                {
-                    GPS_frame_4bytes <<= 1U;  // shift 1 bit left the telemetry word
-                }
+    // ******* symbols to words ******
+    const auto num_words = std::min(static_cast<int32_t>(d_symbol_history.size()) / GPS_WORD_BITS, static_cast<int32_t>(words.size()));
+    for (int32_t i = 0; i < num_words; i++)
+        {
+            words[i] = pack_symbols(d_symbol_history.begin() + i * GPS_WORD_BITS, GPS_WORD_BITS);
         }
 
+    // parity check. If ANY word inside the subframe fails the parity, the subframe is discarded
+    const bool subframe_synchro_confirmation = gps_lnav_parity_check(words.data(), num_words, d_prev_GPS_frame_4bytes);
+    std::memcpy(subframe.data(), words.data(), subframe.size());
+
     // decode subframe
     // NEW GPS SUBFRAME HAS ARRIVED!
     if (subframe_synchro_confirmation)
@@ -483,6 +499,12 @@ int gps_l1_ca_telemetry_decoder_gs::general_work(int noutput_items __attribute__
                 }
         }
 
+    // 3. Assisted TOW synchronization: use the TLM and HOW words as soon as they are received
+    if (d_assisted_tow and d_stat < 2)
+        {
+            assisted_tow_sync(current_symbol);
+        }
+
     if (d_flag_TOW_set == true)
         {
             current_symbol.TOW_at_current_symbol_ms = d_TOW_at_current_symbol_ms;
@@ -60,6 +60,16 @@ public:
     void set_channel(int channel);                        //!< Set receiver's channel
     void reset();
 
+    /*!
+     * \brief Enables the assisted TOW synchronization. The TLM and HOW words
+     * are decoded as soon as they are received, and the TOW they carry is
+     * accepted without waiting for a full subframe if it is within
+     * tolerance_s of the coarse time estimation, which is obtained from
+     * ref_tow_s (GPS time of week at the first sample of the signal source,
+     * in seconds) and the tracking sample counter.
+     */
+    void set_assisted_tow(double ref_tow_s, double tolerance_s);
+
     /*!
      * \brief This is where all signal processing takes place
      */
@@ -73,8 +83,8 @@ private:
 
     gps_l1_ca_telemetry_decoder_gs(const Gnss_Satellite &satellite, bool dump);
 
-    bool gps_word_parityCheck(uint32_t gpsword);
     bool decode_subframe();
+    bool assisted_tow_sync(const Gnss_Synchro &current_symbol);
 
     Gps_Navigation_Message d_nav;
     Gnss_Satellite d_satellite;
@@ -86,6 +96,9 @@ private:
 
     boost::circular_buffer<float> d_symbol_history;
 
+    double d_assisted_ref_tow_s;
+    double d_assisted_tow_tolerance_s;
+
     uint64_t d_sample_counter;
     uint64_t d_preamble_index;
     uint64_t d_last_valid_preamble;
@@ -110,6 +123,7 @@ private:
     bool d_sent_tlm_failed_msg;
     bool d_flag_PLL_180_deg_phase_locked;
     bool d_flag_TOW_set;
+    bool d_assisted_tow;
     bool d_dump;
 };
 
@@ -0,0 +1,88 @@
+/*!
+ * \file deinterleaver.h
+ * \brief Block deinterleaver with dimensions known at compile time
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_DEINTERLEAVER_H
+#define GNSS_SDR_DEINTERLEAVER_H
+
+#include <array>
+#include <cstdint>
+
+/*!
+ * \brief Deinterleaver for a block interleaver of ROWS x COLS soft symbols,
+ * in which symbols are written row by row and read column by column
+ * (see Galileo OS SIS ICD, Section 4.1.4).
+ *
+ * The input is read through any random access iterator, so the symbols can
+ * be taken straight from the receiver's symbol history without a previous
+ * linearization. Each output symbol is multiplied by a gain that depends on
+ * the parity of its position, which allows to fold the polarity correction
+ * of a PLL locked at 180 degrees and the inversion of the symbols of an
+ * inverted generator polynomial into the same pass. The output is then ready
+ * to be fed to the Viterbi decoder.
+ *
+ * Columns are processed in blocks of BLOCK_COLS, so each row of the block is
+ * read contiguously and the output block is written sequentially.
+ */
+template <int32_t ROWS, int32_t COLS>
+class Deinterleaver
+{
+public:
+    static constexpr int32_t size = ROWS * COLS;  //!< Number of symbols in the block
+
+    /*!
+     * \brief out[c * ROWS + r] = gain[(c * ROWS + r) % 2] * in[r * COLS + c]
+     */
+    template <typename InputIt>
+    static void run(InputIt in, float *out, float even_gain = 1.0F, float odd_gain = 1.0F)
+    {
+        const std::array<float, 2> gain{{even_gain, odd_gain}};
+        int32_t c0 = 0;
+        for (; c0 + BLOCK_COLS <= COLS; c0 += BLOCK_COLS)
+            {
+                transpose_block<BLOCK_COLS>(in, out, c0, gain);
+            }
+        transpose_block<COLS % BLOCK_COLS>(in, out, c0, gain);
+    }
+
+private:
+    static constexpr int32_t BLOCK_COLS = 8;
+
+    template <int32_t NCOLS, typename InputIt>
+    static void transpose_block(InputIt in, float *out, int32_t c0, const std::array<float, 2> &gain)
+    {
+        std::array<std::array<float, ROWS>, (NCOLS > 0 ? NCOLS : 1)> block;
+        for (int32_t r = 0; r < ROWS; r++)
+            {
+                InputIt row = in + (r * COLS + c0);
+                for (int32_t c = 0; c < NCOLS; c++)
+                    {
+                        block[c][r] = row[c];
+                    }
+            }
+        for (int32_t c = 0; c < NCOLS; c++)
+            {
+                float *dst = out + (c0 + c) * ROWS;
+                for (int32_t r = 0; r < ROWS; r++)
+                    {
+                        dst[r] = gain[((c0 + c) * ROWS + r) & 1] * block[c][r];
+                    }
+            }
+    }
+};
+
+#endif  // GNSS_SDR_DEINTERLEAVER_H
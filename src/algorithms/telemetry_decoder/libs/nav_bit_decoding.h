@@ -0,0 +1,158 @@
+/*!
+ * \file nav_bit_decoding.h
+ * \brief Table and popcount based decoding of the block codes protecting
+ * the GPS LNAV and BeiDou D1/D2 navigation message words.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_NAV_BIT_DECODING_H
+#define GNSS_SDR_NAV_BIT_DECODING_H
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+
+/*!
+ * \brief Returns 1 if x has an odd number of bits set, 0 otherwise.
+ * std::bitset::count() is lowered to a single popcnt instruction when the
+ * target has it.
+ */
+inline uint32_t parity32(uint32_t x)
+{
+    return static_cast<uint32_t>(std::bitset<32>(x).count() & 1U);
+}
+
+
+/*!
+ * \brief Hard decision of n soft symbols (n <= 32), packed MSB first:
+ * a positive symbol gives a bit 1.
+ */
+template <typename InputIt>
+inline uint32_t pack_symbols(InputIt symbols, int32_t n)
+{
+    uint32_t bits = 0U;
+    for (int32_t i = 0; i < n; i++)
+        {
+            bits = (bits << 1U) | static_cast<uint32_t>(symbols[i] > 0);
+        }
+    return bits;
+}
+
+
+/*!
+ * \brief Masks selecting, for each parity bit D25 to D30 of a GPS LNAV word,
+ * the bits of the extended word that are XOR'ed to produce it
+ * (IS-GPS-200L, Table 20-XIV). The extended word holds D29* and D30* of the
+ * previous word in bits 31 and 30, the (non inverted) data bits d1 to d24 in
+ * bits 29 to 6, and the received parity D25 to D30 in bits 5 to 0.
+ */
+const std::array<uint32_t, 6> GPS_LNAV_PARITY_MASKS{{0xBB1F3480U, 0x5D8F9A40U, 0xAEC7CD00U, 0x5763E680U, 0x6BB1F340U, 0x8B7A89C0U}};
+
+
+/*!
+ * \brief Checks the parity of num_words consecutive 30-bit LNAV words (usually,
+ * a whole subframe) as received. Each word is extended with the last two bits
+ * of the previous one and its data bits are inverted if D30* is set, so that
+ * on return words[] holds the decoded extended words (the layout expected by
+ * Gps_Navigation_Message::subframe_decoder()). prev_word is the last extended
+ * word before words[0], and it is updated to the last word checked.
+ *
+ * \return true if all the words pass the parity check
+ */
+inline bool gps_lnav_parity_check(uint32_t *words, int32_t num_words, uint32_t &prev_word)
+{
+    uint32_t failed = 0U;
+    for (int32_t i = 0; i < num_words; i++)
+        {
+            uint32_t &word = words[i];
+            word |= (prev_word & 3U) << 30U;
+            if (word & 0x40000000U)
+                {
+                    word ^= 0x3FFFFFC0U;
+                }
+            uint32_t parity = 0U;
+            for (uint32_t mask : GPS_LNAV_PARITY_MASKS)
+                {
+                    parity = (parity << 1U) | parity32(word & mask);
+                }
+            failed |= parity ^ (word & 0x3FU);
+            prev_word = word;
+        }
+    return failed == 0U;
+}
+
+
+/*!
+ * \brief Masks selecting the codeword bits contributing to each bit of the
+ * syndrome of the BeiDou BCH(15,11,1) code, g(X) = X^4 + X + 1
+ * (BDS-SIS-ICD-B1I-3.0, Section 5.1.3). Codewords are packed MSB first.
+ */
+const std::array<uint32_t, 4> BCH15_11_SYNDROME_MASKS{{0x7591U, 0x1EB2U, 0x3D64U, 0x7AC8U}};
+
+
+/*!
+ * \brief Error pattern corresponding to each syndrome. The code is perfect,
+ * so every non-zero syndrome points to exactly one bit.
+ */
+const std::array<uint16_t, 16> BCH15_11_ERROR_PATTERNS{{0x0000U,
+    0x0001U, 0x0002U, 0x0010U, 0x0004U, 0x0100U, 0x0020U, 0x0400U, 0x0008U,
+    0x4000U, 0x0200U, 0x0080U, 0x0040U, 0x2000U, 0x0800U, 0x1000U}};
+
+
+/*!
+ * \brief Corrects up to one error in a 15-bit BCH(15,11,1) codeword, packed
+ * MSB first. Returns the corrected codeword (11 information bits followed by
+ * the 4 parity bits).
+ */
+inline uint32_t bch15_11_decode(uint32_t codeword)
+{
+    uint32_t syndrome = 0U;
+    for (uint32_t k = 0; k < 4; k++)
+        {
+            syndrome |= parity32(codeword & BCH15_11_SYNDROME_MASKS[k]) << k;
+        }
+    return codeword ^ BCH15_11_ERROR_PATTERNS[syndrome];
+}
+
+
+/*!
+ * \brief Decodes a 30-symbol word of the BeiDou D1/D2 navigation message.
+ * The first word of a subframe is only partially encoded and it is returned
+ * as received. The other words are made of two BCH(15,11,1) codewords
+ * interleaved bit by bit; they are deinterleaved, corrected, and rearranged as
+ * the 11 + 11 information bits followed by the 4 + 4 parity bits.
+ *
+ * \return The 30 decoded bits, packed MSB first
+ */
+template <typename InputIt>
+inline uint32_t beidou_dnav_decode_word(InputIt symbols, bool first_word)
+{
+    if (first_word)
+        {
+            return pack_symbols(symbols, 30);
+        }
+    uint32_t first_branch = 0U;
+    uint32_t second_branch = 0U;
+    for (int32_t c = 0; c < 15; c++)
+        {
+            first_branch = (first_branch << 1U) | static_cast<uint32_t>(symbols[2 * c] > 0);
+            second_branch = (second_branch << 1U) | static_cast<uint32_t>(symbols[2 * c + 1] > 0);
+        }
+    first_branch = bch15_11_decode(first_branch);
+    second_branch = bch15_11_decode(second_branch);
+    return ((first_branch >> 4U) << 19U) | ((second_branch >> 4U) << 8U) | ((first_branch & 0xFU) << 4U) | (second_branch & 0xFU);
+}
+
+#endif  // GNSS_SDR_NAV_BIT_DECODING_H
@@ -0,0 +1,93 @@
+/*!
+ * \file tlm_decoding_pool.cc
+ * \brief Pool of worker threads shared by all the telemetry decoder blocks
+ * for offloading the FEC decoding of navigation message pages.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "tlm_decoding_pool.h"
+#include <glog/logging.h>
+#include <algorithm>  // for std::max
+#include <utility>    // for std::move
+
+
+Tlm_Decoding_Pool& Tlm_Decoding_Pool::instance()
+{
+    // Leave one core for the flowgraph scheduler when possible
+    static Tlm_Decoding_Pool pool(std::max(2U, std::thread::hardware_concurrency()) - 1U);
+    return pool;
+}
+
+
+Tlm_Decoding_Pool::Tlm_Decoding_Pool(std::size_t num_workers) : d_stop(false)
+{
+    d_workers.reserve(num_workers);
+    for (std::size_t i = 0; i < num_workers; i++)
+        {
+            d_workers.emplace_back(&Tlm_Decoding_Pool::run, this);
+        }
+    DLOG(INFO) << "Telemetry decoding pool started with " << num_workers << " worker threads";
+}
+
+
+Tlm_Decoding_Pool::~Tlm_Decoding_Pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stop = true;
+    }
+    d_cond.notify_all();
+    for (auto& worker : d_workers)
+        {
+            if (worker.joinable())
+                {
+                    worker.join();
+                }
+        }
+}
+
+
+std::future<void> Tlm_Decoding_Pool::submit(std::function<void()> job)
+{
+    std::packaged_task<void()> task(std::move(job));
+    std::future<void> result = task.get_future();
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_jobs.push(std::move(task));
+    }
+    d_cond.notify_one();
+    return result;
+}
+
+
+void Tlm_Decoding_Pool::run()
+{
+    while (true)
+        {
+            std::packaged_task<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(d_mutex);
+                d_cond.wait(lock, [this] { return d_stop or !d_jobs.empty(); });
+                if (d_jobs.empty())
+                    {
+                        // d_stop is set and there is nothing left to do
+                        return;
+                    }
+                task = std::move(d_jobs.front());
+                d_jobs.pop();
+            }
+            task();
+        }
+}
@@ -0,0 +1,73 @@
+/*!
+ * \file tlm_decoding_pool.h
+ * \brief Pool of worker threads shared by all the telemetry decoder blocks
+ * for offloading the FEC decoding of navigation message pages.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_TLM_DECODING_POOL_H
+#define GNSS_SDR_TLM_DECODING_POOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/*!
+ * \brief Process-wide pool of threads that run navigation page decoding jobs
+ * (e.g., Viterbi decoding) on behalf of the telemetry decoder blocks, so that
+ * the channel threads do not stall every time a page is completed.
+ *
+ * Jobs are served in FIFO order. Each call to submit() returns a
+ * std::future that becomes ready when the job has been executed; the
+ * caller is responsible for keeping alive whatever the job refers to
+ * until then.
+ */
+class Tlm_Decoding_Pool
+{
+public:
+    /*!
+     * \brief Returns the pool shared by all channels. Worker threads are
+     * created the first time this function is called.
+     */
+    static Tlm_Decoding_Pool& instance();
+
+    ~Tlm_Decoding_Pool();
+
+    Tlm_Decoding_Pool(const Tlm_Decoding_Pool&) = delete;
+    Tlm_Decoding_Pool& operator=(const Tlm_Decoding_Pool&) = delete;
+
+    /*!
+     * \brief Queues a decoding job.
+     */
+    std::future<void> submit(std::function<void()> job);
+
+    std::size_t num_workers() const { return d_workers.size(); }
+
+private:
+    explicit Tlm_Decoding_Pool(std::size_t num_workers);
+    void run();
+
+    std::vector<std::thread> d_workers;
+    std::queue<std::packaged_task<void()>> d_jobs;
+    std::mutex d_mutex;
+    std::condition_variable d_cond;
+    bool d_stop;
+};
+
+#endif  // GNSS_SDR_TLM_DECODING_POOL_H
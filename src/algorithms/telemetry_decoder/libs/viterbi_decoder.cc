@@ -20,8 +20,7 @@
 
 #include "viterbi_decoder.h"
 #include <glog/logging.h>
-#include <algorithm>  // for fill_n
-#include <ostream>    // for operator<<, basic_ostream, char_traits
+#include <ostream>  // for operator<<, basic_ostream, char_traits
 
 // logging
 #define EVENT 2   // logs important events which don't occur every block
@@ -44,10 +43,10 @@ Viterbi_Decoder::Viterbi_Decoder(const int g_encoder[], const int KK, const int
     d_number_symbols = static_cast<int>(1U << d_nn); /* 2^nn */
 
     /* create appropriate transition matrices (trellis) */
-    d_out0.reserve(d_states);
-    d_out1.reserve(d_states);
-    d_state0.reserve(d_states);
-    d_state1.reserve(d_states);
+    d_out0.resize(d_states);
+    d_out1.resize(d_states);
+    d_state0.resize(d_states);
+    d_state1.resize(d_states);
 
     nsc_transit(d_out0.data(), d_state0.data(), 0, g_encoder, d_KK, d_nn);
     nsc_transit(d_out1.data(), d_state1.data(), 1, g_encoder, d_KK, d_nn);
@@ -126,11 +125,11 @@ void Viterbi_Decoder::init_trellis_state()
             d_metric_c.clear();
         }
 
-    // reserve new trellis state memory
-    d_pm_t.reserve(d_states);
+    // allocate new trellis state memory
+    d_pm_t.resize(d_states);
     d_trellis_paths = std::deque<Prev>();
-    d_rec_array.reserve(d_nn);
-    d_metric_c.reserve(d_number_symbols);
+    d_rec_array.resize(d_nn);
+    d_metric_c.resize(d_number_symbols);
     d_trellis_state_is_initialised = true;
 
     /* initialize trellis */
@@ -432,13 +431,10 @@ Viterbi_Decoder::Prev::Prev(int states, int t)
 {
     this->t = t;
     num_states = states;
-    state.reserve(num_states);
-    v_bit.reserve(num_states);
-    v_metric.reserve(num_states);
+    state.assign(num_states, 0);
+    v_bit.assign(num_states, 0);
+    v_metric.assign(num_states, 0.0F);
     refcount = 1;
-    std::fill_n(state.begin(), num_states, 0);
-    std::fill_n(v_bit.begin(), num_states, 0);
-    std::fill_n(v_metric.begin(), num_states, 0.0F);
 }
 
 
@@ -29,6 +29,7 @@
 #include "display.h"
 #include "dll_pll_conf.h"
 #include "gnss_sdr_flags.h"
+#include "item_type_helpers.h"
 #include <glog/logging.h>
 #include <array>
 
@@ -66,6 +67,11 @@ GalileoE1DllPllVemlTracking::GalileoE1DllPllVemlTracking(
             item_size_ = sizeof(gr_complex);
             tracking_ = dll_pll_veml_make_tracking(trk_params);
         }
+    else if (trk_params.item_type == "cshort" or trk_params.item_type == "cbyte")
+        {
+            item_size_ = item_type_size(trk_params.item_type);
+            tracking_ = dll_pll_veml_make_tracking(trk_params);
+        }
     else
         {
             item_size_ = sizeof(gr_complex);
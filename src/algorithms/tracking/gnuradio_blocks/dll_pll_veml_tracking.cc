@@ -43,7 +43,9 @@
 #include "gps_l2c_signal.h"
 #include "gps_l5_signal.h"
 #include "gps_sdr_signal_processing.h"
+#include "item_type_helpers.h"
 #include "lock_detectors.h"
+#include "replay_clock.h"
 #include "tracking_discriminators.h"
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>   // for io_signature
@@ -51,7 +53,7 @@
 #include <matio.h>                   // for Mat_VarCreate
 #include <pmt/pmt_sugar.h>           // for mp
 #include <volk_gnsssdr/volk_gnsssdr.h>
-#include <algorithm>  // for fill_n
+#include <algorithm>  // for fill_n, min
 #include <array>
 #include <cmath>      // for fmod, round, floor
 #include <exception>  // for exception
@@ -85,7 +87,7 @@ dll_pll_veml_tracking_sptr dll_pll_veml_make_tracking(const Dll_Pll_Conf &conf_)
 }
 
 
-dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_) : gr::block("dll_pll_veml_tracking", gr::io_signature::make(1, 1, sizeof(gr_complex)),
+dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_) : gr::block("dll_pll_veml_tracking", gr::io_signature::make(1, 1, item_type_size(conf_.item_type)),
                                                                               gr::io_signature::make(1, 1, sizeof(Gnss_Synchro)))
 {
     // prevent telemetry symbols accumulation in output buffers
@@ -467,15 +469,20 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_) : gr::bl
     // Enable Data component prompt correlator (slave to Pilot prompt) if tracking uses Pilot signal
     if (d_trk_parameters.track_pilot)
         {
-            // Extra correlator for the data component
-            d_correlator_data_cpu.init(static_cast<int>(2 * d_trk_parameters.vector_length), 1);
-            d_correlator_data_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+            // Extra prompt correlator for the data component, computed by d_multicorrelator_cpu
             d_data_code.resize(2 * d_code_length_chips, 0.0);
         }
 
     // --- Initializations ---
     d_Prompt_circular_buffer.set_capacity(d_secondary_code_length);
     d_multicorrelator_cpu.set_high_dynamics_resampler(d_trk_parameters.high_dyn);
+    d_multicorrelator_cpu.set_packed_codes(d_trk_parameters.packed_codes);
+    if (d_trk_parameters.kernel_autotuning)
+        {
+            // Calibrations must happen before the first kernel call of the process
+            // (see Dll_Pll_Conf::kernel_autotuning), hence here and not in general_work()
+            d_multicorrelator_cpu.tune_kernels(static_cast<int>(d_trk_parameters.vector_length), d_trk_parameters.item_type, d_trk_parameters.track_pilot ? 1 : 0);
+        }
     // Initial code frequency basis of NCO
     d_code_freq_chips = d_code_chip_rate;
     // Residual code phase (in chips)
@@ -576,6 +583,7 @@ dll_pll_veml_tracking::dll_pll_veml_tracking(const Dll_Pll_Conf &conf_) : gr::bl
         }
     d_corrected_doppler = false;
     d_acc_carrier_phase_initialized = false;
+    d_replay_clock_id = Replay_Clock::get().register_consumer(this, d_trk_parameters.fs_in);
 }
 
 
@@ -644,7 +652,6 @@ void dll_pll_veml_tracking::start_tracking()
                     gps_l5q_code_gen_float(d_tracking_code, d_acquisition_gnss_synchro->PRN);
                     gps_l5i_code_gen_float(d_data_code, d_acquisition_gnss_synchro->PRN);
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
                 }
             else
                 {
@@ -659,7 +666,6 @@ void dll_pll_veml_tracking::start_tracking()
                     galileo_e1_code_gen_sinboc11_float(d_tracking_code, pilot_signal, d_acquisition_gnss_synchro->PRN);
                     galileo_e1_code_gen_sinboc11_float(d_data_code, Signal_, d_acquisition_gnss_synchro->PRN);
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
                 }
             else
                 {
@@ -680,7 +686,6 @@ void dll_pll_veml_tracking::start_tracking()
                             d_data_code[i] = aux_code[i].real();  // the same because it is generated the full signal (E5aI + E5aQ)
                         }
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
                 }
             else
                 {
@@ -704,7 +709,6 @@ void dll_pll_veml_tracking::start_tracking()
                             d_data_code[i] = aux_code[i].real();  // the same because it is generated the full signal (E5bI + E5bsQ)
                         }
                     d_Prompt_Data[0] = gr_complex(0.0, 0.0);
-                    d_correlator_data_cpu.set_local_code_and_taps(d_code_length_chips, d_data_code.data(), d_prompt_data_shift);
                 }
             else
                 {
@@ -781,6 +785,11 @@ void dll_pll_veml_tracking::start_tracking()
         }
 
     d_multicorrelator_cpu.set_local_code_and_taps(d_code_samples_per_chip * d_code_length_chips, d_tracking_code.data(), d_local_code_shift_chips.data());
+    if (d_trk_parameters.track_pilot)
+        {
+            // the data prompt shares the carrier wipe-off of the pilot correlators
+            d_multicorrelator_cpu.set_data_local_code_and_taps(d_data_code.data(), d_prompt_data_shift, 1, d_Prompt_Data.data());
+        }
     std::fill_n(d_correlator_outs.begin(), d_n_correlator_taps, gr_complex(0.0, 0.0));
 
     d_carrier_lock_fail_counter = 0;
@@ -832,6 +841,10 @@ void dll_pll_veml_tracking::start_tracking()
 
 dll_pll_veml_tracking::~dll_pll_veml_tracking()
 {
+    if (d_replay_clock_id >= 0)
+        {
+            Replay_Clock::get().unregister_consumer(d_replay_clock_id);
+        }
     if (d_dump_file.is_open())
         {
             try
@@ -856,10 +869,6 @@ dll_pll_veml_tracking::~dll_pll_veml_tracking()
         }
     try
         {
-            if (d_trk_parameters.track_pilot)
-                {
-                    d_correlator_data_cpu.free();
-                }
             d_multicorrelator_cpu.free();
         }
     catch (const std::exception &ex)
@@ -959,6 +968,7 @@ bool dll_pll_veml_tracking::cn0_and_tracking_lock_status(double coh_integration_
             LOG(INFO) << "Loss of lock in channel " << d_channel
                       << " (carrier_lock_fail_counter:" << d_carrier_lock_fail_counter
                       << " code_lock_fail_counter : " << d_code_lock_fail_counter << ")";
+            Replay_Clock::get().event_posted();
             this->message_port_pub(pmt::mp("events"), pmt::from_long(3));  // 3 -> loss of lock
             d_carrier_lock_fail_counter = 0;
             d_code_lock_fail_counter = 0;
@@ -973,31 +983,37 @@ bool dll_pll_veml_tracking::cn0_and_tracking_lock_status(double coh_integration_
 // - updated remnant code phase in samples (d_rem_code_phase_samples)
 // - d_code_freq_chips
 // - d_carrier_doppler_hz
-void dll_pll_veml_tracking::do_correlation_step(const gr_complex *input_samples)
+// cshort and cbyte samples are handed to the correlators as they are,
+// only the correlator outputs are in floating point
+void dll_pll_veml_tracking::set_correlator_input(Cpu_Multicorrelator_Real_Codes &correlator, gr_complex *corr_out, const void *input_samples) const
+{
+    if (d_trk_parameters.item_type == "cshort")
+        {
+            correlator.set_input_output_vectors(corr_out, static_cast<const lv_16sc_t *>(input_samples));
+        }
+    else if (d_trk_parameters.item_type == "cbyte")
+        {
+            correlator.set_input_output_vectors(corr_out, static_cast<const lv_8sc_t *>(input_samples));
+        }
+    else
+        {
+            correlator.set_input_output_vectors(corr_out, static_cast<const gr_complex *>(input_samples));
+        }
+}
+
+
+void dll_pll_veml_tracking::do_correlation_step(const void *input_samples)
 {
     // ################# CARRIER WIPEOFF AND CORRELATORS ##############################
-    // perform carrier wipe-off and compute Early, Prompt and Late correlation
-    d_multicorrelator_cpu.set_input_output_vectors(d_correlator_outs.data(), input_samples);
+    // perform carrier wipe-off and compute Early, Prompt and Late correlation, and the data prompt if tracking tracks the pilot signal
+    set_correlator_input(d_multicorrelator_cpu, d_correlator_outs.data(), input_samples);
     d_multicorrelator_cpu.Carrier_wipeoff_multicorrelator_resampler(
         d_rem_carr_phase_rad,
-        static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
+        d_carrier_phase_step_rad, static_cast<float>(d_carrier_phase_rate_step_rad),
         static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
         static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
         static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
         d_trk_parameters.vector_length);
-
-    // DATA CORRELATOR (if tracking tracks the pilot signal)
-    if (d_trk_parameters.track_pilot)
-        {
-            d_correlator_data_cpu.set_input_output_vectors(d_Prompt_Data.data(), input_samples);
-            d_correlator_data_cpu.Carrier_wipeoff_multicorrelator_resampler(
-                d_rem_carr_phase_rad,
-                static_cast<float>(d_carrier_phase_step_rad), static_cast<float>(d_carrier_phase_rate_step_rad),
-                static_cast<float>(d_rem_code_phase_chips) * static_cast<float>(d_code_samples_per_chip),
-                static_cast<float>(d_code_phase_step_chips) * static_cast<float>(d_code_samples_per_chip),
-                static_cast<float>(d_code_phase_rate_step_chips) * static_cast<float>(d_code_samples_per_chip),
-                d_trk_parameters.vector_length);
-        }
 }
 
 
@@ -1659,8 +1675,15 @@ void dll_pll_veml_tracking::stop_tracking()
 int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items,
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
+    int ninput = ninput_items[0];
+    if (d_replay_clock_id >= 0)
+        {
+            // deterministic replay: do not start beyond the end of the current epoch
+            // (before locking, since the events are applied while waiting)
+            ninput = static_cast<int>(std::min(static_cast<uint64_t>(ninput), Replay_Clock::get().wait(d_replay_clock_id, d_sample_counter)));
+        }
     gr::thread::scoped_lock l(d_setlock);
-    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    const void *in = input_items[0];
     auto **out = reinterpret_cast<Gnss_Synchro **>(&output_items[0]);
     Gnss_Synchro current_synchro_data = Gnss_Synchro();
     current_synchro_data.Flag_valid_symbol_output = false;
@@ -1678,8 +1701,8 @@ int dll_pll_veml_tracking::general_work(int noutput_items __attribute__((unused)
         {
         case 0:  // Standby - Consume samples at full throttle, do nothing
             {
-                d_sample_counter += static_cast<uint64_t>(ninput_items[0]);
-                consume_each(ninput_items[0]);
+                d_sample_counter += static_cast<uint64_t>(ninput);
+                consume_each(ninput);
                 return 0;
                 break;
             }
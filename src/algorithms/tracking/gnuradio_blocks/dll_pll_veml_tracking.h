@@ -79,7 +79,8 @@ private:
     explicit dll_pll_veml_tracking(const Dll_Pll_Conf &conf_);
 
     void msg_handler_telemetry_to_trk(const pmt::pmt_t &msg);
-    void do_correlation_step(const gr_complex *input_samples);
+    void do_correlation_step(const void *input_samples);
+    void set_correlator_input(Cpu_Multicorrelator_Real_Codes &correlator, gr_complex *corr_out, const void *input_samples) const;
     void run_dll_pll();
     void check_carrier_phase_coherent_initialization();
     void update_tracking_vars();
@@ -91,7 +92,6 @@ private:
     int32_t save_matfile() const;
 
     Cpu_Multicorrelator_Real_Codes d_multicorrelator_cpu;
-    Cpu_Multicorrelator_Real_Codes d_correlator_data_cpu;  // for data channel
 
     Dll_Pll_Conf d_trk_parameters;
 
@@ -171,6 +171,8 @@ private:
     uint64_t d_sample_counter;
     uint64_t d_acq_sample_stamp;
 
+    int d_replay_clock_id;  // -1 if the replay is not deterministic
+
     float *d_prompt_data_shift;
     float d_rem_carr_phase_rad;
 
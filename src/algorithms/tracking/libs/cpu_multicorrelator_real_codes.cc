@@ -23,19 +23,56 @@
  */
 
 #include "cpu_multicorrelator_real_codes.h"
+#include "volk_gnsssdr_kernel_tuning.h"
 #include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <algorithm>
 #include <cmath>
 
+
+namespace
+{
+bool is_binary_code(const float* code, int code_length_chips)
+{
+    for (int n = 0; n < code_length_chips; n++)
+        {
+            if (code[n] != 1.0F and code[n] != -1.0F)
+                {
+                    return false;
+                }
+        }
+    return true;
+}
+}  // namespace
+
+
 Cpu_Multicorrelator_Real_Codes::Cpu_Multicorrelator_Real_Codes()
 {
     d_sig_in = nullptr;
+    d_sig_in_16sc = nullptr;
+    d_sig_in_8sc = nullptr;
+    d_sig_in_widened = nullptr;
     d_local_code_in = nullptr;
     d_shifts_chips = nullptr;
     d_corr_out = nullptr;
     d_local_codes_resampled = nullptr;
+    d_data_code_in = nullptr;
+    d_data_shifts_chips = nullptr;
+    d_data_corr_out = nullptr;
+    d_shared_corr_out = nullptr;
     d_code_length_chips = 0;
     d_n_correlators = 0;
+    d_n_data_correlators = 0;
+    d_n_resampled_codes = 0;
+    d_max_signal_length_samples = 0;
     d_use_high_dynamics_resampler = true;
+    d_use_fused_resampler = true;
+    d_use_packed_codes = false;
+    d_local_code_is_binary = false;
+    d_data_code_is_binary = false;
+    d_local_code_hash = 0;
+    d_data_code_hash = 0;
+    d_code_phase_resolution_chips = 1.0F / 64.0F;
 }
 
 
@@ -53,15 +90,36 @@ bool Cpu_Multicorrelator_Real_Codes::init(
     int n_correlators)
 {
     // ALLOCATE MEMORY FOR INTERNAL vectors
-    size_t size = max_signal_length_samples * sizeof(float);
+    d_n_correlators = n_correlators;
+    d_max_signal_length_samples = max_signal_length_samples;
+    allocate_resampled_codes(n_correlators);
+    return true;
+}
+
 
-    d_local_codes_resampled = static_cast<float**>(volk_gnsssdr_malloc(n_correlators * sizeof(float*), volk_gnsssdr_get_alignment()));
-    for (int n = 0; n < n_correlators; n++)
+void Cpu_Multicorrelator_Real_Codes::allocate_resampled_codes(int n_codes)
+{
+    if (n_codes <= d_n_resampled_codes)
         {
-            d_local_codes_resampled[n] = static_cast<float*>(volk_gnsssdr_malloc(size, volk_gnsssdr_get_alignment()));
+            return;
         }
-    d_n_correlators = n_correlators;
-    return true;
+    size_t size = d_max_signal_length_samples * sizeof(float);
+    auto** local_codes_resampled = static_cast<float**>(volk_gnsssdr_malloc(n_codes * sizeof(float*), volk_gnsssdr_get_alignment()));
+    for (int n = 0; n < n_codes; n++)
+        {
+            local_codes_resampled[n] = n < d_n_resampled_codes ? d_local_codes_resampled[n] : static_cast<float*>(volk_gnsssdr_malloc(size, volk_gnsssdr_get_alignment()));
+        }
+    if (d_local_codes_resampled != nullptr)
+        {
+            volk_gnsssdr_free(d_local_codes_resampled);
+        }
+    if (d_shared_corr_out != nullptr)
+        {
+            volk_gnsssdr_free(d_shared_corr_out);
+        }
+    d_local_codes_resampled = local_codes_resampled;
+    d_shared_corr_out = static_cast<std::complex<float>*>(volk_gnsssdr_malloc(n_codes * sizeof(std::complex<float>), volk_gnsssdr_get_alignment()));
+    d_n_resampled_codes = n_codes;
 }
 
 
@@ -73,6 +131,26 @@ bool Cpu_Multicorrelator_Real_Codes::set_local_code_and_taps(
     d_local_code_in = local_code_in;
     d_shifts_chips = shifts_chips;
     d_code_length_chips = code_length_chips;
+    d_local_code_is_binary = is_binary_code(local_code_in, code_length_chips);
+    d_local_code_hash = d_local_code_is_binary ? Packed_Code_Replica_Cache::hash_values(local_code_in, code_length_chips) : 0;
+
+    return true;
+}
+
+
+bool Cpu_Multicorrelator_Real_Codes::set_data_local_code_and_taps(
+    const float* data_code_in,
+    float* data_shifts_chips,
+    int n_data_correlators,
+    std::complex<float>* data_corr_out)
+{
+    d_data_code_in = data_code_in;
+    d_data_shifts_chips = data_shifts_chips;
+    d_n_data_correlators = n_data_correlators;
+    d_data_corr_out = data_corr_out;
+    d_data_code_is_binary = is_binary_code(data_code_in, d_code_length_chips);
+    d_data_code_hash = d_data_code_is_binary ? Packed_Code_Replica_Cache::hash_values(data_code_in, d_code_length_chips) : 0;
+    allocate_resampled_codes(d_n_correlators + n_data_correlators);
 
     return true;
 }
@@ -82,13 +160,244 @@ bool Cpu_Multicorrelator_Real_Codes::set_input_output_vectors(std::complex<float
 {
     // Save CPU pointers
     d_sig_in = sig_in;
+    d_sig_in_16sc = nullptr;
+    d_sig_in_8sc = nullptr;
     d_corr_out = corr_out;
     return true;
 }
 
 
+bool Cpu_Multicorrelator_Real_Codes::set_input_output_vectors(std::complex<float>* corr_out, const std::complex<int16_t>* sig_in)
+{
+    // Save CPU pointers
+    d_sig_in = nullptr;
+    d_sig_in_16sc = sig_in;
+    d_sig_in_8sc = nullptr;
+    d_corr_out = corr_out;
+    return true;
+}
+
+
+bool Cpu_Multicorrelator_Real_Codes::set_input_output_vectors(std::complex<float>* corr_out, const std::complex<int8_t>* sig_in)
+{
+    // Save CPU pointers
+    d_sig_in = nullptr;
+    d_sig_in_16sc = nullptr;
+    d_sig_in_8sc = sig_in;
+    d_corr_out = corr_out;
+    return true;
+}
+
+
+void Cpu_Multicorrelator_Real_Codes::fused_multicorrelator(double phase_step_rad, double* phase_rad, float rem_code_phase_chips, float code_phase_step_chips, int signal_length_samples)
+{
+    // The data code taps, if any, follow the main code taps in the same pass, so that the carrier wipe-off is done once.
+    // The shifts are copied at each call because the tracking block can narrow them in place.
+    const int n_taps = d_n_correlators + d_n_data_correlators;
+    d_fused_local_codes.assign(d_n_correlators, d_local_code_in);
+    d_fused_local_codes.resize(n_taps, d_data_code_in);
+    d_fused_shifts_chips.assign(d_shifts_chips, d_shifts_chips + d_n_correlators);
+    if (d_n_data_correlators > 0)
+        {
+            d_fused_shifts_chips.insert(d_fused_shifts_chips.end(), d_data_shifts_chips, d_data_shifts_chips + d_n_data_correlators);
+        }
+    if (d_sig_in_16sc != nullptr)
+        {
+            volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn(shared_corr_out(), d_sig_in_16sc, phase_step_rad, phase_rad, d_fused_local_codes.data(), rem_code_phase_chips, code_phase_step_chips, 0.0F, d_fused_shifts_chips.data(), d_code_length_chips, n_taps, signal_length_samples);
+        }
+    else if (d_sig_in_8sc != nullptr)
+        {
+            volk_gnsssdr_8ic_32f_resampler_rotator_dot_prod_32fc_xn(shared_corr_out(), d_sig_in_8sc, phase_step_rad, phase_rad, d_fused_local_codes.data(), rem_code_phase_chips, code_phase_step_chips, 0.0F, d_fused_shifts_chips.data(), d_code_length_chips, n_taps, signal_length_samples);
+        }
+    else
+        {
+            volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn(shared_corr_out(), d_sig_in, phase_step_rad, phase_rad, d_fused_local_codes.data(), rem_code_phase_chips, code_phase_step_chips, 0.0F, d_fused_shifts_chips.data(), d_code_length_chips, n_taps, signal_length_samples);
+        }
+    split_shared_corr_out();
+}
+
+
+Packed_Code_Replica_Cache::Replicas Cpu_Multicorrelator_Real_Codes::packed_replicas(const float* local_code_in, uint64_t local_code_hash, float* shifts_chips, int n_correlators, float rem_code_phase_chips, float code_phase_step_chips, int signal_length_samples)
+{
+    // The replicas are built from the quantized code phase and advance, so that they repeat across epochs and channels
+    const double resolution = d_code_phase_resolution_chips;
+    Packed_Code_Replica_Key key{};
+    key.code_hash = local_code_hash;
+    key.shifts_hash = Packed_Code_Replica_Cache::hash_values(shifts_chips, n_correlators);
+    key.code_phase_q = std::llround(static_cast<double>(rem_code_phase_chips) / resolution);
+    key.code_advance_q = std::llround(static_cast<double>(code_phase_step_chips) * static_cast<double>(signal_length_samples) / resolution);
+    key.num_samples = signal_length_samples;
+    key.num_taps = n_correlators;
+
+    return Packed_Code_Replica_Cache::instance().get(key, [&](std::vector<uint32_t>& replicas) {
+        const auto quantized_rem_code_phase_chips = static_cast<float>(static_cast<double>(key.code_phase_q) * resolution);
+        const auto quantized_code_phase_step_chips = static_cast<float>(static_cast<double>(key.code_advance_q) * resolution / static_cast<double>(signal_length_samples));
+        volk_gnsssdr_32f_xn_resampler_32f_xn(d_local_codes_resampled,
+            local_code_in,
+            quantized_rem_code_phase_chips,
+            quantized_code_phase_step_chips,
+            shifts_chips,
+            d_code_length_chips,
+            n_correlators,
+            signal_length_samples);
+        const int words_per_tap = (signal_length_samples + 31) / 32;
+        replicas.assign(static_cast<size_t>(words_per_tap) * n_correlators, 0U);
+        for (int tap = 0; tap < n_correlators; tap++)
+            {
+                uint32_t* packed = &replicas[static_cast<size_t>(tap) * words_per_tap];
+                for (int n = 0; n < signal_length_samples; n++)
+                    {
+                        if (d_local_codes_resampled[tap][n] < 0.0F)
+                            {
+                                packed[n / 32] |= 1U << (n % 32);
+                            }
+                    }
+            }
+    });
+}
+
+
+void Cpu_Multicorrelator_Real_Codes::packed_multicorrelator(double phase_step_rad, double* phase_rad, float rem_code_phase_chips, float code_phase_step_chips, int signal_length_samples)
+{
+    const int words_per_tap = (signal_length_samples + 31) / 32;
+    d_packed_replicas = packed_replicas(d_local_code_in, d_local_code_hash, d_shifts_chips, d_n_correlators, rem_code_phase_chips, code_phase_step_chips, signal_length_samples);
+    d_packed_replica_ptrs.resize(d_n_correlators + d_n_data_correlators);
+    for (int tap = 0; tap < d_n_correlators; tap++)
+        {
+            d_packed_replica_ptrs[tap] = d_packed_replicas->data() + static_cast<size_t>(tap) * words_per_tap;
+        }
+    if (d_n_data_correlators > 0)
+        {
+            d_packed_data_replicas = packed_replicas(d_data_code_in, d_data_code_hash, d_data_shifts_chips, d_n_data_correlators, rem_code_phase_chips, code_phase_step_chips, signal_length_samples);
+            for (int tap = 0; tap < d_n_data_correlators; tap++)
+                {
+                    d_packed_replica_ptrs[d_n_correlators + tap] = d_packed_data_replicas->data() + static_cast<size_t>(tap) * words_per_tap;
+                }
+        }
+    // both codes are correlated in the same pass, so that the carrier wipe-off is done once
+    volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn(shared_corr_out(), float_input(signal_length_samples), phase_step_rad, phase_rad, d_packed_replica_ptrs.data(), d_n_correlators + d_n_data_correlators, signal_length_samples);
+    split_shared_corr_out();
+}
+
+
+std::complex<float>* Cpu_Multicorrelator_Real_Codes::shared_corr_out()
+{
+    return d_n_data_correlators > 0 ? d_shared_corr_out : d_corr_out;
+}
+
+
+void Cpu_Multicorrelator_Real_Codes::split_shared_corr_out()
+{
+    if (d_n_data_correlators > 0)
+        {
+            std::copy(d_shared_corr_out, d_shared_corr_out + d_n_correlators, d_corr_out);
+            std::copy(d_shared_corr_out + d_n_correlators, d_shared_corr_out + d_n_correlators + d_n_data_correlators, d_data_corr_out);
+        }
+}
+
+
+const std::complex<float>* Cpu_Multicorrelator_Real_Codes::float_input(int signal_length_samples)
+{
+    if (d_sig_in != nullptr)
+        {
+            return d_sig_in;
+        }
+    if (d_sig_in_widened == nullptr)
+        {
+            d_sig_in_widened = static_cast<std::complex<float>*>(volk_gnsssdr_malloc(d_max_signal_length_samples * sizeof(std::complex<float>), volk_gnsssdr_get_alignment()));
+        }
+    if (d_sig_in_16sc != nullptr)
+        {
+            volk_gnsssdr_16ic_convert_32fc(d_sig_in_widened, d_sig_in_16sc, signal_length_samples);
+        }
+    else
+        {
+            for (int n = 0; n < signal_length_samples; n++)
+                {
+                    d_sig_in_widened[n] = std::complex<float>(d_sig_in_8sc[n].real(), d_sig_in_8sc[n].imag());
+                }
+        }
+    return d_sig_in_widened;
+}
+
+
+void Cpu_Multicorrelator_Real_Codes::tune_kernels(int signal_length_samples, const std::string& item_type, int n_data_correlators)
+{
+    // Synthetic code and samples: the timings only depend on the call shape
+    const unsigned int code_length_chips = 1023;
+    volk_gnsssdr::vector<float> code(code_length_chips);
+    for (unsigned int n = 0; n < code_length_chips; n++)
+        {
+            code[n] = (n * 7U) % 3U ? 1.0F : -1.0F;
+        }
+    const int n_vectors_max = d_n_correlators + n_data_correlators;
+    volk_gnsssdr::vector<float> shifts(n_vectors_max);
+    for (int n = 0; n < n_vectors_max; n++)
+        {
+            shifts[n] = n_vectors_max > 1 ? -0.5F + static_cast<float>(n) / static_cast<float>(n_vectors_max - 1) : 0.0F;
+        }
+    volk_gnsssdr::vector<std::complex<float>> sig_in(signal_length_samples, std::complex<float>(0.5, -0.5));
+    volk_gnsssdr::vector<std::complex<int16_t>> sig_in_16sc(signal_length_samples, std::complex<int16_t>(3, -3));
+    volk_gnsssdr::vector<std::complex<int8_t>> sig_in_8sc(signal_length_samples, std::complex<int8_t>(3, -3));
+    volk_gnsssdr::vector<std::complex<float>> corr_out(n_vectors_max);
+    const double phase_step_rad = -0.1;
+    const lv_32fc_t phase_inc = std::exp(lv_32fc_t(0.0, -0.1));
+    const float rem_code_phase_chips = 0.25;
+    const float code_phase_step_chips = 0.999F * static_cast<float>(code_length_chips) / static_cast<float>(signal_length_samples);
+    const auto num_points = static_cast<unsigned int>(signal_length_samples);
+    double phase_rad = 0.0;
+    lv_32fc_t phase = lv_cmake(1.0F, 0.0F);
+
+    if (d_use_fused_resampler and !d_use_high_dynamics_resampler)
+        {
+            // The data code, if any, is correlated in the same call
+            std::vector<const float*> codes(n_vectors_max, code.data());
+            const auto num_vectors = static_cast<unsigned int>(n_vectors_max);
+            if (item_type == "cshort")
+                {
+                    volk_gnsssdr_tune_kernel("volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn", volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_get_func_desc(), num_points, num_vectors, [&](const char* impl_name) {
+                        volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_manual(corr_out.data(), sig_in_16sc.data(), phase_step_rad, &phase_rad, codes.data(), rem_code_phase_chips, code_phase_step_chips, 0.0F, shifts.data(), code_length_chips, n_vectors_max, num_points, impl_name);
+                    });
+                }
+            else if (item_type == "cbyte")
+                {
+                    volk_gnsssdr_tune_kernel("volk_gnsssdr_8ic_32f_resampler_rotator_dot_prod_32fc_xn", volk_gnsssdr_8ic_32f_resampler_rotator_dot_prod_32fc_xn_get_func_desc(), num_points, num_vectors, [&](const char* impl_name) {
+                        volk_gnsssdr_8ic_32f_resampler_rotator_dot_prod_32fc_xn_manual(corr_out.data(), sig_in_8sc.data(), phase_step_rad, &phase_rad, codes.data(), rem_code_phase_chips, code_phase_step_chips, 0.0F, shifts.data(), code_length_chips, n_vectors_max, num_points, impl_name);
+                    });
+                }
+            else
+                {
+                    volk_gnsssdr_tune_kernel("volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn", volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn_get_func_desc(), num_points, num_vectors, [&](const char* impl_name) {
+                        volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn_manual(corr_out.data(), sig_in.data(), phase_step_rad, &phase_rad, codes.data(), rem_code_phase_chips, code_phase_step_chips, 0.0F, shifts.data(), code_length_chips, n_vectors_max, num_points, impl_name);
+                    });
+                }
+            return;
+        }
+
+    // Two-stage path, with both codes in the same rotator call. The high dynamics rotator only has a generic implementation.
+    allocate_resampled_codes(n_vectors_max);
+    const auto num_vectors = static_cast<unsigned int>(d_n_correlators);
+    if (d_use_high_dynamics_resampler)
+        {
+            volk_gnsssdr_tune_kernel("volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn", volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn_get_func_desc(), num_points, num_vectors, [&](const char* impl_name) {
+                volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn_manual(d_local_codes_resampled, code.data(), rem_code_phase_chips, code_phase_step_chips, 0.0F, shifts.data(), code_length_chips, d_n_correlators, num_points, impl_name);
+            });
+        }
+    else
+        {
+            volk_gnsssdr_tune_kernel("volk_gnsssdr_32f_xn_resampler_32f_xn", volk_gnsssdr_32f_xn_resampler_32f_xn_get_func_desc(), num_points, num_vectors, [&](const char* impl_name) {
+                volk_gnsssdr_32f_xn_resampler_32f_xn_manual(d_local_codes_resampled, code.data(), rem_code_phase_chips, code_phase_step_chips, shifts.data(), code_length_chips, d_n_correlators, num_points, impl_name);
+            });
+            volk_gnsssdr_tune_kernel("volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn", volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_get_func_desc(), num_points, static_cast<unsigned int>(n_vectors_max), [&](const char* impl_name) {
+                volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_manual(corr_out.data(), sig_in.data(), phase_inc, &phase, const_cast<const float**>(d_local_codes_resampled), n_vectors_max, num_points, impl_name);
+            });
+        }
+}
+
+
 void Cpu_Multicorrelator_Real_Codes::update_local_code(int correlator_length_samples, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips)
 {
+    // The data code taps, if any, are resampled after the main code taps
     if (d_use_high_dynamics_resampler)
         {
             volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn(d_local_codes_resampled,
@@ -100,6 +409,18 @@ void Cpu_Multicorrelator_Real_Codes::update_local_code(int correlator_length_sam
                 d_code_length_chips,
                 d_n_correlators,
                 correlator_length_samples);
+            if (d_n_data_correlators > 0)
+                {
+                    volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn(d_local_codes_resampled + d_n_correlators,
+                        d_data_code_in,
+                        rem_code_phase_chips,
+                        code_phase_step_chips,
+                        code_phase_rate_step_chips,
+                        d_data_shifts_chips,
+                        d_code_length_chips,
+                        d_n_data_correlators,
+                        correlator_length_samples);
+                }
         }
     else
         {
@@ -111,50 +432,91 @@ void Cpu_Multicorrelator_Real_Codes::update_local_code(int correlator_length_sam
                 d_code_length_chips,
                 d_n_correlators,
                 correlator_length_samples);
+            if (d_n_data_correlators > 0)
+                {
+                    volk_gnsssdr_32f_xn_resampler_32f_xn(d_local_codes_resampled + d_n_correlators,
+                        d_data_code_in,
+                        rem_code_phase_chips,
+                        code_phase_step_chips,
+                        d_data_shifts_chips,
+                        d_code_length_chips,
+                        d_n_data_correlators,
+                        correlator_length_samples);
+                }
         }
 }
 
 
 bool Cpu_Multicorrelator_Real_Codes::Carrier_wipeoff_multicorrelator_resampler(
-    float rem_carrier_phase_in_rad,
-    float phase_step_rad,
+    double rem_carrier_phase_in_rad,
+    double phase_step_rad,
     float phase_rate_step_rad,
     float rem_code_phase_chips,
     float code_phase_step_chips,
     float code_phase_rate_step_chips,
     int signal_length_samples)
 {
-    update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
+    if (d_use_packed_codes and d_local_code_is_binary and (d_n_data_correlators == 0 or d_data_code_is_binary) and !d_use_high_dynamics_resampler)
+        {
+            double phase_rad = -rem_carrier_phase_in_rad;
+            packed_multicorrelator(-phase_step_rad, &phase_rad, rem_code_phase_chips, code_phase_step_chips, signal_length_samples);
+            return true;
+        }
+    if (d_use_fused_resampler and !d_use_high_dynamics_resampler)
+        {
+            // The fused kernels keep the carrier phase in a fixed point NCO, so it is passed in radians
+            double phase_rad = -rem_carrier_phase_in_rad;
+            fused_multicorrelator(-phase_step_rad, &phase_rad, rem_code_phase_chips, code_phase_step_chips, signal_length_samples);
+            return true;
+        }
     // Regenerate phase at each call in order to avoid numerical issues
     lv_32fc_t phase_offset_as_complex[1];
-    phase_offset_as_complex[0] = lv_cmake(std::cos(rem_carrier_phase_in_rad), -std::sin(rem_carrier_phase_in_rad));
-    // call VOLK_GNSSSDR kernel
+    phase_offset_as_complex[0] = lv_cmake(static_cast<float>(std::cos(rem_carrier_phase_in_rad)), static_cast<float>(-std::sin(rem_carrier_phase_in_rad)));
+    update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
+    const std::complex<float>* sig_in = float_input(signal_length_samples);
+    // call VOLK_GNSSSDR kernel, with the main and the data code taps in the same pass
     if (d_use_high_dynamics_resampler)
         {
-            volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), std::exp(lv_32fc_t(0.0, -phase_rate_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+            volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn(shared_corr_out(), sig_in, std::exp(lv_32fc_t(0.0, static_cast<float>(-phase_step_rad))), std::exp(lv_32fc_t(0.0, -phase_rate_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators + d_n_data_correlators, signal_length_samples);
         }
     else
         {
-            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(shared_corr_out(), sig_in, std::exp(lv_32fc_t(0.0, static_cast<float>(-phase_step_rad))), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators + d_n_data_correlators, signal_length_samples);
         }
+    split_shared_corr_out();
     return true;
 }
 
 
 bool Cpu_Multicorrelator_Real_Codes::Carrier_wipeoff_multicorrelator_resampler(
-    float rem_carrier_phase_in_rad,
-    float phase_step_rad,
+    double rem_carrier_phase_in_rad,
+    double phase_step_rad,
     float rem_code_phase_chips,
     float code_phase_step_chips,
     float code_phase_rate_step_chips,
     int signal_length_samples)
 {
-    update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
+    if (d_use_packed_codes and d_local_code_is_binary and (d_n_data_correlators == 0 or d_data_code_is_binary) and !d_use_high_dynamics_resampler)
+        {
+            double phase_rad = -rem_carrier_phase_in_rad;
+            packed_multicorrelator(-phase_step_rad, &phase_rad, rem_code_phase_chips, code_phase_step_chips, signal_length_samples);
+            return true;
+        }
+    if (d_use_fused_resampler and !d_use_high_dynamics_resampler)
+        {
+            // The fused kernels keep the carrier phase in a fixed point NCO, so it is passed in radians
+            double phase_rad = -rem_carrier_phase_in_rad;
+            fused_multicorrelator(-phase_step_rad, &phase_rad, rem_code_phase_chips, code_phase_step_chips, signal_length_samples);
+            return true;
+        }
     // Regenerate phase at each call in order to avoid numerical issues
     lv_32fc_t phase_offset_as_complex[1];
-    phase_offset_as_complex[0] = lv_cmake(std::cos(rem_carrier_phase_in_rad), -std::sin(rem_carrier_phase_in_rad));
-    // call VOLK_GNSSSDR kernel
-    volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(d_corr_out, d_sig_in, std::exp(lv_32fc_t(0.0, -phase_step_rad)), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators, signal_length_samples);
+    phase_offset_as_complex[0] = lv_cmake(static_cast<float>(std::cos(rem_carrier_phase_in_rad)), static_cast<float>(-std::sin(rem_carrier_phase_in_rad)));
+    update_local_code(signal_length_samples, rem_code_phase_chips, code_phase_step_chips, code_phase_rate_step_chips);
+    const std::complex<float>* sig_in = float_input(signal_length_samples);
+    // call VOLK_GNSSSDR kernel, with the main and the data code taps in the same pass
+    volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn(shared_corr_out(), sig_in, std::exp(lv_32fc_t(0.0, static_cast<float>(-phase_step_rad))), phase_offset_as_complex, const_cast<const float**>(d_local_codes_resampled), d_n_correlators + d_n_data_correlators, signal_length_samples);
+    split_shared_corr_out();
     return true;
 }
 
@@ -164,12 +526,23 @@ bool Cpu_Multicorrelator_Real_Codes::free()
     // Free memory
     if (d_local_codes_resampled != nullptr)
         {
-            for (int n = 0; n < d_n_correlators; n++)
+            for (int n = 0; n < d_n_resampled_codes; n++)
                 {
                     volk_gnsssdr_free(d_local_codes_resampled[n]);
                 }
             volk_gnsssdr_free(d_local_codes_resampled);
             d_local_codes_resampled = nullptr;
+            d_n_resampled_codes = 0;
+        }
+    if (d_shared_corr_out != nullptr)
+        {
+            volk_gnsssdr_free(d_shared_corr_out);
+            d_shared_corr_out = nullptr;
+        }
+    if (d_sig_in_widened != nullptr)
+        {
+            volk_gnsssdr_free(d_sig_in_widened);
+            d_sig_in_widened = nullptr;
         }
     return true;
 }
@@ -180,3 +553,19 @@ void Cpu_Multicorrelator_Real_Codes::set_high_dynamics_resampler(
 {
     d_use_high_dynamics_resampler = use_high_dynamics_resampler;
 }
+
+
+void Cpu_Multicorrelator_Real_Codes::set_fused_resampler(
+    bool use_fused_resampler)
+{
+    d_use_fused_resampler = use_fused_resampler;
+}
+
+
+void Cpu_Multicorrelator_Real_Codes::set_packed_codes(
+    bool use_packed_codes,
+    float code_phase_resolution_chips)
+{
+    d_use_packed_codes = use_packed_codes;
+    d_code_phase_resolution_chips = code_phase_resolution_chips;
+}
@@ -26,7 +26,11 @@
 #define GNSS_SDR_CPU_MULTICORRELATOR_REAL_CODES_H
 
 
+#include "packed_code_replica_cache.h"
 #include <complex>
+#include <cstdint>
+#include <string>
+#include <vector>
 
 /*!
  * \brief Class that implements carrier wipe-off and correlators.
@@ -36,25 +40,65 @@ class Cpu_Multicorrelator_Real_Codes
 public:
     Cpu_Multicorrelator_Real_Codes();
     void set_high_dynamics_resampler(bool use_high_dynamics_resampler);
+    void set_fused_resampler(bool use_fused_resampler);
+    // Correlates against cached 1-bit replicas when the local code is binary, see Packed_Code_Replica_Cache
+    void set_packed_codes(bool use_packed_codes, float code_phase_resolution_chips = 1.0F / 64.0F);
     ~Cpu_Multicorrelator_Real_Codes();
     bool init(int max_signal_length_samples, int n_correlators);
     bool set_local_code_and_taps(int code_length_chips, const float *local_code_in, float *shifts_chips);
+    // Correlates a second code of the same length (e.g. the data component of a pilot+data signal) with its own taps and output.
+    // Call it after set_local_code_and_taps(). Both codes are correlated in the same pass, so the carrier wipe-off is done once.
+    bool set_data_local_code_and_taps(const float *data_code_in, float *data_shifts_chips, int n_data_correlators, std::complex<float> *data_corr_out);
     bool set_input_output_vectors(std::complex<float> *corr_out, const std::complex<float> *sig_in);
+    bool set_input_output_vectors(std::complex<float> *corr_out, const std::complex<int16_t> *sig_in);
+    bool set_input_output_vectors(std::complex<float> *corr_out, const std::complex<int8_t> *sig_in);
+    // Calibrates the kernels used for this number of samples and taps, see volk_gnsssdr_tune_kernel(). Call it after init().
+    void tune_kernels(int signal_length_samples, const std::string &item_type, int n_data_correlators = 0);
     void update_local_code(int correlator_length_samples, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips = 0.0);
-    bool Carrier_wipeoff_multicorrelator_resampler(float rem_carrier_phase_in_rad, float phase_step_rad, float phase_rate_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
-    bool Carrier_wipeoff_multicorrelator_resampler(float rem_carrier_phase_in_rad, float phase_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
+    bool Carrier_wipeoff_multicorrelator_resampler(double rem_carrier_phase_in_rad, double phase_step_rad, float phase_rate_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
+    bool Carrier_wipeoff_multicorrelator_resampler(double rem_carrier_phase_in_rad, double phase_step_rad, float rem_code_phase_chips, float code_phase_step_chips, float code_phase_rate_step_chips, int signal_length_samples);
     bool free();
 
 private:
+    void fused_multicorrelator(double phase_step_rad, double *phase_rad, float rem_code_phase_chips, float code_phase_step_chips, int signal_length_samples);
+    void packed_multicorrelator(double phase_step_rad, double *phase_rad, float rem_code_phase_chips, float code_phase_step_chips, int signal_length_samples);
+    Packed_Code_Replica_Cache::Replicas packed_replicas(const float *local_code_in, uint64_t local_code_hash, float *shifts_chips, int n_correlators, float rem_code_phase_chips, float code_phase_step_chips, int signal_length_samples);
+    void allocate_resampled_codes(int n_codes);
+    std::complex<float> *shared_corr_out();
+    void split_shared_corr_out();
+    const std::complex<float> *float_input(int signal_length_samples);
+
     // Allocate the device input vectors
     const std::complex<float> *d_sig_in;
+    const std::complex<int16_t> *d_sig_in_16sc;  // integer inputs are only widened to float inside the kernels
+    const std::complex<int8_t> *d_sig_in_8sc;
+    std::complex<float> *d_sig_in_widened;  // widened integer input for the high dynamics path
     const float *d_local_code_in;
     std::complex<float> *d_corr_out;
-    float **d_local_codes_resampled;
+    float **d_local_codes_resampled;  // the main code taps, followed by the data code taps
     float *d_shifts_chips;
+    const float *d_data_code_in;
+    float *d_data_shifts_chips;
+    std::complex<float> *d_data_corr_out;
+    std::complex<float> *d_shared_corr_out;  // outputs of the passes that correlate both codes
     int d_code_length_chips;
     int d_n_correlators;
+    int d_n_data_correlators;
+    int d_n_resampled_codes;
+    int d_max_signal_length_samples;
     bool d_use_high_dynamics_resampler;
+    bool d_use_fused_resampler;  // without high dynamics, resample the code inside the dot product instead of into d_local_codes_resampled
+    bool d_use_packed_codes;
+    bool d_local_code_is_binary;  // all the chips are +1 or -1
+    bool d_data_code_is_binary;
+    uint64_t d_local_code_hash;
+    uint64_t d_data_code_hash;
+    float d_code_phase_resolution_chips;  // quantization of the code phase and of its advance over a span
+    Packed_Code_Replica_Cache::Replicas d_packed_replicas;  // keep the entries in use alive if evicted
+    Packed_Code_Replica_Cache::Replicas d_packed_data_replicas;
+    std::vector<const uint32_t *> d_packed_replica_ptrs;
+    std::vector<const float *> d_fused_local_codes;  // the code of each tap of the fused kernels
+    std::vector<float> d_fused_shifts_chips;
 };
 
 
@@ -28,6 +28,8 @@ Dll_Pll_Conf::Dll_Pll_Conf()
 {
     /* DLL/PLL tracking configuration */
     high_dyn = false;
+    packed_codes = false;
+    kernel_autotuning = false;
     smoother_length = 10;
     fs_in = 2000000.0;
     vector_length = 0U;
@@ -85,10 +87,17 @@ void Dll_Pll_Conf::SetFromConfiguration(const ConfigurationInterface *configurat
             LOG(WARNING) << "Unknown item type: " + item_type << ". Set to gr_complex";
             item_type = "gr_complex";
         }
+    else if (item_type != "gr_complex" and item_type != "cshort" and item_type != "cbyte")
+        {
+            LOG(WARNING) << "Item type " + item_type << " not supported by tracking. Set to gr_complex";
+            item_type = "gr_complex";
+        }
 
     double fs_in_deprecated = configuration->property("GNSS-SDR.internal_fs_hz", fs_in);
     fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
     high_dyn = configuration->property(role + ".high_dyn", high_dyn);
+    packed_codes = configuration->property(role + ".packed_codes", packed_codes);
+    kernel_autotuning = configuration->property(role + ".kernel_autotuning", kernel_autotuning);
     dump = configuration->property(role + ".dump", dump);
     dump_filename = configuration->property(role + ".dump_filename", dump_filename);
     dump_mat = configuration->property(role + ".dump_mat", dump_mat);
@@ -75,6 +75,12 @@ public:
     bool enable_doppler_correction;
     bool carrier_aiding;
     bool high_dyn;
+    bool packed_codes;
+    // Calibrate the correlator kernels for this block's call shapes when it is built.
+    // volk_gnsssdr_rank_archs_by_shape() reads volk_gnsssdr_shape_config once per
+    // process, at the first init of any kernel, so later calibrations only apply
+    // from the next run
+    bool kernel_autotuning;
     bool dump;
     bool dump_mat;
 };
@@ -0,0 +1,126 @@
+/*!
+ * \file packed_code_replica_cache.cc
+ * \brief Process-wide cache of resampled local code replicas packed one bit
+ * per sample, shared by all the bit-wise correlators.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "packed_code_replica_cache.h"
+#include <cstring>  // for memcpy
+
+
+namespace
+{
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+uint64_t fnv1a(uint64_t hash, uint64_t value)
+{
+    for (int i = 0; i < 8; i++)
+        {
+            hash ^= (value >> (8 * i)) & 0xFFU;
+            hash *= FNV_PRIME;
+        }
+    return hash;
+}
+}  // namespace
+
+
+size_t Packed_Code_Replica_Key_Hash::operator()(const Packed_Code_Replica_Key& key) const
+{
+    uint64_t hash = fnv1a(FNV_OFFSET_BASIS, key.code_hash);
+    hash = fnv1a(hash, key.shifts_hash);
+    hash = fnv1a(hash, static_cast<uint64_t>(key.code_phase_q));
+    hash = fnv1a(hash, static_cast<uint64_t>(key.code_advance_q));
+    hash = fnv1a(hash, (static_cast<uint64_t>(static_cast<uint32_t>(key.num_samples)) << 32) | static_cast<uint32_t>(key.num_taps));
+    return static_cast<size_t>(hash);
+}
+
+
+Packed_Code_Replica_Cache& Packed_Code_Replica_Cache::instance()
+{
+    static Packed_Code_Replica_Cache cache;
+    return cache;
+}
+
+
+Packed_Code_Replica_Cache::Replicas Packed_Code_Replica_Cache::get(const Packed_Code_Replica_Key& key, const std::function<void(std::vector<uint32_t>&)>& generate)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        const auto it = d_entries.find(key);
+        if (it != d_entries.end())
+            {
+                return it->second;
+            }
+    }
+
+    // Misses are generated out of the lock, so that other channels are not stalled
+    auto replicas = std::make_shared<std::vector<uint32_t>>();
+    generate(*replicas);
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    const auto inserted = d_entries.emplace(key, replicas);
+    if (inserted.second)
+        {
+            d_insertion_order.push_back(key);
+            while (d_entries.size() > d_max_entries)
+                {
+                    d_entries.erase(d_insertion_order.front());
+                    d_insertion_order.pop_front();
+                }
+        }
+    return inserted.first->second;
+}
+
+
+void Packed_Code_Replica_Cache::set_max_entries(size_t max_entries)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_max_entries = max_entries > 0 ? max_entries : 1;
+    while (d_entries.size() > d_max_entries)
+        {
+            d_entries.erase(d_insertion_order.front());
+            d_insertion_order.pop_front();
+        }
+}
+
+
+void Packed_Code_Replica_Cache::clear()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_entries.clear();
+    d_insertion_order.clear();
+}
+
+
+size_t Packed_Code_Replica_Cache::size() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_entries.size();
+}
+
+
+uint64_t Packed_Code_Replica_Cache::hash_values(const float* values, int n)
+{
+    uint64_t hash = fnv1a(FNV_OFFSET_BASIS, static_cast<uint64_t>(n));
+    for (int i = 0; i < n; i++)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &values[i], sizeof(bits));
+            hash = fnv1a(hash, bits);
+        }
+    return hash;
+}
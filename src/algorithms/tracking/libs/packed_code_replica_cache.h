@@ -0,0 +1,96 @@
+/*!
+ * \file packed_code_replica_cache.h
+ * \brief Process-wide cache of resampled local code replicas packed one bit
+ * per sample, shared by all the bit-wise correlators.
+ *
+ * Between loop updates the code rate is constant, so the resampled replicas
+ * only depend on the code, the taps, the initial code phase and the code rate.
+ * Quantizing the last two makes the replicas repeat across epochs and across
+ * the channels tracking the same signal.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PACKED_CODE_REPLICA_CACHE_H
+#define GNSS_SDR_PACKED_CODE_REPLICA_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/*!
+ * \brief Identifies a set of packed replicas.
+ */
+struct Packed_Code_Replica_Key
+{
+    uint64_t code_hash;        // hash of the local code values and length
+    uint64_t shifts_hash;      // hash of the tap shifts
+    int64_t code_phase_q;      // initial code phase, in quantization steps
+    int64_t code_advance_q;    // code phase advance over the span, in quantization steps
+    int32_t num_samples;
+    int32_t num_taps;
+
+    bool operator==(const Packed_Code_Replica_Key& other) const
+    {
+        return code_hash == other.code_hash and shifts_hash == other.shifts_hash and code_phase_q == other.code_phase_q and code_advance_q == other.code_advance_q and num_samples == other.num_samples and num_taps == other.num_taps;
+    }
+};
+
+
+struct Packed_Code_Replica_Key_Hash
+{
+    size_t operator()(const Packed_Code_Replica_Key& key) const;
+};
+
+
+/*!
+ * \brief Thread-safe cache of packed replicas. Each entry holds num_taps
+ * replicas of (num_samples + 31) / 32 words, one after the other, where bit
+ * n % 32 of word n / 32 is set when the code is negative at sample n.
+ * When full, the oldest entries are evicted.
+ */
+class Packed_Code_Replica_Cache
+{
+public:
+    static Packed_Code_Replica_Cache& instance();  //!< The cache shared by all the correlators
+
+    using Replicas = std::shared_ptr<const std::vector<uint32_t>>;
+
+    /*!
+     * \brief Returns the replicas for \p key, calling \p generate to build
+     * them on a miss. Entries stay valid while referenced, even if evicted.
+     */
+    Replicas get(const Packed_Code_Replica_Key& key, const std::function<void(std::vector<uint32_t>&)>& generate);
+
+    void set_max_entries(size_t max_entries);  //!< Default value: 4096
+    void clear();
+    size_t size() const;
+
+    static uint64_t hash_values(const float* values, int n);  //!< FNV-1a hash of an array of floats
+
+private:
+    Packed_Code_Replica_Cache() = default;
+
+    mutable std::mutex d_mutex;
+    std::unordered_map<Packed_Code_Replica_Key, Replicas, Packed_Code_Replica_Key_Hash> d_entries;
+    std::deque<Packed_Code_Replica_Key> d_insertion_order;
+    size_t d_max_entries = 4096;
+};
+
+#endif  // GNSS_SDR_PACKED_CODE_REPLICA_CACHE_H
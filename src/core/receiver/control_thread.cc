@@ -47,6 +47,7 @@
 #include "gps_iono.h"              // for Gps_Iono
 #include "gps_utc_model.h"         // for Gps_Utc_Model
 #include "pvt_interface.h"         // for PvtInterface
+#include "replay_clock.h"          // for Replay_Clock
 #include "rtklib.h"                // for gtime_t, alm_t
 #include "rtklib_conversions.h"    // for alm_to_rtklib
 #include "rtklib_ephemeris.h"      // for alm2pos, eph2pos
@@ -55,6 +56,7 @@
 #include <boost/lexical_cast.hpp>  // for bad_lexical_cast
 #include <glog/logging.h>          // for LOG
 #include <pmt/pmt.h>               // for make_any
+#include <volk_gnsssdr/volk_gnsssdr.h>
 #include <algorithm>               // for find, min
 #include <chrono>                  // for milliseconds
 #include <cmath>                   // for floor, fmod, log
@@ -67,6 +69,7 @@
 #include <stdexcept>               // for invalid_argument
 #include <sys/ipc.h>               // for IPC_CREAT
 #include <sys/msg.h>               // for msgctl, msgget
+#include <vector>                  // for vector
 
 #ifdef ENABLE_FPGA
 #include <boost/chrono.hpp>  // for steady_clock
@@ -107,6 +110,27 @@ void ControlThread::init()
     // Instantiates a control queue, a GNSS flowgraph, and a control message factory
     control_queue_ = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
     cmd_interface_.set_msg_queue(control_queue_);  // set also the queue pointer for the telecommand thread
+    // OPTIONAL: order the receiver events by sample counter, so the processing of files is reproducible
+    // (it has to be enabled before the blocks are created)
+    if (configuration_->property("GNSS-SDR.deterministic_replay", false))
+        {
+            Replay_Clock::get().enable(configuration_->property("GNSS-SDR.replay_epoch_ms", 10.0) / 1000.0, 0.1);
+        }
+    // OPTIONAL: serve the large volk_gnsssdr::vector buffers from huge pages ("transparent" or "explicit")
+    // (it has to be set before the blocks are created)
+    const std::string huge_pages = configuration_->property("GNSS-SDR.huge_pages", std::string("off"));
+    if (huge_pages == "transparent")
+        {
+            volk_gnsssdr_set_page_mode(VOLK_GNSSSDR_PAGES_TRANSPARENT_HUGE);
+        }
+    else if (huge_pages == "explicit")
+        {
+            volk_gnsssdr_set_page_mode(VOLK_GNSSSDR_PAGES_EXPLICIT_HUGE);
+        }
+    else if (huge_pages != "off")
+        {
+            LOG(WARNING) << "Unknown GNSS-SDR.huge_pages value " << huge_pages << ", valid values are off, transparent and explicit";
+        }
     try
         {
             flowgraph_ = std::make_shared<GNSSFlowgraph>(configuration_, control_queue_);
@@ -240,6 +264,7 @@ void ControlThread::event_dispatcher(bool &valid_event, pmt::pmt_t &msg)
                                        << " what: " << new_event->event_type;
                             flowgraph_->apply_action(new_event->channel_id, new_event->event_type);
                         }
+                    Replay_Clock::get().event_handled();
                 }
             else if (msg_type_hash_code == command_event_type_hash_code_)
                 {
@@ -267,9 +292,9 @@ void ControlThread::event_dispatcher(bool &valid_event, pmt::pmt_t &msg)
         }
     else
         {
-            if (receiver_on_standby_ == false)
+            if (receiver_on_standby_ == false and !Replay_Clock::get().enabled())
                 {
-                    // perform non-priority tasks
+                    // perform non-priority tasks (in deterministic replays, on the ticks of the replay clock)
                     flowgraph_->acquisition_manager(0);  // start acquisition of untracked satellites
                 }
         }
@@ -333,6 +358,18 @@ int ControlThread::run()
     fpga_helper_thread_ = boost::thread(&GNSSFlowgraph::start_acquisition_helper,
         flowgraph_);
 #endif
+    std::thread flowgraph_wait_thread;
+    if (Replay_Clock::get().enabled())
+        {
+            // the receiver stops when all the samples have gone through the flowgraph
+            flowgraph_wait_thread = std::thread([this] { flowgraph_->wait(); });
+            Replay_Clock::get().start([this] {
+                if (receiver_on_standby_ == false)
+                    {
+                        flowgraph_->acquisition_manager(0);
+                    }
+            });
+        }
     // Main loop to read and process the control messages
     pmt::pmt_t msg;
     while (flowgraph_->running() && !stop_)
@@ -343,7 +380,12 @@ int ControlThread::run()
             event_dispatcher(valid_event, msg);
         }
     std::cout << "Stopping GNSS-SDR, please wait!\n";
+    Replay_Clock::get().stop();  // release the blocks waiting for the end of an epoch
     flowgraph_->stop();
+    if (flowgraph_wait_thread.joinable())
+        {
+            flowgraph_wait_thread.join();
+        }
     stop_ = true;
     flowgraph_->disconnect();
 
@@ -373,6 +415,7 @@ int ControlThread::run()
         }
 
     LOG(INFO) << "Flowgraph stopped";
+    log_allocated_bytes();
 
     if (restart_)
         {
@@ -383,6 +426,19 @@ int ControlThread::run()
 }
 
 
+void ControlThread::log_allocated_bytes() const
+{
+    std::vector<volk_gnsssdr_alloc_stats_t> stats(volk_gnsssdr_get_alloc_stats(nullptr, 0));
+    stats.resize(volk_gnsssdr_get_alloc_stats(stats.data(), stats.size()));
+    for (const auto &s : stats)
+        {
+            LOG(INFO) << "Large volk_gnsssdr allocations of " << s.subsystem << ": "
+                      << s.bytes << " bytes (" << s.huge_page_bytes << " in huge pages) in "
+                      << s.allocations << " buffers, peak " << s.peak_bytes << " bytes";
+        }
+}
+
+
 void ControlThread::set_control_queue(std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue)
 {
     if (flowgraph_->running())
@@ -146,6 +146,11 @@ private:
      */
     void assist_GNSS();
 
+    /*
+     * Logs the large volk_gnsssdr allocations of each subsystem
+     */
+    void log_allocated_bytes() const;
+
     void telecommand_listener();
     void keyboard_listener();
     void sysv_queue_listener();
@@ -38,6 +38,7 @@
 #include "beidou_b3i_telemetry_decoder.h"
 #include "byte_to_short.h"
 #include "channel.h"
+#include "channelizer_filter.h"
 #include "configuration_interface.h"
 #include "direct_resampler_conditioner.h"
 #include "file_signal_source.h"
@@ -109,6 +110,7 @@
 #include "two_bit_cpx_file_signal_source.h"
 #include "two_bit_packed_file_signal_source.h"
 #include <glog/logging.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
 #include <exception>  // for exception
 #include <utility>    // for move
 
@@ -189,6 +191,7 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetSignalSource(
         }
     std::string implementation = configuration->property(role + ".implementation", empty_implementation);
     LOG(INFO) << "Getting SignalSource with implementation " << implementation;
+    volk_gnsssdr::alloc_subsystem_scope subsystem("SignalSource");
     return GetBlock(configuration, role, 0, 1, queue);
 }
 
@@ -239,6 +242,7 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetSignalConditioner(
               << input_filter << ", and Resampler implementation: "
               << resampler;
 
+    volk_gnsssdr::alloc_subsystem_scope subsystem("SignalConditioner");
     if (signal_conditioner == "Array_Signal_Conditioner")
         {
             // instantiate the array version
@@ -276,6 +280,7 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetObservables(const Confi
     unsigned int Beidou_channels = configuration->property("Channels_B1.count", 0);
     Beidou_channels += configuration->property("Channels_B3.count", 0);
     unsigned int extra_channels = 1;  // For monitor channel sample counter
+    volk_gnsssdr::alloc_subsystem_scope subsystem("Observables");
     return GetBlock(configuration, "Observables",
         Galileo_channels +
             GPS_channels +
@@ -304,6 +309,7 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetPVT(const Configuration
     Glonass_channels += configuration->property("Channels_2G.count", 0);
     unsigned int Beidou_channels = configuration->property("Channels_B1.count", 0);
     Beidou_channels += configuration->property("Channels_B3.count", 0);
+    volk_gnsssdr::alloc_subsystem_scope subsystem("PVT");
     return GetBlock(configuration, "PVT",
         Galileo_channels + GPS_channels + Glonass_channels + Beidou_channels, 0);
 }
@@ -356,9 +362,14 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetChannel(
               << ", Telemetry Decoder implementation: "
               << configuration->property("TelemetryDecoder_" + signal + appendix3 + ".implementation", std::string("W"));
 
+    // the large buffers allocated by each block are accounted to its subsystem
+    volk_gnsssdr::alloc_subsystem_scope acq_subsystem("Acquisition");
     std::unique_ptr<AcquisitionInterface> acq_ = GetAcqBlock(configuration, "Acquisition_" + signal + appendix1, 1, 0);
+    volk_gnsssdr::alloc_subsystem_scope trk_subsystem("Tracking");
     std::unique_ptr<TrackingInterface> trk_ = GetTrkBlock(configuration, "Tracking_" + signal + appendix2, 1, 1);
+    volk_gnsssdr::alloc_subsystem_scope tlm_subsystem("TelemetryDecoder");
     std::unique_ptr<TelemetryDecoderInterface> tlm_ = GetTlmBlock(configuration, "TelemetryDecoder_" + signal + appendix3, 1, 1);
+    volk_gnsssdr::alloc_subsystem_scope channel_subsystem("Channel");
 
     std::unique_ptr<GNSSBlockInterface> channel_ = std::make_unique<Channel>(configuration, channel,
         std::move(acq_),
@@ -863,6 +874,12 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetBlock(
                 out_streams);
             block = std::move(block_);
         }
+    else if (implementation == "Channelizer_Filter")
+        {
+            std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<ChannelizerFilter>(configuration, role, in_streams,
+                out_streams);
+            block = std::move(block_);
+        }
 
     // RESAMPLER ---------------------------------------------------------------
     else if (implementation == "Direct_Resampler")
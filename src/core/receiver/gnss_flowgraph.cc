@@ -23,12 +23,17 @@
  */
 
 #include "gnss_flowgraph.h"
+#include "Beidou_B1I.h"
+#include "Beidou_B3I.h"
+#include "GLONASS_L1_L2_CA.h"
 #include "GPS_L1_CA.h"
 #include "GPS_L2C.h"
 #include "GPS_L5.h"
 #include "Galileo_E1.h"
 #include "Galileo_E5a.h"
 #include "Galileo_E5b.h"
+#include "acq_conf.h"
+#include "capture_tap.h"
 #include "channel.h"
 #include "channel_fsm.h"
 #include "channel_interface.h"
@@ -47,7 +52,6 @@
 #include <gnuradio/top_block.h>      // for top_block, make_top_block
 #include <pmt/pmt_sugar.h>           // for mp
 #include <algorithm>                 // for transform, sort, unique
-#include <cmath>                     // for floor
 #include <cstddef>                   // for size_t
 #include <exception>                 // for exception
 #include <iostream>                  // for operator<<
@@ -234,6 +238,7 @@ void GNSSFlowgraph::connect()
                                 {
                                     std::cout << "connecting ch " << j << '\n';
                                     top_block_->connect(sig_source_.at(i)->get_right_block(), j, sig_conditioner_.at(i)->get_left_block(), j);
+                                    connect_capture_tap(i, j, sig_source_.at(i)->get_right_block(), j);
                                 }
                         }
                     else
@@ -256,6 +261,7 @@ void GNSSFlowgraph::connect()
                                                 {
                                                     LOG(INFO) << "connecting sig_source_ " << i << " stream " << j << " to conditioner " << j;
                                                     top_block_->connect(sig_source_.at(i)->get_right_block(), j, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), 0);
+                                                    connect_capture_tap(i, j, sig_source_.at(i)->get_right_block(), j);
                                                 }
                                         }
                                     else
@@ -265,12 +271,14 @@ void GNSSFlowgraph::connect()
                                                     // RF_channel 0 backward compatibility with single channel sources
                                                     LOG(INFO) << "connecting sig_source_ " << i << " stream " << 0 << " to conditioner " << j;
                                                     top_block_->connect(sig_source_.at(i)->get_right_block(), 0, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), 0);
+                                                    connect_capture_tap(i, j, sig_source_.at(i)->get_right_block(), 0);
                                                 }
                                             else
                                                 {
                                                     // Multiple channel sources using multiple output blocks of single channel (requires RF_channel selector in call)
                                                     LOG(INFO) << "connecting sig_source_ " << i << " stream " << j << " to conditioner " << j;
                                                     top_block_->connect(sig_source_.at(i)->get_right_block(j), 0, sig_conditioner_.at(signal_conditioner_ID)->get_left_block(), 0);
+                                                    connect_capture_tap(i, j, sig_source_.at(i)->get_right_block(j), 0);
                                                 }
                                         }
                                     signal_conditioner_ID++;
@@ -367,16 +375,20 @@ void GNSSFlowgraph::connect()
 #endif
 
     // Signal conditioner (selected_signal_source) >> channels (i) (dependent of their associated SignalSource_ID)
-    std::vector<bool> signal_conditioner_connected;
+    // (a signal conditioner can have several outputs, one per sub-band, selected by ChannelN.sub_band)
+    std::vector<std::vector<bool>> signal_conditioner_connected;
     signal_conditioner_connected.reserve(sig_conditioner_.size());
     for (size_t n = 0; n < sig_conditioner_.size(); n++)
         {
-            signal_conditioner_connected.push_back(false);
+            const gr::basic_block_sptr right_block = sig_conditioner_.at(n)->get_right_block();
+            const int outputs = right_block ? right_block->output_signature()->max_streams() : 1;
+            signal_conditioner_connected.emplace_back(std::max(outputs, 1), false);
         }
     for (int i = 0; i < channels_count_; i++)
         {
 #ifndef ENABLE_FPGA
             int selected_signal_conditioner_ID = 0;
+            int sub_band = 0;
             const bool use_acq_resampler = configuration_->property("GNSS-SDR.use_acquisition_resampler", false);
             const uint32_t fs = configuration_->property("GNSS-SDR.internal_fs_sps", 0);
             if (configuration_->property(sig_source_.at(0)->role() + ".enable_FPGA", false) == false)
@@ -384,6 +396,7 @@ void GNSSFlowgraph::connect()
                     try
                         {
                             selected_signal_conditioner_ID = configuration_->property("Channel" + std::to_string(i) + ".RF_channel_ID", 0);
+                            sub_band = configuration_->property("Channel" + std::to_string(i) + ".sub_band", 0);
                         }
                     catch (const std::exception& e)
                         {
@@ -395,7 +408,6 @@ void GNSSFlowgraph::connect()
                             if (use_acq_resampler == true)
                                 {
                                     // create acquisition resamplers if required
-                                    double resampler_ratio = 1.0;
                                     double acq_fs = fs;
                                     // find the signal associated to this channel
                                     switch (mapStringValues_[channels_.at(i)->implementation()])
@@ -422,82 +434,85 @@ void GNSSFlowgraph::connect()
                                             acq_fs = GALILEO_E5B_OPT_ACQ_FS_SPS;
                                             break;
                                         case evGLO_1G:
+                                            acq_fs = GLONASS_L1_CA_OPT_ACQ_FS_SPS;
+                                            break;
                                         case evGLO_2G:
+                                            acq_fs = GLONASS_L2_CA_OPT_ACQ_FS_SPS;
+                                            break;
                                         case evBDS_B1:
+                                            acq_fs = BEIDOU_B1I_OPT_ACQ_FS_SPS;
+                                            break;
                                         case evBDS_B3:
-                                            acq_fs = fs;
+                                            acq_fs = BEIDOU_B3I_OPT_ACQ_FS_SPS;
                                             break;
                                         default:
                                             break;
                                         }
 
-                                    if (acq_fs < fs)
+                                    // the target rate can be set for each signal, and must be the one the acquisition block expects
+                                    const std::string acq_role = "Acquisition_" + channels_.at(i)->implementation();
+                                    const std::string acq_channel_role = acq_role + std::to_string(i);
+                                    if (configuration_->property(acq_channel_role + ".implementation", std::string("W")) != "W")
+                                        {
+                                            acq_fs = configuration_->property(acq_channel_role + ".resampler_fs_sps", acq_fs);
+                                        }
+                                    else
+                                        {
+                                            acq_fs = configuration_->property(acq_role + ".resampler_fs_sps", acq_fs);
+                                        }
+                                    const uint32_t decimation = acq_resampler_decimation(fs, acq_fs);
+
+                                    if (decimation > 1)
                                         {
-                                            // check if the resampler is already created for the channel system/signal and for the specific RF Channel
-                                            const std::string map_key = channels_.at(i)->implementation() + std::to_string(selected_signal_conditioner_ID);
-                                            resampler_ratio = static_cast<double>(fs) / acq_fs;
-                                            int decimation = floor(resampler_ratio);
-                                            while (fs % decimation > 0)
-                                                {
-                                                    decimation--;
-                                                };
                                             const double acq_fs_decimated = static_cast<double>(fs) / static_cast<double>(decimation);
+                                            // a single decimator per RF channel and rate, shared by the acquisition of all the signals of the band
+                                            const std::string map_key = std::to_string(selected_signal_conditioner_ID) + "/" + std::to_string(sub_band) + "/" + std::to_string(decimation);
 
-                                            if (decimation > 1)
-                                                {
-                                                    // create a FIR low pass filter
-                                                    std::vector<float> taps = gr::filter::firdes::low_pass(1.0,
-                                                        fs,
-                                                        acq_fs_decimated / 2.1,
-                                                        acq_fs_decimated / 2,
-                                                        gr::filter::firdes::win_type::WIN_HAMMING);
-
-                                                    gr::basic_block_sptr fir_filter_ccf_ = gr::filter::fir_filter_ccf::make(decimation, taps);
-
-                                                    std::pair<std::map<std::string, gr::basic_block_sptr>::iterator, bool> ret;
-                                                    ret = acq_resamplers_.insert(std::pair<std::string, gr::basic_block_sptr>(map_key, fir_filter_ccf_));
-                                                    if (ret.second == true)
-                                                        {
-                                                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
-                                                                acq_resamplers_.at(map_key), 0);
-                                                            LOG(INFO) << "Created "
-                                                                      << channels_.at(i)->implementation()
-                                                                      << " acquisition resampler for RF channel " << std::to_string(signal_conditioner_ID) << " with " << taps.size() << " taps and decimation factor of " << decimation;
-                                                        }
-                                                    else
-                                                        {
-                                                            LOG(INFO) << "Found existing "
-                                                                      << channels_.at(i)->implementation()
-                                                                      << " acquisition resampler for RF channel " << std::to_string(signal_conditioner_ID) << " with " << taps.size() << " taps and decimation factor of " << decimation;
-                                                        }
+                                            // create a FIR low pass filter
+                                            std::vector<float> taps = gr::filter::firdes::low_pass(1.0,
+                                                fs,
+                                                acq_fs_decimated / 2.1,
+                                                acq_fs_decimated / 2,
+                                                gr::filter::firdes::win_type::WIN_HAMMING);
 
-                                                    top_block_->connect(acq_resamplers_.at(map_key), 0,
-                                                        channels_.at(i)->get_left_block_acq(), 0);
+                                            gr::basic_block_sptr fir_filter_ccf_ = gr::filter::fir_filter_ccf::make(decimation, taps);
 
-                                                    std::shared_ptr<Channel> channel_ptr = std::dynamic_pointer_cast<Channel>(channels_.at(i));
-                                                    channel_ptr->acquisition()->set_resampler_latency((taps.size() - 1) / 2);
+                                            std::pair<std::map<std::string, gr::basic_block_sptr>::iterator, bool> ret;
+                                            ret = acq_resamplers_.insert(std::pair<std::string, gr::basic_block_sptr>(map_key, fir_filter_ccf_));
+                                            if (ret.second == true)
+                                                {
+                                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), sub_band,
+                                                        acq_resamplers_.at(map_key), 0);
+                                                    LOG(INFO) << "Created "
+                                                              << channels_.at(i)->implementation()
+                                                              << " acquisition resampler for RF channel " << std::to_string(selected_signal_conditioner_ID) << " with " << taps.size() << " taps and decimation factor of " << decimation;
                                                 }
                                             else
                                                 {
-                                                    LOG(INFO) << "Disabled acquisition resampler because the input sampling frequency is too low";
-                                                    // resampler not required!
-                                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
-                                                        channels_.at(i)->get_left_block_acq(), 0);
+                                                    LOG(INFO) << "Sharing the acquisition resampler of RF channel " << std::to_string(selected_signal_conditioner_ID)
+                                                              << " with decimation factor of " << decimation << " with a " << channels_.at(i)->implementation() << " channel";
                                                 }
+
+                                            top_block_->connect(acq_resamplers_.at(map_key), 0,
+                                                channels_.at(i)->get_left_block_acq(), 0);
+
+                                            std::shared_ptr<Channel> channel_ptr = std::dynamic_pointer_cast<Channel>(channels_.at(i));
+                                            channel_ptr->acquisition()->set_resampler_latency((taps.size() - 1) / 2);
                                         }
                                     else
                                         {
                                             LOG(INFO) << "Disabled acquisition resampler because the input sampling frequency is too low";
-                                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                            // resampler not required!
+                                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), sub_band,
                                                 channels_.at(i)->get_left_block_acq(), 0);
                                         }
                                 }
                             else
                                 {
-                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), sub_band,
                                         channels_.at(i)->get_left_block_acq(), 0);
                                 }
-                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), sub_band,
                                 channels_.at(i)->get_left_block_trk(), 0);
                         }
                     catch (const std::exception& e)
@@ -507,8 +522,8 @@ void GNSSFlowgraph::connect()
                             top_block_->disconnect_all();
                             return;
                         }
-                    signal_conditioner_connected.at(selected_signal_conditioner_ID) = true;  // notify that this signal conditioner is connected
-                    DLOG(INFO) << "signal conditioner " << selected_signal_conditioner_ID << " connected to channel " << i;
+                    signal_conditioner_connected.at(selected_signal_conditioner_ID).at(sub_band) = true;  // notify that this signal conditioner output is connected
+                    DLOG(INFO) << "signal conditioner " << selected_signal_conditioner_ID << " (sub-band " << sub_band << ") connected to channel " << i;
                 }
 #endif
             // Signal Source > Signal conditioner >> Channels >> Observables
@@ -531,12 +546,15 @@ void GNSSFlowgraph::connect()
         {
             for (size_t n = 0; n < sig_conditioner_.size(); n++)
                 {
-                    if (signal_conditioner_connected.at(n) == false)
+                    for (size_t m = 0; m < signal_conditioner_connected.at(n).size(); m++)
                         {
-                            null_sinks_.push_back(gr::blocks::null_sink::make(sizeof(gr_complex)));
-                            top_block_->connect(sig_conditioner_.at(n)->get_right_block(), 0,
-                                null_sinks_.back(), 0);
-                            LOG(INFO) << "Null sink connected to signal conditioner " << n << " due to lack of connection to any channel\n";
+                            if (signal_conditioner_connected.at(n).at(m) == false)
+                                {
+                                    null_sinks_.push_back(gr::blocks::null_sink::make(sizeof(gr_complex)));
+                                    top_block_->connect(sig_conditioner_.at(n)->get_right_block(), m,
+                                        null_sinks_.back(), 0);
+                                    LOG(INFO) << "Null sink connected to signal conditioner " << n << " (output " << m << ") due to lack of connection to any channel\n";
+                                }
                         }
                 }
         }
@@ -736,6 +754,13 @@ void GNSSFlowgraph::disconnect()
             return;
         }
     connected_ = false;
+    // Signal Source (i) > Capture tap
+    for (const auto& capture : capture_taps_)
+        {
+            top_block_->disconnect(capture.block, capture.port, capture.tap, 0);
+        }
+    capture_taps_.clear();
+
     // Signal Source (i) >  Signal conditioner (i) >
     int RF_Channels = 0;
     int signal_conditioner_ID = 0;
@@ -901,9 +926,11 @@ void GNSSFlowgraph::disconnect()
         {
 #ifndef ENABLE_FPGA
             int selected_signal_conditioner_ID;
+            int sub_band;
             try
                 {
                     selected_signal_conditioner_ID = configuration_->property("Channel" + std::to_string(i) + ".RF_channel_ID", 0);
+                    sub_band = configuration_->property("Channel" + std::to_string(i) + ".sub_band", 0);
                 }
             catch (const std::exception& e)
                 {
@@ -913,7 +940,7 @@ void GNSSFlowgraph::disconnect()
                 }
             try
                 {
-                    top_block_->disconnect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                    top_block_->disconnect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), sub_band,
                         channels_.at(i)->get_left_block_trk(), 0);
                 }
             catch (const std::exception& e)
@@ -2015,6 +2042,52 @@ void GNSSFlowgraph::set_channels_state()
 }
 
 
+void GNSSFlowgraph::connect_capture_tap(int source, int rf_channel, const gr::basic_block_sptr& block, int port)
+{
+    // Records the samples of a signal source stream, if requested, without slowing down the receiver
+    const std::string role = sig_source_.at(source)->role();
+    if (configuration_->property(role + ".capture", false) == false)
+        {
+            return;
+        }
+    std::string filename = configuration_->property(role + ".capture_filename", std::string("./capture.dat"));
+    if (sources_count_ > 1 or configuration_->property(role + ".RF_channels", 1) > 1 or sig_source_.at(source)->implementation() == "Raw_Array_Signal_Source")
+        {
+            const size_t dot = filename.find_last_of('.');
+            const std::string tag = "_src" + std::to_string(source) + "_ch" + std::to_string(rf_channel);
+            filename = (dot == std::string::npos) ? filename + tag : filename.substr(0, dot) + tag + filename.substr(dot);
+        }
+    const double fs = configuration_->property(role + ".sampling_frequency", static_cast<double>(configuration_->property("GNSS-SDR.internal_fs_sps", 0)));
+    const std::string item_type = configuration_->property(role + ".item_type", std::string("gr_complex"));
+    const size_t item_size = block->output_signature()->sizeof_stream_item(port);
+
+    // new file every capture_rotation_s seconds or capture_rotation_mb megabytes, whichever comes first (0: never)
+    uint64_t rotation_items = 0;
+    const double rotation_s = configuration_->property(role + ".capture_rotation_s", 0.0);
+    const uint64_t rotation_mb = configuration_->property(role + ".capture_rotation_mb", static_cast<uint64_t>(0));
+    if (rotation_s > 0.0)
+        {
+            rotation_items = static_cast<uint64_t>(rotation_s * fs);
+            if (rotation_items == 0)
+                {
+                    LOG(WARNING) << role << ".capture_rotation_s ignored: no sampling frequency set in " << role << ".sampling_frequency or GNSS-SDR.internal_fs_sps";
+                }
+        }
+    if (rotation_mb > 0)
+        {
+            const uint64_t rotation_mb_items = rotation_mb * 1024 * 1024 / item_size;
+            rotation_items = (rotation_items == 0) ? rotation_mb_items : std::min(rotation_items, rotation_mb_items);
+        }
+    const size_t buffer_bytes = static_cast<size_t>(configuration_->property(role + ".capture_buffer_mb", 256)) * 1024 * 1024;
+    const bool direct_io = configuration_->property(role + ".capture_direct_io", true);
+
+    auto tap = capture_make_tap(item_size, filename, fs, item_type, rotation_items, buffer_bytes, direct_io);
+    top_block_->connect(block, port, tap, 0);
+    capture_taps_.push_back({block, port, tap});
+    LOG(INFO) << "Recording signal source " << source << " stream " << rf_channel << " to " << filename;
+}
+
+
 bool GNSSFlowgraph::is_multiband() const
 {
     bool multiband = false;
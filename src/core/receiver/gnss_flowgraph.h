@@ -35,6 +35,8 @@
 #include <gnuradio/blocks/null_sink.h>  // for null_sink
 #include <gnuradio/runtime_types.h>     // for basic_block_sptr, top_block_sptr
 #include <pmt/pmt.h>                    // for pmt_t
+#include <atomic>                       // for atomic
+#include <cstddef>                      // for size_t
 #include <list>                         // for list
 #include <map>                          // for map
 #include <memory>                       // for for shared_ptr, dynamic_pointer_cast
@@ -145,6 +147,23 @@ public:
         return std::dynamic_pointer_cast<PvtInterface>(pvt_);
     }
 
+    /*!
+     * \brief Returns a smart pointer to a channel
+     */
+    std::shared_ptr<ChannelInterface> get_channel(int channel) const
+    {
+        return channels_.at(channel);
+    }
+
+    /*!
+     * \brief Number of decimating filters that feed the acquisition blocks
+     * when GNSS-SDR.use_acquisition_resampler is set
+     */
+    std::size_t acquisition_resamplers() const
+    {
+        return acq_resamplers_.size();
+    }
+
     /*!
      * \brief Priorize visible satellites in the specified vector
      */
@@ -174,6 +193,8 @@ private:
     double project_doppler(const std::string& searched_signal, double primary_freq_doppler_hz);
     bool is_multiband() const;
 
+    void connect_capture_tap(int source, int rf_channel, const gr::basic_block_sptr& block, int port);
+
     std::vector<std::string> split_string(const std::string& s, char delim);
 
     gr::top_block_sptr top_block_;
@@ -190,6 +211,15 @@ private:
     std::map<std::string, gr::basic_block_sptr> acq_resamplers_;
     std::vector<gr::blocks::null_sink::sptr> null_sinks_;
 
+    // Recorders of the raw samples, with the signal source stream they are attached to
+    struct Capture_Tap_Connection
+    {
+        gr::basic_block_sptr block;
+        int port;
+        gr::basic_block_sptr tap;
+    };
+    std::vector<Capture_Tap_Connection> capture_taps_;
+
     gr::basic_block_sptr GnssSynchroMonitor_;
     channel_status_msg_receiver_sptr channels_status_;  // class that receives and stores the current status of the receiver channels
     gnss_sdr_sample_counter_sptr ch_out_sample_counter_;
@@ -237,7 +267,7 @@ private:
     int max_acq_channels_;
 
     bool connected_;
-    bool running_;
+    std::atomic<bool> running_;
     bool multiband_;
     bool enable_monitor_;
 };
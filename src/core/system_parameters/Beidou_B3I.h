@@ -44,5 +44,8 @@ constexpr char BEIDOU_B3I_SECONDARY_CODE_STR[21] = "00000100110101001110";
 constexpr char BEIDOU_B3I_GEO_PREAMBLE_SYMBOLS_STR[23] = "1111110000001100001100";
 constexpr char BEIDOU_B3I_D2_SECONDARY_CODE_STR[3] = "00";
 
+// acquisition resampler
+constexpr uint32_t BEIDOU_B3I_OPT_ACQ_FS_SPS = 100000000;  //!< Sampling frequency above which the acquisition input is decimated
+
 
 #endif  // GNSS_SDR_BEIDOU_B3I_H
@@ -70,6 +70,7 @@ constexpr double GLONASS_L2_CA_CODE_LENGTH_CHIPS = 511.0;   //!< GLONASS L1 C/A
 constexpr double GLONASS_L2_CA_CODE_PERIOD_S = 0.001;       //!< GLONASS L1 C/A code period [seconds]
 constexpr double GLONASS_L2_CA_CHIP_PERIOD_S = 1.9569e-06;  //!< GLONASS L1 C/A chip period [seconds]
 constexpr double GLONASS_L2_CA_SYMBOL_RATE_BPS = 1000.0;
+constexpr uint32_t GLONASS_L2_CA_OPT_ACQ_FS_SPS = 100000000;  //!< Sampling frequency above which the acquisition input is decimated
 
 constexpr double GLONASS_L1_CA_FREQ_HZ = FREQ1_GLO;         //!< L1 [Hz]
 constexpr double GLONASS_L1_CA_DFREQ_HZ = DFRQ1_GLO;        //!< Freq Bias for GLONASS L1 [Hz]
@@ -78,6 +79,7 @@ constexpr double GLONASS_L1_CA_CODE_LENGTH_CHIPS = 511.0;   //!< GLONASS L1 C/A
 constexpr double GLONASS_L1_CA_CODE_PERIOD_S = 0.001;       //!< GLONASS L1 C/A code period [seconds]
 constexpr double GLONASS_L1_CA_CHIP_PERIOD_S = 1.9569e-06;  //!< GLONASS L1 C/A chip period [seconds]
 constexpr double GLONASS_L1_CA_SYMBOL_RATE_BPS = 1000.0;
+constexpr uint32_t GLONASS_L1_CA_OPT_ACQ_FS_SPS = 100000000;  //!< Sampling frequency above which the acquisition input is decimated
 
 constexpr int32_t GLONASS_CA_NBR_SATS = 24;  // STRING DATA WITHOUT PREAMBLE
 
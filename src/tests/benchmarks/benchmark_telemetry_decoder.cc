@@ -0,0 +1,466 @@
+/*!
+ * \file benchmark_telemetry_decoder.cc
+ * \brief Benchmark for the throughput of the telemetry decoder blocks
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "GPS_L1_CA.h"
+#include "Galileo_E5a.h"
+#include "beidou_b1i_telemetry_decoder_gs.h"
+#include "beidou_b3i_telemetry_decoder_gs.h"
+#include "beidou_dnav_encoder.h"
+#include "galileo_inav_encoder.h"
+#include "galileo_telemetry_decoder_gs.h"
+#include "glonass_gnav_encoder.h"
+#include "glonass_l1_ca_telemetry_decoder_gs.h"
+#include "gnss_satellite.h"
+#include "gnss_synchro.h"
+#include "gps_cnav_encoder.h"
+#include "gps_l1_ca_telemetry_decoder_gs.h"
+#include "gps_l2c_telemetry_decoder_gs.h"
+#include "gps_l5_telemetry_decoder_gs.h"
+#include "gps_lnav_encoder.h"
+#include "sbas_l1_encoder.h"
+#include "sbas_l1_telemetry_decoder_gs.h"
+#include <benchmark/benchmark.h>
+#include <gnuradio/blocks/null_sink.h>
+#include <gnuradio/top_block.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_source_b.h>
+#endif
+
+
+// Count every heap allocation made by the process, so allocations per frame
+// can be reported. Allocations made by the GNU Radio scheduler when starting
+// the flowgraph are included, and amortized over the frames of each run.
+namespace
+{
+std::atomic<uint64_t> num_allocations{0};
+}
+
+
+void* operator new(std::size_t size)
+{
+    num_allocations++;
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+    return ptr;
+}
+
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+
+void operator delete(void* ptr, std::size_t size __attribute__((unused))) noexcept
+{
+    std::free(ptr);
+}
+
+
+namespace
+{
+const int64_t SAMPLING_FREQ = 4000000;
+
+// Fully encoded F/NAV page (without preamble), taken from
+// galileo_fnav_inav_decoder_test.cc. It passes the CRC.
+const std::array<float, 488> FNAV_PAGE{-1, 1, -1, -1, 1, -1, 1, 1, 1, -1, -1, 1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    1, -1, -1, 1, -1, -1, 1, 1, 1, -1, 1, -1, 1, 1, -1, 1, -1, -1, -1, -1, 1, -1, -1, 1, -1, -1, -1, -1, 1, 1, 1, 1, 1, 1,
+    -1, 1, -1, 1, -1, 1, 1, -1, -1, 1, -1, 1, -1, 1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1, -1, 1, -1, 1, -1,
+    -1, 1, 1, -1, 1, 1, 1, 1, -1, 1, 1, 1, -1, 1, -1, 1, 1, -1, 1, -1, 1, 1, -1, 1, 1, 1, -1, -1, 1, 1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, 1, 1, 1, 1, -1, -1, -1, -1, -1, 1, 1,
+    -1, -1, -1, 1, -1, -1, -1, -1, -1, 1, -1, 1, 1, 1, 1, 1, -1, -1, 1, -1, -1, 1, 1, 1, 1, -1, -1, -1, -1, 1, -1, -1, -1,
+    -1, 1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1, -1, -1, -1, -1, -1, 1, -1, -1, 1, 1, 1, 1, 1, 1, -1,
+    -1, 1, -1, 1, -1, -1, 1, -1, 1, -1, -1, -1, -1, 1, -1, 1, 1, -1, 1, -1, -1, -1, 1, -1, 1, 1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, 1, 1, 1, -1, 1, -1, -1, 1, 1, 1, 1, 1, -1, -1, 1, 1, -1, -1, -1, 1, -1, 1, -1, 1, 1, -1,
+    1, -1, 1, 1, -1, -1, -1, 1, 1, -1, 1, 1, 1, -1, -1, -1, -1, 1, -1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1,
+    -1, 1, -1, 1, -1, -1, -1, -1, -1, 1, -1, 1, 1, -1, -1, 1, 1, 1, 1, 1, -1, 1, 1, 1, 1, 1, 1, -1, -1, -1, 1, -1, -1, -1, 1,
+    1, -1, 1, -1, -1, 1, 1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, 1, 1, 1, -1,
+    -1, 1, -1, -1, -1, -1, 1, -1, -1, -1, -1, 1, 1, 1, -1, 1, -1, 1, -1, 1, 1, -1, -1, 1, -1, -1, 1, -1, 1, 1, 1, 1, -1, -1, 1,
+    1, -1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, -1, -1, -1, 1, 1, 1, -1, 1, 1, 1, 1, -1, -1, -1, 1, 1, 1, 1, 1,
+    1, -1, 1, -1, -1, 1, 1, 1, -1, -1, 1, -1, 1, 1};
+
+
+// Symbol stream fed to a telemetry decoder, and number of frames it contains
+class Tlm_Stream
+{
+public:
+    Tlm_Stream(char system, const std::string& signal, uint32_t prn) : frames(0), d_system(system), d_signal(signal), d_prn(prn) {}
+
+    void push_symbol(double value, bool quadrature = false)
+    {
+        Gnss_Synchro gs{};
+        gs.System = d_system;
+        std::memcpy(static_cast<void*>(gs.Signal), d_signal.c_str(), 3);
+        gs.PRN = d_prn;
+        gs.fs = SAMPLING_FREQ;
+        gs.Flag_valid_symbol_output = true;
+        gs.Tracking_sample_counter = static_cast<uint64_t>(symbols.size() + 1) * 4000ULL;
+        if (quadrature)
+            {
+                gs.Prompt_Q = value;
+            }
+        else
+            {
+                gs.Prompt_I = value;
+            }
+        symbols.push_back(gs);
+    }
+
+    void push_bits(const char* bits, int32_t symbols_per_bit, bool quadrature = false)
+    {
+        for (int32_t i = 0; bits[i] != '\0'; i++)
+            {
+                for (int32_t j = 0; j < symbols_per_bit; j++)
+                    {
+                        push_symbol(bits[i] == '1' ? 1.0 : -1.0, quadrature);
+                    }
+            }
+    }
+
+    template <typename It>
+    void push_symbols(It first, It last, bool quadrature = false)
+    {
+        for (It it = first; it != last; ++it)
+            {
+                push_symbol(*it, quadrature);
+            }
+    }
+
+    std::vector<Gnss_Synchro> symbols;
+    int64_t frames;
+
+private:
+    char d_system;
+    std::string d_signal;
+    uint32_t d_prn;
+};
+
+
+// Subframes 1 to 5 with running TOW count. Data words carry zeroed ephemeris,
+// so the decoder goes through parity checking and subframe parsing as usual.
+Tlm_Stream gps_l1_ca_stream(int64_t num_subframes)
+{
+    Tlm_Stream stream('G', "1C", 1);
+    uint32_t prev_word = 0;
+    for (int64_t n = 0; n < num_subframes; n++)
+        {
+            const uint32_t subframe_id = static_cast<uint32_t>(n % 5) + 1U;
+            const uint32_t tow_count = static_cast<uint32_t>(n + 1) % 100800U;
+            const std::array<uint32_t, 10> words = gps_lnav_encode_subframe(tow_count, subframe_id, prev_word);
+            for (uint32_t word : words)
+                {
+                    for (int32_t b = GPS_WORD_BITS - 1; b >= 0; b--)
+                        {
+                            stream.push_symbol(((word >> static_cast<uint32_t>(b)) & 1U) ? 1.0 : -1.0);
+                        }
+                }
+            prev_word = words[9];
+        }
+    stream.frames = num_subframes;
+    return stream;
+}
+
+
+// Batches of words 1 to 5, each batch with a new IOD, so that every batch
+// completes a new ephemeris. Other fields are zero.
+Tlm_Stream galileo_inav_stream(int64_t num_pages)
+{
+    Tlm_Stream stream('E', "1B", 1);
+    for (int64_t n = 0; n < num_pages; n++)
+        {
+            const auto word_type = static_cast<uint32_t>(n % 5) + 1U;
+            std::string word(GALILEO_DATA_JK_BITS, '0');
+            galileo_inav_set_field(word, PAGE_TYPE_BIT, word_type);
+            if (word_type == 5)
+                {
+                    galileo_inav_set_field(word, WN_5_BIT, 1100);
+                    galileo_inav_set_field(word, TOW_5_BIT, 2 * n);
+                }
+            else
+                {
+                    galileo_inav_set_field(word, IOD_NAV_1_BIT, (n / 5) % 1024);  // same field in words 1 to 4
+                }
+            const std::vector<float> page = galileo_inav_encode_page(word);
+            stream.push_symbols(page.cbegin(), page.cend());
+        }
+    stream.frames = 2 * num_pages;
+    return stream;
+}
+
+
+Tlm_Stream galileo_fnav_stream(int64_t num_pages)
+{
+    Tlm_Stream stream('E', "5X", 1);
+    for (int64_t n = 0; n < num_pages; n++)
+        {
+            stream.push_bits(GALILEO_FNAV_PREAMBLE, 1, true);
+            stream.push_symbols(FNAV_PAGE.cbegin(), FNAV_PAGE.cend(), true);
+        }
+    stream.frames = num_pages;
+    return stream;
+}
+
+
+// Messages 10, 11, 30 and 33 in turn, with a new time of ephemeris in each
+// cycle, so that every cycle completes a new ephemeris. The FEC encoder runs
+// across messages, as on air.
+Tlm_Stream gps_cnav_stream(const std::string& signal, int64_t num_messages, bool quadrature)
+{
+    Tlm_Stream stream('G', signal, 1);
+    const std::array<uint32_t, 4> msg_types{{10, 11, 30, 33}};
+    int fec_state = 0;
+    for (int64_t n = 0; n < num_messages; n++)
+        {
+            const auto tow_count = static_cast<uint32_t>(n + 1);
+            const auto toe = static_cast<uint32_t>(n / 4) % 2016U;
+            const std::vector<float> message = gps_cnav_encode_message(1, msg_types[n % 4], tow_count, toe, fec_state);
+            stream.push_symbols(message.cbegin(), message.cend(), quadrature);
+        }
+    stream.frames = num_messages;
+    return stream;
+}
+
+
+// Strings 1 to 5 (the immediate data of a frame) in turn, with a new time of
+// ephemeris in each frame, so that every frame completes a new ephemeris.
+Tlm_Stream glonass_gnav_stream(int64_t num_strings)
+{
+    Tlm_Stream stream('R', "1G", 1);
+    for (int64_t n = 0; n < num_strings; n++)
+        {
+            const auto string_id = static_cast<uint32_t>(n % 5) + 1U;
+            const auto t_b = static_cast<uint32_t>(n / 5) % 96U + 1U;
+            const std::vector<float> symbols = glonass_gnav_encode_string(glonass_gnav_string(string_id, t_b));
+            stream.push_symbols(symbols.cbegin(), symbols.cend());
+        }
+    stream.frames = num_strings;
+    return stream;
+}
+
+
+// D1: subframes 1 to 5, 6 s apart, with a new AODE in each frame, so that
+// every frame completes a new ephemeris.
+Tlm_Stream beidou_d1_stream(const std::string& signal, uint32_t prn, int64_t num_subframes)
+{
+    Tlm_Stream stream('C', signal, prn);
+    for (int64_t n = 0; n < num_subframes; n++)
+        {
+            const auto subframe_id = static_cast<uint32_t>(n % 5) + 1U;
+            const auto sow = static_cast<uint32_t>(6 * n);
+            const auto aode = static_cast<uint32_t>(n / 5) % 31U + 1U;
+            const std::vector<float> symbols = beidou_dnav_encode_subframe(beidou_dnav_subframe(false, subframe_id, sow, 0, aode));
+            stream.push_symbols(symbols.cbegin(), symbols.cend());
+        }
+    stream.frames = num_subframes;
+    return stream;
+}
+
+
+// D2: frames of subframes 1 to 5, 3 s apart, going through pages 1 to 10 of
+// subframe 1 with a new AODE every ten frames, when a new ephemeris is
+// complete.
+Tlm_Stream beidou_d2_stream(int64_t num_subframes)
+{
+    Tlm_Stream stream('C', "B1", 1);
+    for (int64_t n = 0; n < num_subframes; n++)
+        {
+            const auto subframe_id = static_cast<uint32_t>(n % 5) + 1U;
+            const int64_t frame = n / 5;
+            const auto sow = static_cast<uint32_t>(3 * frame);
+            const auto page = static_cast<uint32_t>(frame % 10) + 1U;
+            const auto aode = static_cast<uint32_t>(frame / 10) % 31U + 1U;
+            const std::vector<float> symbols = beidou_dnav_encode_subframe(beidou_dnav_subframe(true, subframe_id, sow, page, aode));
+            stream.push_symbols(symbols.cbegin(), symbols.cend());
+        }
+    stream.frames = num_subframes;
+    return stream;
+}
+
+
+// Messages with rotating preambles and a valid CRC. The decoder takes two
+// correlation samples per symbol.
+Tlm_Stream sbas_l1_stream(int64_t num_messages)
+{
+    Tlm_Stream stream('S', "1C", 120);
+    int fec_state = 0;
+    for (int64_t n = 0; n < num_messages; n++)
+        {
+            for (float symbol : sbas_l1_encode_message(static_cast<uint32_t>(n), fec_state))
+                {
+                    stream.push_symbol(symbol);
+                    stream.push_symbol(symbol);
+                }
+        }
+    stream.frames = num_messages;
+    return stream;
+}
+
+
+void run_tlm_benchmark(benchmark::State& state, const Tlm_Stream& stream, const std::function<gr::basic_block_sptr()>& make_decoder)
+{
+    std::vector<unsigned char> bytes(stream.symbols.size() * sizeof(Gnss_Synchro));
+    std::memcpy(bytes.data(), stream.symbols.data(), bytes.size());
+
+    uint64_t allocations = 0;
+    for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto top_block = gr::make_top_block("TelemetryDecoderBenchmark");
+            auto source = gr::blocks::vector_source_b::make(bytes, false, sizeof(Gnss_Synchro));
+            auto decoder = make_decoder();
+            auto sink = gr::blocks::null_sink::make(sizeof(Gnss_Synchro));
+            top_block->connect(source, 0, decoder, 0);
+            top_block->connect(decoder, 0, sink, 0);
+            const uint64_t allocations_before = num_allocations.load();
+            state.ResumeTiming();
+
+            top_block->run();
+
+            state.PauseTiming();
+            allocations += num_allocations.load() - allocations_before;
+            state.ResumeTiming();
+        }
+
+    const auto total_frames = static_cast<double>(stream.frames * state.iterations());
+    state.SetItemsProcessed(static_cast<int64_t>(stream.symbols.size()) * state.iterations());
+    state.counters["frames"] = static_cast<double>(stream.frames);
+    // The timed region is the whole top_block::run() call, so this is the run
+    // time per frame, flowgraph start and stop included, not the decoding
+    // time alone. Use long runs to make the start and stop negligible.
+    state.counters["run_time_per_frame"] = benchmark::Counter(total_frames, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    state.counters["allocs_per_frame"] = static_cast<double>(allocations) / total_frames;
+}
+}  // namespace
+
+
+void bm_gps_l1_ca_lnav(benchmark::State& state)
+{
+    const Tlm_Stream stream = gps_l1_ca_stream(state.range(0));
+    run_tlm_benchmark(state, stream, []() { return gps_l1_ca_make_telemetry_decoder_gs(Gnss_Satellite("GPS", 1), false); });
+}
+
+
+void bm_gps_l2c_cnav(benchmark::State& state)
+{
+    const Tlm_Stream stream = gps_cnav_stream("2S", state.range(0), false);
+    run_tlm_benchmark(state, stream, []() { return gps_l2c_make_telemetry_decoder_gs(Gnss_Satellite("GPS", 1), false); });
+}
+
+
+void bm_gps_l5_cnav(benchmark::State& state)
+{
+    const Tlm_Stream stream = gps_cnav_stream("L5", state.range(0), true);
+    run_tlm_benchmark(state, stream, []() { return gps_l5_make_telemetry_decoder_gs(Gnss_Satellite("GPS", 1), false); });
+}
+
+
+void bm_galileo_inav(benchmark::State& state)
+{
+    const Tlm_Stream stream = galileo_inav_stream(state.range(0) / 2);
+    run_tlm_benchmark(state, stream, []() { return galileo_make_telemetry_decoder_gs(Gnss_Satellite("Galileo", 1), 1, false, false); });
+}
+
+
+void bm_galileo_inav_offload(benchmark::State& state)
+{
+    const Tlm_Stream stream = galileo_inav_stream(state.range(0) / 2);
+    run_tlm_benchmark(state, stream, []() { return galileo_make_telemetry_decoder_gs(Gnss_Satellite("Galileo", 1), 1, false, true); });
+}
+
+
+void bm_galileo_fnav(benchmark::State& state)
+{
+    const Tlm_Stream stream = galileo_fnav_stream(state.range(0));
+    run_tlm_benchmark(state, stream, []() { return galileo_make_telemetry_decoder_gs(Gnss_Satellite("Galileo", 1), 2, false, false); });
+}
+
+
+void bm_glonass_l1_ca_gnav(benchmark::State& state)
+{
+    const Tlm_Stream stream = glonass_gnav_stream(state.range(0));
+    run_tlm_benchmark(state, stream, []() { return glonass_l1_ca_make_telemetry_decoder_gs(Gnss_Satellite("Glonass", 1), false); });
+}
+
+
+void bm_beidou_b1i_d1(benchmark::State& state)
+{
+    const Tlm_Stream stream = beidou_d1_stream("B1", 10, state.range(0));
+    run_tlm_benchmark(state, stream, []() {
+        auto decoder = beidou_b1i_make_telemetry_decoder_gs(Gnss_Satellite("Beidou", 10), false);
+        decoder->set_satellite(Gnss_Satellite("Beidou", 10));
+        return decoder;
+    });
+}
+
+
+void bm_beidou_b1i_d2(benchmark::State& state)
+{
+    const Tlm_Stream stream = beidou_d2_stream(state.range(0));
+    run_tlm_benchmark(state, stream, []() {
+        auto decoder = beidou_b1i_make_telemetry_decoder_gs(Gnss_Satellite("Beidou", 1), false);
+        decoder->set_satellite(Gnss_Satellite("Beidou", 1));
+        return decoder;
+    });
+}
+
+
+void bm_beidou_b3i_d1(benchmark::State& state)
+{
+    const Tlm_Stream stream = beidou_d1_stream("B3", 10, state.range(0));
+    run_tlm_benchmark(state, stream, []() {
+        auto decoder = beidou_b3i_make_telemetry_decoder_gs(Gnss_Satellite("Beidou", 10), false);
+        decoder->set_satellite(Gnss_Satellite("Beidou", 10));
+        return decoder;
+    });
+}
+
+
+void bm_sbas_l1(benchmark::State& state)
+{
+    const Tlm_Stream stream = sbas_l1_stream(state.range(0));
+    run_tlm_benchmark(state, stream, []() { return sbas_l1_make_telemetry_decoder_gs(Gnss_Satellite("SBAS", 120), false); });
+}
+
+
+// Argument: number of frames (subframes, pages or strings) per run
+BENCHMARK(bm_gps_l1_ca_lnav)->Arg(50)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_gps_l2c_cnav)->Arg(50)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_gps_l5_cnav)->Arg(50)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_galileo_inav)->Arg(100)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_galileo_inav_offload)->Arg(100)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_galileo_fnav)->Arg(50)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_glonass_l1_ca_gnav)->Arg(25)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_beidou_b1i_d1)->Arg(50)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_beidou_b1i_d2)->Arg(100)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_beidou_b3i_d1)->Arg(50)->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_sbas_l1)->Arg(25)->Unit(benchmark::kMillisecond);
+BENCHMARK_MAIN();
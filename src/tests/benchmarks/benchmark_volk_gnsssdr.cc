@@ -0,0 +1,452 @@
+/*!
+ * \file benchmark_volk_gnsssdr.cc
+ * \brief Benchmark for every implementation of the volk_gnsssdr kernels, at
+ * the vector lengths and tap counts of the shipped configuration files
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <benchmark/benchmark.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <array>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+/*
+ * Integration spans of the tracking blocks in conf/, one code period each
+ * (Galileo E1 is resampled at 2 samples per chip of its sinboc(1,1) code).
+ * The pilot+data signals have one more tap, the data prompt, which is
+ * correlated in the same call as the pilot taps.
+ * Element-wise kernels are run over the same number of samples.
+ */
+struct Shape
+{
+    const char* name;
+    unsigned int num_points;
+    unsigned int code_length_chips;
+    int num_taps;
+};
+
+const std::array<Shape, 8> SHAPES = {{
+    {"GPS_L1_CA_2Msps", 2000, 1023, 3},
+    {"GPS_L1_CA_4Msps", 4000, 1023, 3},
+    {"GPS_L1_CA_6.625Msps", 6625, 1023, 3},
+    {"GPS_L1_CA_8Msps", 8000, 1023, 3},
+    {"GPS_L2_M_20ms_4Msps", 80000, 10230, 3},
+    {"Galileo_E1_4ms_4Msps", 16000, 8184, 6},
+    {"Galileo_E5a_20Msps", 20000, 10230, 4},
+    {"GPS_L5_30Msps", 30000, 10230, 4},
+}};
+
+
+// Inputs, outputs and local code replicas for one shape, filled with random values
+struct Kernel_Buffers
+{
+    explicit Kernel_Buffers(const Shape& shape);
+
+    volk_gnsssdr::vector<lv_32fc_t> in_32fc;
+    volk_gnsssdr::vector<lv_32fc_t> out_32fc;
+    volk_gnsssdr::vector<lv_16sc_t> in_16ic;
+    volk_gnsssdr::vector<lv_16sc_t> in_16ic_b;
+    volk_gnsssdr::vector<lv_16sc_t> out_16ic;
+    volk_gnsssdr::vector<lv_8sc_t> in_8ic;
+    volk_gnsssdr::vector<lv_8sc_t> in_8ic_b;
+    volk_gnsssdr::vector<lv_8sc_t> out_8ic;
+    volk_gnsssdr::vector<float> in_32f;
+    volk_gnsssdr::vector<float> out_32f;
+    volk_gnsssdr::vector<double> in_64f;
+    volk_gnsssdr::vector<char> in_8i;
+    volk_gnsssdr::vector<char> in_8i_b;
+    volk_gnsssdr::vector<char> out_8i;
+    volk_gnsssdr::vector<unsigned char> in_8u;
+    volk_gnsssdr::vector<unsigned char> in_8u_b;
+    volk_gnsssdr::vector<unsigned char> out_8u;
+
+    volk_gnsssdr::vector<float> code_32f;
+    volk_gnsssdr::vector<int16_t> code_16i;
+    volk_gnsssdr::vector<lv_32fc_t> code_32fc;
+    volk_gnsssdr::vector<lv_16sc_t> code_16ic;
+    std::vector<const float*> code_32f_ptrs;  // the local code of each tap
+    volk_gnsssdr::vector<float> shifts_chips;  // symmetric taps, half a chip apart
+    volk_gnsssdr::vector<float> rem_code_phases_chips;
+    float code_phase_step_chips;
+
+    // one resampled replica per tap
+    std::vector<volk_gnsssdr::vector<float>> taps_32f;
+    std::vector<volk_gnsssdr::vector<int16_t>> taps_16i;
+    std::vector<volk_gnsssdr::vector<lv_32fc_t>> taps_32fc;
+    std::vector<volk_gnsssdr::vector<lv_16sc_t>> taps_16ic;
+    std::vector<volk_gnsssdr::vector<uint32_t>> taps_32u;
+    std::vector<float*> taps_32f_ptrs;
+    std::vector<int16_t*> taps_16i_ptrs;
+    std::vector<lv_32fc_t*> taps_32fc_ptrs;
+    std::vector<lv_16sc_t*> taps_16ic_ptrs;
+    std::vector<const uint32_t*> taps_32u_ptrs;
+    volk_gnsssdr::vector<lv_32fc_t> corr_32fc;
+    volk_gnsssdr::vector<lv_16sc_t> corr_16ic;
+};
+
+
+Kernel_Buffers::Kernel_Buffers(const Shape& shape)
+    : in_32fc(shape.num_points),
+      out_32fc(shape.num_points),
+      in_16ic(shape.num_points),
+      in_16ic_b(shape.num_points),
+      out_16ic(shape.num_points),
+      in_8ic(shape.num_points),
+      in_8ic_b(shape.num_points),
+      out_8ic(shape.num_points),
+      in_32f(shape.num_points),
+      out_32f(shape.num_points),
+      in_64f(shape.num_points),
+      in_8i(shape.num_points),
+      in_8i_b(shape.num_points),
+      out_8i(shape.num_points),
+      in_8u(shape.num_points),
+      in_8u_b(shape.num_points),
+      out_8u(shape.num_points),
+      code_32f(shape.code_length_chips),
+      code_16i(shape.code_length_chips),
+      code_32fc(shape.code_length_chips),
+      code_16ic(shape.code_length_chips),
+      shifts_chips(shape.num_taps),
+      rem_code_phases_chips(shape.num_taps),
+      code_phase_step_chips(static_cast<float>(shape.code_length_chips) / static_cast<float>(shape.num_points)),
+      corr_32fc(shape.num_taps),
+      corr_16ic(shape.num_taps)
+{
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> samples(-100, 100);
+    std::uniform_int_distribution<int> bytes(0, 255);
+    std::uniform_real_distribution<float> phases(-3.0F, 3.0F);
+    for (unsigned int n = 0; n < shape.num_points; n++)
+        {
+            const auto re = static_cast<int16_t>(samples(gen));
+            const auto im = static_cast<int16_t>(samples(gen));
+            in_32fc[n] = lv_cmake(static_cast<float>(re), static_cast<float>(im));
+            in_16ic[n] = lv_cmake(re, im);
+            in_16ic_b[n] = lv_cmake(im, re);
+            in_8ic[n] = lv_cmake(static_cast<int8_t>(re), static_cast<int8_t>(im));
+            in_8ic_b[n] = lv_cmake(static_cast<int8_t>(im), static_cast<int8_t>(re));
+            in_32f[n] = phases(gen);
+            in_64f[n] = static_cast<double>(re);
+            in_8i[n] = static_cast<char>(re);
+            in_8i_b[n] = static_cast<char>(im);
+            in_8u[n] = static_cast<unsigned char>(bytes(gen));
+            in_8u_b[n] = static_cast<unsigned char>(bytes(gen));
+        }
+    for (unsigned int n = 0; n < shape.code_length_chips; n++)
+        {
+            const bool chip = bytes(gen) & 1;
+            code_32f[n] = chip ? 1.0F : -1.0F;
+            code_16i[n] = chip ? 1 : -1;
+            code_32fc[n] = lv_cmake(code_32f[n], -code_32f[n]);
+            code_16ic[n] = lv_cmake(code_16i[n], static_cast<int16_t>(-code_16i[n]));
+        }
+    for (int tap = 0; tap < shape.num_taps; tap++)
+        {
+            shifts_chips[tap] = 0.5F * static_cast<float>(tap - shape.num_taps / 2);
+            rem_code_phases_chips[tap] = 0.25F + shifts_chips[tap];
+            code_32f_ptrs.push_back(code_32f.data());
+            taps_32f.emplace_back(shape.num_points);
+            taps_16i.emplace_back(shape.num_points);
+            taps_32fc.emplace_back(shape.num_points);
+            taps_16ic.emplace_back(shape.num_points);
+            taps_32u.emplace_back((shape.num_points + 31) / 32);
+        }
+    for (int tap = 0; tap < shape.num_taps; tap++)
+        {
+            for (unsigned int n = 0; n < shape.num_points; n++)
+                {
+                    const float chip = code_32f[(n + tap) % shape.code_length_chips];
+                    taps_32f[tap][n] = chip;
+                    taps_16i[tap][n] = static_cast<int16_t>(chip);
+                    taps_32fc[tap][n] = lv_cmake(chip, -chip);
+                    taps_16ic[tap][n] = lv_cmake(static_cast<int16_t>(chip), static_cast<int16_t>(-chip));
+                    if (chip < 0.0F)
+                        {
+                            taps_32u[tap][n / 32] |= 1U << (n % 32);
+                        }
+                }
+            taps_32f_ptrs.push_back(taps_32f[tap].data());
+            taps_16i_ptrs.push_back(taps_16i[tap].data());
+            taps_32fc_ptrs.push_back(taps_32fc[tap].data());
+            taps_16ic_ptrs.push_back(taps_16ic[tap].data());
+            taps_32u_ptrs.push_back(taps_32u[tap].data());
+        }
+}
+
+
+using Kernel_Call = std::function<void(const char* impl_name)>;
+using Kernel_Setup = std::function<Kernel_Call(Kernel_Buffers& buffers, const Shape& shape)>;
+
+
+// Registers one benchmark per implementation available in this machine and per shape,
+// named <kernel>/<implementation>/<shape>. Throughput is reported in samples per second.
+void register_kernel(const std::string& kernel_name, const volk_gnsssdr_func_desc_t& desc, const Kernel_Setup& setup)
+{
+    for (size_t i = 0; i < desc.n_impls; i++)
+        {
+            const char* impl_name = desc.impl_names[i];
+            for (const auto& shape : SHAPES)
+                {
+                    const std::string name = kernel_name + "/" + impl_name + "/" + shape.name;
+                    benchmark::RegisterBenchmark(name.c_str(), [setup, impl_name, shape](benchmark::State& state) {
+                        Kernel_Buffers buffers(shape);
+                        const Kernel_Call call = setup(buffers, shape);
+                        while (state.KeepRunning())
+                            {
+                                call(impl_name);
+                            }
+                        state.SetItemsProcessed(static_cast<int64_t>(shape.num_points) * state.iterations());
+                        state.counters["taps"] = static_cast<double>(shape.num_taps);
+                    });
+                }
+        }
+}
+
+
+void register_correlators()
+{
+    register_kernel("volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn", volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            lv_32fc_t phase = lv_cmake(1.0F, 0.0F);
+            volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn_manual(b.corr_32fc.data(), b.in_32fc.data(), std::polar(1.0F, 0.1F), &phase, const_cast<const lv_32fc_t**>(b.taps_32fc_ptrs.data()), s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn", volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            lv_32fc_t phase = lv_cmake(1.0F, 0.0F);
+            volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_manual(b.corr_32fc.data(), b.in_32fc.data(), std::polar(1.0F, 0.1F), &phase, const_cast<const float**>(b.taps_32f_ptrs.data()), s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn", volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            lv_32fc_t phase = lv_cmake(1.0F, 0.0F);
+            volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn_manual(b.corr_32fc.data(), b.in_32fc.data(), std::polar(1.0F, 0.1F), std::polar(1.0F, 1e-6F), &phase, const_cast<const float**>(b.taps_32f_ptrs.data()), s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn", volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            double phase_rad = 0.0;
+            volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_manual(b.corr_32fc.data(), b.in_32fc.data(), 0.1, &phase_rad, b.taps_32u_ptrs.data(), s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn", volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            double phase_rad = 0.0;
+            volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn_manual(b.corr_32fc.data(), b.in_32fc.data(), 0.1, &phase_rad, b.code_32f_ptrs.data(), 0.25F, b.code_phase_step_chips, 0.0F, b.shifts_chips.data(), s.code_length_chips, s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn", volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            double phase_rad = 0.0;
+            volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_manual(b.corr_32fc.data(), b.in_16ic.data(), 0.1, &phase_rad, b.code_32f_ptrs.data(), 0.25F, b.code_phase_step_chips, 0.0F, b.shifts_chips.data(), s.code_length_chips, s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_8ic_32f_resampler_rotator_dot_prod_32fc_xn", volk_gnsssdr_8ic_32f_resampler_rotator_dot_prod_32fc_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            double phase_rad = 0.0;
+            volk_gnsssdr_8ic_32f_resampler_rotator_dot_prod_32fc_xn_manual(b.corr_32fc.data(), b.in_8ic.data(), 0.1, &phase_rad, b.code_32f_ptrs.data(), 0.25F, b.code_phase_step_chips, 0.0F, b.shifts_chips.data(), s.code_length_chips, s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_16ic_x2_rotator_dot_prod_16ic_xn", volk_gnsssdr_16ic_x2_rotator_dot_prod_16ic_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            lv_32fc_t phase = lv_cmake(1.0F, 0.0F);
+            volk_gnsssdr_16ic_x2_rotator_dot_prod_16ic_xn_manual(b.corr_16ic.data(), b.in_16ic.data(), std::polar(1.0F, 0.1F), &phase, const_cast<const lv_16sc_t**>(b.taps_16ic_ptrs.data()), s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_16ic_16i_rotator_dot_prod_16ic_xn", volk_gnsssdr_16ic_16i_rotator_dot_prod_16ic_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            lv_32fc_t phase = lv_cmake(1.0F, 0.0F);
+            volk_gnsssdr_16ic_16i_rotator_dot_prod_16ic_xn_manual(b.corr_16ic.data(), b.in_16ic.data(), std::polar(1.0F, 0.1F), &phase, const_cast<const int16_t**>(b.taps_16i_ptrs.data()), s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_16ic_x2_dot_prod_16ic_xn", volk_gnsssdr_16ic_x2_dot_prod_16ic_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            volk_gnsssdr_16ic_x2_dot_prod_16ic_xn_manual(b.corr_16ic.data(), b.in_16ic.data(), const_cast<const lv_16sc_t**>(b.taps_16ic_ptrs.data()), s.num_taps, s.num_points, impl);
+        };
+    });
+}
+
+
+void register_resamplers()
+{
+    register_kernel("volk_gnsssdr_32f_xn_resampler_32f_xn", volk_gnsssdr_32f_xn_resampler_32f_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            volk_gnsssdr_32f_xn_resampler_32f_xn_manual(b.taps_32f_ptrs.data(), b.code_32f.data(), 0.25F, b.code_phase_step_chips, b.shifts_chips.data(), s.code_length_chips, s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn", volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            volk_gnsssdr_32f_xn_high_dynamics_resampler_32f_xn_manual(b.taps_32f_ptrs.data(), b.code_32f.data(), 0.25F, b.code_phase_step_chips, 1e-9F, b.shifts_chips.data(), s.code_length_chips, s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_32fc_xn_resampler_32fc_xn", volk_gnsssdr_32fc_xn_resampler_32fc_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            volk_gnsssdr_32fc_xn_resampler_32fc_xn_manual(b.taps_32fc_ptrs.data(), b.code_32fc.data(), 0.25F, b.code_phase_step_chips, b.shifts_chips.data(), s.code_length_chips, s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_16ic_xn_resampler_16ic_xn", volk_gnsssdr_16ic_xn_resampler_16ic_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            volk_gnsssdr_16ic_xn_resampler_16ic_xn_manual(b.taps_16ic_ptrs.data(), b.code_16ic.data(), 0.25F, b.code_phase_step_chips, b.shifts_chips.data(), s.code_length_chips, s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_16i_xn_resampler_16i_xn", volk_gnsssdr_16i_xn_resampler_16i_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            volk_gnsssdr_16i_xn_resampler_16i_xn_manual(b.taps_16i_ptrs.data(), b.code_16i.data(), 0.25F, b.code_phase_step_chips, b.shifts_chips.data(), s.code_length_chips, s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_16ic_xn_resampler_fast_16ic_xn", volk_gnsssdr_16ic_xn_resampler_fast_16ic_xn_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            volk_gnsssdr_16ic_xn_resampler_fast_16ic_xn_manual(b.taps_16ic_ptrs.data(), b.code_16ic.data(), b.rem_code_phases_chips.data(), b.code_phase_step_chips, s.code_length_chips, s.num_taps, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_16ic_resampler_fast_16ic", volk_gnsssdr_16ic_resampler_fast_16ic_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            volk_gnsssdr_16ic_resampler_fast_16ic_manual(b.out_16ic.data(), b.code_16ic.data(), 0.25F, b.code_phase_step_chips, static_cast<int>(s.code_length_chips), s.num_points, impl);
+        };
+    });
+}
+
+
+void register_element_wise_kernels()
+{
+    register_kernel("volk_gnsssdr_16ic_conjugate_16ic", volk_gnsssdr_16ic_conjugate_16ic_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_16ic_conjugate_16ic_manual(b.out_16ic.data(), b.in_16ic.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_16ic_convert_32fc", volk_gnsssdr_16ic_convert_32fc_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_16ic_convert_32fc_manual(b.out_32fc.data(), b.in_16ic.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_16ic_s32fc_x2_rotator_16ic", volk_gnsssdr_16ic_s32fc_x2_rotator_16ic_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            lv_32fc_t phase = lv_cmake(1.0F, 0.0F);
+            volk_gnsssdr_16ic_s32fc_x2_rotator_16ic_manual(b.out_16ic.data(), b.in_16ic.data(), std::polar(1.0F, 0.1F), &phase, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_16ic_x2_dot_prod_16ic", volk_gnsssdr_16ic_x2_dot_prod_16ic_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_16ic_x2_dot_prod_16ic_manual(b.corr_16ic.data(), b.in_16ic.data(), b.in_16ic_b.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_16ic_x2_multiply_16ic", volk_gnsssdr_16ic_x2_multiply_16ic_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_16ic_x2_multiply_16ic_manual(b.out_16ic.data(), b.in_16ic.data(), b.in_16ic_b.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_32f_index_max_32u", volk_gnsssdr_32f_index_max_32u_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            uint32_t index;
+            volk_gnsssdr_32f_index_max_32u_manual(&index, b.in_32f.data(), s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_32f_sincos_32fc", volk_gnsssdr_32f_sincos_32fc_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_32f_sincos_32fc_manual(b.out_32fc.data(), b.in_32f.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_s32f_sincos_32fc", volk_gnsssdr_s32f_sincos_32fc_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            float phase = 0.0F;
+            volk_gnsssdr_s32f_sincos_32fc_manual(b.out_32fc.data(), 0.1F, &phase, s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_32fc_convert_16ic", volk_gnsssdr_32fc_convert_16ic_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_32fc_convert_16ic_manual(b.out_16ic.data(), b.in_32fc.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_32fc_convert_8ic", volk_gnsssdr_32fc_convert_8ic_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_32fc_convert_8ic_manual(b.out_8ic.data(), b.in_32fc.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_64f_accumulator_64f", volk_gnsssdr_64f_accumulator_64f_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            double result;
+            volk_gnsssdr_64f_accumulator_64f_manual(&result, b.in_64f.data(), s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_8i_accumulator_s8i", volk_gnsssdr_8i_accumulator_s8i_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            char result;
+            volk_gnsssdr_8i_accumulator_s8i_manual(&result, b.in_8i.data(), s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_8i_index_max_16u", volk_gnsssdr_8i_index_max_16u_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            unsigned int index;
+            volk_gnsssdr_8i_index_max_16u_manual(&index, b.in_8i.data(), s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_8i_max_s8i", volk_gnsssdr_8i_max_s8i_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            char result;
+            volk_gnsssdr_8i_max_s8i_manual(&result, b.in_8i.data(), s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_8i_x2_add_8i", volk_gnsssdr_8i_x2_add_8i_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_8i_x2_add_8i_manual(b.out_8i.data(), b.in_8i.data(), b.in_8i_b.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_8ic_conjugate_8ic", volk_gnsssdr_8ic_conjugate_8ic_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_8ic_conjugate_8ic_manual(b.out_8ic.data(), b.in_8ic.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_8ic_magnitude_squared_8i", volk_gnsssdr_8ic_magnitude_squared_8i_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_8ic_magnitude_squared_8i_manual(b.out_8i.data(), b.in_8ic.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_8ic_s8ic_multiply_8ic", volk_gnsssdr_8ic_s8ic_multiply_8ic_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_8ic_s8ic_multiply_8ic_manual(b.out_8ic.data(), b.in_8ic.data(), lv_cmake(static_cast<int8_t>(1), static_cast<int8_t>(-1)), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_8ic_x2_dot_prod_8ic", volk_gnsssdr_8ic_x2_dot_prod_8ic_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) {
+            lv_8sc_t result;
+            volk_gnsssdr_8ic_x2_dot_prod_8ic_manual(&result, b.in_8ic.data(), b.in_8ic_b.data(), s.num_points, impl);
+        };
+    });
+    register_kernel("volk_gnsssdr_8ic_x2_multiply_8ic", volk_gnsssdr_8ic_x2_multiply_8ic_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_8ic_x2_multiply_8ic_manual(b.out_8ic.data(), b.in_8ic.data(), b.in_8ic_b.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_8u_x2_multiply_8u", volk_gnsssdr_8u_x2_multiply_8u_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_8u_x2_multiply_8u_manual(b.out_8u.data(), b.in_8u.data(), b.in_8u_b.data(), s.num_points, impl); };
+    });
+}
+
+
+void register_unpackers()
+{
+    register_kernel("volk_gnsssdr_8u_unpack2bit_32f", volk_gnsssdr_8u_unpack2bit_32f_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_8u_unpack2bit_32f_manual(b.out_32f.data(), b.in_8u.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_8u_unpack2bit_8i", volk_gnsssdr_8u_unpack2bit_8i_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_8u_unpack2bit_8i_manual(b.out_8i.data(), b.in_8u.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_8u_unpack2bitcpx_16ic", volk_gnsssdr_8u_unpack2bitcpx_16ic_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_8u_unpack2bitcpx_16ic_manual(b.out_16ic.data(), b.in_8u.data(), s.num_points, impl); };
+    });
+    register_kernel("volk_gnsssdr_8u_unpack4bit_8i", volk_gnsssdr_8u_unpack4bit_8i_get_func_desc(), [](Kernel_Buffers& b, const Shape& s) {
+        return [&b, s](const char* impl) { volk_gnsssdr_8u_unpack4bit_8i_manual(b.out_8i.data(), b.in_8u.data(), s.num_points, impl); };
+    });
+}
+
+
+const bool kernels_registered = []() {
+    register_correlators();
+    register_resamplers();
+    register_element_wise_kernels();
+    register_unpackers();
+    return true;
+}();
+}  // namespace
+
+
+BENCHMARK_MAIN();
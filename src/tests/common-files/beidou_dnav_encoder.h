@@ -0,0 +1,122 @@
+/*!
+ * \file beidou_dnav_encoder.h
+ * \brief Helper file for unit testing. Encodes BeiDou D1 and D2 navigation
+ * message subframes, with their BCH code and interleaving.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_BEIDOU_DNAV_ENCODER_H
+#define GNSS_SDR_BEIDOU_DNAV_ENCODER_H
+
+#include "Beidou_DNAV.h"
+#include "nav_message_encoder.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief BCH(15,11,1) codeword, packed MSB first, of 11 information bits:
+ * the information bits followed by the remainder of their division by
+ * g(X) = X^4 + X + 1 (BDS-SIS-ICD-B1I-3.0, Section 5.1.3).
+ */
+inline uint32_t bch15_11_encode(uint32_t info)
+{
+    uint32_t remainder = (info & 0x7FFU) << 4U;
+    for (int32_t b = 14; b >= 4; b--)
+        {
+            if ((remainder >> static_cast<uint32_t>(b)) & 1U)
+                {
+                    remainder ^= 0x13U << static_cast<uint32_t>(b - 4);
+                }
+        }
+    return ((info & 0x7FFU) << 4U) | remainder;
+}
+
+
+/*!
+ * \brief 300 bits of a D1 (D2 if d2 is true) subframe, laid out as decoded:
+ * the first word as transmitted, then each following word as its 11 + 11
+ * information bits and 4 + 4 parity bits, so that the field definitions of
+ * Beidou_DNAV.h apply. Only the preamble, subframe ID, seconds of week, page
+ * number (D2) and AODE are set; every other field is zero. The parity bits
+ * are left for beidou_dnav_encode_subframe() to compute.
+ */
+inline std::string beidou_dnav_subframe(bool d2, uint32_t subframe_id, uint32_t sow, uint32_t page, uint32_t aode)
+{
+    std::string bits = std::string(BEIDOU_DNAV_PREAMBLE) + std::string(BEIDOU_DNAV_SUBFRAME_DATA_BITS - BEIDOU_DNAV_PREAMBLE_LENGTH_BITS, '0');
+    nav_message_set_field(bits, D1_FRAID, subframe_id);
+    nav_message_set_field(bits, D1_SOW, sow);
+    if (d2)
+        {
+            if (subframe_id == 1)
+                {
+                    nav_message_set_field(bits, D2_PNUM, page);
+                    if (page == 4)
+                        {
+                            nav_message_set_field(bits, D2_AODE, aode);
+                        }
+                }
+        }
+    else if (subframe_id == 1)
+        {
+            nav_message_set_field(bits, D1_AODE, aode);
+        }
+    return bits;
+}
+
+
+/*!
+ * \brief 300 symbols of a subframe given as laid out by
+ * beidou_dnav_subframe(), +1 for a 1 and -1 for a 0. The last 11 bits of the
+ * first word and both halves of the other words are BCH encoded, and the two
+ * codewords of each word but the first are interleaved bit by bit. The
+ * secondary (Neumann-Hoffman) code is not applied.
+ */
+inline std::vector<float> beidou_dnav_encode_subframe(const std::string &bits)
+{
+    auto info = [&bits](int32_t first) {
+        uint32_t value = 0U;
+        for (int32_t i = 0; i < 11; i++)
+            {
+                value = (value << 1U) | (bits[first + i] == '1' ? 1U : 0U);
+            }
+        return value;
+    };
+    std::vector<float> symbols;
+    symbols.reserve(BEIDOU_DNAV_SUBFRAME_SYMBOLS);
+    for (int32_t i = 0; i < 15; i++)
+        {
+            symbols.push_back(bits[i] == '1' ? 1.0F : -1.0F);
+        }
+    const uint32_t first_codeword = bch15_11_encode(info(15));
+    for (int32_t c = 14; c >= 0; c--)
+        {
+            symbols.push_back(((first_codeword >> static_cast<uint32_t>(c)) & 1U) ? 1.0F : -1.0F);
+        }
+    for (int32_t w = 1; w < static_cast<int32_t>(BEIDOU_DNAV_WORDS_SUBFRAME); w++)
+        {
+            const int32_t first = w * static_cast<int32_t>(BEIDOU_DNAV_WORD_LENGTH_BITS);
+            const uint32_t first_branch = bch15_11_encode(info(first));
+            const uint32_t second_branch = bch15_11_encode(info(first + 11));
+            for (int32_t c = 14; c >= 0; c--)
+                {
+                    symbols.push_back(((first_branch >> static_cast<uint32_t>(c)) & 1U) ? 1.0F : -1.0F);
+                    symbols.push_back(((second_branch >> static_cast<uint32_t>(c)) & 1U) ? 1.0F : -1.0F);
+                }
+        }
+    return symbols;
+}
+
+#endif  // GNSS_SDR_BEIDOU_DNAV_ENCODER_H
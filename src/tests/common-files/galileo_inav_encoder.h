@@ -0,0 +1,90 @@
+/*!
+ * \file galileo_inav_encoder.h
+ * \brief Helper file for unit testing. Encodes Galileo I/NAV nominal pages,
+ * with their CRC, FEC and interleaving.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GALILEO_INAV_ENCODER_H
+#define GNSS_SDR_GALILEO_INAV_ENCODER_H
+
+#include "Galileo_INAV.h"
+#include "nav_message_encoder.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Writes value, MSB first, into a field of a word given as a string of
+ * '0' and '1'. Bits are numbered from 1, as in the field definitions of
+ * Galileo_INAV.h.
+ */
+inline void galileo_inav_set_field(std::string &word, const std::vector<std::pair<int32_t, int32_t>> &field, uint64_t value)
+{
+    nav_message_set_field(word, field, value);
+}
+
+
+/*!
+ * \brief Encodes the 120 bits of a page part (including the tail bits) into
+ * 240 interleaved symbols, +1 for a 1 and -1 for a 0. The G2 output of the
+ * FEC encoder is inverted, as in Galileo OS SIS ICD, Figure 13.
+ */
+inline std::array<float, 240> galileo_inav_encode_page_part(const std::string &bits)
+{
+    int state = 0;
+    const std::vector<float> encoded = nav_message_convolutional_encode(bits.substr(0, 120), state, true);
+    std::array<float, 240> symbols{};
+    for (int32_t r = 0; r < GALILEO_INAV_INTERLEAVER_ROWS; r++)
+        {
+            for (int32_t c = 0; c < GALILEO_INAV_INTERLEAVER_COLS; c++)
+                {
+                    symbols[r * GALILEO_INAV_INTERLEAVER_COLS + c] = encoded[c * GALILEO_INAV_INTERLEAVER_ROWS + r];
+                }
+        }
+    return symbols;
+}
+
+
+/*!
+ * \brief Symbols of a nominal page carrying a 128-bit word: the even and the
+ * odd page parts, each one after its preamble. The reserved, SAR and spare
+ * fields are all zeros.
+ */
+inline std::vector<float> galileo_inav_encode_page(const std::string &word)
+{
+    const std::string tail(6, '0');
+    const std::string even = "00" + word.substr(0, 112) + tail;
+    std::string odd = "10" + word.substr(112, 16) + std::string(64, '0');
+    std::string crc_bits = even.substr(0, 114) + odd;
+    nav_message_append_crc24q(crc_bits);
+    odd = crc_bits.substr(114) + std::string(8, '0') + tail;
+
+    std::vector<float> symbols;
+    for (const std::string &part : {even, odd})
+        {
+            for (int32_t i = 0; GALILEO_INAV_PREAMBLE[i] != '\0'; i++)
+                {
+                    symbols.push_back(GALILEO_INAV_PREAMBLE[i] == '1' ? 1.0F : -1.0F);
+                }
+            const std::array<float, 240> part_symbols = galileo_inav_encode_page_part(part);
+            symbols.insert(symbols.end(), part_symbols.cbegin(), part_symbols.cend());
+        }
+    return symbols;
+}
+
+#endif  // GNSS_SDR_GALILEO_INAV_ENCODER_H
@@ -0,0 +1,112 @@
+/*!
+ * \file glonass_gnav_encoder.h
+ * \brief Helper file for unit testing. Encodes GLONASS GNAV strings, with
+ * their Hamming code, relative and bi-binary coding and time mark.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GLONASS_GNAV_ENCODER_H
+#define GNSS_SDR_GLONASS_GNAV_ENCODER_H
+
+#include "GLONASS_L1_L2_CA.h"
+#include "nav_message_encoder.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief Sets the eight check bits of an 85-bit string (GLONASS ICD, 4.7),
+ * so that C1 to C7 and C_Sigma are all zero. Check bit k is the k-th bit
+ * counted from the end of the string, as in the index tables of
+ * GLONASS_L1_L2_CA.h.
+ */
+inline void glonass_gnav_set_check_bits(std::string &bits)
+{
+    auto bit = [&bits](int32_t k) -> char & { return bits[GLONASS_GNAV_STRING_BITS - k]; };
+    auto parity = [&bit](const std::vector<int32_t> &indexes) {
+        int32_t sum = 0;
+        for (int32_t i : indexes)
+            {
+                sum += bit(i) == '1' ? 1 : 0;
+            }
+        return sum % 2;
+    };
+    const std::vector<std::vector<int32_t>> check_indexes{GLONASS_GNAV_CRC_I_INDEX, GLONASS_GNAV_CRC_J_INDEX,
+        GLONASS_GNAV_CRC_K_INDEX, GLONASS_GNAV_CRC_L_INDEX, GLONASS_GNAV_CRC_M_INDEX, GLONASS_GNAV_CRC_N_INDEX,
+        GLONASS_GNAV_CRC_P_INDEX};
+    int32_t sum_hamming = 0;
+    for (int32_t k = 1; k <= 7; k++)
+        {
+            const int32_t check = parity(check_indexes[k - 1]);
+            bit(k) = check ? '1' : '0';
+            sum_hamming += check;
+        }
+    bit(8) = ((sum_hamming + parity(GLONASS_GNAV_CRC_Q_INDEX)) % 2) ? '1' : '0';
+}
+
+
+/*!
+ * \brief 85 bits of one of the immediate data strings 1 to 5 of a GNAV
+ * frame. The time of ephemeris t_b, in 15 minute units, must change from one
+ * frame to the next for a new ephemeris to be announced. The satellite slot
+ * number is 1, and every other field is zero.
+ */
+inline std::string glonass_gnav_string(uint32_t string_id, uint32_t t_b)
+{
+    std::string bits(GLONASS_GNAV_STRING_BITS, '0');
+    nav_message_set_field(bits, STRING_ID, string_id);
+    if (string_id == 2)
+        {
+            nav_message_set_field(bits, T_B, t_b);
+        }
+    if (string_id == 4)
+        {
+            nav_message_set_field(bits, N_T, 1);
+            nav_message_set_field(bits, N, 1);
+        }
+    if (string_id == 5)
+        {
+            nav_message_set_field(bits, N_4, 7);
+        }
+    glonass_gnav_set_check_bits(bits);
+    return bits;
+}
+
+
+/*!
+ * \brief 2000 symbols of a string, +1 for a 1 and -1 for a 0: the time mark
+ * followed by the relative and bi-binary coded data bits, each symbol lasting
+ * one code period. The decoder takes the time mark as the start of a string.
+ */
+inline std::vector<float> glonass_gnav_encode_string(const std::string &bits)
+{
+    std::vector<float> symbols;
+    symbols.reserve(GLONASS_GNAV_PREAMBLE_PERIOD_SYMBOLS);
+    const std::vector<int32_t> preamble = GLONASS_GNAV_PREAMBLE;
+    for (int32_t preamble_bit : preamble)
+        {
+            symbols.insert(symbols.end(), GLONASS_GNAV_TELEMETRY_SYMBOLS_PER_PREAMBLE_BIT, preamble_bit == 1 ? 1.0F : -1.0F);
+        }
+    bool relative = false;
+    for (char bit : bits)
+        {
+            relative = relative != (bit == '1');
+            symbols.insert(symbols.end(), GLONASS_GNAV_TELEMETRY_SYMBOLS_PER_BIT, relative ? 1.0F : -1.0F);
+            symbols.insert(symbols.end(), GLONASS_GNAV_TELEMETRY_SYMBOLS_PER_BIT, relative ? -1.0F : 1.0F);
+        }
+    return symbols;
+}
+
+#endif  // GNSS_SDR_GLONASS_GNAV_ENCODER_H
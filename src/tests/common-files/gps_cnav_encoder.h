@@ -0,0 +1,64 @@
+/*!
+ * \file gps_cnav_encoder.h
+ * \brief Helper file for unit testing. Encodes GPS L2C and L5 CNAV messages,
+ * with their CRC and FEC.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GPS_CNAV_ENCODER_H
+#define GNSS_SDR_GPS_CNAV_ENCODER_H
+
+#include "GPS_CNAV.h"
+#include "nav_message_encoder.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief 300 bits of a CNAV message (IS-GPS-200, 30.3.3) of the given type.
+ * Only the common fields and the time of ephemeris of messages 10 and 11 are
+ * set, so that a message 10 followed by a message 11 with the same toe makes
+ * up a new ephemeris. The remaining fields are all zeros.
+ */
+inline std::string gps_cnav_message(uint32_t prn, uint32_t msg_type, uint32_t tow_count, uint32_t toe)
+{
+    std::string bits = "10001011" + std::string(268, '0');
+    nav_message_set_field(bits, CNAV_PRN, prn);
+    nav_message_set_field(bits, CNAV_MSG_TYPE, msg_type);
+    nav_message_set_field(bits, CNAV_TOW, tow_count);
+    if (msg_type == 10)
+        {
+            nav_message_set_field(bits, CNAV_TOE1, toe);
+        }
+    if (msg_type == 11)
+        {
+            nav_message_set_field(bits, CNAV_TOE2, toe);
+        }
+    nav_message_append_crc24q(bits);
+    return bits;
+}
+
+
+/*!
+ * \brief 600 symbols of a CNAV message, +1 for a 1 and -1 for a 0. The FEC
+ * encoder runs continuously across messages, so state must be kept from one
+ * message to the next.
+ */
+inline std::vector<float> gps_cnav_encode_message(uint32_t prn, uint32_t msg_type, uint32_t tow_count, uint32_t toe, int &state)
+{
+    return nav_message_convolutional_encode(gps_cnav_message(prn, msg_type, tow_count, toe), state);
+}
+
+#endif  // GNSS_SDR_GPS_CNAV_ENCODER_H
@@ -0,0 +1,106 @@
+/*!
+ * \file gps_lnav_encoder.h
+ * \brief Helper file for unit testing. Encodes GPS LNAV words and subframes
+ * with their parity bits.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GPS_LNAV_ENCODER_H
+#define GNSS_SDR_GPS_LNAV_ENCODER_H
+
+#include <array>
+#include <cstdint>
+
+/*!
+ * \brief Returns the 30 bits of a word as transmitted, given its 24 data bits
+ * and the last transmitted word. Bit by bit parity equations of IS-GPS-200,
+ * Table 20-XIV.
+ */
+inline uint32_t gps_lnav_encode_word(uint32_t data, uint32_t prev_word)
+{
+    const uint32_t d29_star = (prev_word >> 1U) & 1U;
+    const uint32_t d30_star = prev_word & 1U;
+    auto d = [data](int i) { return (data >> (24 - i)) & 1U; };
+    const uint32_t D25 = d29_star ^ d(1) ^ d(2) ^ d(3) ^ d(5) ^ d(6) ^ d(10) ^ d(11) ^ d(12) ^ d(13) ^ d(14) ^ d(17) ^ d(18) ^ d(20) ^ d(23);
+    const uint32_t D26 = d30_star ^ d(2) ^ d(3) ^ d(4) ^ d(6) ^ d(7) ^ d(11) ^ d(12) ^ d(13) ^ d(14) ^ d(15) ^ d(18) ^ d(19) ^ d(21) ^ d(24);
+    const uint32_t D27 = d29_star ^ d(1) ^ d(3) ^ d(4) ^ d(5) ^ d(7) ^ d(8) ^ d(12) ^ d(13) ^ d(14) ^ d(15) ^ d(16) ^ d(19) ^ d(20) ^ d(22);
+    const uint32_t D28 = d30_star ^ d(2) ^ d(4) ^ d(5) ^ d(6) ^ d(8) ^ d(9) ^ d(13) ^ d(14) ^ d(15) ^ d(16) ^ d(17) ^ d(20) ^ d(21) ^ d(23);
+    const uint32_t D29 = d30_star ^ d(1) ^ d(3) ^ d(5) ^ d(6) ^ d(7) ^ d(9) ^ d(10) ^ d(14) ^ d(15) ^ d(16) ^ d(17) ^ d(18) ^ d(21) ^ d(22) ^ d(24);
+    const uint32_t D30 = d29_star ^ d(3) ^ d(5) ^ d(6) ^ d(8) ^ d(9) ^ d(10) ^ d(11) ^ d(13) ^ d(15) ^ d(19) ^ d(22) ^ d(23) ^ d(24);
+    const uint32_t tx_data = d30_star ? (~data & 0xFFFFFFU) : data;
+    return (tx_data << 6U) | (D25 << 5U) | (D26 << 4U) | (D27 << 3U) | (D28 << 2U) | (D29 << 1U) | D30;
+}
+
+
+/*!
+ * \brief Encodes a word whose last two data bits are the non-information bits
+ * that make D29 = D30 = 0, as IS-GPS-200 requires for words 2 and 10.
+ */
+inline uint32_t gps_lnav_encode_word_with_zero_tail(uint32_t data, uint32_t prev_word)
+{
+    for (uint32_t t = 0; t < 4; t++)
+        {
+            const uint32_t word = gps_lnav_encode_word((data & 0xFFFFFCU) | t, prev_word);
+            if ((word & 3U) == 0)
+                {
+                    return word;
+                }
+        }
+    return gps_lnav_encode_word(data, prev_word);
+}
+
+
+/*!
+ * \brief Encodes the ten words of a subframe, given their data bits and the
+ * last word of the previous subframe.
+ */
+inline std::array<uint32_t, 10> gps_lnav_encode_subframe(const std::array<uint32_t, 10> &data, uint32_t prev_word)
+{
+    std::array<uint32_t, 10> words{};
+    for (int32_t w = 0; w < 10; w++)
+        {
+            words[w] = gps_lnav_encode_word(data[w], prev_word);
+            prev_word = words[w];
+        }
+    return words;
+}
+
+
+/*!
+ * \brief Encodes a subframe with the given TOW count and subframe ID in the
+ * HOW. Words 2 and 10 end with the two non-information bits that make
+ * D29 = D30 = 0. The other words are all zeros.
+ */
+inline std::array<uint32_t, 10> gps_lnav_encode_subframe(uint32_t tow_count, uint32_t subframe_id, uint32_t prev_word)
+{
+    std::array<uint32_t, 10> words{};
+    for (int32_t w = 0; w < 10; w++)
+        {
+            uint32_t data = 0U;
+            if (w == 0)
+                {
+                    data = 0x8B0000U;  // preamble
+                }
+            else if (w == 1)
+                {
+                    data = (tow_count << 7U) | (subframe_id << 2U);
+                }
+            words[w] = (w == 1 or w == 9) ? gps_lnav_encode_word_with_zero_tail(data, prev_word) : gps_lnav_encode_word(data, prev_word);
+            prev_word = words[w];
+        }
+    return words;
+}
+
+#endif  // GNSS_SDR_GPS_LNAV_ENCODER_H
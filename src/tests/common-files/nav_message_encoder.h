@@ -0,0 +1,109 @@
+/*!
+ * \file nav_message_encoder.h
+ * \brief Helper file for unit testing. Field packing, CRC-24Q and
+ * convolutional encoding shared by the navigation message encoders.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_NAV_MESSAGE_ENCODER_H
+#define GNSS_SDR_NAV_MESSAGE_ENCODER_H
+
+#include "convolutional.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Writes value, MSB first, into a field of a message given as a string
+ * of '0' and '1'. Bits are numbered from 1 at the start of the string, as in
+ * the field definitions of the system parameter headers.
+ */
+inline void nav_message_set_field(std::string &bits, const std::vector<std::pair<int32_t, int32_t>> &field, uint64_t value)
+{
+    int32_t remaining = 0;
+    for (const auto &part : field)
+        {
+            remaining += part.second;
+        }
+    for (const auto &part : field)
+        {
+            for (int32_t i = 0; i < part.second; i++)
+                {
+                    remaining--;
+                    bits[part.first - 1 + i] = ((value >> static_cast<uint32_t>(remaining)) & 1U) ? '1' : '0';
+                }
+        }
+}
+
+
+/*!
+ * \brief CRC-24Q of a string of '0' and '1', as used by GPS CNAV, SBAS and
+ * Galileo (Galileo OS SIS ICD, 4.3.2.3).
+ */
+inline uint32_t nav_message_crc24q(const std::string &bits)
+{
+    uint32_t crc = 0U;
+    for (char bit : bits)
+        {
+            const uint32_t feedback = ((crc >> 23U) & 1U) ^ (bit == '1' ? 1U : 0U);
+            crc = (crc << 1U) & 0xFFFFFFU;
+            if (feedback)
+                {
+                    crc ^= 0x864CFBU;
+                }
+        }
+    return crc;
+}
+
+
+/*!
+ * \brief Appends the CRC-24Q of bits to it.
+ */
+inline void nav_message_append_crc24q(std::string &bits)
+{
+    const uint32_t crc = nav_message_crc24q(bits);
+    for (int32_t b = 23; b >= 0; b--)
+        {
+            bits.push_back(((crc >> static_cast<uint32_t>(b)) & 1U) ? '1' : '0');
+        }
+}
+
+
+/*!
+ * \brief Encodes bits with the rate 1/2, constraint length 7 convolutional
+ * code of GPS, SBAS and Galileo (G1 = 171, G2 = 133 octal), giving the G1
+ * and then the G2 symbol of each bit, +1 for a 1 and -1 for a 0. The state
+ * of the encoder is kept in state, so that a continuous stream can be encoded
+ * message by message. Galileo inverts the G2 output.
+ */
+inline std::vector<float> nav_message_convolutional_encode(const std::string &bits, int &state, bool invert_g2 = false)
+{
+    const std::array<int, 2> g_encoder{{121, 91}};  // Polynomial G1 and G2
+    std::vector<float> symbols;
+    symbols.reserve(2 * bits.size());
+    for (char bit : bits)
+        {
+            int next_state = 0;
+            const int out = nsc_enc_bit(&next_state, bit == '1' ? 1 : 0, state, g_encoder.data(), 7, 2);
+            state = next_state;
+            symbols.push_back((out & 2) ? 1.0F : -1.0F);
+            symbols.push_back(((out & 1) != 0) != invert_g2 ? 1.0F : -1.0F);
+        }
+    return symbols;
+}
+
+#endif  // GNSS_SDR_NAV_MESSAGE_ENCODER_H
@@ -0,0 +1,53 @@
+/*!
+ * \file sbas_l1_encoder.h
+ * \brief Helper file for unit testing. Encodes SBAS L1 messages, with their
+ * CRC and FEC.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_SBAS_L1_ENCODER_H
+#define GNSS_SDR_SBAS_L1_ENCODER_H
+
+#include "nav_message_encoder.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*!
+ * \brief 250 bits of an SBAS message (RTCA DO-229, A.4.2). The preamble
+ * rotates over three consecutive messages, as given by count. The message is
+ * a type 0 (do not use for safety applications) with a zero payload.
+ */
+inline std::string sbas_l1_message(uint32_t count)
+{
+    const std::array<const char *, 3> preambles{{"01010011", "10011010", "11000110"}};
+    std::string bits = std::string(preambles[count % 3]) + std::string(218, '0');
+    nav_message_append_crc24q(bits);
+    return bits;
+}
+
+
+/*!
+ * \brief 500 symbols of an SBAS message, +1 for a 1 and -1 for a 0. The FEC
+ * encoder runs continuously across messages, so state must be kept from one
+ * message to the next.
+ */
+inline std::vector<float> sbas_l1_encode_message(uint32_t count, int &state)
+{
+    return nav_message_convolutional_encode(sbas_l1_message(count), state);
+}
+
+#endif  // GNSS_SDR_SBAS_L1_ENCODER_H
@@ -50,12 +50,15 @@ DECLARE_string(log_dir);
 #include "unit-tests/arithmetic/magnitude_squared_test.cc"
 #include "unit-tests/arithmetic/multiply_test.cc"
 #include "unit-tests/arithmetic/preamble_correlator_test.cc"
+#include "unit-tests/arithmetic/volk_gnsssdr_alloc_test.cc"
+#include "unit-tests/arithmetic/volk_gnsssdr_taps_test.cc"
 #include "unit-tests/control-plane/control_thread_test.cc"
 #include "unit-tests/control-plane/file_configuration_test.cc"
 #include "unit-tests/control-plane/gnss_block_factory_test.cc"
 #include "unit-tests/control-plane/gnss_flowgraph_test.cc"
 #include "unit-tests/control-plane/in_memory_configuration_test.cc"
 #include "unit-tests/control-plane/protobuf_test.cc"
+#include "unit-tests/control-plane/replay_clock_test.cc"
 #include "unit-tests/control-plane/string_converter_test.cc"
 #include "unit-tests/signal-processing-blocks/acquisition/galileo_e1_pcps_8ms_ambiguous_acquisition_gsoc2013_test.cc"
 #include "unit-tests/signal-processing-blocks/acquisition/galileo_e1_pcps_ambiguous_acquisition_gsoc2013_test.cc"
@@ -73,14 +76,22 @@ DECLARE_string(log_dir);
 #include "unit-tests/signal-processing-blocks/acquisition/gps_l1_ca_pcps_tong_acquisition_gsoc2013_test.cc"
 #include "unit-tests/signal-processing-blocks/adapter/adapter_test.cc"
 #include "unit-tests/signal-processing-blocks/adapter/pass_through_test.cc"
+#include "unit-tests/signal-processing-blocks/filter/channelizer_filter_test.cc"
 #include "unit-tests/signal-processing-blocks/filter/fir_filter_test.cc"
 #include "unit-tests/signal-processing-blocks/filter/notch_filter_lite_test.cc"
 #include "unit-tests/signal-processing-blocks/filter/notch_filter_test.cc"
 #include "unit-tests/signal-processing-blocks/filter/pulse_blanking_filter_test.cc"
 #include "unit-tests/signal-processing-blocks/resampler/direct_resampler_conditioner_cc_test.cc"
 #include "unit-tests/signal-processing-blocks/resampler/mmse_resampler_test.cc"
+#include "unit-tests/signal-processing-blocks/sources/capture_file_writer_test.cc"
+#include "unit-tests/signal-processing-blocks/sources/capture_tap_test.cc"
 #include "unit-tests/signal-processing-blocks/sources/file_signal_source_test.cc"
 #include "unit-tests/signal-processing-blocks/sources/gnss_sdr_valve_test.cc"
+#include "unit-tests/signal-processing-blocks/sources/mmap_file_source_test.cc"
+#include "unit-tests/signal-processing-blocks/sources/multichannel_file_source_test.cc"
+#include "unit-tests/signal-processing-blocks/sources/sequential_file_test.cc"
+#include "unit-tests/signal-processing-blocks/sources/spsc_ring_buffer_test.cc"
+#include "unit-tests/signal-processing-blocks/sources/udp_payload_fifo_test.cc"
 #include "unit-tests/signal-processing-blocks/sources/unpack_2bit_samples_test.cc"
 // #include "unit-tests/signal-processing-blocks/acquisition/glonass_l2_ca_pcps_acquisition_test.cc"
 #include "unit-tests/signal-processing-blocks/libs/item_type_helpers_test.cc"
@@ -120,7 +131,12 @@ DECLARE_string(log_dir);
 #include "unit-tests/signal-processing-blocks/pvt/rtcm_printer_test.cc"
 #include "unit-tests/signal-processing-blocks/pvt/rtcm_test.cc"
 #include "unit-tests/signal-processing-blocks/pvt/serdes_monitor_pvt_test.cc"
+#include "unit-tests/signal-processing-blocks/telemetry_decoder/deinterleaver_test.cc"
 #include "unit-tests/signal-processing-blocks/telemetry_decoder/galileo_fnav_inav_decoder_test.cc"
+#include "unit-tests/signal-processing-blocks/telemetry_decoder/galileo_telemetry_decoder_offload_test.cc"
+#include "unit-tests/signal-processing-blocks/telemetry_decoder/gps_l1_ca_assisted_tow_test.cc"
+#include "unit-tests/signal-processing-blocks/telemetry_decoder/nav_bit_decoding_test.cc"
+#include "unit-tests/signal-processing-blocks/telemetry_decoder/tlm_decoding_pool_test.cc"
 #include "unit-tests/system-parameters/glonass_gnav_crc_test.cc"
 #include "unit-tests/system-parameters/glonass_gnav_ephemeris_test.cc"
 #include "unit-tests/system-parameters/glonass_gnav_nav_message_test.cc"
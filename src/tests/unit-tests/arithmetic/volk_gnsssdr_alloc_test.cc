@@ -0,0 +1,98 @@
+/*!
+ * \file volk_gnsssdr_alloc_test.cc
+ * \brief  This file implements tests for the huge page backed allocations of
+ * volk_gnsssdr::vector and their accounting per subsystem.
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+volk_gnsssdr_alloc_stats_t subsystem_stats(const std::string& subsystem)
+{
+    std::vector<volk_gnsssdr_alloc_stats_t> stats(volk_gnsssdr_get_alloc_stats(nullptr, 0));
+    stats.resize(volk_gnsssdr_get_alloc_stats(stats.data(), stats.size()));
+    for (const auto& s : stats)
+        {
+            if (subsystem == s.subsystem)
+                {
+                    return s;
+                }
+        }
+    return volk_gnsssdr_alloc_stats_t{};
+}
+}  // namespace
+
+
+TEST(VolkGnsssdrAllocTest, HugePageModes)
+{
+    const volk_gnsssdr_page_mode_t initial_mode = volk_gnsssdr_get_page_mode();
+    for (const auto mode : {VOLK_GNSSSDR_PAGES_DEFAULT, VOLK_GNSSSDR_PAGES_TRANSPARENT_HUGE, VOLK_GNSSSDR_PAGES_EXPLICIT_HUGE})
+        {
+            volk_gnsssdr_set_page_mode(mode);
+            // small, size class and dedicated region allocations
+            for (const size_t n : {100, 20000, 100000, 1000000})
+                {
+                    volk_gnsssdr::vector<std::complex<float>> v(n);
+                    ASSERT_EQ(reinterpret_cast<uintptr_t>(v.data()) % volk_gnsssdr_get_alignment(), 0U);
+                    std::iota(reinterpret_cast<float*>(v.data()), reinterpret_cast<float*>(v.data() + n), 0.0F);
+                    EXPECT_EQ(v[n - 1], std::complex<float>(static_cast<float>(2 * n - 2), static_cast<float>(2 * n - 1)));
+                    v.resize(2 * n);  // moves the data to a larger block
+                    EXPECT_EQ(v[n - 1], std::complex<float>(static_cast<float>(2 * n - 2), static_cast<float>(2 * n - 1)));
+                }
+        }
+    volk_gnsssdr_set_page_mode(initial_mode);
+}
+
+
+// huge pages and accounting are only available on Linux
+#if defined(__linux__)
+TEST(VolkGnsssdrAllocTest, SubsystemAccounting)
+{
+    const volk_gnsssdr_page_mode_t initial_mode = volk_gnsssdr_get_page_mode();
+    volk_gnsssdr_set_page_mode(VOLK_GNSSSDR_PAGES_TRANSPARENT_HUGE);
+    const size_t n = 50000;
+    {
+        volk_gnsssdr::alloc_subsystem_scope scope("AllocTest");
+        volk_gnsssdr::vector<float> large(n);
+        volk_gnsssdr::vector<float> small(100);  // below VOLK_GNSSSDR_LARGE_ALLOC_MIN_BYTES, not accounted
+        {
+            volk_gnsssdr::alloc_subsystem_scope nested_scope("AllocTestNested");
+            volk_gnsssdr::vector<float> nested(n);
+            EXPECT_EQ(subsystem_stats("AllocTestNested").bytes, n * sizeof(float));
+        }
+        EXPECT_EQ(std::string(volk_gnsssdr_get_alloc_subsystem()), "AllocTest");
+        const volk_gnsssdr_alloc_stats_t stats = subsystem_stats("AllocTest");
+        EXPECT_EQ(stats.bytes, n * sizeof(float));
+        EXPECT_EQ(stats.allocations, 1U);
+        EXPECT_EQ(stats.huge_page_bytes, n * sizeof(float));
+        EXPECT_EQ(subsystem_stats("AllocTestNested").bytes, 0U);
+        EXPECT_EQ(subsystem_stats("AllocTestNested").peak_bytes, n * sizeof(float));
+    }
+    EXPECT_EQ(subsystem_stats("AllocTest").bytes, 0U);
+    EXPECT_EQ(subsystem_stats("AllocTest").allocations, 0U);
+    volk_gnsssdr_set_page_mode(initial_mode);
+}
+#endif
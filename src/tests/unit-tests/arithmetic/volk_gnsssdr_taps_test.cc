@@ -0,0 +1,163 @@
+/*!
+ * \file volk_gnsssdr_taps_test.cc
+ * \brief  This file implements tests for the correlator kernels of
+ * volk_gnsssdr at every number of taps, comparing each implementation with the
+ * generic one. The SIMD implementations are specialised for 1, 3, 4, 5 and 6
+ * taps, and the QA puppets of volk_gnsssdr only use 3.
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+const int MAX_TAPS = 8;                      // 2, 7 and 8 taps take the generic path of the SIMD implementations
+const unsigned int TAPS_TEST_POINTS = 2047;  // not a multiple of the vector length, so that the tails are checked
+const unsigned int TAPS_TEST_CODE_LENGTH = 1023;
+
+// Runs the implementation impl_name of a kernel for a number of taps
+using Taps_Kernel_Call = std::function<void(lv_32fc_t* result, int num_taps, const char* impl_name)>;
+
+
+void expect_impls_match_generic(const volk_gnsssdr_func_desc_t& desc, const Taps_Kernel_Call& run_kernel)
+{
+    volk_gnsssdr::vector<lv_32fc_t> expected(MAX_TAPS);
+    volk_gnsssdr::vector<lv_32fc_t> result(MAX_TAPS);
+    for (int num_taps = 1; num_taps <= MAX_TAPS; num_taps++)
+        {
+            run_kernel(expected.data(), num_taps, "generic");
+            for (size_t i = 0; i < desc.n_impls; i++)
+                {
+                    if (std::string(desc.impl_names[i]) == "generic")
+                        {
+                            continue;
+                        }
+                    std::fill(result.begin(), result.end(), lv_32fc_t(0.0, 0.0));
+                    run_kernel(result.data(), num_taps, desc.impl_names[i]);
+                    for (int tap = 0; tap < num_taps; tap++)
+                        {
+                            const float tolerance = 1e-3F * std::abs(expected[tap]) + 1e-2F;
+                            EXPECT_NEAR(result[tap].real(), expected[tap].real(), tolerance) << desc.impl_names[i] << " with " << num_taps << " taps, tap " << tap;
+                            EXPECT_NEAR(result[tap].imag(), expected[tap].imag(), tolerance) << desc.impl_names[i] << " with " << num_taps << " taps, tap " << tap;
+                        }
+                }
+        }
+}
+
+
+// Random samples and binary codes, with a different code and shift for each tap
+struct Taps_Test_Buffers
+{
+    Taps_Test_Buffers()
+        : in_32fc(TAPS_TEST_POINTS),
+          in_16ic(TAPS_TEST_POINTS),
+          in_8ic(TAPS_TEST_POINTS),
+          shifts_chips(MAX_TAPS)
+    {
+        std::mt19937 gen(1);
+        std::uniform_int_distribution<int> samples(-100, 100);
+        std::uniform_int_distribution<int> bits(0, 1);
+        for (unsigned int n = 0; n < TAPS_TEST_POINTS; n++)
+            {
+                const int re = samples(gen);
+                const int im = samples(gen);
+                in_32fc[n] = lv_32fc_t(static_cast<float>(re), static_cast<float>(im));
+                in_16ic[n] = lv_16sc_t(static_cast<int16_t>(re), static_cast<int16_t>(im));
+                in_8ic[n] = lv_8sc_t(static_cast<int8_t>(re), static_cast<int8_t>(im));
+            }
+        for (int tap = 0; tap < MAX_TAPS; tap++)
+            {
+                shifts_chips[tap] = 0.5F * static_cast<float>(tap - MAX_TAPS / 2);
+                codes.emplace_back(TAPS_TEST_CODE_LENGTH);
+                replicas.emplace_back(TAPS_TEST_POINTS);
+                packed_replicas.emplace_back((TAPS_TEST_POINTS + 31) / 32, 0U);
+                for (unsigned int n = 0; n < TAPS_TEST_CODE_LENGTH; n++)
+                    {
+                        codes[tap][n] = bits(gen) ? 1.0F : -1.0F;
+                    }
+                for (unsigned int n = 0; n < TAPS_TEST_POINTS; n++)
+                    {
+                        replicas[tap][n] = codes[tap][n % TAPS_TEST_CODE_LENGTH];
+                        if (replicas[tap][n] < 0.0F)
+                            {
+                                packed_replicas[tap][n / 32] |= 1U << (n % 32);
+                            }
+                    }
+            }
+        for (int tap = 0; tap < MAX_TAPS; tap++)
+            {
+                code_ptrs.push_back(codes[tap].data());
+                replica_ptrs.push_back(replicas[tap].data());
+                packed_replica_ptrs.push_back(packed_replicas[tap].data());
+            }
+    }
+
+    volk_gnsssdr::vector<lv_32fc_t> in_32fc;
+    volk_gnsssdr::vector<lv_16sc_t> in_16ic;
+    volk_gnsssdr::vector<lv_8sc_t> in_8ic;
+    volk_gnsssdr::vector<float> shifts_chips;
+    std::vector<volk_gnsssdr::vector<float>> codes;
+    std::vector<volk_gnsssdr::vector<float>> replicas;
+    std::vector<volk_gnsssdr::vector<uint32_t>> packed_replicas;
+    std::vector<const float*> code_ptrs;
+    std::vector<const float*> replica_ptrs;
+    std::vector<const uint32_t*> packed_replica_ptrs;
+};
+}  // namespace
+
+
+TEST(VolkGnsssdrTapsTest, ResamplerRotatorDotProd)
+{
+    Taps_Test_Buffers b;
+    const float code_phase_step_chips = (static_cast<float>(TAPS_TEST_CODE_LENGTH) + 0.1F) / static_cast<float>(TAPS_TEST_POINTS);
+    expect_impls_match_generic(volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn_get_func_desc(), [&](lv_32fc_t* result, int num_taps, const char* impl_name) {
+        double phase_rad = 0.25;
+        volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn_manual(result, b.in_32fc.data(), 0.1, &phase_rad, b.code_ptrs.data(), -0.234F, code_phase_step_chips, 1e-8F, b.shifts_chips.data(), TAPS_TEST_CODE_LENGTH, num_taps, TAPS_TEST_POINTS, impl_name);
+    });
+    expect_impls_match_generic(volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_get_func_desc(), [&](lv_32fc_t* result, int num_taps, const char* impl_name) {
+        double phase_rad = 0.25;
+        volk_gnsssdr_16ic_32f_resampler_rotator_dot_prod_32fc_xn_manual(result, b.in_16ic.data(), 0.1, &phase_rad, b.code_ptrs.data(), -0.234F, code_phase_step_chips, 1e-8F, b.shifts_chips.data(), TAPS_TEST_CODE_LENGTH, num_taps, TAPS_TEST_POINTS, impl_name);
+    });
+    expect_impls_match_generic(volk_gnsssdr_8ic_32f_resampler_rotator_dot_prod_32fc_xn_get_func_desc(), [&](lv_32fc_t* result, int num_taps, const char* impl_name) {
+        double phase_rad = 0.25;
+        volk_gnsssdr_8ic_32f_resampler_rotator_dot_prod_32fc_xn_manual(result, b.in_8ic.data(), 0.1, &phase_rad, b.code_ptrs.data(), -0.234F, code_phase_step_chips, 1e-8F, b.shifts_chips.data(), TAPS_TEST_CODE_LENGTH, num_taps, TAPS_TEST_POINTS, impl_name);
+    });
+}
+
+
+TEST(VolkGnsssdrTapsTest, RotatorDotProd)
+{
+    Taps_Test_Buffers b;
+    expect_impls_match_generic(volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_get_func_desc(), [&](lv_32fc_t* result, int num_taps, const char* impl_name) {
+        lv_32fc_t phase(std::cos(0.25F), std::sin(0.25F));
+        const lv_32fc_t phase_inc(std::cos(0.1F), std::sin(0.1F));
+        volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn_manual(result, b.in_32fc.data(), phase_inc, &phase, b.replica_ptrs.data(), num_taps, TAPS_TEST_POINTS, impl_name);
+    });
+    expect_impls_match_generic(volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_get_func_desc(), [&](lv_32fc_t* result, int num_taps, const char* impl_name) {
+        double phase_rad = 0.25;
+        volk_gnsssdr_32fc_32u_rotator_dot_prod_32fc_xn_manual(result, b.in_32fc.data(), 0.1, &phase_rad, b.packed_replica_ptrs.data(), num_taps, TAPS_TEST_POINTS, impl_name);
+    });
+}
@@ -29,8 +29,13 @@
 #include "gnss_flowgraph.h"
 #include "in_memory_configuration.h"
 #include "pass_through.h"
+#include "pcps_acquisition.h"
 #include "tracking_interface.h"
 #include <gtest/gtest.h>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
 
 
 TEST(GNSSFlowgraph /*unused*/, InstantiateConnectStartStopOldNotation /*unused*/)
@@ -252,3 +257,88 @@ TEST(GNSSFlowgraph /*unused*/, InstantiateConnectStartStopHybrid /*unused*/)
     flowgraph->stop();
     EXPECT_FALSE(flowgraph->running());
 }
+
+
+namespace
+{
+// Two GPS L1 C/A and two Galileo E1 channels on the same RF channel, at 8 Msps
+std::shared_ptr<InMemoryConfiguration> make_acquisition_resampler_config()
+{
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", "8000000");
+    config->set_property("GNSS-SDR.use_acquisition_resampler", "true");
+    config->set_property("SignalSource.sampling_frequency", "8000000");
+    config->set_property("SignalSource.implementation", "File_Signal_Source");
+    config->set_property("SignalSource.item_type", "gr_complex");
+    config->set_property("SignalSource.repeat", "true");
+    std::string path = std::string(TEST_PATH);
+    std::string filename = path + "signal_samples/Galileo_E1_ID_1_Fs_4Msps_8ms.dat";
+    config->set_property("SignalSource.filename", filename);
+    config->set_property("SignalConditioner.implementation", "Pass_Through");
+    config->set_property("Channels_1C.count", "2");
+    config->set_property("Channels_1B.count", "2");
+    config->set_property("Channels.in_acquisition", "1");
+    config->set_property("Acquisition_1C.implementation", "GPS_L1_CA_PCPS_Acquisition");
+    config->set_property("Acquisition_1C.threshold", "1");
+    config->set_property("Acquisition_1C.doppler_max", "5000");
+    config->set_property("Tracking_1C.implementation", "GPS_L1_CA_DLL_PLL_Tracking");
+    config->set_property("TelemetryDecoder_1C.implementation", "GPS_L1_CA_Telemetry_Decoder");
+    config->set_property("Acquisition_1B.implementation", "Galileo_E1_PCPS_Ambiguous_Acquisition");
+    config->set_property("Acquisition_1B.threshold", "1");
+    config->set_property("Acquisition_1B.doppler_max", "5000");
+    config->set_property("Tracking_1B.implementation", "Galileo_E1_DLL_PLL_VEML_Tracking");
+    config->set_property("TelemetryDecoder_1B.implementation", "Galileo_E1B_Telemetry_Decoder");
+    config->set_property("Observables.implementation", "Hybrid_Observables");
+    config->set_property("PVT.implementation", "RTKLIB_PVT");
+    return config;
+}
+
+
+// Connects the flowgraph, and checks the number of decimators and the
+// sampling rate expected by the acquisition block of each channel
+void expect_acquisition_resamplers(const std::shared_ptr<InMemoryConfiguration>& config, std::size_t resamplers, const std::map<std::string, int64_t>& acq_fs)
+{
+    std::shared_ptr<GNSSFlowgraph> flowgraph = std::make_shared<GNSSFlowgraph>(config, std::make_shared<Concurrent_Queue<pmt::pmt_t>>());
+    EXPECT_NO_THROW(flowgraph->connect());
+    ASSERT_TRUE(flowgraph->connected());
+    EXPECT_EQ(flowgraph->acquisition_resamplers(), resamplers);
+    for (int i = 0; i < 4; i++)
+        {
+            std::shared_ptr<Channel> channel = std::dynamic_pointer_cast<Channel>(flowgraph->get_channel(i));
+            ASSERT_TRUE(channel != nullptr);
+#if GNURADIO_USES_STD_POINTERS
+            const auto acquisition = std::dynamic_pointer_cast<pcps_acquisition>(channel->acquisition()->get_right_block());
+#else
+            const auto acquisition = boost::dynamic_pointer_cast<pcps_acquisition>(channel->acquisition()->get_right_block());
+#endif
+            ASSERT_TRUE(acquisition != nullptr);
+            EXPECT_EQ(acquisition->resampled_fs(), acq_fs.at(channel->implementation())) << "in channel " << i << " (" << channel->implementation() << ")";
+        }
+}
+}  // namespace
+
+
+TEST(GNSSFlowgraph /*unused*/, SharedAcquisitionResamplers /*unused*/)
+{
+    // GPS L1 C/A and Galileo E1 are acquired at 2 Msps by default: one decimator by 4
+    std::shared_ptr<InMemoryConfiguration> config = make_acquisition_resampler_config();
+    expect_acquisition_resamplers(config, 1, {{"1C", 2000000}, {"1B", 2000000}});
+
+    // Galileo E1 at 4 Msps needs its own decimator by 2
+    config = make_acquisition_resampler_config();
+    config->set_property("Acquisition_1B.resampler_fs_sps", "4000000");
+    expect_acquisition_resamplers(config, 2, {{"1C", 2000000}, {"1B", 4000000}});
+
+    // different rates that round to the same decimation factor share it
+    config = make_acquisition_resampler_config();
+    config->set_property("Acquisition_1C.resampler_fs_sps", "4000000");
+    config->set_property("Acquisition_1B.resampler_fs_sps", "3000000");
+    expect_acquisition_resamplers(config, 1, {{"1C", 4000000}, {"1B", 4000000}});
+
+    // at 2 Msps only a target rate below the built-in one needs a decimator
+    config = make_acquisition_resampler_config();
+    config->set_property("GNSS-SDR.internal_fs_sps", "2000000");
+    config->set_property("SignalSource.sampling_frequency", "2000000");
+    config->set_property("Acquisition_1C.resampler_fs_sps", "1000000");
+    expect_acquisition_resamplers(config, 1, {{"1C", 1000000}, {"1B", 2000000}});
+}
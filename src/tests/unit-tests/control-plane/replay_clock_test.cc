@@ -0,0 +1,155 @@
+/*!
+ * \file replay_clock_test.cc
+ * \brief  This file implements unit tests for the Replay_Clock class.
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gps_l1_ca_pcps_acquisition.h"
+#include "in_memory_configuration.h"
+#include "replay_clock.h"
+#include <gnuradio/blocks/head.h>
+#include <gnuradio/top_block.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/analog/sig_source.h>
+#else
+#include <gnuradio/analog/sig_source_c.h>
+#endif
+
+
+TEST(ReplayClockTest, DeferredEventsAtEpochBoundaries)
+{
+    // epochs of 1 ms, ticks every 2 ms
+    Replay_Clock& clock = Replay_Clock::get();
+    clock.enable(0.001, 0.002);
+    const int fast = clock.register_consumer(nullptr, 4e6);
+    const int slow = clock.register_consumer(nullptr, 2e6);
+    ASSERT_GE(fast, 0);
+    ASSERT_GE(slow, 0);
+
+    const uint64_t epochs = 20;
+    std::atomic<uint64_t> fast_counter(0);
+    std::atomic<uint64_t> slow_counter(0);
+    std::mutex log_mutex;
+    std::vector<uint32_t> order;
+    std::vector<uint64_t> fast_at_event;
+    std::vector<uint64_t> slow_at_event;
+    std::atomic<int> ticks(0);
+
+    clock.start([&ticks] { ticks++; });
+
+    auto consume = [&](int id, uint64_t chunk, uint64_t total, std::atomic<uint64_t>& counter, bool post_events) {
+        while (counter < total)
+            {
+                const uint64_t n = std::min(chunk, clock.wait(id, counter));
+                counter += n;
+                if (post_events and counter % 4000 == 0)
+                    {
+                        // two events in the same epoch, posted in reverse channel order
+                        for (uint32_t channel : {3U, 1U})
+                            {
+                                clock.event_posted();
+                                clock.defer(channel, [&, channel] {
+                                    std::lock_guard<std::mutex> lock(log_mutex);
+                                    order.push_back(channel);
+                                    fast_at_event.push_back(fast_counter);
+                                    slow_at_event.push_back(slow_counter);
+                                });
+                            }
+                    }
+            }
+        clock.unregister_consumer(id);
+    };
+
+    std::thread fast_thread(consume, fast, 1000, epochs * 4000, std::ref(fast_counter), true);
+    std::thread slow_thread(consume, slow, 3000, epochs * 2000, std::ref(slow_counter), false);
+    fast_thread.join();
+    slow_thread.join();
+    clock.stop();
+
+    // the events of the last epoch are posted once the other consumer is gone
+    ASSERT_EQ(order.size(), 2 * (epochs - 1));
+    for (size_t i = 0; i < order.size(); i += 2)
+        {
+            EXPECT_EQ(order[i], 1U);
+            EXPECT_EQ(order[i + 1], 3U);
+            const uint64_t epoch = i / 2 + 1;
+            EXPECT_EQ(fast_at_event[i], epoch * 4000);
+            EXPECT_EQ(slow_at_event[i], epoch * 2000);
+        }
+    EXPECT_EQ(ticks, static_cast<int>((epochs - 1) / 2));
+    EXPECT_FALSE(clock.enabled());
+}
+
+
+TEST(ReplayClockTest, IdleAcquisitionBlockingOnStandby)
+{
+    // epochs of 1 ms at 4 Msps
+    Replay_Clock& clock = Replay_Clock::get();
+    clock.enable(0.001, 0.01);
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", "4000000");
+    config->set_property("Acquisition_1C.item_type", "gr_complex");
+    config->set_property("Acquisition_1C.coherent_integration_time_ms", "1");
+    config->set_property("Acquisition_1C.doppler_max", "5000");
+    config->set_property("Acquisition_1C.doppler_step", "250");
+    config->set_property("Acquisition_1C.blocking_on_standby", "true");
+    auto acquisition = std::make_shared<GpsL1CaPcpsAcquisition>(config.get(), "Acquisition_1C", 1, 0);
+
+    // the acquisition is never activated, so it has to consume the samples
+    // on standby for the epochs to complete
+    const uint64_t epochs = 20;
+    auto top_block = gr::make_top_block("Replay clock test");
+    auto source = gr::analog::sig_source_c::make(4e6, gr::analog::GR_SIN_WAVE, 1000, 1, gr_complex(0));
+    auto head = gr::blocks::head::make(sizeof(gr_complex), epochs * 4000);
+    acquisition->connect(top_block);
+    top_block->connect(source, 0, head, 0);
+    top_block->connect(head, 0, acquisition->get_left_block(), 0);
+
+    clock.start([] {});
+    top_block->start();
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (clock.epoch() < epochs and std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    const uint64_t epoch = clock.epoch();
+    clock.stop();
+    top_block->stop();
+    top_block->wait();
+
+    EXPECT_EQ(epoch, epochs);
+    EXPECT_FALSE(clock.enabled());
+}
+
+
+TEST(ReplayClockTest, DisabledByDefault)
+{
+    Replay_Clock& clock = Replay_Clock::get();
+    EXPECT_FALSE(clock.enabled());
+    EXPECT_EQ(clock.register_consumer(nullptr, 4e6), -1);
+    // events are ignored, and nothing waits
+    clock.event_posted();
+    clock.event_handled();
+}
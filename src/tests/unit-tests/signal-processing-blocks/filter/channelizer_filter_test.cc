@@ -0,0 +1,94 @@
+/*!
+ * \file channelizer_filter_test.cc
+ * \brief Implements Unit Test for the ChannelizerFilter class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "channelizer_filter.h"
+#include "gnss_sdr_make_unique.h"
+#include "in_memory_configuration.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
+
+
+TEST(ChannelizerFilterTest, TonesAtSubBandCenters)
+{
+    // two sub-bands, neither of them at the center of an FFT channel
+    const double fs = 8e6;
+    const std::vector<double> freqs{-1.2e6, 2.3e6};
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("InputFilter.sampling_frequency", "8000000");
+    config->set_property("InputFilter.decimation_factor", "4");
+    config->set_property("InputFilter.fft_size", "16");
+    config->set_property("InputFilter.sub_bands", "2");
+    config->set_property("InputFilter.IF0", "-1200000");
+    config->set_property("InputFilter.IF1", "2300000");
+    config->set_property("InputFilter.bw0", "800000");
+    config->set_property("InputFilter.bw1", "800000");
+    auto filter = std::make_unique<ChannelizerFilter>(config.get(), "InputFilter", 1, 1);
+    ASSERT_TRUE(filter->get_right_block() != nullptr);
+    EXPECT_EQ(filter->get_right_block()->output_signature()->max_streams(), 2);
+
+    // one tone at the center of each sub-band
+    std::vector<gr_complex> samples(40000);
+    for (size_t n = 0; n < samples.size(); n++)
+        {
+            gr_complex sample(0.0, 0.0);
+            for (const double freq : freqs)
+                {
+                    const double phase = 2.0 * M_PI * std::fmod(freq * static_cast<double>(n) / fs, 1.0);
+                    sample += gr_complex(std::cos(phase), std::sin(phase));
+                }
+            samples[n] = sample;
+        }
+
+    auto top_block = gr::make_top_block("ChannelizerFilterTest");
+    auto source = gr::blocks::vector_source_c::make(samples);
+    auto sink0 = gr::blocks::vector_sink_c::make();
+    auto sink1 = gr::blocks::vector_sink_c::make();
+    filter->connect(top_block);
+    top_block->connect(source, 0, filter->get_left_block(), 0);
+    top_block->connect(filter->get_right_block(), 0, sink0, 0);
+    top_block->connect(filter->get_right_block(), 1, sink1, 0);
+    top_block->run();
+
+    // each output is its own tone at zero frequency, without the other one
+    for (const auto& sink : {sink0, sink1})
+        {
+            const std::vector<gr_complex> output = sink->data();
+            ASSERT_GT(output.size(), 9000U);
+            double max_gain_error = 0.0;
+            double max_step = 0.0;
+            for (size_t n = 200; n < output.size(); n++)
+                {
+                    max_gain_error = std::max(max_gain_error, static_cast<double>(std::abs(std::abs(output[n]) - 1.0F)));
+                    max_step = std::max(max_step, static_cast<double>(std::abs(output[n] - output[n - 1])));
+                }
+            EXPECT_LT(max_gain_error, 0.02);
+            EXPECT_LT(max_step, 0.02);
+        }
+}
@@ -20,13 +20,22 @@
 #include <gflags/gflags.h>
 #include <gnuradio/analog/sig_source_waveform.h>
 #include <gnuradio/top_block.h>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <complex>
 #include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
 #ifdef GR_GREATER_38
 #include <gnuradio/analog/sig_source.h>
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
 #else
 #include <gnuradio/analog/sig_source_c.h>
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
 #endif
 #include "concurrent_queue.h"
 #include "file_signal_source.h"
@@ -36,12 +45,101 @@
 #include "gnss_sdr_valve.h"
 #include "in_memory_configuration.h"
 #include "notch_filter_lite.h"
+#include "notch_lite_cc.h"
+#include <boost/math/distributions/chi_squared.hpp>
 #include <gnuradio/blocks/null_sink.h>
+#include <gnuradio/fft/fft.h>
 #include <gtest/gtest.h>
+#include <volk/volk.h>
 
 
 DEFINE_int32(notch_filter_lite_test_nsamples, 1000000, "Number of samples to filter in the tests (max: 2147483647)");
 
+// Per-sample implementation of the lite notch filter, as it was before the
+// feedforward term was computed with VOLK. Filters the whole of in, in
+// segments of length_ samples, and returns the output of every segment.
+std::vector<gr_complex> notch_lite_per_sample(const std::vector<gr_complex>& in,
+    float p_c_factor, float pfa, int32_t length_, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff_reset)
+{
+    const int32_t n_deg_fred = 2 * length_;
+    boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred);
+    const float thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa));
+    const gr_complex p_c(p_c_factor, 0.0);
+    gr::fft::fft_complex fft(length_, true);
+    std::vector<float> power_spect(length_);
+    // the block has a history of one sample, initially zero
+    std::vector<gr_complex> history(in.size() + 1, gr_complex(0.0, 0.0));
+    std::copy(in.begin(), in.end(), history.begin() + 1);
+    std::vector<gr_complex> out(in.size() - in.size() % length_);
+    bool filter_state = false;
+    int32_t n_segments = 0;
+    int32_t n_segments_coeff = 0;
+    float noise_pow_est = 0.0;
+    gr_complex last_out(0.0, 0.0);
+    gr_complex z_0(0.0, 0.0);
+    gr_complex c_samples1;
+    gr_complex c_samples2;
+    float angle1;
+    float angle2;
+    lv_32fc_t dot_prod;
+    for (size_t index = 0; index < out.size(); index += length_)
+        {
+            const gr_complex* x = history.data() + 1 + index;
+            gr_complex* y = out.data() + index;
+            if ((n_segments < n_segments_est) && (filter_state == false))
+                {
+                    float sig2dB = 0.0;
+                    memcpy(fft.get_inbuf(), x, sizeof(gr_complex) * length_);
+                    fft.execute();
+                    volk_32fc_s32f_power_spectrum_32f(power_spect.data(), fft.get_outbuf(), 1.0, length_);
+                    volk_32f_s32f_calc_spectral_noise_floor_32f(&sig2dB, power_spect.data(), 15.0, length_);
+                    const float sig2lin = std::pow(10.0F, (sig2dB / 10.0F)) / static_cast<float>(n_deg_fred);
+                    noise_pow_est = (static_cast<float>(n_segments) * noise_pow_est + sig2lin) / static_cast<float>(n_segments + 1);
+                    memcpy(y, x, sizeof(gr_complex) * length_);
+                }
+            else
+                {
+                    volk_32fc_x2_conjugate_dot_prod_32fc(&dot_prod, x, x, length_);
+                    if ((lv_creal(dot_prod) / noise_pow_est) > thres_)
+                        {
+                            if (filter_state == false)
+                                {
+                                    filter_state = true;
+                                    last_out = gr_complex(0, 0);
+                                    n_segments_coeff = 0;
+                                }
+                            if (n_segments_coeff == 0)
+                                {
+                                    volk_32fc_x2_multiply_conjugate_32fc(&c_samples1, (x + 1), x, 1);
+                                    volk_32fc_s32f_atan2_32f(&angle1, &c_samples1, static_cast<float>(1.0), 1);
+                                    volk_32fc_x2_multiply_conjugate_32fc(&c_samples2, (x + length_ - 1), (x + length_ - 2), 1);
+                                    volk_32fc_s32f_atan2_32f(&angle2, &c_samples2, static_cast<float>(1.0), 1);
+                                    z_0 = std::exp(gr_complex(0, 1) * ((angle1 + angle2) / 2.0F));
+                                }
+                            for (int32_t aux = 0; aux < length_; aux++)
+                                {
+                                    y[aux] = x[aux] - z_0 * x[aux - 1] + p_c * z_0 * last_out;
+                                    last_out = y[aux];
+                                }
+                            n_segments_coeff++;
+                            n_segments_coeff = n_segments_coeff % n_segments_coeff_reset;
+                        }
+                    else
+                        {
+                            if (n_segments > n_segments_reset)
+                                {
+                                    n_segments = 0;
+                                }
+                            filter_state = false;
+                            memcpy(y, x, sizeof(gr_complex) * length_);
+                        }
+                }
+            n_segments++;
+        }
+    return out;
+}
+
+
 class NotchFilterLiteTest : public ::testing::Test
 {
 protected:
@@ -167,3 +265,49 @@ TEST_F(NotchFilterLiteTest, ConnectAndRunGrcomplex)
     }) << "Failure running the top_block.";
     std::cout << "Filtered " << nsamples << " gr_complex samples in " << elapsed_seconds.count() * 1e6 << " microseconds\n";
 }
+
+
+TEST(NotchLiteCcTest, MatchesPerSampleFilter)
+{
+    const float p_c_factor = 0.9F;
+    const float pfa = 0.001F;
+    const int32_t length_ = 32;
+    const int32_t n_segments_est = 100;
+    const int32_t n_segments_reset = 5000000;
+    const int32_t n_segments_coeff = 5;
+
+    // Gaussian noise, with a strong continuous wave interference switched
+    // on and off after the noise estimation, so that both states are visited
+    std::vector<gr_complex> samples(65536);
+    std::mt19937 generator(1);
+    std::normal_distribution<float> noise(0.0, 1.0);
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            samples[i] = gr_complex(noise(generator), noise(generator));
+            if (i >= 8192 and (i / 8192) % 2 == 1)
+                {
+                    samples[i] += std::polar(5.0F, 0.3F * static_cast<float>(i));
+                }
+        }
+    const std::vector<gr_complex> expected = notch_lite_per_sample(samples, p_c_factor, pfa, length_, n_segments_est, n_segments_reset, n_segments_coeff);
+
+    auto top_block = gr::make_top_block("notch_lite_cc_test");
+    auto source = gr::blocks::vector_source_c::make(samples);
+    auto notch = make_notch_filter_lite(p_c_factor, pfa, length_, n_segments_est, n_segments_reset, n_segments_coeff);
+    auto sink = gr::blocks::vector_sink_c::make();
+    top_block->connect(source, 0, notch, 0);
+    top_block->connect(notch, 0, sink, 0);
+    top_block->run();
+
+    // the filter may leave the last segments behind at the end of the input.
+    // The products are now computed by VOLK kernels, so the filtered samples
+    // differ by rounding errors only
+    const std::vector<gr_complex> output = sink->data();
+    ASSERT_GT(output.size(), expected.size() * 9 / 10);
+    ASSERT_LE(output.size(), expected.size());
+    for (size_t i = 0; i < output.size(); i++)
+        {
+            ASSERT_NEAR(output[i].real(), expected[i].real(), 1e-4) << "output item " << i;
+            ASSERT_NEAR(output[i].imag(), expected[i].imag(), 1e-4) << "output item " << i;
+        }
+}
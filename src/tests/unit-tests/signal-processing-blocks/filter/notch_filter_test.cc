@@ -20,13 +20,22 @@
 #include <gflags/gflags.h>
 #include <gnuradio/analog/sig_source_waveform.h>
 #include <gnuradio/top_block.h>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <complex>
 #include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
 #ifdef GR_GREATER_38
 #include <gnuradio/analog/sig_source.h>
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
 #else
 #include <gnuradio/analog/sig_source_c.h>
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
 #endif
 #include "concurrent_queue.h"
 #include "file_signal_source.h"
@@ -35,13 +44,90 @@
 #include "gnss_sdr_make_unique.h"
 #include "gnss_sdr_valve.h"
 #include "in_memory_configuration.h"
+#include "notch_cc.h"
 #include "notch_filter.h"
+#include <boost/math/distributions/chi_squared.hpp>
 #include <gnuradio/blocks/null_sink.h>
+#include <gnuradio/fft/fft.h>
 #include <gtest/gtest.h>
+#include <volk/volk.h>
 
 
 DEFINE_int32(notch_filter_test_nsamples, 1000000, "Number of samples to filter in the tests (max: 2147483647)");
 
+// Per-sample implementation of the notch filter, as it was before the
+// feedforward term and the pole were computed with VOLK. Filters the whole of
+// in, in segments of length_ samples, and returns the output of every segment.
+std::vector<gr_complex> notch_per_sample(const std::vector<gr_complex>& in,
+    float pfa, float p_c_factor, int32_t length_, int32_t n_segments_est, int32_t n_segments_reset)
+{
+    const int32_t n_deg_fred = 2 * length_;
+    boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred);
+    const float thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa));
+    const gr_complex p_c(p_c_factor, 0.0);
+    gr::fft::fft_complex fft(length_, true);
+    std::vector<float> power_spect(length_);
+    std::vector<float> angle(length_);
+    std::vector<gr_complex> c_samples(length_);
+    // the block has a history of one sample, initially zero
+    std::vector<gr_complex> history(in.size() + 1, gr_complex(0.0, 0.0));
+    std::copy(in.begin(), in.end(), history.begin() + 1);
+    std::vector<gr_complex> out(in.size() - in.size() % length_);
+    bool filter_state = false;
+    int32_t n_segments = 0;
+    float noise_pow_est = 0.0;
+    gr_complex last_out(0.0, 0.0);
+    lv_32fc_t dot_prod;
+    for (size_t index = 0; index < out.size(); index += length_)
+        {
+            const gr_complex* x = history.data() + 1 + index;
+            gr_complex* y = out.data() + index;
+            if ((n_segments < n_segments_est) && (filter_state == false))
+                {
+                    float sig2dB = 0.0;
+                    memcpy(fft.get_inbuf(), x, sizeof(gr_complex) * length_);
+                    fft.execute();
+                    volk_32fc_s32f_power_spectrum_32f(power_spect.data(), fft.get_outbuf(), 1.0, length_);
+                    volk_32f_s32f_calc_spectral_noise_floor_32f(&sig2dB, power_spect.data(), 15.0, length_);
+                    const float sig2lin = std::pow(10.0F, (sig2dB / 10.0F)) / (static_cast<float>(n_deg_fred));
+                    noise_pow_est = (static_cast<float>(n_segments) * noise_pow_est + sig2lin) / (static_cast<float>(n_segments + 1));
+                    memcpy(y, x, sizeof(gr_complex) * length_);
+                }
+            else
+                {
+                    volk_32fc_x2_conjugate_dot_prod_32fc(&dot_prod, x, x, length_);
+                    if ((lv_creal(dot_prod) / noise_pow_est) > thres_)
+                        {
+                            if (filter_state == false)
+                                {
+                                    filter_state = true;
+                                    last_out = gr_complex(0.0, 0.0);
+                                }
+                            volk_32fc_x2_multiply_conjugate_32fc(c_samples.data(), x, (x - 1), length_);
+                            volk_32fc_s32f_atan2_32f(angle.data(), c_samples.data(), static_cast<float>(1.0), length_);
+                            for (int32_t aux = 0; aux < length_; aux++)
+                                {
+                                    const gr_complex z_0 = std::exp(gr_complex(0.0, 1.0) * angle[aux]);
+                                    y[aux] = x[aux] - z_0 * x[aux - 1] + p_c * z_0 * last_out;
+                                    last_out = y[aux];
+                                }
+                        }
+                    else
+                        {
+                            if (n_segments > n_segments_reset)
+                                {
+                                    n_segments = 0;
+                                }
+                            filter_state = false;
+                            memcpy(y, x, sizeof(gr_complex) * length_);
+                        }
+                }
+            n_segments++;
+        }
+    return out;
+}
+
+
 class NotchFilterTest : public ::testing::Test
 {
 protected:
@@ -167,3 +253,48 @@ TEST_F(NotchFilterTest, ConnectAndRunGrcomplex)
     }) << "Failure running the top_block.";
     std::cout << "Filtered " << nsamples << " gr_complex samples in " << elapsed_seconds.count() * 1e6 << " microseconds\n";
 }
+
+
+TEST(NotchCcTest, MatchesPerSampleFilter)
+{
+    const float pfa = 0.001F;
+    const float p_c_factor = 0.9F;
+    const int32_t length_ = 32;
+    const int32_t n_segments_est = 100;
+    const int32_t n_segments_reset = 5000000;
+
+    // Gaussian noise, with a strong continuous wave interference switched
+    // on and off after the noise estimation, so that both states are visited
+    std::vector<gr_complex> samples(65536);
+    std::mt19937 generator(1);
+    std::normal_distribution<float> noise(0.0, 1.0);
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            samples[i] = gr_complex(noise(generator), noise(generator));
+            if (i >= 8192 and (i / 8192) % 2 == 1)
+                {
+                    samples[i] += std::polar(5.0F, 0.3F * static_cast<float>(i));
+                }
+        }
+    const std::vector<gr_complex> expected = notch_per_sample(samples, pfa, p_c_factor, length_, n_segments_est, n_segments_reset);
+
+    auto top_block = gr::make_top_block("notch_cc_test");
+    auto source = gr::blocks::vector_source_c::make(samples);
+    auto notch = make_notch_filter(pfa, p_c_factor, length_, n_segments_est, n_segments_reset);
+    auto sink = gr::blocks::vector_sink_c::make();
+    top_block->connect(source, 0, notch, 0);
+    top_block->connect(notch, 0, sink, 0);
+    top_block->run();
+
+    // the filter may leave the last segments behind at the end of the input.
+    // The zero of the filter is now computed without atan2 and exp, so the
+    // filtered samples differ by rounding errors only
+    const std::vector<gr_complex> output = sink->data();
+    ASSERT_GT(output.size(), expected.size() * 9 / 10);
+    ASSERT_LE(output.size(), expected.size());
+    for (size_t i = 0; i < output.size(); i++)
+        {
+            ASSERT_NEAR(output[i].real(), expected[i].real(), 1e-4) << "output item " << i;
+            ASSERT_NEAR(output[i].imag(), expected[i].imag(), 1e-4) << "output item " << i;
+        }
+}
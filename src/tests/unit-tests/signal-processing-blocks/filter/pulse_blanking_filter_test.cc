@@ -23,10 +23,17 @@
 #include <chrono>
 #include <complex>
 #include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
 #ifdef GR_GREATER_38
 #include <gnuradio/analog/sig_source.h>
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
 #else
 #include <gnuradio/analog/sig_source_c.h>
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
 #endif
 #include "concurrent_queue.h"
 #include "file_signal_source.h"
@@ -35,13 +42,64 @@
 #include "gnss_sdr_make_unique.h"
 #include "gnss_sdr_valve.h"
 #include "in_memory_configuration.h"
+#include "pulse_blanking_cc.h"
 #include "pulse_blanking_filter.h"
+#include <boost/math/distributions/chi_squared.hpp>
 #include <gnuradio/blocks/null_sink.h>
 #include <gtest/gtest.h>
+#include <volk/volk.h>
 
 
 DEFINE_int32(pb_filter_test_nsamples, 1000000, "Number of samples to filter in the tests (max: 2147483647)");
 
+// Pulse blanking filter as it was before the segment energy was computed
+// with a single dot product. Filters the whole of in, in segments of length_
+// samples, and returns the output of every segment.
+std::vector<gr_complex> pulse_blanking_per_sample(const std::vector<gr_complex>& in,
+    float pfa, int32_t length_, int32_t n_segments_est, int32_t n_segments_reset)
+{
+    const int32_t n_deg_fred = 2 * length_;
+    boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred);
+    const float thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa));
+    const std::vector<gr_complex> zeros(length_, gr_complex(0.0, 0.0));
+    std::vector<float> magnitude(in.size());
+    volk_32fc_magnitude_squared_32f(magnitude.data(), in.data(), in.size());
+    std::vector<gr_complex> out(in.size() - in.size() % length_);
+    bool last_filtered = false;
+    int32_t n_segments = 0;
+    float noise_power_estimation = 0.0;
+    float segment_energy;
+    for (size_t index = 0; index < out.size(); index += length_)
+        {
+            volk_32f_accumulator_s32f(&segment_energy, (magnitude.data() + index), length_);
+            if ((n_segments < n_segments_est) && (last_filtered == false))
+                {
+                    noise_power_estimation = (static_cast<float>(n_segments) * noise_power_estimation + segment_energy / static_cast<float>(n_deg_fred)) / static_cast<float>(n_segments + 1);
+                    memcpy(&out[index], &in[index], sizeof(gr_complex) * length_);
+                }
+            else
+                {
+                    if ((segment_energy / noise_power_estimation) > thres_)
+                        {
+                            memcpy(&out[index], zeros.data(), sizeof(gr_complex) * length_);
+                            last_filtered = true;
+                        }
+                    else
+                        {
+                            memcpy(&out[index], &in[index], sizeof(gr_complex) * length_);
+                            last_filtered = false;
+                            if (n_segments > n_segments_reset)
+                                {
+                                    n_segments = 0;
+                                }
+                        }
+                }
+            n_segments++;
+        }
+    return out;
+}
+
+
 class PulseBlankingFilterTest : public ::testing::Test
 {
 protected:
@@ -166,3 +224,44 @@ TEST_F(PulseBlankingFilterTest, ConnectAndRunGrcomplex)
     }) << "Failure running the top_block.";
     std::cout << "Filtered " << nsamples << " gr_complex samples in " << elapsed_seconds.count() * 1e6 << " microseconds\n";
 }
+
+
+TEST(PulseBlankingCcTest, MatchesPerSampleFilter)
+{
+    const float pfa = 0.001F;
+    const int32_t length_ = 32;
+    const int32_t n_segments_est = 100;
+    const int32_t n_segments_reset = 5000000;
+
+    // Gaussian noise, with strong pulses after the noise estimation
+    std::vector<gr_complex> samples(65536);
+    std::mt19937 generator(1);
+    std::normal_distribution<float> noise(0.0, 1.0);
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            samples[i] = gr_complex(noise(generator), noise(generator));
+            if (i >= 8192 and i % 1000 < 100)
+                {
+                    samples[i] += gr_complex(10.0, 0.0);
+                }
+        }
+    const std::vector<gr_complex> expected = pulse_blanking_per_sample(samples, pfa, length_, n_segments_est, n_segments_reset);
+
+    auto top_block = gr::make_top_block("pulse_blanking_cc_test");
+    auto source = gr::blocks::vector_source_c::make(samples);
+    auto blanking = make_pulse_blanking_cc(pfa, length_, n_segments_est, n_segments_reset);
+    auto sink = gr::blocks::vector_sink_c::make();
+    top_block->connect(source, 0, blanking, 0);
+    top_block->connect(blanking, 0, sink, 0);
+    top_block->run();
+
+    // the filter may leave the last segments behind at the end of the input.
+    // Samples are either copied or blanked, so the output is exact
+    const std::vector<gr_complex> output = sink->data();
+    ASSERT_GT(output.size(), expected.size() * 9 / 10);
+    ASSERT_LE(output.size(), expected.size());
+    for (size_t i = 0; i < output.size(); i++)
+        {
+            ASSERT_EQ(output[i], expected[i]) << "output item " << i;
+        }
+}
@@ -23,17 +23,73 @@
 #include <gnuradio/analog/sig_source_waveform.h>
 #include <gnuradio/top_block.h>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
 #ifdef GR_GREATER_38
 #include <gnuradio/analog/sig_source.h>
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
 #else
 #include <gnuradio/analog/sig_source_c.h>
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
 #endif
 #include "concurrent_queue.h"
 #include "direct_resampler_conditioner_cc.h"
+#include "direct_resampler_index.h"
 #include "gnss_sdr_valve.h"
 #include <gnuradio/blocks/null_sink.h>
 
 
+// Per-sample implementation of the direct resampler, as it was before the
+// index tables. Resamples the whole of in, and returns the number of outputs.
+int direct_resampler_per_sample_cc(const std::vector<gr_complex>& in, std::vector<gr_complex>& out, double fs_in, double fs_out)
+{
+    const double two_32 = 4294967296.0;
+    const bool downsampling = fs_in >= fs_out;
+    const auto phase_step = static_cast<uint32_t>(std::floor(two_32 * (downsampling ? fs_out / fs_in : fs_in / fs_out)));
+    uint32_t phase = 0;
+    uint32_t lphase = 0;
+    size_t count = 0;
+    int lcv = 0;
+    const int noutput_items = static_cast<int>(out.size());
+    if (downsampling)
+        {
+            while (lcv < noutput_items and count < in.size())
+                {
+                    if (phase <= lphase)
+                        {
+                            out[lcv] = in[count];
+                            lcv++;
+                        }
+                    lphase = phase;
+                    phase += phase_step;
+                    count++;
+                }
+        }
+    else
+        {
+            while (lcv < noutput_items)
+                {
+                    lphase = phase;
+                    phase += phase_step;
+                    if (phase <= lphase)
+                        {
+                            count++;
+                        }
+                    if (count >= in.size())
+                        {
+                            break;
+                        }
+                    out[lcv] = in[count];
+                    lcv++;
+                }
+        }
+    return lcv;
+}
+
+
 TEST(DirectResamplerConditionerCcTest, InstantiationAndRunTest)
 {
     double fs_in = 8000000.0;   // Input sampling frequency in Hz
@@ -69,3 +125,70 @@ TEST(DirectResamplerConditionerCcTest, InstantiationAndRunTest)
 
     std::cout << "Resampled " << nsamples << " samples in " << elapsed_seconds.count() * 1e6 << " microseconds\n";
 }
+
+
+TEST(DirectResamplerConditionerCcTest, MatchesPerSampleResampling)
+{
+    const std::vector<std::pair<double, double>> rates = {{8000000.0, 4000000.0}, {20480000.0, 2046000.0}, {4000000.0, 6138000.0}};
+    for (const auto& rate : rates)
+        {
+            std::vector<gr_complex> samples(100000);
+            for (size_t i = 0; i < samples.size(); i++)
+                {
+                    samples[i] = gr_complex(static_cast<float>(i), -static_cast<float>(i));
+                }
+            std::vector<gr_complex> expected(static_cast<size_t>(static_cast<double>(samples.size()) * rate.second / rate.first) + 1);
+            expected.resize(direct_resampler_per_sample_cc(samples, expected, rate.first, rate.second));
+
+            auto top_block = gr::make_top_block("direct_resampler_conditioner_cc_test");
+            auto source = gr::blocks::vector_source_c::make(samples);
+            auto resampler = direct_resampler_make_conditioner_cc(rate.first, rate.second);
+            auto sink = gr::blocks::vector_sink_c::make();
+            top_block->connect(source, 0, resampler, 0);
+            top_block->connect(resampler, 0, sink, 0);
+            top_block->run();
+
+            // the resampler may leave the last few outputs behind at the end of the input
+            const std::vector<gr_complex> output = sink->data();
+            ASSERT_GT(output.size(), expected.size() * 9 / 10);
+            ASSERT_LE(output.size(), expected.size());
+            for (size_t i = 0; i < output.size(); i++)
+                {
+                    ASSERT_EQ(output[i], expected[i]) << "output item " << i << " from " << rate.first << " to " << rate.second << " sps";
+                }
+        }
+}
+
+
+TEST(DirectResamplerConditionerCcTest, IndexTablesVersusPerSample)
+{
+    const double fs_in = 20480000.0;
+    const double fs_out = 2046000.0;
+    const int nsamples = 10000000;
+    const int block_size = 8192;
+    std::vector<gr_complex> in(nsamples, gr_complex(1.0, -1.0));
+    std::vector<gr_complex> out(static_cast<size_t>(static_cast<double>(nsamples) * fs_out / fs_in) + 1);
+
+    auto start = std::chrono::system_clock::now();
+    const int n_per_sample = direct_resampler_per_sample_cc(in, out, fs_in, fs_out);
+    std::chrono::duration<double> elapsed_per_sample = std::chrono::system_clock::now() - start;
+
+    const auto phase_step = static_cast<uint32_t>(std::floor(4294967296.0 * fs_out / fs_in));
+    uint32_t phase = 0;
+    uint32_t lphase = 0;
+    std::vector<int32_t> index;
+    int n_tables = 0;
+    int consumed = 0;
+    start = std::chrono::system_clock::now();
+    for (int pos = 0; pos < nsamples; pos += consumed)
+        {
+            const int nout = direct_resampler_index(index, block_size, nsamples - pos, true, phase_step, phase, lphase, consumed);
+            direct_resampler_gather(in.data() + pos, out.data() + n_tables, index, nout);
+            n_tables += nout;
+        }
+    std::chrono::duration<double> elapsed_tables = std::chrono::system_clock::now() - start;
+
+    EXPECT_EQ(n_per_sample, n_tables);
+    std::cout << "Resampled " << nsamples << " samples in " << elapsed_per_sample.count() * 1e6
+              << " microseconds with the per-sample loop, and in " << elapsed_tables.count() * 1e6 << " microseconds with index tables\n";
+}
@@ -0,0 +1,171 @@
+/*!
+ * \file capture_file_writer_test.cc
+ * \brief Unit tests for the disk recorder behind the capture tap block
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "capture_file_writer.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+// Items of the file, which must hold a whole number of them
+template <typename T>
+std::vector<T> read_capture_file(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::in | std::ios::binary | std::ios::ate);
+    EXPECT_TRUE(file.is_open()) << filename;
+    const auto size = static_cast<size_t>(file.tellg());
+    EXPECT_EQ(size % sizeof(T), 0U) << filename;
+    std::vector<T> items(size / sizeof(T));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(items.data()), static_cast<std::streamsize>(items.size() * sizeof(T)));
+    return items;
+}
+
+
+// key=value lines of the sidecar of a capture file
+std::map<std::string, std::string> read_sidecar(const std::string& filename)
+{
+    std::map<std::string, std::string> values;
+    std::ifstream sidecar(filename + ".hdr");
+    EXPECT_TRUE(sidecar.is_open()) << filename;
+    std::string line;
+    while (std::getline(sidecar, line))
+        {
+            const size_t equal = line.find('=');
+            if (equal != std::string::npos)
+                {
+                    values[line.substr(0, equal)] = line.substr(equal + 1);
+                }
+        }
+    return values;
+}
+
+
+void remove_capture_file(const std::string& filename)
+{
+    std::remove(filename.c_str());
+    std::remove((filename + ".hdr").c_str());
+}
+}  // namespace
+
+
+TEST(CaptureFileWriterTest, DroppedItemsSplitTheFile)
+{
+    // item number i holds i. The ring buffer holds 64 KB, pushed in chunks
+    // of at most 2048 items plus a 16-byte header, and the writer thread is
+    // started only once everything has been pushed
+    std::vector<uint64_t> items(9192);
+    for (size_t i = 0; i < items.size(); i++)
+        {
+            items[i] = i;
+        }
+    Capture_File_Writer writer(sizeof(uint64_t), "./capture_file_writer_test.dat", 4e6, "ishort", 0, 64 * 1024, true);
+    writer.push(&items[0], 0, 6144);        // three chunks, 16336 bytes left
+    writer.push(&items[6144], 6144, 2048);  // does not fit
+    writer.push(&items[8192], 8192, 1000);  // fits
+    EXPECT_EQ(writer.dropped_items(), 2048U);
+    writer.start();
+    writer.stop();
+
+    ASSERT_EQ(writer.files(), 2U);
+    const std::string first = writer.file_name(0);
+    const std::string second = writer.file_name(1);
+    EXPECT_EQ(first, "./capture_file_writer_test.dat");
+    EXPECT_EQ(second, "./capture_file_writer_test_0001.dat");
+
+    const std::vector<uint64_t> first_items = read_capture_file<uint64_t>(first);
+    ASSERT_EQ(first_items.size(), 6144U);
+    for (size_t i = 0; i < first_items.size(); i++)
+        {
+            ASSERT_EQ(first_items[i], i);
+        }
+    const std::vector<uint64_t> second_items = read_capture_file<uint64_t>(second);
+    ASSERT_EQ(second_items.size(), 1000U);
+    for (size_t i = 0; i < second_items.size(); i++)
+        {
+            ASSERT_EQ(second_items[i], 8192 + i);
+        }
+
+    std::map<std::string, std::string> sidecar = read_sidecar(first);
+    EXPECT_EQ(sidecar["start_sample_counter"], "0");
+    EXPECT_EQ(sidecar["dropped_items_before"], "0");
+    EXPECT_EQ(sidecar["items"], "6144");
+    sidecar = read_sidecar(second);
+    EXPECT_EQ(sidecar["start_sample_counter"], "8192");
+    EXPECT_EQ(sidecar["dropped_items_before"], "2048");
+    EXPECT_EQ(sidecar["items"], "1000");
+    EXPECT_EQ(sidecar["item_type"], "ishort");
+
+    remove_capture_file(first);
+    remove_capture_file(second);
+}
+
+
+class CaptureFileWriterLengthTest : public ::testing::TestWithParam<bool>
+{
+};
+
+
+TEST_P(CaptureFileWriterLengthTest, PaddedBlocksAreTruncated)
+{
+    // With direct I/O the last block of each file is padded to 4 KB and the
+    // file cut afterwards. Without it (also the fallback when the file system
+    // rejects O_DIRECT) nothing is padded. Either way each file must hold
+    // exactly its items: one full 4 MB block plus 12 bytes without rotation,
+    // and unaligned lengths with rotation
+    std::vector<uint32_t> items(1024 * 1024 + 3);
+    for (size_t i = 0; i < items.size(); i++)
+        {
+            items[i] = static_cast<uint32_t>(i);
+        }
+    for (const uint64_t rotation_items : {static_cast<uint64_t>(0), static_cast<uint64_t>(300001)})
+        {
+            Capture_File_Writer writer(sizeof(uint32_t), "./capture_file_writer_length_test.dat", 4e6, "ishort", rotation_items, 8 * 1024 * 1024, GetParam());
+            writer.push(items.data(), 0, items.size());
+            writer.start();
+            writer.stop();
+            EXPECT_EQ(writer.dropped_items(), 0U);
+            ASSERT_EQ(writer.files(), rotation_items == 0 ? 1U : 4U);
+
+            size_t k = 0;
+            for (uint32_t n = 0; n < writer.files(); n++)
+                {
+                    const std::string filename = writer.file_name(n);
+                    const std::vector<uint32_t> recorded = read_capture_file<uint32_t>(filename);
+                    const size_t expected = rotation_items == 0 ? items.size() : std::min(static_cast<size_t>(rotation_items), items.size() - k);
+                    EXPECT_EQ(recorded.size(), expected) << filename;
+                    EXPECT_EQ(read_sidecar(filename)["items"], std::to_string(expected));
+                    for (size_t i = 0; i < recorded.size(); i++)
+                        {
+                            ASSERT_EQ(recorded[i], items[k++]);
+                        }
+                    remove_capture_file(filename);
+                }
+            EXPECT_EQ(k, items.size());
+        }
+}
+
+
+INSTANTIATE_TEST_CASE_P(DirectIo, CaptureFileWriterLengthTest, ::testing::Values(true, false));
@@ -0,0 +1,80 @@
+/*!
+ * \file capture_tap_test.cc
+ * \brief Unit tests for the capture tap block
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "capture_tap.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
+
+
+TEST(CaptureTapTest, Rotation)
+{
+    const std::vector<std::string> filenames{"./capture_tap_test_0000.dat", "./capture_tap_test_0001.dat", "./capture_tap_test_0002.dat"};
+    std::vector<gr_complex> samples(2500);
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            samples[i] = gr_complex(static_cast<float>(i), -static_cast<float>(i));
+        }
+
+    auto top_block = gr::make_top_block("CaptureTapTest");
+    auto source = gr::blocks::vector_source_c::make(samples);
+    auto tap = capture_make_tap(sizeof(gr_complex), "./capture_tap_test.dat", 4e6, "gr_complex", 1000, 1024 * 1024);
+    top_block->connect(source, 0, tap, 0);
+    top_block->run();
+
+    EXPECT_EQ(tap->files(), 3U);
+    EXPECT_EQ(tap->dropped_items(), 0U);
+    size_t k = 0;
+    for (size_t n = 0; n < filenames.size(); n++)
+        {
+            std::ifstream file(filenames[n], std::ios::in | std::ios::binary);
+            ASSERT_TRUE(file.is_open());
+            std::vector<gr_complex> recorded(1000);
+            file.read(reinterpret_cast<char*>(recorded.data()), recorded.size() * sizeof(gr_complex));
+            const size_t items = static_cast<size_t>(file.gcount()) / sizeof(gr_complex);
+            EXPECT_EQ(items, n < 2 ? 1000U : 500U);
+            for (size_t i = 0; i < items; i++)
+                {
+                    ASSERT_EQ(recorded[i], samples[k++]);
+                }
+
+            std::ifstream sidecar(filenames[n] + ".hdr");
+            ASSERT_TRUE(sidecar.is_open());
+            std::string line;
+            bool counter_found = false;
+            while (std::getline(sidecar, line))
+                {
+                    if (line == "start_sample_counter=" + std::to_string(1000 * n))
+                        {
+                            counter_found = true;
+                        }
+                }
+            EXPECT_TRUE(counter_found);
+            std::remove(filenames[n].c_str());
+            std::remove((filenames[n] + ".hdr").c_str());
+        }
+    EXPECT_EQ(k, samples.size());
+}
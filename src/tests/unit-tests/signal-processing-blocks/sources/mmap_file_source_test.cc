@@ -0,0 +1,97 @@
+/*!
+ * \file mmap_file_source_test.cc
+ * \brief Unit tests for the memory mapped file source block
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "mmap_file_source.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#else
+#include <gnuradio/blocks/vector_sink_s.h>
+#endif
+
+
+class MmapFileSourceTest : public ::testing::Test
+{
+protected:
+    MmapFileSourceTest() : filename("./mmap_file_source_test.dat")
+    {
+        // an odd number of items, not a multiple of the page size
+        samples.resize(100003);
+        for (size_t i = 0; i < samples.size(); i++)
+            {
+                samples[i] = static_cast<int16_t>(i * 7);
+            }
+        std::ofstream file(filename, std::ios::out | std::ios::binary);
+        file.write(reinterpret_cast<const char*>(samples.data()), samples.size() * sizeof(int16_t));
+    }
+
+    ~MmapFileSourceTest() override
+    {
+        std::remove(filename.c_str());
+    }
+
+    std::vector<int16_t> run(const mmap_file_source_sptr& source) const
+    {
+        auto top_block = gr::make_top_block("MmapFileSourceTest");
+        auto sink = gr::blocks::vector_sink_s::make();
+        top_block->connect(source, 0, sink, 0);
+        top_block->run();
+        return sink->data();
+    }
+
+    std::string filename;
+    std::vector<int16_t> samples;
+};
+
+
+TEST_F(MmapFileSourceTest, ReadsWholeFile)
+{
+    // a small readahead window forces several prefetch and release steps
+    auto source = mmap_make_file_source(sizeof(int16_t), filename, false, 4096);
+    EXPECT_EQ(source->items(), samples.size());
+    EXPECT_EQ(run(source), samples);
+    EXPECT_GT(source->bandwidth(), 0.0);
+}
+
+
+TEST_F(MmapFileSourceTest, Seek)
+{
+    auto source = mmap_make_file_source(sizeof(int16_t), filename, false);
+    EXPECT_FALSE(source->seek(-1, SEEK_SET));
+    EXPECT_FALSE(source->seek(samples.size() + 1, SEEK_SET));
+    ASSERT_TRUE(source->seek(12345, SEEK_SET));
+    ASSERT_TRUE(source->seek(10, SEEK_CUR));
+    EXPECT_EQ(source->position(), 12355U);
+    EXPECT_EQ(run(source), std::vector<int16_t>(samples.begin() + 12355, samples.end()));
+
+    ASSERT_TRUE(source->seek(-3, SEEK_END));
+    EXPECT_EQ(run(source), std::vector<int16_t>(samples.end() - 3, samples.end()));
+}
+
+
+TEST_F(MmapFileSourceTest, NotExists)
+{
+    EXPECT_THROW({ auto source = mmap_make_file_source(sizeof(int16_t), "./i_dont_exist.dat", false); }, std::exception);
+}
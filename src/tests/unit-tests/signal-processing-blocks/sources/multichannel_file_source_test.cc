@@ -0,0 +1,110 @@
+/*!
+ * \file multichannel_file_source_test.cc
+ * \brief Unit tests for the lockstep multichannel file source block
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "multichannel_file_source.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#else
+#include <gnuradio/blocks/vector_sink_s.h>
+#endif
+
+
+class MultichannelFileSourceTest : public ::testing::Test
+{
+protected:
+    MultichannelFileSourceTest() : filenames{"./multichannel_file_source_test_0.dat", "./multichannel_file_source_test_1.dat"}
+    {
+        // files of different lengths, with different contents
+        write_file(filenames[0], 100000, 1);
+        write_file(filenames[1], 90001, 3);
+    }
+
+    ~MultichannelFileSourceTest() override
+    {
+        for (const auto& filename : filenames)
+            {
+                std::remove(filename.c_str());
+            }
+    }
+
+    static void write_file(const std::string& filename, int32_t items, int32_t step)
+    {
+        std::vector<int16_t> samples(items);
+        for (int32_t i = 0; i < items; i++)
+            {
+                samples[i] = static_cast<int16_t>(i * step);
+            }
+        std::ofstream file(filename, std::ios::out | std::ios::binary);
+        file.write(reinterpret_cast<const char*>(samples.data()), samples.size() * sizeof(int16_t));
+    }
+
+    void check_lockstep(bool use_mmap) const
+    {
+        const std::vector<uint64_t> items_to_skip{100, 7};
+        auto source = multichannel_make_file_source(sizeof(int16_t), filenames, items_to_skip, false, use_mmap, 4096);
+        const uint64_t expected_items = 90001 - 7;
+        EXPECT_EQ(source->items_available(), expected_items);
+
+        auto top_block = gr::make_top_block("MultichannelFileSourceTest");
+        auto sink0 = gr::blocks::vector_sink_s::make();
+        auto sink1 = gr::blocks::vector_sink_s::make();
+        top_block->connect(source, 0, sink0, 0);
+        top_block->connect(source, 1, sink1, 0);
+        top_block->run();
+
+        const std::vector<int16_t> out0 = sink0->data();
+        const std::vector<int16_t> out1 = sink1->data();
+        ASSERT_EQ(out0.size(), expected_items);
+        ASSERT_EQ(out1.size(), expected_items);
+        EXPECT_EQ(source->sample_counter(), expected_items);
+        for (size_t i = 0; i < expected_items; i++)
+            {
+                ASSERT_EQ(out0[i], static_cast<int16_t>(100 + i));
+                ASSERT_EQ(out1[i], static_cast<int16_t>(3 * (7 + i)));
+            }
+    }
+
+    std::vector<std::string> filenames;
+};
+
+
+TEST_F(MultichannelFileSourceTest, LockstepMmap)
+{
+    check_lockstep(true);
+}
+
+
+TEST_F(MultichannelFileSourceTest, LockstepPread)
+{
+    check_lockstep(false);
+}
+
+
+TEST_F(MultichannelFileSourceTest, NotExists)
+{
+    const std::vector<std::string> names{filenames[0], "./i_dont_exist.dat"};
+    EXPECT_THROW({ auto source = multichannel_make_file_source(sizeof(int16_t), names, {}, false, true); }, std::exception);
+}
@@ -0,0 +1,100 @@
+/*!
+ * \file sequential_file_test.cc
+ * \brief Unit tests for the readahead and release windows of the file sources
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "sequential_file.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+class SequentialFileTest : public ::testing::Test
+{
+protected:
+    SequentialFileTest() : filename("./sequential_file_test.dat")
+    {
+        // 4 MB and a few bytes
+        samples.resize(1024 * 1024 + 5);
+        for (size_t i = 0; i < samples.size(); i++)
+            {
+                samples[i] = static_cast<uint32_t>(i);
+            }
+        std::ofstream file(filename, std::ios::out | std::ios::binary);
+        file.write(reinterpret_cast<const char*>(samples.data()), samples.size() * sizeof(uint32_t));
+    }
+
+    ~SequentialFileTest() override
+    {
+        std::remove(filename.c_str());
+    }
+
+    std::string filename;
+    std::vector<uint32_t> samples;
+};
+
+
+TEST_F(SequentialFileTest, MappedPagesAreReleased)
+{
+    const size_t readahead = 1024 * 1024;
+    Sequential_File file(filename, true, readahead);
+    ASSERT_NE(file.data(), nullptr);
+    EXPECT_EQ(file.size(), samples.size() * sizeof(uint32_t));
+    file.reset(0);
+
+    // nothing is released until the read position is a readahead window ahead
+    file.advance(readahead / 2);
+    EXPECT_EQ(file.released_until(), 0U);
+    file.advance(readahead + 100);
+    EXPECT_EQ(file.released_until(), readahead);
+    file.advance(3 * readahead + 100);
+    EXPECT_EQ(file.released_until(), 3 * readahead);
+
+    // released pages are read again from the file when needed
+    const auto* data = reinterpret_cast<const uint32_t*>(file.data());
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            ASSERT_EQ(data[i], samples[i]);
+        }
+
+    // a rewind starts over
+    file.reset(0);
+    EXPECT_EQ(file.released_until(), 0U);
+    file.advance(readahead + 100);
+    EXPECT_EQ(file.released_until(), readahead);
+}
+
+
+TEST_F(SequentialFileTest, NotMapped)
+{
+    Sequential_File file(filename, false, 1024 * 1024);
+    EXPECT_EQ(file.data(), nullptr);
+    EXPECT_GE(file.fd(), 0);
+    EXPECT_EQ(file.size(), samples.size() * sizeof(uint32_t));
+    file.reset(0);
+    file.advance(3 * 1024 * 1024);
+    EXPECT_EQ(file.released_until(), 0U);
+}
+
+
+TEST_F(SequentialFileTest, NotExists)
+{
+    EXPECT_THROW({ Sequential_File file("./i_dont_exist.dat", true, 1024 * 1024); }, std::exception);
+}
@@ -0,0 +1,99 @@
+/*!
+ * \file spsc_ring_buffer_test.cc
+ * \brief Unit tests for the lock-free single-producer, single-consumer ring
+ * buffer used by the UDP sample source
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "spsc_ring_buffer.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+TEST(SpscRingBufferTest, WrapAround)
+{
+    Spsc_Ring_Buffer ring(1000);
+    EXPECT_EQ(ring.capacity(), 1024U);
+    EXPECT_EQ(ring.space(), 1024U);
+
+    std::vector<uint8_t> in(700);
+    std::vector<uint8_t> out(700);
+    for (int round = 0; round < 3; round++)
+        {
+            for (size_t i = 0; i < in.size(); i++)
+                {
+                    in[i] = static_cast<uint8_t>(i + round);
+                }
+            ASSERT_TRUE(ring.write(in.data(), in.size()));
+            EXPECT_EQ(ring.size(), in.size());
+            // does not fit: nothing is written
+            EXPECT_FALSE(ring.write(in.data(), in.size()));
+            EXPECT_EQ(ring.size(), in.size());
+            ASSERT_EQ(ring.read(out.data(), out.size()), out.size());
+            EXPECT_EQ(in, out);
+        }
+    EXPECT_EQ(ring.read(out.data(), out.size()), 0U);
+
+    ASSERT_TRUE(ring.write(in.data(), 10));
+    ASSERT_TRUE(ring.write_zeros(20));
+    std::vector<uint8_t> all(100, 0xFF);
+    EXPECT_EQ(ring.read(all.data(), all.size()), 30U);
+    EXPECT_EQ(all[9], in[9]);
+    EXPECT_EQ(all[10], 0);
+    EXPECT_EQ(all[29], 0);
+    EXPECT_EQ(all[30], 0xFF);
+}
+
+
+TEST(SpscRingBufferTest, ProducerConsumer)
+{
+    Spsc_Ring_Buffer ring(4096);
+    const uint32_t packets = 10000;
+    const size_t packet_size = 100;
+
+    std::thread producer([&] {
+        std::vector<uint8_t> packet(packet_size);
+        for (uint32_t n = 0; n < packets; n++)
+            {
+                for (size_t i = 0; i < packet_size; i++)
+                    {
+                        packet[i] = static_cast<uint8_t>(n + i);
+                    }
+                while (not ring.write(packet.data(), packet.size()))
+                    {
+                        std::this_thread::yield();
+                    }
+            }
+    });
+
+    std::vector<uint8_t> out(333);
+    uint64_t received = 0;
+    bool in_order = true;
+    while (received < packets * packet_size)
+        {
+            const size_t n = ring.read(out.data(), out.size());
+            for (size_t i = 0; i < n; i++)
+                {
+                    const uint64_t k = received + i;
+                    in_order = in_order and (out[i] == static_cast<uint8_t>(k / packet_size + k % packet_size));
+                }
+            received += n;
+        }
+    producer.join();
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(ring.size(), 0U);
+}
@@ -0,0 +1,152 @@
+/*!
+ * \file udp_payload_fifo_test.cc
+ * \brief Unit tests for the packet counter handling of the UDP sample source
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "udp_payload_fifo.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+
+class UdpPayloadFifoTest : public ::testing::TestWithParam<int>
+{
+public:
+    static const int payload_bytes = 8;
+
+    // Payload made of the big-endian counter and payload_bytes bytes equal to fill
+    std::vector<uint8_t> packet(uint64_t sequence_number, uint8_t fill) const
+    {
+        std::vector<uint8_t> bytes;
+        for (int i = GetParam() - 1; i >= 0; i--)
+            {
+                bytes.push_back(static_cast<uint8_t>(sequence_number >> (8U * static_cast<uint32_t>(i))));
+            }
+        bytes.insert(bytes.end(), payload_bytes, fill);
+        return bytes;
+    }
+
+    void push(Udp_Payload_Fifo& fifo, uint64_t sequence_number, uint8_t fill) const
+    {
+        const std::vector<uint8_t> bytes = packet(sequence_number, fill);
+        fifo.push_payload(bytes.data(), static_cast<int>(bytes.size()));
+    }
+
+    // Payloads stored in the FIFO, one fill byte per payload (0 for the zero-filled gaps)
+    static std::vector<uint8_t> read_payloads(Udp_Payload_Fifo& fifo)
+    {
+        std::vector<uint8_t> bytes(fifo.size());
+        fifo.read(bytes.data(), bytes.size());
+        std::vector<uint8_t> payloads;
+        for (size_t i = 0; i < bytes.size(); i += payload_bytes)
+            {
+                payloads.push_back(bytes[i]);
+                for (size_t j = i; j < i + payload_bytes; j++)
+                    {
+                        EXPECT_EQ(bytes[j], bytes[i]) << "payload " << i / payload_bytes << " is not uniform";
+                    }
+            }
+        return payloads;
+    }
+
+    uint64_t max_sequence_number() const
+    {
+        return GetParam() == 8 ? UINT64_MAX : (uint64_t(1) << (8U * static_cast<uint32_t>(GetParam()))) - 1;
+    }
+};
+
+
+TEST_P(UdpPayloadFifoTest, GapsAreFilledWithZeros)
+{
+    Udp_Payload_Fifo fifo(4096, GetParam());
+    push(fifo, 100, 1);
+    push(fifo, 101, 2);
+    push(fifo, 104, 3);  // 102 and 103 lost
+    push(fifo, 105, 4);
+    EXPECT_EQ(fifo.lost_packets(), 2U);
+    EXPECT_EQ(fifo.overflows(), 0U);
+    EXPECT_EQ(read_payloads(fifo), std::vector<uint8_t>({1, 2, 0, 0, 3, 4}));
+}
+
+
+TEST_P(UdpPayloadFifoTest, CounterWrapsAround)
+{
+    Udp_Payload_Fifo fifo(4096, GetParam());
+    const uint64_t max = max_sequence_number();
+    push(fifo, max - 1, 1);
+    push(fifo, max, 2);
+    push(fifo, 0, 3);
+    push(fifo, 1, 4);
+    EXPECT_EQ(fifo.lost_packets(), 0U);
+    EXPECT_EQ(read_payloads(fifo), std::vector<uint8_t>({1, 2, 3, 4}));
+
+    // a gap across the wrap
+    push(fifo, max - 1, 5);
+    EXPECT_EQ(fifo.lost_packets(), 0U);  // late packet, dropped
+    push(fifo, 2, 6);
+    push(fifo, 5, 7);
+    EXPECT_EQ(fifo.lost_packets(), 2U);
+    EXPECT_EQ(read_payloads(fifo), std::vector<uint8_t>({6, 0, 0, 7}));
+
+    Udp_Payload_Fifo wrapping(4096, GetParam());
+    push(wrapping, max, 1);
+    push(wrapping, 1, 2);  // 0 lost
+    EXPECT_EQ(wrapping.lost_packets(), 1U);
+    EXPECT_EQ(read_payloads(wrapping), std::vector<uint8_t>({1, 0, 2}));
+}
+
+
+TEST_P(UdpPayloadFifoTest, LatePacketsAreDropped)
+{
+    Udp_Payload_Fifo fifo(4096, GetParam());
+    push(fifo, 10, 1);
+    push(fifo, 12, 2);  // 11 lost, zero-filled
+    push(fifo, 11, 3);  // arrives late: its place has been filled
+    push(fifo, 12, 4);  // duplicated
+    push(fifo, 5, 5);   // old
+    push(fifo, 13, 6);
+    EXPECT_EQ(fifo.lost_packets(), 1U);
+    EXPECT_EQ(fifo.overflows(), 0U);
+    EXPECT_EQ(read_payloads(fifo), std::vector<uint8_t>({1, 0, 2, 6}));
+}
+
+
+TEST_P(UdpPayloadFifoTest, GapOverflow)
+{
+    // room for four payloads
+    Udp_Payload_Fifo fifo(4 * payload_bytes, GetParam());
+    push(fifo, 0, 1);
+    push(fifo, 10, 2);  // the nine zero-filled payloads do not fit
+    EXPECT_EQ(fifo.lost_packets(), 9U);
+    EXPECT_EQ(fifo.overflows(), 1U);
+    EXPECT_EQ(read_payloads(fifo), std::vector<uint8_t>({1, 2}));
+}
+
+
+INSTANTIATE_TEST_CASE_P(SequenceNumberBytes, UdpPayloadFifoTest, ::testing::Values(2, 4, 8));
+
+
+TEST(UdpPayloadFifoNoCounterTest, PayloadsAreStoredAsIs)
+{
+    Udp_Payload_Fifo fifo(64, 0);
+    const std::vector<uint8_t> payload{0, 1, 2, 3};
+    fifo.push_payload(payload.data(), static_cast<int>(payload.size()));
+    fifo.push_payload(payload.data(), static_cast<int>(payload.size()));
+    std::vector<uint8_t> out(fifo.size());
+    fifo.read(out.data(), out.size());
+    EXPECT_EQ(out, std::vector<uint8_t>({0, 1, 2, 3, 0, 1, 2, 3}));
+    EXPECT_EQ(fifo.lost_packets(), 0U);
+}
@@ -0,0 +1,100 @@
+/*!
+ * \file deinterleaver_test.cc
+ * \brief Unit test for the block deinterleaver used by the telemetry decoders
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2012-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "deinterleaver.h"
+#include <boost/circular_buffer.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+
+namespace
+{
+void naive_deinterleaver(int32_t rows, int32_t cols, const float *in, float *out)
+{
+    for (int32_t r = 0; r < rows; r++)
+        {
+            for (int32_t c = 0; c < cols; c++)
+                {
+                    out[c * rows + r] = in[r * cols + c];
+                }
+        }
+}
+
+
+template <int32_t ROWS, int32_t COLS>
+void check_deinterleaver()
+{
+    const int32_t n = ROWS * COLS;
+    std::vector<float> in(n);
+    for (int32_t i = 0; i < n; i++)
+        {
+            in[i] = static_cast<float>(i + 1);
+        }
+    std::vector<float> expected(n);
+    naive_deinterleaver(ROWS, COLS, in.data(), expected.data());
+
+    std::vector<float> out(n);
+    Deinterleaver<ROWS, COLS>::run(in.data(), out.data());
+    for (int32_t i = 0; i < n; i++)
+        {
+            ASSERT_EQ(out[i], expected[i]);
+        }
+
+    // gains applied on the output positions, as done for the G2 inversion
+    Deinterleaver<ROWS, COLS>::run(in.data(), out.data(), -1.0F, 1.0F);
+    for (int32_t i = 0; i < n; i++)
+        {
+            ASSERT_EQ(out[i], (i % 2 == 0) ? -expected[i] : expected[i]);
+        }
+
+    // input read from a wrapped ring
+    boost::circular_buffer<float> ring(n + 7);
+    for (int32_t i = 0; i < 13; i++)
+        {
+            ring.push_back(0.0);
+        }
+    for (int32_t i = 0; i < n; i++)
+        {
+            ring.push_back(in[i]);
+        }
+    Deinterleaver<ROWS, COLS>::run(ring.begin() + 7, out.data());
+    for (int32_t i = 0; i < n; i++)
+        {
+            ASSERT_EQ(out[i], expected[i]);
+        }
+}
+}  // namespace
+
+
+TEST(DeinterleaverTest, GalileoInav)
+{
+    check_deinterleaver<8, 30>();
+}
+
+
+TEST(DeinterleaverTest, GalileoFnav)
+{
+    check_deinterleaver<8, 61>();
+}
+
+
+TEST(DeinterleaverTest, NotMultipleOfBlock)
+{
+    check_deinterleaver<5, 13>();
+}
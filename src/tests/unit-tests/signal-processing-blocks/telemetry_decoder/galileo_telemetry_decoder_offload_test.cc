@@ -0,0 +1,196 @@
+/*!
+ * \file galileo_telemetry_decoder_offload_test.cc
+ * \brief Tests that the Galileo telemetry decoder gives the same TOW and
+ * ephemeris when the page decoding is offloaded to the decoding pool
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2012-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "Galileo_E1.h"
+#include "Galileo_INAV.h"
+#include "galileo_ephemeris.h"
+#include "galileo_inav_encoder.h"
+#include "galileo_telemetry_decoder_gs.h"
+#include "gnss_satellite.h"
+#include "gnss_synchro.h"
+#include <boost/any.hpp>
+#include <gnuradio/blocks/message_debug.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_b.h>
+#include <gnuradio/blocks/vector_source_b.h>
+#endif
+
+
+class GalileoTelemetryDecoderOffloadTest : public ::testing::Test
+{
+protected:
+    static constexpr int64_t fs = 4000000;
+    static constexpr uint32_t first_tow_s = 345600;
+    static constexpr int32_t batches = 4;  // of words 1 to 5
+
+    // Batches of words 1 to 5 with random contents, and a last page to
+    // push the last word through the decoder
+    std::vector<Gnss_Synchro> make_symbols() const
+    {
+        std::mt19937 gen(1);
+        std::bernoulli_distribution bit(0.5);
+        std::vector<float> values;
+        for (int32_t n = 0; n <= batches * 5; n++)
+            {
+                std::string word(GALILEO_DATA_JK_BITS, '0');
+                const int32_t word_type = n < batches * 5 ? n % 5 + 1 : 0;
+                if (word_type != 0)
+                    {
+                        for (char& b : word)
+                            {
+                                b = bit(gen) ? '1' : '0';
+                            }
+                    }
+                galileo_inav_set_field(word, PAGE_TYPE_BIT, word_type);
+                if (word_type == 5)
+                    {
+                        galileo_inav_set_field(word, WN_5_BIT, 1100);
+                        galileo_inav_set_field(word, TOW_5_BIT, first_tow_s + 2 * n);  // at the start of the page
+                    }
+                else if (word_type != 0)
+                    {
+                        galileo_inav_set_field(word, IOD_NAV_1_BIT, 42 + n / 5);  // same field in words 1 to 4
+                    }
+                const std::vector<float> page = galileo_inav_encode_page(word);
+                values.insert(values.end(), page.cbegin(), page.cend());
+            }
+        std::vector<Gnss_Synchro> symbols;
+        for (size_t i = 0; i < values.size(); i++)
+            {
+                Gnss_Synchro gs{};
+                gs.System = 'E';
+                std::memcpy(static_cast<void*>(gs.Signal), "1B", 3);
+                gs.PRN = 1;
+                gs.fs = fs;
+                gs.Flag_valid_symbol_output = true;
+                gs.Tracking_sample_counter = static_cast<uint64_t>(i + 1) * static_cast<uint64_t>(fs / 250);
+                gs.Prompt_I = values[i];
+                symbols.push_back(gs);
+            }
+        return symbols;
+    }
+
+    struct Decoder_Output
+    {
+        std::map<uint64_t, uint32_t> tow_ms;  // TOW of each valid output, by sample counter
+        std::vector<Galileo_Ephemeris> ephemeris;
+    };
+
+    Decoder_Output run_decoder(const std::vector<Gnss_Synchro>& symbols, bool offload_decoding) const
+    {
+        auto decoder = galileo_make_telemetry_decoder_gs(Gnss_Satellite("Galileo", 1), 1, false, offload_decoding);
+        std::vector<unsigned char> bytes(symbols.size() * sizeof(Gnss_Synchro));
+        std::memcpy(bytes.data(), symbols.data(), bytes.size());
+        auto top_block = gr::make_top_block("GalileoTelemetryDecoderOffloadTest");
+        auto source = gr::blocks::vector_source_b::make(bytes, false, sizeof(Gnss_Synchro));
+        auto sink = gr::blocks::vector_sink_b::make(sizeof(Gnss_Synchro));
+        auto messages = gr::blocks::message_debug::make();
+        top_block->connect(source, 0, decoder, 0);
+        top_block->connect(decoder, 0, sink, 0);
+        top_block->msg_connect(decoder, pmt::mp("telemetry"), messages, pmt::mp("store"));
+        top_block->run();
+
+        Decoder_Output output;
+        const std::vector<unsigned char> out_bytes = sink->data();
+        std::vector<Gnss_Synchro> out(out_bytes.size() / sizeof(Gnss_Synchro));
+        std::memcpy(static_cast<void*>(out.data()), out_bytes.data(), out.size() * sizeof(Gnss_Synchro));
+        for (const auto& gs : out)
+            {
+                if (gs.Flag_valid_word)
+                    {
+                        output.tow_ms[gs.Tracking_sample_counter] = gs.TOW_at_current_symbol_ms;
+                    }
+            }
+        for (int i = 0; i < messages->num_messages(); i++)
+            {
+                const pmt::pmt_t msg = messages->get_message(i);
+                if (pmt::any_ref(msg).type() == typeid(std::shared_ptr<Galileo_Ephemeris>))
+                    {
+                        output.ephemeris.push_back(*boost::any_cast<std::shared_ptr<Galileo_Ephemeris>>(pmt::any_ref(msg)));
+                    }
+            }
+        return output;
+    }
+};
+
+
+TEST_F(GalileoTelemetryDecoderOffloadTest, SameTowAndEphemeris)
+{
+    const std::vector<Gnss_Synchro> symbols = make_symbols();
+    const Decoder_Output inline_decoding = run_decoder(symbols, false);
+    const Decoder_Output offloaded = run_decoder(symbols, true);
+
+    // the TOW is set by the first word 5, at the end of the first batch
+    ASSERT_FALSE(inline_decoding.tow_ms.empty());
+    ASSERT_FALSE(offloaded.tow_ms.empty());
+    EXPECT_GE(offloaded.tow_ms.cbegin()->first, inline_decoding.tow_ms.cbegin()->first);
+    EXPECT_GT(offloaded.tow_ms.size(), inline_decoding.tow_ms.size() / 2);
+    for (const auto& tow : offloaded.tow_ms)
+        {
+            const auto it = inline_decoding.tow_ms.find(tow.first);
+            ASSERT_NE(it, inline_decoding.tow_ms.cend()) << "at sample " << tow.first;
+            ASSERT_EQ(tow.second, it->second) << "at sample " << tow.first;
+        }
+
+    // consecutive symbols are GALILEO_E1_CODE_PERIOD_MS apart
+    uint64_t prev_sample = 0;
+    uint32_t prev_tow_ms = 0;
+    for (const auto& tow : inline_decoding.tow_ms)
+        {
+            if (prev_sample != 0)
+                {
+                    ASSERT_EQ(tow.second - prev_tow_ms, static_cast<uint32_t>(tow.first - prev_sample) / static_cast<uint32_t>(fs / 250) * GALILEO_E1_CODE_PERIOD_MS);
+                }
+            prev_sample = tow.first;
+            prev_tow_ms = tow.second;
+        }
+
+    ASSERT_GE(inline_decoding.ephemeris.size(), static_cast<size_t>(batches - 1));
+    ASSERT_EQ(offloaded.ephemeris.size(), inline_decoding.ephemeris.size());
+    for (size_t i = 0; i < offloaded.ephemeris.size(); i++)
+        {
+            const Galileo_Ephemeris& a = inline_decoding.ephemeris[i];
+            const Galileo_Ephemeris& b = offloaded.ephemeris[i];
+            EXPECT_EQ(b.IOD_ephemeris, a.IOD_ephemeris);
+            EXPECT_EQ(b.SV_ID_PRN_4, a.SV_ID_PRN_4);
+            EXPECT_EQ(b.M0_1, a.M0_1);
+            EXPECT_EQ(b.e_1, a.e_1);
+            EXPECT_EQ(b.A_1, a.A_1);
+            EXPECT_EQ(b.OMEGA_0_2, a.OMEGA_0_2);
+            EXPECT_EQ(b.i_0_2, a.i_0_2);
+            EXPECT_EQ(b.omega_2, a.omega_2);
+            EXPECT_EQ(b.C_rc_3, a.C_rc_3);
+            EXPECT_EQ(b.af0_4, a.af0_4);
+            EXPECT_EQ(b.WN_5, a.WN_5);
+            EXPECT_EQ(b.TOW_5, a.TOW_5);
+        }
+}
@@ -0,0 +1,149 @@
+/*!
+ * \file gps_l1_ca_assisted_tow_test.cc
+ * \brief Tests the assisted TOW synchronization of the GPS L1 C/A telemetry
+ * decoder
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2012-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "GPS_L1_CA.h"
+#include "gnss_satellite.h"
+#include "gnss_synchro.h"
+#include "gps_l1_ca_telemetry_decoder_gs.h"
+#include "gps_lnav_encoder.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_b.h>
+#include <gnuradio/blocks/vector_source_b.h>
+#endif
+
+
+class GpsL1CaAssistedTowTest : public ::testing::Test
+{
+protected:
+    static constexpr int64_t fs = 4000000;
+    static constexpr int32_t leading_bits = 37;
+    static constexpr uint32_t first_tow_count = 1001;  // first subframe starts at TOW = 6000 s
+
+    // Bits as received: some bits of an unknown subframe, then two full subframes
+    std::vector<Gnss_Synchro> make_symbols(bool inverted) const
+    {
+        std::vector<Gnss_Synchro> symbols;
+        uint32_t prev_word = 0;
+        std::vector<double> bits(leading_bits, 1.0);
+        for (uint32_t n = 0; n < 2; n++)
+            {
+                const auto words = gps_lnav_encode_subframe(first_tow_count + n, n + 1, prev_word);
+                for (uint32_t word : words)
+                    {
+                        for (int32_t b = GPS_WORD_BITS - 1; b >= 0; b--)
+                            {
+                                bits.push_back(((word >> static_cast<uint32_t>(b)) & 1U) ? 1.0 : -1.0);
+                            }
+                    }
+                prev_word = words[9];
+            }
+        for (size_t i = 0; i < bits.size(); i++)
+            {
+                Gnss_Synchro gs{};
+                gs.System = 'G';
+                std::memcpy(static_cast<void*>(gs.Signal), "1C", 3);
+                gs.PRN = 1;
+                gs.fs = fs;
+                gs.Flag_valid_symbol_output = true;
+                gs.Tracking_sample_counter = static_cast<uint64_t>(i + 1) * static_cast<uint64_t>(fs / 50);
+                gs.Prompt_I = inverted ? -bits[i] : bits[i];
+                symbols.push_back(gs);
+            }
+        return symbols;
+    }
+
+    std::vector<Gnss_Synchro> run_decoder(const std::vector<Gnss_Synchro>& symbols, bool assisted, double ref_tow_s) const
+    {
+        auto decoder = gps_l1_ca_make_telemetry_decoder_gs(Gnss_Satellite("GPS", 1), false);
+        if (assisted)
+            {
+                decoder->set_assisted_tow(ref_tow_s, 10.0);
+            }
+        std::vector<unsigned char> bytes(symbols.size() * sizeof(Gnss_Synchro));
+        std::memcpy(bytes.data(), symbols.data(), bytes.size());
+        auto top_block = gr::make_top_block("GpsL1CaAssistedTowTest");
+        auto source = gr::blocks::vector_source_b::make(bytes, false, sizeof(Gnss_Synchro));
+        auto sink = gr::blocks::vector_sink_b::make(sizeof(Gnss_Synchro));
+        top_block->connect(source, 0, decoder, 0);
+        top_block->connect(decoder, 0, sink, 0);
+        top_block->run();
+
+        const std::vector<unsigned char> out_bytes = sink->data();
+        std::vector<Gnss_Synchro> out(out_bytes.size() / sizeof(Gnss_Synchro));
+        std::memcpy(static_cast<void*>(out.data()), out_bytes.data(), out.size() * sizeof(Gnss_Synchro));
+        return out;
+    }
+
+    // Index of the first output with a valid TOW, or -1
+    static int64_t first_valid(const std::vector<Gnss_Synchro>& out)
+    {
+        for (size_t i = 0; i < out.size(); i++)
+            {
+                if (out[i].Flag_valid_word)
+                    {
+                        return static_cast<int64_t>(i);
+                    }
+            }
+        return -1;
+    }
+};
+
+
+TEST_F(GpsL1CaAssistedTowTest, TowAfterHow)
+{
+    // receiver clock 1.2 s off
+    const double ref_tow_s = 6000.0 - static_cast<double>(leading_bits) * 0.02 + 1.2;
+    for (bool inverted : {false, true})
+        {
+            const std::vector<Gnss_Synchro> out = run_decoder(make_symbols(inverted), true, ref_tow_s);
+            const int64_t i = first_valid(out);
+            // valid right after the last bit of the HOW
+            ASSERT_EQ(i, leading_bits + 2 * GPS_WORD_BITS - 1);
+            EXPECT_EQ(out[i].TOW_at_current_symbol_ms, first_tow_count * 6000 - 6000 + 2 * GPS_WORD_BITS * GPS_L1_CA_BIT_PERIOD_MS);
+            for (size_t j = i + 1; j < out.size(); j++)
+                {
+                    ASSERT_TRUE(out[j].Flag_valid_word);
+                    ASSERT_EQ(out[j].TOW_at_current_symbol_ms, out[j - 1].TOW_at_current_symbol_ms + GPS_L1_CA_BIT_PERIOD_MS);
+                }
+        }
+}
+
+
+TEST_F(GpsL1CaAssistedTowTest, RejectsWrongCoarseTime)
+{
+    const std::vector<Gnss_Synchro> out = run_decoder(make_symbols(false), true, 6000.0 + 60.0);
+    const int64_t i = first_valid(out);
+    EXPECT_TRUE(i == -1 or i >= leading_bits + GPS_SUBFRAME_BITS);
+}
+
+
+TEST_F(GpsL1CaAssistedTowTest, NotAssisted)
+{
+    const std::vector<Gnss_Synchro> out = run_decoder(make_symbols(false), false, 0.0);
+    const int64_t i = first_valid(out);
+    EXPECT_TRUE(i == -1 or i >= leading_bits + GPS_SUBFRAME_BITS);
+}
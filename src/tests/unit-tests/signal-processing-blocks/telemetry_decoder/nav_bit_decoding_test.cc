@@ -0,0 +1,111 @@
+/*!
+ * \file nav_bit_decoding_test.cc
+ * \brief Unit tests for the GPS LNAV parity check and the BeiDou BCH(15,11)
+ * decoder used by the telemetry decoders
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2012-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gps_lnav_encoder.h"
+#include "nav_bit_decoding.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+
+
+namespace
+{
+// Systematic encoding by polynomial division, g(X) = X^4 + X + 1
+uint32_t bch15_11_encode(uint32_t message)
+{
+    uint32_t remainder = message << 4U;
+    for (int32_t i = 14; i >= 4; i--)
+        {
+            if (remainder & (1U << static_cast<uint32_t>(i)))
+                {
+                    remainder ^= 0x13U << static_cast<uint32_t>(i - 4);
+                }
+        }
+    return (message << 4U) | remainder;
+}
+}  // namespace
+
+
+TEST(NavBitDecodingTest, Bch15_11CorrectsSingleErrors)
+{
+    for (uint32_t message = 0; message < (1U << 11U); message++)
+        {
+            const uint32_t codeword = bch15_11_encode(message);
+            ASSERT_EQ(bch15_11_decode(codeword), codeword);
+            for (uint32_t bit = 0; bit < 15; bit++)
+                {
+                    ASSERT_EQ(bch15_11_decode(codeword ^ (1U << bit)), codeword);
+                }
+        }
+}
+
+
+TEST(NavBitDecodingTest, BeidouDnavWord)
+{
+    const uint32_t first = bch15_11_encode(0x5A3U);
+    const uint32_t second = bch15_11_encode(0x1C7U);
+    std::array<float, 30> symbols{};
+    for (int32_t c = 0; c < 15; c++)
+        {
+            symbols[2 * c] = ((first >> static_cast<uint32_t>(14 - c)) & 1U) ? 0.8F : -0.8F;
+            symbols[2 * c + 1] = ((second >> static_cast<uint32_t>(14 - c)) & 1U) ? 0.8F : -0.8F;
+        }
+    const uint32_t expected = (0x5A3U << 19U) | (0x1C7U << 8U) | ((first & 0xFU) << 4U) | (second & 0xFU);
+    EXPECT_EQ(beidou_dnav_decode_word(symbols.data(), false), expected);
+
+    // one error in each codeword
+    symbols[6] = -symbols[6];
+    symbols[21] = -symbols[21];
+    EXPECT_EQ(beidou_dnav_decode_word(symbols.data(), false), expected);
+
+    // the first word is not interleaved
+    EXPECT_EQ(beidou_dnav_decode_word(symbols.data(), true), pack_symbols(symbols.data(), 30));
+}
+
+
+TEST(NavBitDecodingTest, LnavParity)
+{
+    const std::array<uint32_t, 10> data{{0x8B1234U, 0x00A5A4U, 0xFFFFFFU, 0x000000U, 0x123456U,
+        0x654321U, 0xABCDEFU, 0xFEDCBAU, 0x0F0F0FU, 0xF0F0F0U}};
+    for (uint32_t prev_tail = 0; prev_tail < 4; prev_tail++)
+        {
+            const std::array<uint32_t, 10> subframe = gps_lnav_encode_subframe(data, prev_tail);
+
+            std::array<uint32_t, 10> words = subframe;
+            uint32_t prev_word = prev_tail;
+            ASSERT_TRUE(gps_lnav_parity_check(words.data(), 10, prev_word));
+            for (int32_t w = 0; w < 10; w++)
+                {
+                    // data bits are restored to their non inverted value
+                    EXPECT_EQ((words[w] >> 6U) & 0xFFFFFFU, data[w]);
+                }
+            EXPECT_EQ(prev_word, words[9]);
+
+            for (int32_t w = 0; w < 10; w++)
+                {
+                    for (uint32_t bit = 0; bit < 30; bit++)
+                        {
+                            words = subframe;
+                            words[w] ^= 1U << bit;
+                            prev_word = prev_tail;
+                            ASSERT_FALSE(gps_lnav_parity_check(words.data(), 10, prev_word));
+                        }
+                }
+        }
+}
@@ -0,0 +1,61 @@
+/*!
+ * \file tlm_decoding_pool_test.cc
+ * \brief Unit test for the pool of threads shared by the telemetry decoders
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2012-2020  (see AUTHORS file for a list of contributors)
+ *
+ * GNSS-SDR is a software defined Global Navigation
+ *          Satellite Systems receiver
+ *
+ * This file is part of GNSS-SDR.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "tlm_decoding_pool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include <vector>
+
+
+TEST(TlmDecodingPoolTest, RunsAllJobs)
+{
+    auto& pool = Tlm_Decoding_Pool::instance();
+    EXPECT_GE(pool.num_workers(), 1U);
+
+    const int num_jobs = 100;
+    std::atomic<int> executed{0};
+    std::vector<std::future<void>> results;
+    results.reserve(num_jobs);
+    for (int i = 0; i < num_jobs; i++)
+        {
+            results.push_back(pool.submit([&executed] { executed++; }));
+        }
+    for (auto& r : results)
+        {
+            r.get();
+        }
+    EXPECT_EQ(executed.load(), num_jobs);
+}
+
+
+TEST(TlmDecodingPoolTest, JobResultIsVisibleAfterWait)
+{
+    std::vector<int> page(500, 0);
+    std::future<void> result = Tlm_Decoding_Pool::instance().submit([&page] {
+        for (size_t i = 0; i < page.size(); i++)
+            {
+                page[i] = static_cast<int>(i);
+            }
+    });
+    result.wait();
+    for (size_t i = 0; i < page.size(); i++)
+        {
+            EXPECT_EQ(page[i], static_cast<int>(i));
+        }
+}
@@ -19,14 +19,24 @@
  */
 
 #include "GPS_L1_CA.h"
+#include "MATH_CONSTANTS.h"
 #include "cpu_multicorrelator_real_codes.h"
+#include "galileo_e5_signal_processing.h"
 #include "gps_sdr_signal_processing.h"
+#include "packed_code_replica_cache.h"
 #include <gflags/gflags.h>
 #include <gnuradio/gr_complex.h>
 #include <gtest/gtest.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <volk_gnsssdr/volk_gnsssdr_prefs.h>
+#include <array>
 #include <chrono>
+#include <cmath>
 #include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
 #include <random>
 #include <thread>
 
@@ -255,3 +265,382 @@ TEST(CpuMulticorrelatorRealCodesTest, MeasureExecutionTimeAlloc)
             correlator_pool[n]->free();
         }
 }
+
+
+TEST(CpuMulticorrelatorRealCodesTest, FusedResamplerVsTwoStage)
+{
+    const int correlation_size = 4092;
+    const int d_n_correlator_taps = 3;  // Early, Prompt, and Late
+    volk_gnsssdr::vector<float> d_ca_code(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS));
+    volk_gnsssdr::vector<gr_complex> in_cpu(correlation_size);
+    volk_gnsssdr::vector<gr_complex> outs_two_stage(d_n_correlator_taps, gr_complex(0.0, 0.0));
+    volk_gnsssdr::vector<gr_complex> outs_fused(d_n_correlator_taps, gr_complex(0.0, 0.0));
+    volk_gnsssdr::vector<float> d_local_code_shift_chips = {-0.5, 0.0, 0.5};
+
+    gps_l1_ca_code_gen_float(d_ca_code, 1, 0);
+    std::default_random_engine e1(1);
+    std::uniform_real_distribution<float> uniform_dist(0, 1);
+    for (int n = 0; n < correlation_size; n++)
+        {
+            in_cpu[n] = std::complex<float>(uniform_dist(e1), uniform_dist(e1));
+        }
+
+    Cpu_Multicorrelator_Real_Codes two_stage;
+    Cpu_Multicorrelator_Real_Codes fused;
+    two_stage.set_fused_resampler(false);
+    fused.set_fused_resampler(true);
+    for (auto* correlator : {&two_stage, &fused})
+        {
+            correlator->set_high_dynamics_resampler(false);
+            correlator->init(correlation_size, d_n_correlator_taps);
+            correlator->set_local_code_and_taps(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS), d_ca_code.data(), d_local_code_shift_chips.data());
+        }
+    two_stage.set_input_output_vectors(outs_two_stage.data(), in_cpu.data());
+    fused.set_input_output_vectors(outs_fused.data(), in_cpu.data());
+
+    const float d_rem_carrier_phase_rad = 0.3;
+    const float d_carrier_phase_step_rad = 0.1;
+    const float d_code_phase_step_chips = static_cast<float>(GPS_L1_CA_CODE_LENGTH_CHIPS) / static_cast<float>(correlation_size);
+    const float d_rem_code_phase_chips = 0.4;
+
+    std::chrono::duration<double> elapsed_two_stage(0);
+    std::chrono::duration<double> elapsed_fused(0);
+    for (int k = 0; k < FLAGS_cpu_multicorrelator_real_codes_iterations_test; k++)
+        {
+            auto start = std::chrono::system_clock::now();
+            two_stage.Carrier_wipeoff_multicorrelator_resampler(d_rem_carrier_phase_rad, d_carrier_phase_step_rad, d_rem_code_phase_chips, d_code_phase_step_chips, 0.0, correlation_size);
+            auto middle = std::chrono::system_clock::now();
+            fused.Carrier_wipeoff_multicorrelator_resampler(d_rem_carrier_phase_rad, d_carrier_phase_step_rad, d_rem_code_phase_chips, d_code_phase_step_chips, 0.0, correlation_size);
+            auto end = std::chrono::system_clock::now();
+            elapsed_two_stage += middle - start;
+            elapsed_fused += end - middle;
+        }
+    std::cout << "CPU Multicorrelator (real codes) execution time for length=" << correlation_size
+              << ": two-stage " << elapsed_two_stage.count() / static_cast<double>(FLAGS_cpu_multicorrelator_real_codes_iterations_test)
+              << " [s], fused " << elapsed_fused.count() / static_cast<double>(FLAGS_cpu_multicorrelator_real_codes_iterations_test) << " [s]\n";
+
+    for (int n = 0; n < d_n_correlator_taps; n++)
+        {
+            EXPECT_NEAR(outs_two_stage[n].real(), outs_fused[n].real(), 1e-3 * std::abs(outs_two_stage[n]));
+            EXPECT_NEAR(outs_two_stage[n].imag(), outs_fused[n].imag(), 1e-3 * std::abs(outs_two_stage[n]));
+        }
+
+    two_stage.free();
+    fused.free();
+}
+
+
+TEST(CpuMulticorrelatorRealCodesTest, IntegerInputVsFloat)
+{
+    const int correlation_size = 4092;
+    const int d_n_correlator_taps = 3;  // Early, Prompt, and Late
+    volk_gnsssdr::vector<float> d_ca_code(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS));
+    volk_gnsssdr::vector<gr_complex> in_float(correlation_size);
+    volk_gnsssdr::vector<std::complex<int16_t>> in_16sc(correlation_size);
+    volk_gnsssdr::vector<std::complex<int8_t>> in_8sc(correlation_size);
+    volk_gnsssdr::vector<float> d_local_code_shift_chips = {-0.5, 0.0, 0.5};
+
+    gps_l1_ca_code_gen_float(d_ca_code, 1, 0);
+    std::default_random_engine e1(1);
+    std::uniform_int_distribution<int> uniform_dist(-100, 100);
+    for (int n = 0; n < correlation_size; n++)
+        {
+            const int re = uniform_dist(e1);
+            const int im = uniform_dist(e1);
+            in_float[n] = gr_complex(static_cast<float>(re), static_cast<float>(im));
+            in_16sc[n] = std::complex<int16_t>(static_cast<int16_t>(re), static_cast<int16_t>(im));
+            in_8sc[n] = std::complex<int8_t>(static_cast<int8_t>(re), static_cast<int8_t>(im));
+        }
+
+    const float d_rem_carrier_phase_rad = 0.3;
+    const float d_carrier_phase_step_rad = 0.1;
+    const float d_code_phase_step_chips = static_cast<float>(GPS_L1_CA_CODE_LENGTH_CHIPS) / static_cast<float>(correlation_size);
+    const float d_code_phase_rate_step_chips = 1e-8;
+    const float d_rem_code_phase_chips = 0.4;
+
+    // both the fused path and the high dynamics path (which widens the samples before the rotator) are checked
+    for (bool high_dynamics : {false, true})
+        {
+            volk_gnsssdr::vector<gr_complex> outs_float(d_n_correlator_taps, gr_complex(0.0, 0.0));
+            volk_gnsssdr::vector<gr_complex> outs_16sc(d_n_correlator_taps, gr_complex(0.0, 0.0));
+            volk_gnsssdr::vector<gr_complex> outs_8sc(d_n_correlator_taps, gr_complex(0.0, 0.0));
+            Cpu_Multicorrelator_Real_Codes correlator_float;
+            Cpu_Multicorrelator_Real_Codes correlator_16sc;
+            Cpu_Multicorrelator_Real_Codes correlator_8sc;
+            for (auto* correlator : {&correlator_float, &correlator_16sc, &correlator_8sc})
+                {
+                    correlator->set_high_dynamics_resampler(high_dynamics);
+                    correlator->init(correlation_size, d_n_correlator_taps);
+                    correlator->set_local_code_and_taps(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS), d_ca_code.data(), d_local_code_shift_chips.data());
+                }
+            correlator_float.set_input_output_vectors(outs_float.data(), in_float.data());
+            correlator_16sc.set_input_output_vectors(outs_16sc.data(), in_16sc.data());
+            correlator_8sc.set_input_output_vectors(outs_8sc.data(), in_8sc.data());
+
+            for (auto* correlator : {&correlator_float, &correlator_16sc, &correlator_8sc})
+                {
+                    correlator->Carrier_wipeoff_multicorrelator_resampler(d_rem_carrier_phase_rad,
+                        d_carrier_phase_step_rad,
+                        d_rem_code_phase_chips,
+                        d_code_phase_step_chips,
+                        high_dynamics ? d_code_phase_rate_step_chips : 0.0F,
+                        correlation_size);
+                }
+
+            for (int n = 0; n < d_n_correlator_taps; n++)
+                {
+                    const float tolerance = 1e-3 * std::abs(outs_float[n]);
+                    EXPECT_NEAR(outs_float[n].real(), outs_16sc[n].real(), tolerance);
+                    EXPECT_NEAR(outs_float[n].imag(), outs_16sc[n].imag(), tolerance);
+                    EXPECT_NEAR(outs_float[n].real(), outs_8sc[n].real(), tolerance);
+                    EXPECT_NEAR(outs_float[n].imag(), outs_8sc[n].imag(), tolerance);
+                }
+
+            correlator_float.free();
+            correlator_16sc.free();
+            correlator_8sc.free();
+        }
+}
+
+
+TEST(CpuMulticorrelatorRealCodesTest, FusedCarrierPhaseDoesNotDrift)
+{
+    // A long integration with a constant input and a constant code, so that the
+    // correlation is the sum of the carrier phasors and has a closed form
+    const unsigned int num_points = 2000000;
+    const double phase_step_rad = 0.0123;
+    const double initial_phase_rad = 0.3;
+    volk_gnsssdr::vector<gr_complex> in(num_points, gr_complex(1.0, 0.0));
+    volk_gnsssdr::vector<float> local_code(1, 1.0);
+    const float* local_codes[1] = {local_code.data()};
+    volk_gnsssdr::vector<float> shifts_chips(1, 0.0);
+    volk_gnsssdr::vector<gr_complex> out(1);
+
+    double phase_rad = initial_phase_rad;
+    volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn(out.data(), in.data(), phase_step_rad, &phase_rad, local_codes, 0.0, 1.0, 0.0, shifts_chips.data(), 1, 1, num_points);
+
+    const double total_phase_rad = initial_phase_rad + phase_step_rad * static_cast<double>(num_points);
+    EXPECT_NEAR(std::remainder(phase_rad - total_phase_rad, TWO_PI), 0.0, 1e-6);
+
+    const std::complex<double> j(0.0, 1.0);
+    const std::complex<double> expected = std::exp(j * initial_phase_rad) * (1.0 - std::exp(j * total_phase_rad - j * initial_phase_rad)) / (1.0 - std::exp(j * phase_step_rad));
+    EXPECT_NEAR(out[0].real(), expected.real(), 0.05);
+    EXPECT_NEAR(out[0].imag(), expected.imag(), 0.05);
+}
+
+
+TEST(CpuMulticorrelatorRealCodesTest, PackedCodesVsFused)
+{
+    const int correlation_size = 4092;
+    const int d_n_correlator_taps = 3;  // Early, Prompt, and Late
+    volk_gnsssdr::vector<float> d_ca_code(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS));
+    volk_gnsssdr::vector<gr_complex> in_cpu(correlation_size);
+    volk_gnsssdr::vector<gr_complex> outs_fused(d_n_correlator_taps, gr_complex(0.0, 0.0));
+    volk_gnsssdr::vector<gr_complex> outs_packed(d_n_correlator_taps, gr_complex(0.0, 0.0));
+    volk_gnsssdr::vector<gr_complex> outs_packed_2(d_n_correlator_taps, gr_complex(0.0, 0.0));
+    volk_gnsssdr::vector<float> d_local_code_shift_chips = {-0.5, 0.0, 0.5};
+
+    gps_l1_ca_code_gen_float(d_ca_code, 1, 0);
+    std::default_random_engine e1(1);
+    std::uniform_real_distribution<float> uniform_dist(0, 1);
+    for (int n = 0; n < correlation_size; n++)
+        {
+            in_cpu[n] = std::complex<float>(uniform_dist(e1), uniform_dist(e1));
+        }
+
+    Cpu_Multicorrelator_Real_Codes fused;
+    Cpu_Multicorrelator_Real_Codes packed;
+    Cpu_Multicorrelator_Real_Codes packed_2;  // another channel on the same signal
+    packed.set_packed_codes(true);
+    packed_2.set_packed_codes(true);
+    for (auto* correlator : {&fused, &packed, &packed_2})
+        {
+            correlator->set_high_dynamics_resampler(false);
+            correlator->init(correlation_size, d_n_correlator_taps);
+            correlator->set_local_code_and_taps(static_cast<int>(GPS_L1_CA_CODE_LENGTH_CHIPS), d_ca_code.data(), d_local_code_shift_chips.data());
+        }
+    fused.set_input_output_vectors(outs_fused.data(), in_cpu.data());
+    packed.set_input_output_vectors(outs_packed.data(), in_cpu.data());
+    packed_2.set_input_output_vectors(outs_packed_2.data(), in_cpu.data());
+
+    // the code phase and its advance over the span are multiples of the default resolution, so the replicas are exact
+    const float d_rem_carrier_phase_rad = 0.3;
+    const float d_carrier_phase_step_rad = 0.1;
+    const float d_code_phase_step_chips = static_cast<float>(GPS_L1_CA_CODE_LENGTH_CHIPS) / static_cast<float>(correlation_size);
+    const float d_rem_code_phase_chips = 0.375;
+
+    Packed_Code_Replica_Cache::instance().clear();
+    fused.Carrier_wipeoff_multicorrelator_resampler(d_rem_carrier_phase_rad, d_carrier_phase_step_rad, d_rem_code_phase_chips, d_code_phase_step_chips, 0.0, correlation_size);
+    packed.Carrier_wipeoff_multicorrelator_resampler(d_rem_carrier_phase_rad, d_carrier_phase_step_rad, d_rem_code_phase_chips, d_code_phase_step_chips, 0.0, correlation_size);
+    EXPECT_EQ(Packed_Code_Replica_Cache::instance().size(), 1U);
+    packed_2.Carrier_wipeoff_multicorrelator_resampler(d_rem_carrier_phase_rad, d_carrier_phase_step_rad, d_rem_code_phase_chips, d_code_phase_step_chips, 0.0, correlation_size);
+    EXPECT_EQ(Packed_Code_Replica_Cache::instance().size(), 1U);
+
+    for (int n = 0; n < d_n_correlator_taps; n++)
+        {
+            EXPECT_NEAR(outs_fused[n].real(), outs_packed[n].real(), 1e-3 * std::abs(outs_fused[n]));
+            EXPECT_NEAR(outs_fused[n].imag(), outs_packed[n].imag(), 1e-3 * std::abs(outs_fused[n]));
+            EXPECT_EQ(outs_packed[n], outs_packed_2[n]);
+        }
+
+    fused.free();
+    packed.free();
+    packed_2.free();
+    Packed_Code_Replica_Cache::instance().clear();
+}
+
+
+TEST(CpuMulticorrelatorRealCodesTest, DataCodeVsSeparateCorrelator)
+{
+    const int correlation_size = 10230;
+    const int code_length_chips = 10230;
+    volk_gnsssdr::vector<gr_complex> aux_code(code_length_chips);
+    volk_gnsssdr::vector<float> pilot_code(code_length_chips);
+    volk_gnsssdr::vector<float> data_code(code_length_chips);
+    volk_gnsssdr::vector<gr_complex> in_cpu(correlation_size);
+    volk_gnsssdr::vector<std::complex<int16_t>> in_16sc(correlation_size);
+
+    const std::array<char, 3> signal_type = {{'5', 'X', '\0'}};
+    galileo_e5_a_code_gen_complex_primary(aux_code, 1, signal_type);
+    for (int n = 0; n < code_length_chips; n++)
+        {
+            pilot_code[n] = aux_code[n].imag();
+            data_code[n] = aux_code[n].real();
+        }
+    std::default_random_engine e1(1);
+    std::uniform_int_distribution<int> uniform_dist(-100, 100);
+    for (int n = 0; n < correlation_size; n++)
+        {
+            const int re = uniform_dist(e1);
+            const int im = uniform_dist(e1);
+            in_cpu[n] = gr_complex(static_cast<float>(re), static_cast<float>(im));
+            in_16sc[n] = std::complex<int16_t>(static_cast<int16_t>(re), static_cast<int16_t>(im));
+        }
+
+    const float d_rem_carrier_phase_rad = 0.3;
+    const float d_carrier_phase_step_rad = 0.1;
+    const float d_code_phase_step_chips = static_cast<float>(code_length_chips) / static_cast<float>(correlation_size);
+    const float d_rem_code_phase_chips = 0.375;
+
+    // E/P/L and VE/E/P/L/VL pilot taps, plus the data prompt
+    for (auto d_local_code_shift_chips : {volk_gnsssdr::vector<float>{-0.5, 0.0, 0.5}, volk_gnsssdr::vector<float>{-1.0, -0.5, 0.0, 0.5, 1.0}})
+        {
+            const int d_n_correlator_taps = static_cast<int>(d_local_code_shift_chips.size());
+            float* d_prompt_data_shift = &d_local_code_shift_chips[d_n_correlator_taps / 2];
+            // fused, two-stage and packed paths
+            for (int path = 0; path < 3; path++)
+                {
+                    volk_gnsssdr::vector<gr_complex> outs_pilot(d_n_correlator_taps, gr_complex(0.0, 0.0));
+                    volk_gnsssdr::vector<gr_complex> outs_data(1, gr_complex(0.0, 0.0));
+                    volk_gnsssdr::vector<gr_complex> outs_shared(d_n_correlator_taps, gr_complex(0.0, 0.0));
+                    volk_gnsssdr::vector<gr_complex> outs_shared_data(1, gr_complex(0.0, 0.0));
+                    volk_gnsssdr::vector<gr_complex> outs_shared_16sc(d_n_correlator_taps, gr_complex(0.0, 0.0));
+                    volk_gnsssdr::vector<gr_complex> outs_shared_16sc_data(1, gr_complex(0.0, 0.0));
+                    Cpu_Multicorrelator_Real_Codes pilot;
+                    Cpu_Multicorrelator_Real_Codes data;
+                    Cpu_Multicorrelator_Real_Codes shared;
+                    Cpu_Multicorrelator_Real_Codes shared_16sc;  // the fused kernels read integer samples directly
+                    for (auto* correlator : {&pilot, &data, &shared, &shared_16sc})
+                        {
+                            correlator->set_high_dynamics_resampler(false);
+                            correlator->set_fused_resampler(path == 0);
+                            correlator->set_packed_codes(path == 2);
+                        }
+                    pilot.init(correlation_size, d_n_correlator_taps);
+                    data.init(correlation_size, 1);
+                    pilot.set_local_code_and_taps(code_length_chips, pilot_code.data(), d_local_code_shift_chips.data());
+                    data.set_local_code_and_taps(code_length_chips, data_code.data(), d_prompt_data_shift);
+                    for (auto* correlator : {&shared, &shared_16sc})
+                        {
+                            correlator->init(correlation_size, d_n_correlator_taps);
+                            correlator->set_local_code_and_taps(code_length_chips, pilot_code.data(), d_local_code_shift_chips.data());
+                        }
+                    shared.set_data_local_code_and_taps(data_code.data(), d_prompt_data_shift, 1, outs_shared_data.data());
+                    shared_16sc.set_data_local_code_and_taps(data_code.data(), d_prompt_data_shift, 1, outs_shared_16sc_data.data());
+                    pilot.set_input_output_vectors(outs_pilot.data(), in_cpu.data());
+                    data.set_input_output_vectors(outs_data.data(), in_cpu.data());
+                    shared.set_input_output_vectors(outs_shared.data(), in_cpu.data());
+                    shared_16sc.set_input_output_vectors(outs_shared_16sc.data(), in_16sc.data());
+
+                    std::chrono::duration<double> elapsed_separate(0);
+                    std::chrono::duration<double> elapsed_shared(0);
+                    for (int k = 0; k < FLAGS_cpu_multicorrelator_real_codes_iterations_test; k++)
+                        {
+                            auto start = std::chrono::system_clock::now();
+                            pilot.Carrier_wipeoff_multicorrelator_resampler(d_rem_carrier_phase_rad, d_carrier_phase_step_rad, d_rem_code_phase_chips, d_code_phase_step_chips, 0.0, correlation_size);
+                            data.Carrier_wipeoff_multicorrelator_resampler(d_rem_carrier_phase_rad, d_carrier_phase_step_rad, d_rem_code_phase_chips, d_code_phase_step_chips, 0.0, correlation_size);
+                            auto middle = std::chrono::system_clock::now();
+                            shared.Carrier_wipeoff_multicorrelator_resampler(d_rem_carrier_phase_rad, d_carrier_phase_step_rad, d_rem_code_phase_chips, d_code_phase_step_chips, 0.0, correlation_size);
+                            auto end = std::chrono::system_clock::now();
+                            elapsed_separate += middle - start;
+                            elapsed_shared += end - middle;
+                        }
+                    shared_16sc.Carrier_wipeoff_multicorrelator_resampler(d_rem_carrier_phase_rad, d_carrier_phase_step_rad, d_rem_code_phase_chips, d_code_phase_step_chips, 0.0, correlation_size);
+                    std::cout << "CPU Multicorrelator (real codes) pilot+data execution time for length=" << correlation_size << " and " << d_n_correlator_taps << "+1 taps"
+                              << (path == 0 ? " (fused)" : (path == 1 ? " (two-stage)" : " (packed)"))
+                              << ": separate " << elapsed_separate.count() / static_cast<double>(FLAGS_cpu_multicorrelator_real_codes_iterations_test)
+                              << " [s], shared " << elapsed_shared.count() / static_cast<double>(FLAGS_cpu_multicorrelator_real_codes_iterations_test) << " [s]\n";
+
+                    for (int n = 0; n < d_n_correlator_taps; n++)
+                        {
+                            EXPECT_NEAR(outs_pilot[n].real(), outs_shared[n].real(), 1e-3 * std::abs(outs_pilot[n]));
+                            EXPECT_NEAR(outs_pilot[n].imag(), outs_shared[n].imag(), 1e-3 * std::abs(outs_pilot[n]));
+                            EXPECT_NEAR(outs_pilot[n].real(), outs_shared_16sc[n].real(), 1e-3 * std::abs(outs_pilot[n]));
+                            EXPECT_NEAR(outs_pilot[n].imag(), outs_shared_16sc[n].imag(), 1e-3 * std::abs(outs_pilot[n]));
+                        }
+                    EXPECT_NEAR(outs_data[0].real(), outs_shared_data[0].real(), 1e-3 * std::abs(outs_data[0]));
+                    EXPECT_NEAR(outs_data[0].imag(), outs_shared_data[0].imag(), 1e-3 * std::abs(outs_data[0]));
+                    EXPECT_NEAR(outs_data[0].real(), outs_shared_16sc_data[0].real(), 1e-3 * std::abs(outs_data[0]));
+                    EXPECT_NEAR(outs_data[0].imag(), outs_shared_16sc_data[0].imag(), 1e-3 * std::abs(outs_data[0]));
+
+                    pilot.free();
+                    data.free();
+                    shared.free();
+                    shared_16sc.free();
+                }
+        }
+    Packed_Code_Replica_Cache::instance().clear();
+}
+
+
+TEST(CpuMulticorrelatorRealCodesTest, KernelAutotuning)
+{
+    // keep the calibration away from the user volk_gnsssdr_shape_config
+    const std::string config_folder("./volk_gnsssdr_tuning_test");
+    const std::string config_file = config_folder + "/volk_gnsssdr/volk_gnsssdr_shape_config";
+    setenv("VOLK_CONFIGPATH", config_folder.c_str(), 1);
+
+    const int correlation_size = 4092;
+    const int d_n_correlator_taps = 3;  // Early, Prompt, and Late
+    Cpu_Multicorrelator_Real_Codes correlator;
+    correlator.set_high_dynamics_resampler(false);
+    correlator.init(2 * correlation_size, d_n_correlator_taps);
+    correlator.tune_kernels(correlation_size, "gr_complex");
+
+    volk_gnsssdr_shape_pref_t* prefs = nullptr;
+    const size_t n_prefs = volk_gnsssdr_load_shape_preferences(&prefs);
+    int n_entries = 0;
+    for (size_t i = 0; i < n_prefs; i++)
+        {
+            if (std::string(prefs[i].name) == "volk_gnsssdr_32fc_32f_resampler_rotator_dot_prod_32fc_xn" and
+                prefs[i].num_points_bucket == volk_gnsssdr_num_points_bucket(correlation_size) and
+                prefs[i].num_vectors == static_cast<unsigned int>(d_n_correlator_taps))
+                {
+                    n_entries++;
+                }
+        }
+    free(prefs);
+    EXPECT_EQ(n_entries, 1);
+
+    // a second calibration of the same shape reuses the stored entry
+    correlator.tune_kernels(correlation_size + 1, "gr_complex");
+    prefs = nullptr;
+    EXPECT_EQ(volk_gnsssdr_load_shape_preferences(&prefs), n_prefs);
+    free(prefs);
+
+    correlator.free();
+    unsetenv("VOLK_CONFIGPATH");
+    std::remove(config_file.c_str());
+    std::remove((config_folder + "/volk_gnsssdr").c_str());
+    std::remove(config_folder.c_str());
+}
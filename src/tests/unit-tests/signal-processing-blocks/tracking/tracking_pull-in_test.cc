@@ -44,17 +44,22 @@
 #include "tracking_tests_flags.h"
 #include "tracking_true_obs_reader.h"
 #include <armadillo>
+#include <gnuradio/blocks/char_to_short.h>
 #include <gnuradio/blocks/file_source.h>
 #include <gnuradio/blocks/head.h>
 #include <gnuradio/blocks/interleaved_char_to_complex.h>
 #include <gnuradio/blocks/null_sink.h>
 #include <gnuradio/blocks/skiphead.h>
+#include <gnuradio/blocks/stream_to_vector.h>
 #include <gnuradio/filter/firdes.h>
 #include <gnuradio/top_block.h>
 #include <gtest/gtest.h>
 #include <pmt/pmt.h>
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -157,6 +162,23 @@ TrackingPullInTest_msg_rx::~TrackingPullInTest_msg_rx() = default;
 
 // ###########################################################
 
+// The signal file holds interleaved 8 bits I/Q samples. They are fed to the
+// tracking as they are for cbyte, widened to 16 bits for cshort, and converted
+// to float for gr_complex
+size_t tracking_item_size(const std::string& item_type)
+{
+    if (item_type == "cbyte")
+        {
+            return 2 * sizeof(int8_t);
+        }
+    if (item_type == "cshort")
+        {
+            return 2 * sizeof(int16_t);
+        }
+    return sizeof(gr_complex);
+}
+
+
 class TrackingPullInTest : public ::testing::Test
 {
 public:
@@ -233,10 +255,21 @@ public:
         double DLL_wide_bw_hz,
         double PLL_narrow_bw_hz,
         double DLL_narrow_bw_hz,
-        int extend_correlation_symbols);
+        int extend_correlation_symbols,
+        const std::string& item_type);
 
     bool acquire_signal(int SV_ID);
 
+    gr::blocks::head::sptr connect_signal_file(const gr::top_block_sptr& top_block,
+        const std::string& file,
+        const std::string& item_type);
+
+    void track_signal_file(const std::string& file,
+        const std::string& item_type,
+        bool& locked,
+        std::vector<double>& doppler_hz,
+        std::vector<double>& delay_chips);
+
     std::shared_ptr<GNSSBlockFactory> factory;
     std::shared_ptr<InMemoryConfiguration> config;
     Gnss_Synchro gnss_synchro;
@@ -298,13 +331,14 @@ void TrackingPullInTest::configure_receiver(
     double DLL_wide_bw_hz,
     double PLL_narrow_bw_hz,
     double DLL_narrow_bw_hz,
-    int extend_correlation_symbols)
+    int extend_correlation_symbols,
+    const std::string& item_type)
 {
     config = std::make_shared<InMemoryConfiguration>();
     config->set_property("Tracking.dump", "true");
     config->set_property("Tracking.dump_filename", "./tracking_ch_");
     config->set_property("Tracking.implementation", implementation);
-    config->set_property("Tracking.item_type", "gr_complex");
+    config->set_property("Tracking.item_type", item_type);
     config->set_property("Tracking.pll_bw_hz", std::to_string(PLL_wide_bw_hz));
     config->set_property("Tracking.dll_bw_hz", std::to_string(DLL_wide_bw_hz));
     config->set_property("Tracking.extend_correlation_symbols", std::to_string(extend_correlation_symbols));
@@ -691,6 +725,83 @@ bool TrackingPullInTest::acquire_signal(int SV_ID)
 }
 
 
+gr::blocks::head::sptr TrackingPullInTest::connect_signal_file(const gr::top_block_sptr& top_block,
+    const std::string& file,
+    const std::string& item_type)
+{
+    gr::blocks::file_source::sptr file_source = gr::blocks::file_source::make(sizeof(int8_t), file.c_str(), false);
+    gr::blocks::head::sptr head_samples = gr::blocks::head::make(tracking_item_size(item_type), baseband_sampling_freq * FLAGS_duration);
+    if (item_type == "cbyte")
+        {
+            gr::blocks::stream_to_vector::sptr char_to_cbyte = gr::blocks::stream_to_vector::make(sizeof(int8_t), 2);
+            top_block->connect(file_source, 0, char_to_cbyte, 0);
+            top_block->connect(char_to_cbyte, 0, head_samples, 0);
+        }
+    else if (item_type == "cshort")
+        {
+            gr::blocks::char_to_short::sptr char_to_short = gr::blocks::char_to_short::make();
+            gr::blocks::stream_to_vector::sptr short_to_cshort = gr::blocks::stream_to_vector::make(sizeof(int16_t), 2);
+            top_block->connect(file_source, 0, char_to_short, 0);
+            top_block->connect(char_to_short, 0, short_to_cshort, 0);
+            top_block->connect(short_to_cshort, 0, head_samples, 0);
+        }
+    else
+        {
+            gr::blocks::interleaved_char_to_complex::sptr gr_interleaved_char_to_complex = gr::blocks::interleaved_char_to_complex::make();
+            top_block->connect(file_source, 0, gr_interleaved_char_to_complex, 0);
+            top_block->connect(gr_interleaved_char_to_complex, 0, head_samples, 0);
+        }
+    file_source->seek(2 * FLAGS_skip_samples, SEEK_SET);  // skip head. ibyte, two bytes per complex sample
+    return head_samples;
+}
+
+
+void TrackingPullInTest::track_signal_file(const std::string& file,
+    const std::string& item_type,
+    bool& locked,
+    std::vector<double>& doppler_hz,
+    std::vector<double>& delay_chips)
+{
+    {
+        // the flowgraph is destroyed at the end of this scope, which closes the dump file
+        auto top_block_trk = gr::make_top_block("Tracking test");
+        std::shared_ptr<GNSSBlockInterface> trk_ = factory->GetBlock(config.get(), "Tracking", 1, 1);
+        std::shared_ptr<TrackingInterface> tracking = std::dynamic_pointer_cast<TrackingInterface>(trk_);
+        auto msg_rx = TrackingPullInTest_msg_rx_make();
+
+        ASSERT_NO_THROW({
+            tracking->set_channel(gnss_synchro.Channel_ID);
+            tracking->set_gnss_synchro(&gnss_synchro);
+            tracking->connect(top_block_trk);
+            gr::blocks::head::sptr head_samples = connect_signal_file(top_block_trk, file, item_type);
+            gr::blocks::null_sink::sptr sink = gr::blocks::null_sink::make(sizeof(Gnss_Synchro));
+            top_block_trk->connect(head_samples, 0, tracking->get_left_block(), 0);
+            top_block_trk->connect(tracking->get_right_block(), 0, sink, 0);
+            top_block_trk->msg_connect(tracking->get_right_block(), pmt::mp("events"), msg_rx, pmt::mp("events"));
+        }) << "Failure connecting the blocks of tracking test.";
+
+        std::cout << "--- START TRACKING WITH " << item_type << " INPUT ---\n";
+        tracking->start_tracking();
+        EXPECT_NO_THROW({
+            top_block_trk->run();  // Start threads and wait
+        }) << "Failure running the top_block.";
+
+        locked = msg_rx->rx_message != 3;
+    }
+
+    Tracking_Dump_Reader trk_dump;
+    ASSERT_EQ(trk_dump.open_obs_file(std::string("./tracking_ch_0.dat")), true)
+        << "Failure opening tracking dump file";
+    doppler_hz.clear();
+    delay_chips.clear();
+    while (trk_dump.read_binary_obs())
+        {
+            doppler_hz.push_back(trk_dump.carrier_doppler_hz);
+            delay_chips.push_back(GPS_L1_CA_CODE_LENGTH_CHIPS - GPS_L1_CA_CODE_LENGTH_CHIPS * (fmod((static_cast<double>(trk_dump.PRN_start_sample_count) + trk_dump.aux1) / static_cast<double>(baseband_sampling_freq), 1.0e-3) / 1.0e-3));
+        }
+}
+
+
 TEST_F(TrackingPullInTest, ValidationOfResults)
 {
     // *************************************************
@@ -765,7 +876,8 @@ TEST_F(TrackingPullInTest, ValidationOfResults)
         FLAGS_DLL_bw_hz_start,
         FLAGS_PLL_narrow_bw_hz,
         FLAGS_DLL_narrow_bw_hz,
-        FLAGS_extend_correlation_symbols);
+        FLAGS_extend_correlation_symbols,
+        FLAGS_trk_test_item_type);
 
     // ******************************************************************************************
     // ***** Obtain the initial signal sinchronization parameters (emulating an acquisition) ****
@@ -808,7 +920,8 @@ TEST_F(TrackingPullInTest, ValidationOfResults)
     // create the msg queue for valve
     queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
     long long int acq_to_trk_delay_samples = ceil(static_cast<double>(FLAGS_fs_gen_sps) * FLAGS_acq_to_trk_delay_s);
-    auto resetable_valve_ = gnss_sdr_make_valve(sizeof(gr_complex), acq_to_trk_delay_samples, queue.get(), false);
+    item_size = tracking_item_size(FLAGS_trk_test_item_type);
+    auto resetable_valve_ = gnss_sdr_make_valve(item_size, acq_to_trk_delay_samples, queue.get(), false);
 
     // CN0 LOOP
     std::vector<std::vector<double>> pull_in_results_v_v;
@@ -854,13 +967,8 @@ TEST_F(TrackingPullInTest, ValidationOfResults)
                                     {
                                         file = FLAGS_signal_file;
                                     }
-                                const char* file_name = file.c_str();
-                                gr::blocks::file_source::sptr file_source = gr::blocks::file_source::make(sizeof(int8_t), file_name, false);
-                                gr::blocks::interleaved_char_to_complex::sptr gr_interleaved_char_to_complex = gr::blocks::interleaved_char_to_complex::make();
                                 gr::blocks::null_sink::sptr sink = gr::blocks::null_sink::make(sizeof(Gnss_Synchro));
-                                gr::blocks::head::sptr head_samples = gr::blocks::head::make(sizeof(gr_complex), baseband_sampling_freq * FLAGS_duration);
-                                top_block_trk->connect(file_source, 0, gr_interleaved_char_to_complex, 0);
-                                top_block_trk->connect(gr_interleaved_char_to_complex, 0, head_samples, 0);
+                                gr::blocks::head::sptr head_samples = connect_signal_file(top_block_trk, file, FLAGS_trk_test_item_type);
                                 if (acq_to_trk_delay_samples > 0)
                                     {
                                         top_block_trk->connect(head_samples, 0, resetable_valve_, 0);
@@ -872,7 +980,6 @@ TEST_F(TrackingPullInTest, ValidationOfResults)
                                     }
                                 top_block_trk->connect(tracking->get_right_block(), 0, sink, 0);
                                 top_block_trk->msg_connect(tracking->get_right_block(), pmt::mp("events"), msg_rx, pmt::mp("events"));
-                                file_source->seek(2 * FLAGS_skip_samples, 0);  // skip head. ibyte, two bytes per complex sample
                             }) << "Failure connecting the blocks of tracking test.";
 
                             // ********************************************************************
@@ -1141,3 +1248,101 @@ TEST_F(TrackingPullInTest, ValidationOfResults)
                 }
         }
 }
+
+
+TEST_F(TrackingPullInTest, ItemTypesAgree)
+{
+    // The same capture, with the same synchronization parameters, is tracked
+    // from gr_complex, cshort and cbyte samples. The capture holds 8 bits
+    // samples, so the integer paths get the same information as the float one
+    // and must keep the lock and estimate the same Doppler and code phase.
+    const std::vector<std::string> item_types = {"gr_complex", "cshort", "cbyte"};
+    const double max_doppler_difference_hz = 2.0;
+    const double max_delay_difference_chips = 0.02;
+
+    std::string file;
+    double acq_doppler_hz = 0.0;
+    double acq_delay_samples = 0.0;
+    if (FLAGS_enable_external_signal_file)
+        {
+            ASSERT_EQ(acquire_signal(FLAGS_test_satellite_PRN), true);
+            ASSERT_TRUE(doppler_measurements_map.find(FLAGS_test_satellite_PRN) != doppler_measurements_map.end())
+                << "Error: satellite SV: " << FLAGS_test_satellite_PRN << " is not acquired";
+            acq_doppler_hz = doppler_measurements_map.at(FLAGS_test_satellite_PRN);
+            acq_delay_samples = code_delay_measurements_map.at(FLAGS_test_satellite_PRN);
+            file = FLAGS_signal_file;
+        }
+    else
+        {
+            configure_generator(FLAGS_CN0_dBHz_start, 0);
+            if (FLAGS_disable_generator == false)
+                {
+                    generate_signal();
+                }
+            Tracking_True_Obs_Reader true_obs_data;
+            ASSERT_EQ(true_obs_data.open_obs_file("./gps_l1_ca_obs_prn" + std::to_string(FLAGS_test_satellite_PRN) + ".dat"), true)
+                << "Failure opening true observables file";
+            ASSERT_EQ(true_obs_data.read_binary_obs(), true)
+                << "Failure reading true tracking dump file.\n"
+                << "Maybe sat PRN #" + std::to_string(FLAGS_test_satellite_PRN) +
+                       " is not available?";
+            acq_doppler_hz = true_obs_data.doppler_l1_hz;
+            acq_delay_samples = (GPS_L1_CA_CODE_LENGTH_CHIPS - true_obs_data.prn_delay_chips / GPS_L1_CA_CODE_LENGTH_CHIPS) * static_cast<double>(baseband_sampling_freq) * GPS_L1_CA_CODE_PERIOD_S;
+            file = "./" + filename_raw_data + "0";
+        }
+
+    std::vector<bool> locked;
+    std::vector<std::vector<double>> doppler_hz(item_types.size());
+    std::vector<std::vector<double>> delay_chips(item_types.size());
+    for (size_t i = 0; i < item_types.size(); i++)
+        {
+            configure_receiver(FLAGS_PLL_bw_hz_start,
+                FLAGS_DLL_bw_hz_start,
+                FLAGS_PLL_narrow_bw_hz,
+                FLAGS_DLL_narrow_bw_hz,
+                FLAGS_extend_correlation_symbols,
+                item_types[i]);
+            gnss_synchro.Acq_samplestamp_samples = 0;
+            gnss_synchro.Acq_doppler_hz = acq_doppler_hz;
+            gnss_synchro.Acq_delay_samples = acq_delay_samples;
+            bool lock = false;
+            track_signal_file(file, item_types[i], lock, doppler_hz[i], delay_chips[i]);
+            if (HasFatalFailure())
+                {
+                    return;
+                }
+            locked.push_back(lock);
+        }
+
+    // Compare each integer path with the float one epoch by epoch, once the
+    // loops have pulled in (second half of the run)
+    for (size_t i = 1; i < item_types.size(); i++)
+        {
+            EXPECT_EQ(locked[i], locked[0]) << item_types[i] << " and gr_complex inputs disagree on the loss of lock";
+            const size_t n_epochs = std::min(doppler_hz[0].size(), doppler_hz[i].size());
+            ASSERT_GT(n_epochs, 1U) << "No tracking epochs for " << item_types[i];
+            double doppler_difference_hz = 0.0;
+            double delay_difference_chips = 0.0;
+            for (size_t k = n_epochs / 2; k < n_epochs; k++)
+                {
+                    doppler_difference_hz += doppler_hz[i][k] - doppler_hz[0][k];
+                    double delay_difference = delay_chips[i][k] - delay_chips[0][k];
+                    // the code phase wraps around at the code period
+                    if (delay_difference > GPS_L1_CA_CODE_LENGTH_CHIPS / 2.0)
+                        {
+                            delay_difference -= GPS_L1_CA_CODE_LENGTH_CHIPS;
+                        }
+                    else if (delay_difference < -GPS_L1_CA_CODE_LENGTH_CHIPS / 2.0)
+                        {
+                            delay_difference += GPS_L1_CA_CODE_LENGTH_CHIPS;
+                        }
+                    delay_difference_chips += delay_difference;
+                }
+            doppler_difference_hz /= static_cast<double>(n_epochs - n_epochs / 2);
+            delay_difference_chips /= static_cast<double>(n_epochs - n_epochs / 2);
+            std::cout << item_types[i] << " minus gr_complex: mean Doppler " << doppler_difference_hz
+                      << " [Hz], mean code phase " << delay_difference_chips << " [Chips]\n";
+            EXPECT_LT(std::abs(doppler_difference_hz), max_doppler_difference_hz) << item_types[i] << " and gr_complex Doppler estimates disagree";
+            EXPECT_LT(std::abs(delay_difference_chips), max_delay_difference_chips) << item_types[i] << " and gr_complex code phase estimates disagree";
+        }
+}